@@ -0,0 +1,86 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_grammars_Parsers_hpp_
+#define _uhal_grammars_Parsers_hpp_
+
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>   // for pair
+#include <vector>
+
+#include "uhal/grammars/URI.hpp"
+
+
+namespace uhal
+{
+  struct NodeTreeFirmwareInfoAttribute;
+
+namespace grammars
+{
+  /**
+    Hand-written, single-pass equivalents of the boost::spirit grammars that are used when connecting to devices and building node trees.
+    Each function accepts exactly the same strings as the corresponding grammar (including skipping whitespace where that grammar uses a
+    skipper), and produces the same result. In particular, like boost::qi::phrase_parse, they return false if the start of the string does
+    not match, ignore any trailing characters that cannot be parsed, and throw where the grammar's expectations (i.e. the '>' operator) fail.
+  */
+
+  //! Exception thrown by the hand-written parsers where the corresponding grammar would throw a boost::spirit::qi::expectation_failure
+  class ParsingError : public std::runtime_error
+  {
+    public:
+      ParsingError ( const std::string& aString , const size_t aPosition , const std::string& aExpected );
+  };
+
+  //! Equivalent of URIGrammar, for URIs of the form "protocol://host:port/patha/pathb/blah.ext?key1=val1&key2=val2&key3=val3"
+  bool parseURI ( const std::string& aString , URI& aURI );
+
+  //! Equivalent of SemicolonDelimitedUriListGrammar, for lists of the form "protocol1://address1;protocol2://address2"; appends to aUriList
+  bool parseSemicolonDelimitedUriList ( const std::string& aString , std::vector< std::pair<std::string, std::string> >& aUriList );
+
+  //! Equivalent of NodeTreeParametersGrammar, for node parameters of the form "name1=val1;name2=val2;name3=val3"; inserts into aParameters
+  bool parseNodeTreeParameters ( const std::string& aString , std::unordered_map<std::string, std::string>& aParameters );
+
+  //! Equivalent of NodeTreeFirmwareinfoAttributeGrammar, for node firmware info attributes of the form "endpoint;name1=val1;name2=val2"
+  bool parseNodeTreeFirmwareInfoAttribute ( const std::string& aString , NodeTreeFirmwareInfoAttribute& aAttribute );
+
+  //! Parses a string of the form "host:port" or "[IPv6 address]:port" (whitespace is skipped, and either part may be empty); unless aPortRequired, the ":port" suffix may be omitted
+  bool parseHostPort ( const std::string& aString , std::pair<std::string, std::string>& aHostPort , const bool aPortRequired = true );
+}
+}
+
+#endif
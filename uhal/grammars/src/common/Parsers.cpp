@@ -0,0 +1,412 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/grammars/Parsers.hpp"
+
+
+#include <string.h>
+
+#include "uhal/grammars/NodeTreeFirmwareInfoAttributeGrammar.hpp"
+
+
+namespace uhal
+{
+namespace grammars
+{
+  namespace
+  {
+    //! Equivalent of boost::spirit::ascii::space
+    bool isSpace ( const char aChar )
+    {
+      return ( aChar == ' ' ) or ( ( aChar >= '\t' ) and ( aChar <= '\r' ) );
+    }
+
+    //! Equivalent of boost::spirit::ascii::punct
+    bool isPunct ( const char aChar )
+    {
+      return ( ( aChar >= '!' ) and ( aChar <= '/' ) ) or ( ( aChar >= ':' ) and ( aChar <= '@' ) ) or ( ( aChar >= '[' ) and ( aChar <= '`' ) ) or ( ( aChar >= '{' ) and ( aChar <= '~' ) );
+    }
+
+    bool isIdentifierStart ( const char aChar )
+    {
+      return ( ( aChar >= 'a' ) and ( aChar <= 'z' ) ) or ( ( aChar >= 'A' ) and ( aChar <= 'Z' ) ) or ( aChar == '_' );
+    }
+
+    bool isIdentifier ( const char aChar )
+    {
+      return isIdentifierStart ( aChar ) or ( ( aChar >= '0' ) and ( aChar <= '9' ) );
+    }
+
+
+    //! Iterates over a string, skipping whitespace before each character or literal (like boost::spirit::ascii::space as a skipper)
+    class Cursor
+    {
+      public:
+        Cursor ( const std::string& aString ) :
+          mBegin ( aString.data() ),
+          mIt ( aString.data() ),
+          mEnd ( aString.data() + aString.size() )
+        {
+        }
+
+        size_t position() const
+        {
+          return mIt - mBegin;
+        }
+
+        //! Consumes the specified character, if it is next
+        bool literal ( const char aChar )
+        {
+          skip();
+
+          if ( ( mIt == mEnd ) or ( *mIt != aChar ) )
+          {
+            return false;
+          }
+
+          ++mIt;
+          return true;
+        }
+
+        //! Consumes the specified string (which cannot contain whitespace), if it is next
+        bool literal ( const char* aString , const size_t aSize )
+        {
+          skip();
+
+          if ( not startsWith ( mIt , aString , aSize ) )
+          {
+            return false;
+          }
+
+          mIt += aSize;
+          return true;
+        }
+
+        /**
+          Appends characters to a string, until reaching the end or a character for which the predicate returns true (called with a pointer to the character)
+          @return the number of characters appended
+        */
+        template < typename Predicate >
+        size_t consume ( const Predicate& aStop , std::string& aValue )
+        {
+          size_t lCount ( 0 );
+
+          while ( true )
+          {
+            skip();
+            const char* lBegin ( mIt );
+
+            while ( ( mIt != mEnd ) and ( not isSpace ( *mIt ) ) and ( not aStop ( mIt ) ) )
+            {
+              ++mIt;
+            }
+
+            aValue.append ( lBegin , mIt );
+            lCount += ( mIt - lBegin );
+
+            if ( ( mIt == mEnd ) or ( not isSpace ( *mIt ) ) )
+            {
+              return lCount;
+            }
+          }
+        }
+
+        //! Consumes the remaining characters, other than whitespace
+        size_t consumeAll ( std::string& aValue )
+        {
+          return consume ( [] ( const char* ) { return false; } , aValue );
+        }
+
+        //! Consumes characters until one of those listed
+        size_t consumeUntil ( const char* aStops , std::string& aValue )
+        {
+          return consume ( [aStops] ( const char* aIt ) { return strchr ( aStops , *aIt ) != NULL; } , aValue );
+        }
+
+        //! Returns whether the specified string (which cannot contain whitespace) occurs at the specified position
+        bool startsWith ( const char* aIt , const char* aString , const size_t aSize ) const
+        {
+          return ( size_t ( mEnd - aIt ) >= aSize ) and ( memcmp ( aIt , aString , aSize ) == 0 );
+        }
+
+      private:
+        void skip()
+        {
+          while ( ( mIt != mEnd ) and isSpace ( *mIt ) )
+          {
+            ++mIt;
+          }
+        }
+
+        const char* mBegin;
+        const char* mIt;
+        const char* mEnd;
+    };
+
+
+    //! Parses name-value pairs of the form "name1=val1<separator>name2=val2", as in URIGrammar's data_pairs rule
+    void parsePairs ( const std::string& aString , Cursor& aCursor , const char aSeparator , NameValuePairVectorType& aPairs )
+    {
+      const char lSeparator[] = { aSeparator , '\0' };
+
+      while ( true )
+      {
+        std::pair<std::string, std::string> lPair;
+
+        if ( not aCursor.consumeUntil ( "=" , lPair.first ) )
+        {
+          return;
+        }
+
+        if ( not aCursor.literal ( '=' ) )
+        {
+          throw ParsingError ( aString , aCursor.position() , "'='" );
+        }
+
+        aCursor.consumeUntil ( lSeparator , lPair.second );
+        aCursor.literal ( aSeparator );
+        aPairs.push_back ( std::move ( lPair ) );
+      }
+    }
+  }
+
+
+  ParsingError::ParsingError ( const std::string& aString , const size_t aPosition , const std::string& aExpected ) :
+    std::runtime_error ( "Expected " + aExpected + " at position " + std::to_string ( aPosition ) + " of \"" + aString + "\"" )
+  {
+  }
+
+
+  bool parseURI ( const std::string& aString , URI& aURI )
+  {
+    Cursor lCursor ( aString );
+    URI lURI;
+
+    if ( not lCursor.consumeUntil ( ":" , lURI.mProtocol ) )
+    {
+      return false;
+    }
+
+    if ( not lCursor.literal ( "://" , 3 ) )
+    {
+      throw ParsingError ( aString , lCursor.position() , "\"://\"" );
+    }
+
+    if ( not lCursor.consumeUntil ( ":?" , lURI.mHostname ) )
+    {
+      throw ParsingError ( aString , lCursor.position() , "hostname" );
+    }
+
+    if ( lCursor.literal ( ':' ) and not lCursor.consume ( [] ( const char* aIt ) { return isPunct ( *aIt ); } , lURI.mPort ) )
+    {
+      throw ParsingError ( aString , lCursor.position() , "port" );
+    }
+
+    if ( lCursor.literal ( '/' ) and not lCursor.consumeUntil ( ".?" , lURI.mPath ) )
+    {
+      throw ParsingError ( aString , lCursor.position() , "path" );
+    }
+
+    if ( lCursor.literal ( '.' ) and not lCursor.consumeUntil ( "?" , lURI.mExtension ) )
+    {
+      throw ParsingError ( aString , lCursor.position() , "extension" );
+    }
+
+    if ( lCursor.literal ( '?' ) )
+    {
+      parsePairs ( aString , lCursor , '&' , lURI.mArguments );
+    }
+
+    aURI = std::move ( lURI );
+    return true;
+  }
+
+
+  bool parseSemicolonDelimitedUriList ( const std::string& aString , std::vector< std::pair<std::string, std::string> >& aUriList )
+  {
+    Cursor lCursor ( aString );
+
+    while ( true )
+    {
+      while ( lCursor.literal ( ';' ) )
+      {
+      }
+
+      std::pair<std::string, std::string> lUri;
+
+      if ( not lCursor.consume ( [&lCursor] ( const char* aIt ) { return lCursor.startsWith ( aIt , "://" , 3 ); } , lUri.first ) )
+      {
+        return true;
+      }
+
+      if ( not lCursor.literal ( "://" , 3 ) )
+      {
+        throw ParsingError ( aString , lCursor.position() , "\"://\"" );
+      }
+
+      lCursor.consumeUntil ( ";" , lUri.second );
+
+      while ( lCursor.literal ( ';' ) )
+      {
+      }
+
+      aUriList.push_back ( std::move ( lUri ) );
+    }
+  }
+
+
+  bool parseNodeTreeParameters ( const std::string& aString , std::unordered_map<std::string, std::string>& aParameters )
+  {
+    // The grammar has no skipper, so whitespace is only skipped at the start
+    const char* lIt ( aString.data() );
+    const char* const lEnd ( aString.data() + aString.size() );
+
+    while ( ( lIt != lEnd ) and isSpace ( *lIt ) )
+    {
+      ++lIt;
+    }
+
+    for ( bool lFirst = true; ; lFirst = false )
+    {
+      const char* lKey ( lIt );
+
+      if ( not lFirst )
+      {
+        // Separator, which is only consumed if followed by another pair
+        if ( ( lKey == lEnd ) or ( ( *lKey != ';' ) and ( *lKey != '&' ) ) )
+        {
+          return true;
+        }
+
+        ++lKey;
+      }
+
+      if ( ( lKey == lEnd ) or not isIdentifierStart ( *lKey ) )
+      {
+        return not lFirst;
+      }
+
+      const char* lKeyEnd ( lKey + 1 );
+
+      while ( ( lKeyEnd != lEnd ) and isIdentifier ( *lKeyEnd ) )
+      {
+        ++lKeyEnd;
+      }
+
+      // Value, which is only consumed if non-empty
+      const char* lValue ( lKeyEnd );
+      const char* lValueEnd ( lKeyEnd );
+
+      if ( ( lValue != lEnd ) and ( *lValue == '=' ) )
+      {
+        for ( lValueEnd = lValue + 1; ( lValueEnd != lEnd ) and isIdentifier ( *lValueEnd ); )
+        {
+          ++lValueEnd;
+        }
+
+        if ( lValueEnd == lValue + 1 )
+        {
+          lValueEnd = lValue;
+        }
+        else
+        {
+          ++lValue;
+        }
+      }
+
+      aParameters.insert ( std::make_pair ( std::string ( lKey , lKeyEnd ) , std::string ( lValue , lValueEnd ) ) );
+      lIt = lValueEnd;
+    }
+  }
+
+
+  bool parseNodeTreeFirmwareInfoAttribute ( const std::string& aString , NodeTreeFirmwareInfoAttribute& aAttribute )
+  {
+    Cursor lCursor ( aString );
+    NodeTreeFirmwareInfoAttribute lAttribute;
+
+    if ( not lCursor.consumeUntil ( ";" , lAttribute.mType ) )
+    {
+      return false;
+    }
+
+    if ( lCursor.literal ( ';' ) )
+    {
+      parsePairs ( aString , lCursor , ';' , lAttribute.mArguments );
+    }
+
+    aAttribute = std::move ( lAttribute );
+    return true;
+  }
+
+
+  bool parseHostPort ( const std::string& aString , std::pair<std::string, std::string>& aHostPort , const bool aPortRequired )
+  {
+    Cursor lCursor ( aString );
+    std::pair<std::string, std::string> lHostPort;
+
+    // IPv6 addresses contain colons, so must be enclosed in brackets if followed by a port
+    if ( lCursor.literal ( '[' ) )
+    {
+      lCursor.consumeUntil ( "]" , lHostPort.first );
+
+      if ( not lCursor.literal ( ']' ) )
+      {
+        throw ParsingError ( aString , lCursor.position() , "']'" );
+      }
+    }
+    else
+    {
+      lCursor.consumeUntil ( ":" , lHostPort.first );
+    }
+
+    if ( not lCursor.literal ( ':' ) )
+    {
+      if ( aPortRequired or lCursor.consumeAll ( lHostPort.second ) )
+      {
+        throw ParsingError ( aString , lCursor.position() , "':'" );
+      }
+
+      aHostPort = std::move ( lHostPort );
+      return true;
+    }
+
+    lCursor.consumeAll ( lHostPort.second );
+    aHostPort = std::move ( lHostPort );
+    return true;
+  }
+
+}
+}
@@ -5,6 +5,9 @@
 
 #include <iostream>
 #include <stdint.h>
+#include <thread>
+
+#include <sys/time.h>
 
 
 // NOTE: the UHAL_LOG_INSERT_WARNING is defined to bridge between the compilers used on Linux and OSX.
@@ -42,11 +45,13 @@ namespace uhal
   {
     protected:
       typedef void ( *fPtr ) ( std::ostream& aStr );
+      typedef void ( *fEntryHeadPtr ) ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID );
 
-      BaseLogLevel ( std::ostream& aStr , fPtr aHeadFunction , fPtr aTailFunction ) :
+      BaseLogLevel ( std::ostream& aStr , fPtr aHeadFunction , fPtr aTailFunction , fEntryHeadPtr aEntryHeadFunction = NULL ) :
         mStr ( aStr ),
         mHeadFunction ( aHeadFunction ),
-        mTailFunction ( aTailFunction )
+        mTailFunction ( aTailFunction ),
+        mEntryHeadFunction ( aEntryHeadFunction )
       {}
 
     public:
@@ -61,6 +66,21 @@ namespace uhal
         return static_cast<T&> ( *this );
       }
 
+      //! Writes the head of an entry that was made at the given time by the given thread (used by the asynchronous logging backend)
+      T& head ( const timeval& aTime , const std::thread::id& aThreadID )
+      {
+        if ( mEntryHeadFunction )
+        {
+          mEntryHeadFunction ( mStr , aTime , aThreadID );
+        }
+        else
+        {
+          mHeadFunction ( mStr );
+        }
+
+        return static_cast<T&> ( *this );
+      }
+
       T& tail()
       {
         mTailFunction ( mStr );
@@ -76,6 +96,7 @@ namespace uhal
       std::ostream& mStr;
       fPtr mHeadFunction;
       fPtr mTailFunction;
+      fEntryHeadPtr mEntryHeadFunction;
 
   };
 
@@ -89,6 +110,7 @@ namespace uhal
       FatalLevel ( std::ostream& aStr = std::cout , Base::fPtr aHeadFunction = FatalLevel::colour_head, Base::fPtr aTailFunction = FatalLevel::colour_tail );
 
       static void colour_head ( std::ostream& aStr );
+      static void colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID );
       static void colour_tail ( std::ostream& aStr );
   };
 
@@ -104,6 +126,7 @@ namespace uhal
       ErrorLevel ( std::ostream& aStr = std::cout , Base::fPtr aHeadFunction = ErrorLevel::colour_head, Base::fPtr aTailFunction = ErrorLevel::colour_tail );
 
       static void colour_head ( std::ostream& aStr );
+      static void colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID );
       static void colour_tail ( std::ostream& aStr );
   };
 
@@ -120,6 +143,7 @@ namespace uhal
       WarningLevel ( std::ostream& aStr = std::cout , Base::fPtr aHeadFunction = WarningLevel::colour_head, Base::fPtr aTailFunction = WarningLevel::colour_tail );
 
       static void colour_head ( std::ostream& aStr );
+      static void colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID );
       static void colour_tail ( std::ostream& aStr );
   };
 
@@ -135,6 +159,7 @@ namespace uhal
       NoticeLevel ( std::ostream& aStr = std::cout , Base::fPtr aHeadFunction = NoticeLevel::colour_head, Base::fPtr aTailFunction = NoticeLevel::colour_tail );
 
       static void colour_head ( std::ostream& aStr );
+      static void colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID );
       static void colour_tail ( std::ostream& aStr );
   };
 
@@ -149,6 +174,7 @@ namespace uhal
       InfoLevel ( std::ostream& aStr = std::cout , Base::fPtr aHeadFunction = InfoLevel::colour_head, Base::fPtr aTailFunction = InfoLevel::colour_tail );
 
       static void colour_head ( std::ostream& aStr );
+      static void colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID );
       static void colour_tail ( std::ostream& aStr );
   };
 
@@ -163,6 +189,7 @@ namespace uhal
       DebugLevel ( std::ostream& aStr = std::cout , Base::fPtr aHeadFunction = DebugLevel::colour_head, Base::fPtr aTailFunction = DebugLevel::colour_tail );
 
       static void colour_head ( std::ostream& aStr );
+      static void colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID );
       static void colour_tail ( std::ostream& aStr );
   };
 
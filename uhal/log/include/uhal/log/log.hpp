@@ -6,11 +6,25 @@
 #include <iosfwd>  // for ostream
 #include <mutex>   // for lock_guard, mutex
 
+#include <uhal/log/log_async.hpp>
+#include <uhal/log/log_binary.hpp>
+#include <uhal/log/log_rate_limit.hpp>
 #include <uhal/log/log_inserters.hpp>
 #include <uhal/log/LogLevels.hpp>
 #include <uhal/log/exception.hpp>
 
 
+// Log entries are rarely written on hot paths, so the level check is marked as unlikely to succeed, and the code that
+// writes the entry is kept out-of-line, in the section for cold code
+#if defined ( __GNUC__ ) || defined ( __clang__ )
+#define UHAL_LOG_UNLIKELY( x ) __builtin_expect ( !! ( x ) , 0 )
+#define UHAL_LOG_COLD __attribute__ ( ( noinline , cold ) )
+#else
+#define UHAL_LOG_UNLIKELY( x ) ( x )
+#define UHAL_LOG_COLD
+#endif
+
+
 namespace uhal{
 
 class DebugLevel;
@@ -45,7 +59,7 @@ void setLogLevelTo ( const FatalLevel& /**< a dummy parameter to choose the spec
 	Function to check at runtime whether the level Fatal is to be included in the log output
 	@return whether the level Fatal is to be included in the log output
 */
-const bool& LoggingIncludes ( const FatalLevel& /**< a dummy parameter to choose the specialization of the function for the Fatal level */ );
+inline const bool& LoggingIncludes ( const FatalLevel& /**< a dummy parameter to choose the specialization of the function for the Fatal level */ );
 
 /**
 	Function to specify, at runtime, that only messages with a severity level above Error should be logged
@@ -55,7 +69,7 @@ void setLogLevelTo ( const ErrorLevel& /**< a dummy parameter to choose the spec
 	Function to check at runtime whether the level Error is to be included in the log output
 	@return whether the level Error is to be included in the log output
 */
-const bool& LoggingIncludes ( const ErrorLevel& /**< a dummy parameter to choose the specialization of the function for the Error level */ );
+inline const bool& LoggingIncludes ( const ErrorLevel& /**< a dummy parameter to choose the specialization of the function for the Error level */ );
 
 /**
 	Function to specify, at runtime, that only messages with a severity level above Warning should be logged
@@ -65,7 +79,7 @@ void setLogLevelTo ( const WarningLevel& /**< a dummy parameter to choose the sp
 	Function to check at runtime whether the level Warning is to be included in the log output
 	@return whether the level Warning is to be included in the log output
 */
-const bool& LoggingIncludes ( const WarningLevel& /**< a dummy parameter to choose the specialization of the function for the Warning level */ );
+inline const bool& LoggingIncludes ( const WarningLevel& /**< a dummy parameter to choose the specialization of the function for the Warning level */ );
 
 /**
 	Function to specify, at runtime, that only messages with a severity level above Notice should be logged
@@ -75,7 +89,7 @@ void setLogLevelTo ( const NoticeLevel& /**< a dummy parameter to choose the spe
 	Function to check at runtime whether the level Notice is to be included in the log output
 	@return whether the level Notice is to be included in the log output
 */
-const bool& LoggingIncludes ( const NoticeLevel& /**< a dummy parameter to choose the specialization of the function for the Notice level */ );
+inline const bool& LoggingIncludes ( const NoticeLevel& /**< a dummy parameter to choose the specialization of the function for the Notice level */ );
 
 /**
 	Function to specify, at runtime, that only messages with a severity level above Info should be logged
@@ -85,7 +99,7 @@ void setLogLevelTo ( const InfoLevel& /**< a dummy parameter to choose the speci
 	Function to check at runtime whether the level Info is to be included in the log output
 	@return whether the level Info is to be included in the log output
 */
-const bool& LoggingIncludes ( const InfoLevel& /**< a dummy parameter to choose the specialization of the function for the Info level */ );
+inline const bool& LoggingIncludes ( const InfoLevel& /**< a dummy parameter to choose the specialization of the function for the Info level */ );
 
 /**
 	Function to specify, at runtime, that only messages with a severity level above Debug should be logged
@@ -95,7 +109,7 @@ void setLogLevelTo ( const DebugLevel& /**< a dummy parameter to choose the spec
 	Function to check at runtime whether the level Debug is to be included in the log output
 	@return whether the level Debug is to be included in the log output
 */
-const bool& LoggingIncludes ( const DebugLevel& /**< a dummy parameter to choose the specialization of the function for the Debug level */ );
+inline const bool& LoggingIncludes ( const DebugLevel& /**< a dummy parameter to choose the specialization of the function for the Debug level */ );
 
 //! Class to restrict access to the log configuration parameters
 class log_configuration
@@ -164,5229 +178,125 @@ class log_configuration
 // WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
 // ======================================================================================================================================================
 
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Fatal level
-		@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( FatalLevel& aFatal , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( ErrorLevel& aError , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Error level
-		@param aError a dummy parameter to choose the specialization of the function for the Error level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( ErrorLevel& aError , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Warning level
-		@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( WarningLevel& aWarning , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Notice level
-		@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( NoticeLevel& aNotice , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Info level
-		@param aInfo a dummy parameter to choose the specialization of the function for the Info level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( InfoLevel& aInfo , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
-
-	/**
-		Function to add a log entry at Debug level
-		@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( DebugLevel& aDebug , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
-
-// ======================================================================================================================================================
-// WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
-// ======================================================================================================================================================
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-	*/
-	template< typename T0 >
-	void log ( exception::exception& aExc , const T0& aArg0 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-	*/
-	template< typename T0 , typename T1 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-	*/
-	template< typename T0 , typename T1 , typename T2 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 );
-
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 );
+/**
+	Function to add a log entry at Fatal level
+	@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( FatalLevel& aFatal , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 );
+/**
+	Function to add a log entry at Error level
+	@param aError a dummy parameter to choose the specialization of the function for the Error level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( ErrorLevel& aError , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 );
+/**
+	Function to add a log entry at Warning level
+	@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( WarningLevel& aWarning , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 );
+/**
+	Function to add a log entry at Notice level
+	@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( NoticeLevel& aNotice , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 );
+/**
+	Function to add a log entry at Info level
+	@param aInfo a dummy parameter to choose the specialization of the function for the Info level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( InfoLevel& aInfo , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 );
+/**
+	Function to add a log entry at Debug level
+	@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( DebugLevel& aDebug , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 );
+/**
+	Function to add a log entry at Fatal level, unless suppressed by a rate limit
+	@param aRateLimit the rate limit of the call site
+	@param aFatal a dummy parameter to choose the specialization of the function for the Fatal level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( LogRateLimit& aRateLimit , FatalLevel& aFatal , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 );
+/**
+	Function to add a log entry at Error level, unless suppressed by a rate limit
+	@param aRateLimit the rate limit of the call site
+	@param aError a dummy parameter to choose the specialization of the function for the Error level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( LogRateLimit& aRateLimit , ErrorLevel& aError , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 );
+/**
+	Function to add a log entry at Warning level, unless suppressed by a rate limit
+	@param aRateLimit the rate limit of the call site
+	@param aWarning a dummy parameter to choose the specialization of the function for the Warning level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( LogRateLimit& aRateLimit , WarningLevel& aWarning , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 );
+/**
+	Function to add a log entry at Notice level, unless suppressed by a rate limit
+	@param aRateLimit the rate limit of the call site
+	@param aNotice a dummy parameter to choose the specialization of the function for the Notice level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( LogRateLimit& aRateLimit , NoticeLevel& aNotice , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 );
+/**
+	Function to add a log entry at Info level, unless suppressed by a rate limit
+	@param aRateLimit the rate limit of the call site
+	@param aInfo a dummy parameter to choose the specialization of the function for the Info level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( LogRateLimit& aRateLimit , InfoLevel& aInfo , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 );
+/**
+	Function to add a log entry at Debug level, unless suppressed by a rate limit
+	@param aRateLimit the rate limit of the call site
+	@param aDebug a dummy parameter to choose the specialization of the function for the Debug level
+	@param aArgs the templated arguments to be added to the log entry
+*/
+template< typename... Args >
+void log ( LogRateLimit& aRateLimit , DebugLevel& aDebug , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 );
+/**
+	Function to append a message to an exception, and add it to the log at Error level
+	@param aExc the exception to which the message is appended
+	@param aArgs the templated arguments forming the message
+*/
+template< typename... Args >
+void log ( exception::exception& aExc , const Args&... aArgs );
 
-	/**
-		@param aArg0 a templated argument to be added to the log 1st
-		@param aArg1 a templated argument to be added to the log 2nd
-		@param aArg2 a templated argument to be added to the log 3rd
-		@param aArg3 a templated argument to be added to the log 4th
-		@param aArg4 a templated argument to be added to the log 5th
-		@param aArg5 a templated argument to be added to the log 6th
-		@param aArg6 a templated argument to be added to the log 7th
-		@param aArg7 a templated argument to be added to the log 8th
-		@param aArg8 a templated argument to be added to the log 9th
-		@param aArg9 a templated argument to be added to the log 10th
-		@param aArg10 a templated argument to be added to the log 11th
-		@param aArg11 a templated argument to be added to the log 12th
-		@param aArg12 a templated argument to be added to the log 13th
-		@param aArg13 a templated argument to be added to the log 14th
-		@param aArg14 a templated argument to be added to the log 15th
-		@param aArg15 a templated argument to be added to the log 16th
-		@param aArg16 a templated argument to be added to the log 17th
-		@param aArg17 a templated argument to be added to the log 18th
-		@param aArg18 a templated argument to be added to the log 19th
-		@param aArg19 a templated argument to be added to the log 20th
-		@param aArg20 a templated argument to be added to the log 21st
-		@param aArg21 a templated argument to be added to the log 22nd
-		@param aArg22 a templated argument to be added to the log 23rd
-		@param aArg23 a templated argument to be added to the log 24th
-		@param aArg24 a templated argument to be added to the log 25th
-		@param aArg25 a templated argument to be added to the log 26th
-		@param aArg26 a templated argument to be added to the log 27th
-		@param aArg27 a templated argument to be added to the log 28th
-		@param aArg28 a templated argument to be added to the log 29th
-		@param aArg29 a templated argument to be added to the log 30th
-		@param aArg30 a templated argument to be added to the log 31st
-		@param aArg31 a templated argument to be added to the log 32nd
-	*/
-	template< typename T0 , typename T1 , typename T2 , typename T3 , typename T4 , typename T5 , typename T6 , typename T7 , typename T8 , typename T9 , typename T10 , typename T11 , typename T12 , typename T13 , typename T14 , typename T15 , typename T16 , typename T17 , typename T18 , typename T19 , typename T20 , typename T21 , typename T22 , typename T23 , typename T24 , typename T25 , typename T26 , typename T27 , typename T28 , typename T29 , typename T30 , typename T31 >
-	void log ( exception::exception& aExc , const T0& aArg0 , const T1& aArg1 , const T2& aArg2 , const T3& aArg3 , const T4& aArg4 , const T5& aArg5 , const T6& aArg6 , const T7& aArg7 , const T8& aArg8 , const T9& aArg9 , const T10& aArg10 , const T11& aArg11 , const T12& aArg12 , const T13& aArg13 , const T14& aArg14 , const T15& aArg15 , const T16& aArg16 , const T17& aArg17 , const T18& aArg18 , const T19& aArg19 , const T20& aArg20 , const T21& aArg21 , const T22& aArg22 , const T23& aArg23 , const T24& aArg24 , const T25& aArg25 , const T26& aArg26 , const T27& aArg27 , const T28& aArg28 , const T29& aArg29 , const T30& aArg30 , const T31& aArg31 );
+/**
+	Function to append a message to an exception and add it to the log at Error level, unless suppressed by a rate limit (in which case
+	the message is neither formatted nor appended to the exception)
+	@param aRateLimit the rate limit of the call site
+	@param aExc the exception to which the message is appended
+	@param aArgs the templated arguments forming the message
+*/
+template< typename... Args >
+void log ( LogRateLimit& aRateLimit , exception::exception& aExc , const Args&... aArgs );
 
 // ======================================================================================================================================================
 // WARNING! This file is automatically generated! Do not modify it! Any changes will be overwritten!
@@ -0,0 +1,205 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_log_log_async_hpp_
+#define _uhal_log_log_async_hpp_
+
+
+#include <atomic>
+#include <iosfwd>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <sys/time.h>
+
+#include "uhal/log/LogLevels.hpp"
+#include "uhal/log/log_inserters.integer.hpp"
+
+
+namespace uhal
+{
+
+  /**
+    Enables the asynchronous logging backend. Subsequent log entries are captured (level, timestamp, thread ID and argument values)
+    into a bounded lock-free buffer owned by the logging thread; formatting and output is done by a background thread. Entries are
+    dropped if the calling thread's buffer is full, and entries that are larger than half of a buffer are written out synchronously.
+    N.B. Log levels passed to the log functions must outlive the entries (as is the case for the global Fatal, Error, ... objects)
+    @param aBufferSize the size in bytes of each thread's buffer (only applies to buffers created after this call)
+  */
+  void enableAsyncLogging ( const size_t aBufferSize = 65536 );
+
+  //! Stops the background thread, after writing out all pending log entries, and returns to synchronous logging
+  void disableAsyncLogging();
+
+  /**
+    Function to check at runtime whether log entries are written out by the asynchronous backend
+    @return whether the asynchronous logging backend is enabled
+  */
+  bool LoggingIsAsync();
+
+  //! Blocks until the log entries that were made by the calling thread before this call have been written out
+  void flushLog();
+
+  /**
+    Function to retrieve the number of log entries that have been dropped, because the logging thread's buffer was full (asynchronous
+    backend) or the entry was too large (binary backend)
+    @return the number of log entries that have been dropped since the program started
+  */
+  uint64_t GetDroppedLogEntryCount();
+
+
+  namespace detail
+  {
+    //! Whether the asynchronous logging backend is enabled
+    extern std::atomic< bool > gAsyncLogging;
+
+    //! Number of log entries that have been dropped by the asynchronous or binary logging backends
+    extern std::atomic< uint64_t > gDroppedLogEntries;
+
+    //! Function that writes out a log entry, from the level, timestamp and thread ID of the entry, and the captured argument values
+    typedef void ( *AsyncLogWriterPtr ) ( void* aLevel , const timeval& aTime , const std::thread::id& aThreadID , const uint8_t* aPayload );
+
+    /**
+      Returns the calling thread's scratch buffer for capturing argument values, emptied
+      @return the calling thread's scratch buffer
+    */
+    std::vector< uint8_t >& LogPayload();
+
+    /**
+      Copies a log entry into the calling thread's buffer
+      @param aWriter the function that will write out the entry
+      @param aLevel the log level of the entry
+      @param aPayload the captured argument values
+      @return false if the entry must be written synchronously instead, otherwise true (including if the entry has been dropped)
+    */
+    bool commitAsyncLogEntry ( AsyncLogWriterPtr aWriter , void* aLevel , const std::vector< uint8_t >& aPayload );
+
+    //! Appends raw bytes to an entry's captured argument values
+    inline void captureLogBytes ( std::vector< uint8_t >& aPayload , const void* aData , const size_t aSize )
+    {
+      const uint8_t* lData ( static_cast< const uint8_t* > ( aData ) );
+      aPayload.insert ( aPayload.end() , lData , lData + aSize );
+    }
+
+    //! Appends a length-prefixed string to an entry's captured argument values
+    void captureLogString ( std::vector< uint8_t >& aPayload , const char* aData , const size_t aSize );
+
+    //! Writes out a string captured by captureLogString, and advances the payload pointer past it
+    void writeLogString ( std::ostream& aStr , const uint8_t*& aPayload );
+
+    //! Writes the string representation of an argument into the calling thread's scratch stream, which is returned
+    std::ostringstream& LogScratchStream();
+
+
+    /**
+      Captures the value of a log argument, and later writes it out in the background thread. The default implementation formats the
+      argument in the logging thread; specializations copy the values of types whose formatting can be deferred
+    */
+    template< typename T , typename Enable = void >
+    struct AsyncLogArgument
+    {
+      static void capture ( std::vector< uint8_t >& aPayload , const T& aArg );
+      static void write ( std::ostream& aStr , const uint8_t*& aPayload );
+    };
+
+    template< typename T >
+    struct AsyncLogArgument< T , typename std::enable_if< std::is_arithmetic< T >::value >::type >
+    {
+      static void capture ( std::vector< uint8_t >& aPayload , const T& aArg );
+      static void write ( std::ostream& aStr , const uint8_t*& aPayload );
+    };
+
+    template< typename T , typename FORMAT >
+    struct AsyncLogArgument< _Integer< T , FORMAT > , typename std::enable_if< std::is_arithmetic< T >::value >::type >
+    {
+      static void capture ( std::vector< uint8_t >& aPayload , const _Integer< T , FORMAT >& aArg );
+      static void write ( std::ostream& aStr , const uint8_t*& aPayload );
+    };
+
+    template< size_t N >
+    struct AsyncLogArgument< char [ N ] >
+    {
+      static void capture ( std::vector< uint8_t >& aPayload , const char ( &aArg ) [ N ] );
+      static void write ( std::ostream& aStr , const uint8_t*& aPayload );
+    };
+
+    template<>
+    struct AsyncLogArgument< const char* >
+    {
+      static void capture ( std::vector< uint8_t >& aPayload , const char* aArg );
+      static void write ( std::ostream& aStr , const uint8_t*& aPayload );
+    };
+
+    template<>
+    struct AsyncLogArgument< char* > : public AsyncLogArgument< const char* >
+    {
+    };
+
+    template<>
+    struct AsyncLogArgument< std::string >
+    {
+      static void capture ( std::vector< uint8_t >& aPayload , const std::string& aArg );
+      static void write ( std::ostream& aStr , const uint8_t*& aPayload );
+    };
+
+
+    //! Writes out a log entry with the given level and argument types from its captured values
+    template< typename Level , typename... Args >
+    struct AsyncLogWriter
+    {
+      static void write ( void* aLevel , const timeval& aTime , const std::thread::id& aThreadID , const uint8_t* aPayload );
+    };
+
+
+    /**
+      Captures a log entry into the calling thread's buffer, if the asynchronous logging backend is enabled
+      @param aLevel the log level of the entry
+      @param aArgs the arguments of the entry
+      @return whether the entry has been handled by the asynchronous backend (i.e. captured or dropped)
+    */
+    template< typename Level , typename... Args >
+    bool pushAsyncLogEntry ( Level& aLevel , const Args&... aArgs );
+  }
+
+}
+
+
+#include "uhal/log/log_async.hxx"
+
+#endif
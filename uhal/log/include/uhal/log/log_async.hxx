@@ -0,0 +1,135 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include <cstring>
+#include <sstream>
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    template< typename T , typename Enable >
+    void AsyncLogArgument< T , Enable >::capture ( std::vector< uint8_t >& aPayload , const T& aArg )
+    {
+      std::ostringstream& lStr ( LogScratchStream() );
+      insert ( lStr , aArg );
+      const std::string lString ( lStr.str() );
+      captureLogString ( aPayload , lString.data() , lString.size() );
+    }
+
+    template< typename T , typename Enable >
+    void AsyncLogArgument< T , Enable >::write ( std::ostream& aStr , const uint8_t*& aPayload )
+    {
+      writeLogString ( aStr , aPayload );
+    }
+
+
+    template< typename T >
+    void AsyncLogArgument< T , typename std::enable_if< std::is_arithmetic< T >::value >::type >::capture ( std::vector< uint8_t >& aPayload , const T& aArg )
+    {
+      captureLogBytes ( aPayload , &aArg , sizeof ( T ) );
+    }
+
+    template< typename T >
+    void AsyncLogArgument< T , typename std::enable_if< std::is_arithmetic< T >::value >::type >::write ( std::ostream& aStr , const uint8_t*& aPayload )
+    {
+      T lValue;
+      std::memcpy ( &lValue , aPayload , sizeof ( T ) );
+      aPayload += sizeof ( T );
+      aStr << lValue;
+    }
+
+
+    template< typename T , typename FORMAT >
+    void AsyncLogArgument< _Integer< T , FORMAT > , typename std::enable_if< std::is_arithmetic< T >::value >::type >::capture ( std::vector< uint8_t >& aPayload , const _Integer< T , FORMAT >& aArg )
+    {
+      captureLogBytes ( aPayload , &aArg.value() , sizeof ( T ) );
+    }
+
+    template< typename T , typename FORMAT >
+    void AsyncLogArgument< _Integer< T , FORMAT > , typename std::enable_if< std::is_arithmetic< T >::value >::type >::write ( std::ostream& aStr , const uint8_t*& aPayload )
+    {
+      T lValue;
+      std::memcpy ( &lValue , aPayload , sizeof ( T ) );
+      aPayload += sizeof ( T );
+      aStr << _Integer< T , FORMAT > ( lValue );
+    }
+
+
+    template< size_t N >
+    void AsyncLogArgument< char [ N ] >::capture ( std::vector< uint8_t >& aPayload , const char ( &aArg ) [ N ] )
+    {
+      captureLogString ( aPayload , aArg , strnlen ( aArg , N ) );
+    }
+
+    template< size_t N >
+    void AsyncLogArgument< char [ N ] >::write ( std::ostream& aStr , const uint8_t*& aPayload )
+    {
+      writeLogString ( aStr , aPayload );
+    }
+
+
+    template< typename Level , typename... Args >
+    void AsyncLogWriter< Level , Args... >::write ( void* aLevel , const timeval& aTime , const std::thread::id& aThreadID , const uint8_t* aPayload )
+    {
+      Level& lLevel ( *static_cast< Level* > ( aLevel ) );
+      std::ostream& lStr ( lLevel.stream() );
+      lLevel.head ( aTime , aThreadID );
+      // Braced initializers are evaluated in order, so the arguments are read back in the order they were captured
+      int lExpander[] = { 0 , ( AsyncLogArgument< Args >::write ( lStr , aPayload ) , 0 )... };
+      ( void ) lExpander;
+      lLevel.tail();
+    }
+
+
+    template< typename Level , typename... Args >
+    bool pushAsyncLogEntry ( Level& aLevel , const Args&... aArgs )
+    {
+      if ( not gAsyncLogging.load ( std::memory_order_relaxed ) )
+      {
+        return false;
+      }
+
+      std::vector< uint8_t >& lPayload ( LogPayload() );
+      int lExpander[] = { 0 , ( AsyncLogArgument< Args >::capture ( lPayload , aArgs ) , 0 )... };
+      ( void ) lExpander;
+      return commitAsyncLogEntry ( &AsyncLogWriter< Level , Args... >::write , &aLevel , lPayload );
+    }
+
+  }
+}
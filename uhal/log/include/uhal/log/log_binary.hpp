@@ -0,0 +1,238 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_log_log_binary_hpp_
+#define _uhal_log_log_binary_hpp_
+
+
+#include <atomic>
+#include <initializer_list>
+#include <iosfwd>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "uhal/log/exception.hpp"
+#include "uhal/log/log_async.hpp"
+#include "uhal/log/log_inserters.integer.hpp"
+#include "uhal/log/log_inserters.quote.hpp"
+#include "uhal/log/LogLevels.hpp"
+
+
+namespace uhal
+{
+  namespace exception
+  {
+    //! Exception class to handle the case where a binary log file cannot be created or read
+    UHAL_DEFINE_EXCEPTION_CLASS ( BinaryLogFileError , "Exception class to handle the case where a binary log file cannot be created or read." )
+  }
+
+  /**
+    Enables the binary logging backend. Subsequent log entries are written to memory-mapped files as a format ID (identifying the level
+    and argument types) plus the raw values of the arguments, rather than as text; decodeBinaryLog (or the uhal_log_decode command) renders
+    the files back into the text format. Files are named aPath.0, aPath.1, ... : when a file is full the next one is created, and only the
+    aFileCount most recent files are kept. Entries larger than 64 kB are dropped.
+    @param aPath the path of the log files, without the sequence number suffix
+    @param aFileSize the size of each file in bytes
+    @param aFileCount the number of files to keep
+  */
+  void enableBinaryLogging ( const std::string& aPath , const size_t aFileSize = 64 << 20 , const size_t aFileCount = 2 );
+
+  //! Returns to writing log entries as text; entries being written by other threads at the time of the call are still written to file
+  void disableBinaryLogging();
+
+  /**
+    Function to check at runtime whether log entries are written by the binary backend
+    @return whether the binary logging backend is enabled
+  */
+  bool LoggingIsBinary();
+
+  /**
+    Renders binary log files into the text format, ordering the entries by time
+    @param aFiles the paths of the files
+    @param aStr the stream to which the entries are written
+    @return the number of entries written
+  */
+  size_t decodeBinaryLog ( const std::vector< std::string >& aFiles , std::ostream& aStr );
+
+
+  namespace detail
+  {
+    //! Whether the binary logging backend is enabled
+    extern std::atomic< bool > gBinaryLogging;
+
+    //! Identifies the log level in binary log files
+    template< typename Level >
+    struct BinaryLogLevel;
+
+    template<> struct BinaryLogLevel< FatalLevel > { static const uint8_t code = 0; };
+    template<> struct BinaryLogLevel< ErrorLevel > { static const uint8_t code = 1; };
+    template<> struct BinaryLogLevel< WarningLevel > { static const uint8_t code = 2; };
+    template<> struct BinaryLogLevel< NoticeLevel > { static const uint8_t code = 3; };
+    template<> struct BinaryLogLevel< InfoLevel > { static const uint8_t code = 4; };
+    template<> struct BinaryLogLevel< DebugLevel > { static const uint8_t code = 5; };
+
+    //! The first byte of each argument's descriptor in a format
+    enum BinaryLogArgumentKind
+    {
+      kBinaryLogIntegral = 1,     ///< Integral type (followed by size and BinaryLogIntegralFlags), written with operator<<
+      kBinaryLogFloatingPoint,    ///< Floating point type (followed by size), written with operator<<
+      kBinaryLogInteger,          ///< Integer() formatter (followed by size, signedness, base, format and 32-bit width)
+      kBinaryLogString,           ///< String, or argument formatted when the entry was made
+      kBinaryLogQuotedString      ///< Quote() formatter of a string
+    };
+
+    enum BinaryLogIntegralFlags
+    {
+      kBinaryLogSigned = 1,
+      kBinaryLogCharacter = 2,
+      kBinaryLogBoolean = 4
+    };
+
+    //! The level and argument types of a log entry; one is created for each combination of level and argument types that is logged
+    class BinaryLogFormat
+    {
+      public:
+        BinaryLogFormat ( const uint8_t aLevel , const std::initializer_list< std::string >& aArguments );
+
+        //! Unique identifier of the format within the process
+        const uint32_t id;
+        const uint8_t level;
+        const uint8_t argumentCount;
+        //! Concatenated descriptors of the arguments (see BinaryLogArgumentKind)
+        const std::string descriptor;
+        //! Index of the latest file to which the format's description has been written, set once the description is in the file (files are indexed from 1)
+        std::atomic< uint64_t > file;
+    };
+
+    //! Writes an entry to the calling thread's region of the current binary log file
+    void commitBinaryLogEntry ( BinaryLogFormat& aFormat , const std::vector< uint8_t >& aPayload );
+
+
+    //! Describes the type of a log argument, and captures its value. The default implementation formats the argument when logging it
+    template< typename T , typename Enable = void >
+    struct BinaryLogArgument
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const T& aArg );
+    };
+
+    template< typename T >
+    struct BinaryLogArgument< T , typename std::enable_if< std::is_integral< T >::value >::type >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const T& aArg );
+    };
+
+    template< typename T >
+    struct BinaryLogArgument< T , typename std::enable_if< std::is_floating_point< T >::value >::type >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const T& aArg );
+    };
+
+    template< typename T , integer_base BASE , integer_format FORMAT , uint32_t WIDTH >
+    struct BinaryLogArgument< _Integer< T , IntFmt< BASE , FORMAT , WIDTH > > , typename std::enable_if< std::is_integral< T >::value >::type >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const _Integer< T , IntFmt< BASE , FORMAT , WIDTH > >& aArg );
+    };
+
+    template< size_t N >
+    struct BinaryLogArgument< char [ N ] >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const char ( &aArg ) [ N ] );
+    };
+
+    template<>
+    struct BinaryLogArgument< const char* >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const char* aArg );
+    };
+
+    template<>
+    struct BinaryLogArgument< char* > : public BinaryLogArgument< const char* >
+    {
+    };
+
+    template<>
+    struct BinaryLogArgument< std::string >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const std::string& aArg );
+    };
+
+    template< size_t N >
+    struct BinaryLogArgument< _Quote< char [ N ] > >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const _Quote< char [ N ] >& aArg );
+    };
+
+    template<>
+    struct BinaryLogArgument< _Quote< const char* > >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const _Quote< const char* >& aArg );
+    };
+
+    template<>
+    struct BinaryLogArgument< _Quote< std::string > >
+    {
+      static std::string descriptor();
+      static void capture ( std::vector< uint8_t >& aPayload , const _Quote< std::string >& aArg );
+    };
+
+
+    /**
+      Writes a log entry to the binary log, if the binary logging backend is enabled
+      @param aLevel the log level of the entry
+      @param aArgs the arguments of the entry
+      @return whether the entry has been handled by the binary backend (i.e. written or dropped)
+    */
+    template< typename Level , typename... Args >
+    bool pushBinaryLogEntry ( Level& aLevel , const Args&... aArgs );
+  }
+
+}
+
+
+#include "uhal/log/log_binary.hxx"
+
+#endif
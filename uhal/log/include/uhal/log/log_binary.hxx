@@ -0,0 +1,154 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include <cstring>
+#include <sstream>
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    template< typename T , typename Enable >
+    std::string BinaryLogArgument< T , Enable >::descriptor()
+    {
+      return std::string ( 1 , char ( kBinaryLogString ) );
+    }
+
+    template< typename T , typename Enable >
+    void BinaryLogArgument< T , Enable >::capture ( std::vector< uint8_t >& aPayload , const T& aArg )
+    {
+      std::ostringstream& lStr ( LogScratchStream() );
+      insert ( lStr , aArg );
+      const std::string lString ( lStr.str() );
+      captureLogString ( aPayload , lString.data() , lString.size() );
+    }
+
+
+    template< typename T >
+    std::string BinaryLogArgument< T , typename std::enable_if< std::is_integral< T >::value >::type >::descriptor()
+    {
+      const char lDescriptor[] = {
+        char ( kBinaryLogIntegral ) ,
+        char ( sizeof ( T ) ) ,
+        char ( ( std::is_signed< T >::value ? kBinaryLogSigned : 0 ) |
+               ( std::is_same< T , bool >::value ? kBinaryLogBoolean : 0 ) |
+               ( ( std::is_same< T , char >::value or std::is_same< T , signed char >::value or std::is_same< T , unsigned char >::value ) ? kBinaryLogCharacter : 0 ) )
+      };
+      return std::string ( lDescriptor , sizeof ( lDescriptor ) );
+    }
+
+    template< typename T >
+    void BinaryLogArgument< T , typename std::enable_if< std::is_integral< T >::value >::type >::capture ( std::vector< uint8_t >& aPayload , const T& aArg )
+    {
+      captureLogBytes ( aPayload , &aArg , sizeof ( T ) );
+    }
+
+
+    template< typename T >
+    std::string BinaryLogArgument< T , typename std::enable_if< std::is_floating_point< T >::value >::type >::descriptor()
+    {
+      const char lDescriptor[] = { char ( kBinaryLogFloatingPoint ) , char ( sizeof ( T ) ) };
+      return std::string ( lDescriptor , sizeof ( lDescriptor ) );
+    }
+
+    template< typename T >
+    void BinaryLogArgument< T , typename std::enable_if< std::is_floating_point< T >::value >::type >::capture ( std::vector< uint8_t >& aPayload , const T& aArg )
+    {
+      captureLogBytes ( aPayload , &aArg , sizeof ( T ) );
+    }
+
+
+    template< typename T , integer_base BASE , integer_format FORMAT , uint32_t WIDTH >
+    std::string BinaryLogArgument< _Integer< T , IntFmt< BASE , FORMAT , WIDTH > > , typename std::enable_if< std::is_integral< T >::value >::type >::descriptor()
+    {
+      const char lDescriptor[] = { char ( kBinaryLogInteger ) , char ( sizeof ( T ) ) , char ( std::is_signed< T >::value ) , char ( BASE ) , char ( FORMAT ) };
+      const uint32_t lWidth ( WIDTH );
+      return std::string ( lDescriptor , sizeof ( lDescriptor ) ) + std::string ( reinterpret_cast< const char* > ( &lWidth ) , sizeof ( lWidth ) );
+    }
+
+    template< typename T , integer_base BASE , integer_format FORMAT , uint32_t WIDTH >
+    void BinaryLogArgument< _Integer< T , IntFmt< BASE , FORMAT , WIDTH > > , typename std::enable_if< std::is_integral< T >::value >::type >::capture ( std::vector< uint8_t >& aPayload , const _Integer< T , IntFmt< BASE , FORMAT , WIDTH > >& aArg )
+    {
+      captureLogBytes ( aPayload , &aArg.value() , sizeof ( T ) );
+    }
+
+
+    template< size_t N >
+    std::string BinaryLogArgument< char [ N ] >::descriptor()
+    {
+      return std::string ( 1 , char ( kBinaryLogString ) );
+    }
+
+    template< size_t N >
+    void BinaryLogArgument< char [ N ] >::capture ( std::vector< uint8_t >& aPayload , const char ( &aArg ) [ N ] )
+    {
+      captureLogString ( aPayload , aArg , strnlen ( aArg , N ) );
+    }
+
+
+    template< size_t N >
+    std::string BinaryLogArgument< _Quote< char [ N ] > >::descriptor()
+    {
+      return std::string ( 1 , char ( kBinaryLogQuotedString ) );
+    }
+
+    template< size_t N >
+    void BinaryLogArgument< _Quote< char [ N ] > >::capture ( std::vector< uint8_t >& aPayload , const _Quote< char [ N ] >& aArg )
+    {
+      captureLogString ( aPayload , aArg.value() , strnlen ( aArg.value() , N ) );
+    }
+
+
+    template< typename Level , typename... Args >
+    bool pushBinaryLogEntry ( Level& , const Args&... aArgs )
+    {
+      if ( not gBinaryLogging.load ( std::memory_order_relaxed ) )
+      {
+        return false;
+      }
+
+      static BinaryLogFormat lFormat ( BinaryLogLevel< Level >::code , { BinaryLogArgument< Args >::descriptor()... } );
+      std::vector< uint8_t >& lPayload ( LogPayload() );
+      int lExpander[] = { 0 , ( BinaryLogArgument< Args >::capture ( lPayload , aArgs ) , 0 )... };
+      ( void ) lExpander;
+      commitBinaryLogEntry ( lFormat , lPayload );
+      return true;
+    }
+
+  }
+}
@@ -0,0 +1,97 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_log_log_rate_limit_hpp_
+#define _uhal_log_log_rate_limit_hpp_
+
+
+#include <atomic>
+#include <stdint.h>
+
+
+namespace uhal
+{
+
+  /**
+    Limits the rate at which a log call site writes entries, e.g. for errors that are repeated on every transaction while a device is
+    unreachable. Passed as the first argument of the log functions, typically as a static object at the call site:
+
+      static LogRateLimit lRateLimit;
+      log ( lRateLimit , Error() , "Timeout occurred for device " , Quote ( lId ) );
+
+    At most aMaxEntries entries are written in each period; the others are suppressed before any of their arguments are formatted. The
+    number of entries suppressed since the last written entry is appended to the next one that is written. Where the entries concern
+    one of many objects (e.g. the clients' transports), the limit should instead be a member of each object.
+  */
+  class LogRateLimit
+  {
+    public:
+      /**
+        Constructor
+        @param aMaxEntries the maximum number of entries that are written in each period
+        @param aPeriod the length of each period in milliseconds
+      */
+      LogRateLimit ( const uint32_t aMaxEntries = 1 , const uint32_t aPeriod = 1000 );
+
+      LogRateLimit ( const LogRateLimit& ) = delete;
+      LogRateLimit& operator= ( const LogRateLimit& ) = delete;
+
+      /**
+        Checks whether another entry can be written in the current period (lock-free); if not, the entry is counted as suppressed
+        @param aSuppressed set to the number of entries suppressed since the last entry that was written
+        @return whether the entry should be written
+      */
+      bool allow ( uint64_t& aSuppressed );
+
+      /**
+        Function to retrieve the total number of entries that have been suppressed
+        @return the number of entries suppressed since the object was created
+      */
+      uint64_t suppressed() const;
+
+    private:
+      const uint32_t mMaxEntries;
+      const uint32_t mPeriod;
+      //! The index of the current period (upper 40 bits) and number of entries written in it (lower 24 bits)
+      std::atomic< uint64_t > mState;
+      //! Number of entries suppressed since the last one that was written
+      std::atomic< uint64_t > mPending;
+      std::atomic< uint64_t > mTotal;
+  };
+
+}
+
+
+#endif
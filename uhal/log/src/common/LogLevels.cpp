@@ -3,12 +3,29 @@
 
 
 #include "uhal/log/log_inserters.time.hpp"
-#include "uhal/log/log_inserters.threadID.hpp"
 
 
 namespace uhal
 {
 
+  namespace
+  {
+    typedef void ( *EntryHeadPtr ) ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID );
+
+    //! Returns the variant of the default head function which takes an entry's time and thread ID, unless a custom head function is used
+    template< typename T >
+    EntryHeadPtr EntryHead ( void ( *aHeadFunction ) ( std::ostream& aStr ) )
+    {
+      if ( aHeadFunction != static_cast< void ( * ) ( std::ostream& ) > ( &T::colour_head ) )
+      {
+        return NULL;
+      }
+
+      return static_cast< EntryHeadPtr > ( &T::colour_head );
+    }
+  }
+
+
   void insert ( std::ostream& aStr , const uint32_t& aUint )
   {
     aStr << aUint;
@@ -25,13 +42,18 @@ namespace uhal
   }
 
 
-  FatalLevel::FatalLevel ( std::ostream& aStr , Base::fPtr aHeadFunction, Base::fPtr aTailFunction ) : Base ( aStr , aHeadFunction , aTailFunction ) {}
+  FatalLevel::FatalLevel ( std::ostream& aStr , Base::fPtr aHeadFunction, Base::fPtr aTailFunction ) : Base ( aStr , aHeadFunction , aTailFunction , EntryHead< FatalLevel > ( aHeadFunction ) ) {}
 
   void FatalLevel::colour_head ( std::ostream& aStr )
+  {
+    colour_head ( aStr , Now() , std::this_thread::get_id() );
+  }
+
+  void FatalLevel::colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID )
   {
     aStr << "\033[0;31m" //standard red
-         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( Now() )
-         << " [" << ThisThreadID() << "]"
+         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( aTime )
+         << " [" << aThreadID << "]"
          << " FATAL - ";
   }
 
@@ -43,13 +65,18 @@ namespace uhal
   FatalLevel Fatal;
 
 
-  ErrorLevel::ErrorLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction ) : Base ( aStr , aHeadFunction , aTailFunction ) {}
+  ErrorLevel::ErrorLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction ) : Base ( aStr , aHeadFunction , aTailFunction , EntryHead< ErrorLevel > ( aHeadFunction ) ) {}
 
   void ErrorLevel::colour_head ( std::ostream& aStr )
+  {
+    colour_head ( aStr , Now() , std::this_thread::get_id() );
+  }
+
+  void ErrorLevel::colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID )
   {
     aStr << "\033[0;31m" //standard red
-         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( Now() )
-         << " [" << ThisThreadID() << "]"
+         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( aTime )
+         << " [" << aThreadID << "]"
          << " ERROR - ";
   }
 
@@ -61,13 +88,18 @@ namespace uhal
   ErrorLevel Error;
 
 
-  WarningLevel::WarningLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction )  : Base ( aStr , aHeadFunction , aTailFunction ) {}
+  WarningLevel::WarningLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction )  : Base ( aStr , aHeadFunction , aTailFunction , EntryHead< WarningLevel > ( aHeadFunction ) ) {}
 
   void WarningLevel::colour_head ( std::ostream& aStr )
+  {
+    colour_head ( aStr , Now() , std::this_thread::get_id() );
+  }
+
+  void WarningLevel::colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID )
   {
     aStr << "\033[0;33m" //standard yellow
-         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( Now() )
-         << " [" << ThisThreadID() << "]"
+         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( aTime )
+         << " [" << aThreadID << "]"
          << " WARNING - ";
   }
 
@@ -79,13 +111,18 @@ namespace uhal
   WarningLevel Warning;
 
 
-  NoticeLevel::NoticeLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction )  : Base ( aStr , aHeadFunction , aTailFunction ) {}
+  NoticeLevel::NoticeLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction )  : Base ( aStr , aHeadFunction , aTailFunction , EntryHead< NoticeLevel > ( aHeadFunction ) ) {}
 
   void NoticeLevel::colour_head ( std::ostream& aStr )
+  {
+    colour_head ( aStr , Now() , std::this_thread::get_id() );
+  }
+
+  void NoticeLevel::colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID )
   {
     aStr << "\033[0;32m" //standard green
-         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( Now() )
-         << " [" << ThisThreadID() << "]"
+         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( aTime )
+         << " [" << aThreadID << "]"
          << " NOTICE - ";
   }
 
@@ -97,13 +134,18 @@ namespace uhal
   NoticeLevel Notice;
 
 
-  InfoLevel::InfoLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction ) : Base ( aStr , aHeadFunction , aTailFunction ) {}
+  InfoLevel::InfoLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction ) : Base ( aStr , aHeadFunction , aTailFunction , EntryHead< InfoLevel > ( aHeadFunction ) ) {}
 
   void InfoLevel::colour_head ( std::ostream& aStr )
+  {
+    colour_head ( aStr , Now() , std::this_thread::get_id() );
+  }
+
+  void InfoLevel::colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID )
   {
     aStr << "\033[0;36m" //standard cyan
-         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( Now() )
-         << " [" << ThisThreadID() << "]"
+         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( aTime )
+         << " [" << aThreadID << "]"
          << " INFO - ";
   }
 
@@ -115,13 +157,18 @@ namespace uhal
   InfoLevel Info;
 
 
-  DebugLevel::DebugLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction )  : Base ( aStr , aHeadFunction , aTailFunction ) {}
+  DebugLevel::DebugLevel ( std::ostream& aStr, Base::fPtr aHeadFunction, Base::fPtr aTailFunction )  : Base ( aStr , aHeadFunction , aTailFunction , EntryHead< DebugLevel > ( aHeadFunction ) ) {}
 
   void DebugLevel::colour_head ( std::ostream& aStr )
+  {
+    colour_head ( aStr , Now() , std::this_thread::get_id() );
+  }
+
+  void DebugLevel::colour_head ( std::ostream& aStr , const timeval& aTime , const std::thread::id& aThreadID )
   {
     aStr << "\033[0;34m" //standard blue
-         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( Now() )
-         << " [" << ThisThreadID() << "]"
+         << Time< day,'-',mth,'-',yr,' ',hr,':',min,':',sec,'.',usec > ( aTime )
+         << " [" << aThreadID << "]"
          << " DEBUG - ";
   }
 
@@ -68,11 +68,25 @@ void fileHeaders ( std::ofstream& aHppFile , std::ofstream& aHxxFile , std::ofst
             << "#include <iosfwd>  // for ostream\n"
             << "#include <mutex>   // for lock_guard, mutex\n"
             << "\n"
+            << "#include <uhal/log/log_async.hpp>\n"
+            << "#include <uhal/log/log_binary.hpp>\n"
+            << "#include <uhal/log/log_rate_limit.hpp>\n"
             << "#include <uhal/log/log_inserters.hpp>\n"
             << "#include <uhal/log/LogLevels.hpp>\n"
             << "#include <uhal/log/exception.hpp>\n"
             << "\n"
             << "\n"
+            << "// Log entries are rarely written on hot paths, so the level check is marked as unlikely to succeed, and the code that\n"
+            << "// writes the entry is kept out-of-line, in the section for cold code\n"
+            << "#if defined ( __GNUC__ ) || defined ( __clang__ )\n"
+            << "#define UHAL_LOG_UNLIKELY( x ) __builtin_expect ( !! ( x ) , 0 )\n"
+            << "#define UHAL_LOG_COLD __attribute__ ( ( noinline , cold ) )\n"
+            << "#else\n"
+            << "#define UHAL_LOG_UNLIKELY( x ) ( x )\n"
+            << "#define UHAL_LOG_COLD\n"
+            << "#endif\n"
+            << "\n"
+            << "\n"
             << "namespace uhal{\n"
             << "\n"
             << "class DebugLevel;\n"
@@ -96,6 +110,57 @@ void fileHeaders ( std::ofstream& aHppFile , std::ofstream& aHxxFile , std::ofst
             << "namespace uhal{\n"
             << "\n"
             << gDivider
+            << "\n"
+            << "namespace detail{\n"
+            << "\n"
+            << "//! Writes a log entry (via the binary or asynchronous backend if either is enabled)\n"
+            << "template< typename Level , typename... Args >\n"
+            << "UHAL_LOG_COLD void writeLogEntry ( Level& aLevel , const Args&... aArgs )\n"
+            << "{\n"
+            << "\tif( pushBinaryLogEntry( aLevel , aArgs... ) or pushAsyncLogEntry( aLevel , aArgs... ) ){\n"
+            << "\t\treturn;\n"
+            << "\t}\n"
+            << "\tstd::lock_guard<std::mutex> lLock ( GetLoggingMutex() );\n"
+            << "\tstd::ostream& lStr( aLevel.stream() );\n"
+            << "\taLevel.head();\n"
+            << "\tint lExpander[] = { 0 , ( insert( lStr , aArgs ) , 0 )... };\n"
+            << "\t( void ) lExpander;\n"
+            << "\taLevel.tail();\n"
+            << "}\n"
+            << "\n"
+            << "//! Writes a log entry if the rate limit allows it, noting how many entries from the same call site have been suppressed\n"
+            << "template< typename Level , typename... Args >\n"
+            << "UHAL_LOG_COLD void writeRateLimitedLogEntry ( LogRateLimit& aRateLimit , Level& aLevel , const Args&... aArgs )\n"
+            << "{\n"
+            << "\tuint64_t lSuppressed ( 0 );\n"
+            << "\tif( not aRateLimit.allow( lSuppressed ) ){\n"
+            << "\t\treturn;\n"
+            << "\t}\n"
+            << "\tif( lSuppressed == 0 ){\n"
+            << "\t\twriteLogEntry ( aLevel , aArgs... );\n"
+            << "\t}\n"
+            << "\telse{\n"
+            << "\t\twriteLogEntry ( aLevel , aArgs... , \" [\" , Integer ( lSuppressed ) , \" similar entries suppressed]\" );\n"
+            << "\t}\n"
+            << "}\n"
+            << "\n"
+            << "//! Appends a message to an exception, and returns the message\n"
+            << "template< typename... Args >\n"
+            << "UHAL_LOG_COLD std::string appendToException ( exception::exception& aExc , const Args&... aArgs )\n"
+            << "{\n"
+            << "\tstd::stringstream lStr;\n"
+            << "\t{\n"
+            << "\t\tstd::lock_guard<std::mutex> lLock ( GetLoggingMutex() );\n"
+            << "\t\tint lExpander[] = { 0 , ( insert( lStr , aArgs ) , 0 )... };\n"
+            << "\t\t( void ) lExpander;\n"
+            << "\t\taExc.append( ( lStr.str() + \"\\n\" ).c_str() );\n"
+            << "\t}\n"
+            << "\treturn lStr.str();\n"
+            << "}\n"
+            << "\n"
+            << "}\n"
+            << "\n"
+            << gDivider
             << "\n";
   aCppFile	<< "\n"
             << "#include <mutex>                             // for lock_guard, mutex\n"
@@ -218,9 +283,10 @@ void log_configuration_functions ( std::ofstream& aHppFile , std::ofstream& aHxx
              << "\tFunction to check at runtime whether the level " << *lIt << " is to be included in the log output\n"
              << "\t@return whether the level " << *lIt << " is to be included in the log output\n"
              << "*/\n"
-             << "const bool& LoggingIncludes ( const " << *lIt << "Level& /**< a dummy parameter to choose the specialization of the function for the " << *lIt << " level */ );\n"
+             << "inline const bool& LoggingIncludes ( const " << *lIt << "Level& /**< a dummy parameter to choose the specialization of the function for the " << *lIt << " level */ );\n"
              << "\n";
-    aCppFile << "const bool& LoggingIncludes ( const " << *lIt << "Level& )\n"
+    // Defined inline, so that checking the level at each call site does not require a function call
+    aHxxFile << "inline const bool& LoggingIncludes ( const " << *lIt << "Level& )\n"
              << "{\n"
              << lIfDefs.str()
              << "\t\treturn log_configuration::mLoggingIncludes" << *lIt << ";\n"
@@ -292,20 +358,6 @@ void log_configuration_functions ( std::ofstream& aHppFile , std::ofstream& aHxx
 }
 
 
-std::string suffix ( uint32_t i )
-{
-  i = i % 100;
-
-  if ( i > 10 && i < 20 )
-  {
-    return "th";
-  }
-
-  std::string lIndices[] = { "th" , "st" , "nd" , "rd" , "th" , "th" , "th" , "th" , "th" , "th" };
-  return lIndices[ i%10 ];
-}
-
-
 void log_functions ( std::ofstream& aHppFile , std::ofstream& aHxxFile , std::ofstream& aCppFile )
 {
   std::stringstream lIfDefs , lEndIfs;
@@ -314,96 +366,98 @@ void log_functions ( std::ofstream& aHppFile , std::ofstream& aHxxFile , std::of
   {
     lIfDefs << "\t#ifndef LOGGING_EXCLUDE_" << boost::to_upper_copy ( lLevel ) << "\n";
     lEndIfs << "\t#endif\n";
-    std::stringstream lTemplates;
-    std::stringstream lArgs;
-    std::stringstream lInstructions;
-    std::stringstream lDoxygen;
-    lDoxygen << "\t\tFunction to add a log entry at " << lLevel << " level\n"
-             << "\t\t@param a" << lLevel << " a dummy parameter to choose the specialization of the function for the " << lLevel << " level\n";
-
-    for ( uint32_t i = 0 ; i!=MAX_NUM_ARGS ; ++i )
-    {
-      lTemplates << " typename T" << i << " ,";
-      std::string lTemplatesStr ( lTemplates.str() );
-      lTemplatesStr.resize ( lTemplatesStr.size()-1 );
-      lArgs << " const T" << i << "& aArg" << i << " ,";
-      std::string lArgsStr ( lArgs.str() );
-      lArgsStr.resize ( lArgsStr.size()-1 );
-      lInstructions << "\t\t\tinsert( lStr , aArg" << i << " );\n";
-      lDoxygen << "\t\t@param aArg" << i << " a templated argument to be added to the log " << ( i+1 ) << suffix ( i+1 ) <<"\n";
-      aHppFile << "\t/**\n"
-               << lDoxygen.str()
-               << "\t*/\n"
-               << "\ttemplate<" << lTemplatesStr << ">\n"
-               //               << "\tvoid operator() ( const " <<lLevel << "& a" << lLevel << " ," << lArgsStr << ");\n"
-               << "\tvoid log ( " <<lLevel << "Level& a" << lLevel << " ," << lArgsStr << ");\n"
-               << "\n";
-      aHxxFile << "template<" << lTemplatesStr << ">\n"
-               //               << "void logger::operator() ( const " <<lLevel << "& a" << lLevel << " ," << lArgsStr << " )\n"
-               << "void log (  " <<lLevel << "Level& a" << lLevel << " ," << lArgsStr << " )\n"
-               << "{\n"
-               << lIfDefs.str()
-               << "\t\tif( LoggingIncludes( a" << lLevel << " ) ){\n"
-               << "\t\t\tstd::lock_guard<std::mutex> lLock ( GetLoggingMutex() );\n"
-               << "\t\t\tstd::ostream& lStr( a" << lLevel << ".stream() );\n"
-               << "\t\t\ta" << lLevel << ".head();\n"
-               << lInstructions.str()
-               << "\t\t\ta" << lLevel << ".tail();\n"
-               << "\t\t}\n"
-               << lEndIfs.str()
-               << "}\n"
-               << "\n";
-    }
-
-    aHppFile	<< gDivider
-              << "\n";
-    aHxxFile	<< gDivider
-              << "\n";
+    aHppFile << "/**\n"
+             << "\tFunction to add a log entry at " << lLevel << " level\n"
+             << "\t@param a" << lLevel << " a dummy parameter to choose the specialization of the function for the " << lLevel << " level\n"
+             << "\t@param aArgs the templated arguments to be added to the log entry\n"
+             << "*/\n"
+             << "template< typename... Args >\n"
+             << "void log ( " << lLevel << "Level& a" << lLevel << " , const Args&... aArgs );\n"
+             << "\n";
+    aHxxFile << "template< typename... Args >\n"
+             << "inline void log ( " << lLevel << "Level& a" << lLevel << " , const Args&... aArgs )\n"
+             << "{\n"
+             << lIfDefs.str()
+             << "\t\tif ( UHAL_LOG_UNLIKELY ( LoggingIncludes ( a" << lLevel << " ) ) )\n"
+             << "\t\t{\n"
+             << "\t\t\tdetail::writeLogEntry ( a" << lLevel << " , aArgs... );\n"
+             << "\t\t}\n"
+             << lEndIfs.str()
+             << "}\n"
+             << "\n";
   }
 
-  {
-    std::stringstream lTemplates;
-    std::stringstream lArgs;
-    std::stringstream lInstructions;
-    std::stringstream lDoxygen;
+  std::stringstream lRateLimitedIfDefs , lRateLimitedEndIfs;
 
-    for ( uint32_t i = 0 ; i!=MAX_NUM_ARGS ; ++i )
-    {
-      lTemplates << " typename T" << i << " ,";
-      std::string lTemplatesStr ( lTemplates.str() );
-      lTemplatesStr.resize ( lTemplatesStr.size()-1 );
-      lArgs << " const T" << i << "& aArg" << i << " ,";
-      std::string lArgsStr ( lArgs.str() );
-      lArgsStr.resize ( lArgsStr.size()-1 );
-      lInstructions << "\t\t\tinsert( lStr , aArg" << i << " );\n";
-      lDoxygen << "\t\t@param aArg" << i << " a templated argument to be added to the log " << ( i+1 ) << suffix ( i+1 ) <<"\n";
-      aHppFile << "\t/**\n"
-               << lDoxygen.str()
-               << "\t*/\n"
-               << "\ttemplate<" << lTemplatesStr << ">\n"
-               //               << "\tvoid operator() ( const " <<*lIt << "& a" << *lIt << " ," << lArgsStr << ");\n"
-               << "\tvoid log ( exception::exception& aExc ," << lArgsStr << ");\n"
-               << "\n";
-      aHxxFile << "template<" << lTemplatesStr << ">\n"
-               //               << "void logger::operator() ( const " <<*lIt << "& a" << *lIt << " ," << lArgsStr << " )\n"
-               << "void log (  exception::exception& aExc ," << lArgsStr << " )\n"
-               << "{\n"
-               << "\t\t\tstd::stringstream lStr;\n"
-               << "\t\t\t{\n"
-               << "\t\t\tstd::lock_guard<std::mutex> lLock ( GetLoggingMutex() );\n"
-               << lInstructions.str()
-               << "\t\t\taExc.append( ( lStr.str() + \"\\n\" ).c_str() );\n"
-               << "\t\t\t}\n"
-               << "\t\t\tlog ( Error() , lStr.str() );\n"
-               << "}\n"
-               << "\n";
-    }
-
-    aHppFile  << gDivider
-              << "\n";
-    aHxxFile  << gDivider
-              << "\n";
+  for ( const auto& lLevel: gLogLevels )
+  {
+    lRateLimitedIfDefs << "\t#ifndef LOGGING_EXCLUDE_" << boost::to_upper_copy ( lLevel ) << "\n";
+    lRateLimitedEndIfs << "\t#endif\n";
+    aHppFile << "/**\n"
+             << "\tFunction to add a log entry at " << lLevel << " level, unless suppressed by a rate limit\n"
+             << "\t@param aRateLimit the rate limit of the call site\n"
+             << "\t@param a" << lLevel << " a dummy parameter to choose the specialization of the function for the " << lLevel << " level\n"
+             << "\t@param aArgs the templated arguments to be added to the log entry\n"
+             << "*/\n"
+             << "template< typename... Args >\n"
+             << "void log ( LogRateLimit& aRateLimit , " << lLevel << "Level& a" << lLevel << " , const Args&... aArgs );\n"
+             << "\n";
+    aHxxFile << "template< typename... Args >\n"
+             << "inline void log ( LogRateLimit& aRateLimit , " << lLevel << "Level& a" << lLevel << " , const Args&... aArgs )\n"
+             << "{\n"
+             << lRateLimitedIfDefs.str()
+             << "\t\tif ( UHAL_LOG_UNLIKELY ( LoggingIncludes ( a" << lLevel << " ) ) )\n"
+             << "\t\t{\n"
+             << "\t\t\tdetail::writeRateLimitedLogEntry ( aRateLimit , a" << lLevel << " , aArgs... );\n"
+             << "\t\t}\n"
+             << lRateLimitedEndIfs.str()
+             << "}\n"
+             << "\n";
   }
+
+  aHppFile << "/**\n"
+           << "\tFunction to append a message to an exception, and add it to the log at Error level\n"
+           << "\t@param aExc the exception to which the message is appended\n"
+           << "\t@param aArgs the templated arguments forming the message\n"
+           << "*/\n"
+           << "template< typename... Args >\n"
+           << "void log ( exception::exception& aExc , const Args&... aArgs );\n"
+           << "\n";
+  aHxxFile << "template< typename... Args >\n"
+           << "inline void log ( exception::exception& aExc , const Args&... aArgs )\n"
+           << "{\n"
+           << "\tlog ( Error() , detail::appendToException ( aExc , aArgs... ) );\n"
+           << "}\n"
+           << "\n";
+  aHppFile << "/**\n"
+           << "\tFunction to append a message to an exception and add it to the log at Error level, unless suppressed by a rate limit (in which case\n"
+           << "\tthe message is neither formatted nor appended to the exception)\n"
+           << "\t@param aRateLimit the rate limit of the call site\n"
+           << "\t@param aExc the exception to which the message is appended\n"
+           << "\t@param aArgs the templated arguments forming the message\n"
+           << "*/\n"
+           << "template< typename... Args >\n"
+           << "void log ( LogRateLimit& aRateLimit , exception::exception& aExc , const Args&... aArgs );\n"
+           << "\n";
+  aHxxFile << "template< typename... Args >\n"
+           << "inline void log ( LogRateLimit& aRateLimit , exception::exception& aExc , const Args&... aArgs )\n"
+           << "{\n"
+           << "\tuint64_t lSuppressed ( 0 );\n"
+           << "\tif( not aRateLimit.allow( lSuppressed ) ){\n"
+           << "\t\treturn;\n"
+           << "\t}\n"
+           << "\tif( lSuppressed == 0 ){\n"
+           << "\t\tlog ( Error() , detail::appendToException ( aExc , aArgs... ) );\n"
+           << "\t}\n"
+           << "\telse{\n"
+           << "\t\tlog ( Error() , detail::appendToException ( aExc , aArgs... ) , \" [\" , Integer ( lSuppressed ) , \" similar entries suppressed]\" );\n"
+           << "\t}\n"
+           << "}\n"
+           << "\n";
+  aHppFile  << gDivider
+            << "\n";
+  aHxxFile  << gDivider
+            << "\n";
 }
 
 
@@ -96,14 +96,6 @@ void setLogLevelTo ( const FatalLevel& )
 	#endif
 }
 
-const bool& LoggingIncludes ( const FatalLevel& )
-{
-	#ifndef LOGGING_EXCLUDE_FATAL
-		return log_configuration::mLoggingIncludesFatal;
-	#endif
-	return log_configuration::mFalse;
-}
-
 void setLogLevelTo ( const ErrorLevel& )
 {
 	#ifndef LOGGING_EXCLUDE_FATAL // A waste of time to change any level below this if it is going to disabled by compile-time checking anyway... 
@@ -118,16 +110,6 @@ void setLogLevelTo ( const ErrorLevel& )
 	#endif
 }
 
-const bool& LoggingIncludes ( const ErrorLevel& )
-{
-	#ifndef LOGGING_EXCLUDE_FATAL
-	#ifndef LOGGING_EXCLUDE_ERROR
-		return log_configuration::mLoggingIncludesError;
-	#endif
-	#endif
-	return log_configuration::mFalse;
-}
-
 void setLogLevelTo ( const WarningLevel& )
 {
 	#ifndef LOGGING_EXCLUDE_FATAL // A waste of time to change any level below this if it is going to disabled by compile-time checking anyway... 
@@ -144,18 +126,6 @@ void setLogLevelTo ( const WarningLevel& )
 	#endif
 }
 
-const bool& LoggingIncludes ( const WarningLevel& )
-{
-	#ifndef LOGGING_EXCLUDE_FATAL
-	#ifndef LOGGING_EXCLUDE_ERROR
-	#ifndef LOGGING_EXCLUDE_WARNING
-		return log_configuration::mLoggingIncludesWarning;
-	#endif
-	#endif
-	#endif
-	return log_configuration::mFalse;
-}
-
 void setLogLevelTo ( const NoticeLevel& )
 {
 	#ifndef LOGGING_EXCLUDE_FATAL // A waste of time to change any level below this if it is going to disabled by compile-time checking anyway... 
@@ -174,20 +144,6 @@ void setLogLevelTo ( const NoticeLevel& )
 	#endif
 }
 
-const bool& LoggingIncludes ( const NoticeLevel& )
-{
-	#ifndef LOGGING_EXCLUDE_FATAL
-	#ifndef LOGGING_EXCLUDE_ERROR
-	#ifndef LOGGING_EXCLUDE_WARNING
-	#ifndef LOGGING_EXCLUDE_NOTICE
-		return log_configuration::mLoggingIncludesNotice;
-	#endif
-	#endif
-	#endif
-	#endif
-	return log_configuration::mFalse;
-}
-
 void setLogLevelTo ( const InfoLevel& )
 {
 	#ifndef LOGGING_EXCLUDE_FATAL // A waste of time to change any level below this if it is going to disabled by compile-time checking anyway... 
@@ -208,22 +164,6 @@ void setLogLevelTo ( const InfoLevel& )
 	#endif
 }
 
-const bool& LoggingIncludes ( const InfoLevel& )
-{
-	#ifndef LOGGING_EXCLUDE_FATAL
-	#ifndef LOGGING_EXCLUDE_ERROR
-	#ifndef LOGGING_EXCLUDE_WARNING
-	#ifndef LOGGING_EXCLUDE_NOTICE
-	#ifndef LOGGING_EXCLUDE_INFO
-		return log_configuration::mLoggingIncludesInfo;
-	#endif
-	#endif
-	#endif
-	#endif
-	#endif
-	return log_configuration::mFalse;
-}
-
 void setLogLevelTo ( const DebugLevel& )
 {
 	#ifndef LOGGING_EXCLUDE_FATAL // A waste of time to change any level below this if it is going to disabled by compile-time checking anyway... 
@@ -246,24 +186,6 @@ void setLogLevelTo ( const DebugLevel& )
 	#endif
 }
 
-const bool& LoggingIncludes ( const DebugLevel& )
-{
-	#ifndef LOGGING_EXCLUDE_FATAL
-	#ifndef LOGGING_EXCLUDE_ERROR
-	#ifndef LOGGING_EXCLUDE_WARNING
-	#ifndef LOGGING_EXCLUDE_NOTICE
-	#ifndef LOGGING_EXCLUDE_INFO
-	#ifndef LOGGING_EXCLUDE_DEBUG
-		return log_configuration::mLoggingIncludesDebug;
-	#endif
-	#endif
-	#endif
-	#endif
-	#endif
-	#endif
-	return log_configuration::mFalse;
-}
-
 bool log_configuration::mLoggingIncludesFatal = true; // No #ifdefs required here since they are implemented in all the access functions.
 bool log_configuration::mLoggingIncludesError = true; // No #ifdefs required here since they are implemented in all the access functions.
 bool log_configuration::mLoggingIncludesWarning = true; // No #ifdefs required here since they are implemented in all the access functions.
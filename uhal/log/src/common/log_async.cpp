@@ -0,0 +1,505 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/log/log_async.hpp"
+
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#include "uhal/log/log.hpp"
+#include "uhal/log/log_inserters.time.hpp"
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    std::atomic< bool > gAsyncLogging ( false );
+
+    std::atomic< uint64_t > gDroppedLogEntries ( 0 );
+
+
+    namespace
+    {
+      //! The fixed-size part of each entry in a thread's buffer; the captured argument values follow it
+      struct AsyncLogRecord
+      {
+        //! Size of the entry, including the captured argument values and padding to an 8-byte boundary
+        uint32_t size;
+        //! Whether this entry just skips the unused space at the end of the buffer
+        uint32_t skip;
+        AsyncLogWriterPtr writer;
+        void* level;
+        timeval time;
+        std::thread::id thread;
+      };
+
+
+      //! Single-producer single-consumer ring buffer of variable-size log entries, owned by one logging thread
+      class AsyncLogRing
+      {
+        public:
+          AsyncLogRing ( const size_t aSize ) :
+            mBuffer ( std::max< size_t > ( aSize , 4096 ) / sizeof ( uint64_t ) ),
+            mWrite ( 0 ),
+            mRead ( 0 )
+          {
+          }
+
+          size_t capacity() const
+          {
+            return mBuffer.size() * sizeof ( uint64_t );
+          }
+
+          /**
+            Copies an entry into the buffer (called by the owning thread only)
+            @return false if there is not enough free space for the entry
+          */
+          bool push ( const AsyncLogRecord& aRecord , const std::vector< uint8_t >& aPayload , bool& aHalfFull )
+          {
+            const uint64_t lCapacity ( capacity() );
+            uint64_t lWrite ( mWrite.load ( std::memory_order_relaxed ) );
+            const uint64_t lRead ( mRead.load ( std::memory_order_acquire ) );
+            const uint64_t lOffset ( lWrite % lCapacity );
+            // Entries are contiguous, so if this one doesn't fit before the end of the buffer the remaining space is skipped
+            const uint64_t lSkip ( ( lOffset + aRecord.size > lCapacity ) ? lCapacity - lOffset : 0 );
+
+            if ( lWrite + lSkip + aRecord.size - lRead > lCapacity )
+            {
+              return false;
+            }
+
+            if ( lSkip )
+            {
+              AsyncLogRecord* lRecord ( at ( lWrite ) );
+              lRecord->size = lSkip;
+              lRecord->skip = 1;
+              lWrite += lSkip;
+            }
+
+            AsyncLogRecord* lRecord ( at ( lWrite ) );
+            *lRecord = aRecord;
+
+            if ( not aPayload.empty() )
+            {
+              std::memcpy ( lRecord + 1 , aPayload.data() , aPayload.size() );
+            }
+
+            const uint64_t lUsed ( lWrite - lRead );
+            lWrite += aRecord.size;
+            aHalfFull = ( lUsed < lCapacity / 2 ) and ( lWrite - lRead >= lCapacity / 2 );
+            mWrite.store ( lWrite , std::memory_order_release );
+            return true;
+          }
+
+          //! @return the oldest entry in the buffer, or NULL if it is empty (called by the background thread only)
+          const AsyncLogRecord* front()
+          {
+            uint64_t lRead ( mRead.load ( std::memory_order_relaxed ) );
+            const uint64_t lWrite ( mWrite.load ( std::memory_order_acquire ) );
+
+            while ( lRead != lWrite )
+            {
+              const AsyncLogRecord* lRecord ( at ( lRead ) );
+
+              if ( not lRecord->skip )
+              {
+                return lRecord;
+              }
+
+              lRead += lRecord->size;
+              mRead.store ( lRead , std::memory_order_release );
+            }
+
+            return NULL;
+          }
+
+          //! Releases the space occupied by the oldest entry (called by the background thread only)
+          void pop ( const AsyncLogRecord& aRecord )
+          {
+            mRead.store ( mRead.load ( std::memory_order_relaxed ) + aRecord.size , std::memory_order_release );
+          }
+
+        private:
+          AsyncLogRecord* at ( const uint64_t aPosition )
+          {
+            return reinterpret_cast< AsyncLogRecord* > ( reinterpret_cast< uint8_t* > ( mBuffer.data() ) + ( aPosition % capacity() ) );
+          }
+
+          std::vector< uint64_t > mBuffer;
+          //! Total number of bytes written and read; each is kept on its own cache line, since they are updated by different threads
+          char mPadding0 [ 64 ];
+          std::atomic< uint64_t > mWrite;
+          char mPadding1 [ 64 ];
+          std::atomic< uint64_t > mRead;
+          char mPadding2 [ 64 ];
+      };
+
+
+      //! Owns the per-thread buffers and the background thread which writes their entries out
+      class AsyncLogger
+      {
+        public:
+          static AsyncLogger& getInstance()
+          {
+            static AsyncLogger lInstance;
+            return lInstance;
+          }
+
+          ~AsyncLogger()
+          {
+            stop();
+          }
+
+          void start ( const size_t aBufferSize )
+          {
+            std::lock_guard< std::mutex > lControlLock ( mControlMutex );
+            mBufferSize = aBufferSize;
+
+            if ( not mThread.joinable() )
+            {
+              mStop = false;
+              mRunning = true;
+              mThread = std::thread ( &AsyncLogger::run , this );
+            }
+
+            gAsyncLogging = true;
+          }
+
+          void stop()
+          {
+            std::lock_guard< std::mutex > lControlLock ( mControlMutex );
+            gAsyncLogging = false;
+
+            if ( mThread.joinable() )
+            {
+              {
+                std::lock_guard< std::mutex > lLock ( mMutex );
+                mStop = true;
+              }
+              mCondition.notify_all();
+              mThread.join();
+            }
+
+            // Write out any entries from threads that were already logging when the backend was disabled
+            while ( drain() == kBatchSize )
+            {
+            }
+          }
+
+          void flush()
+          {
+            std::unique_lock< std::mutex > lLock ( mMutex );
+
+            if ( not mRunning )
+            {
+              return;
+            }
+
+            const uint64_t lRequest ( ++mFlushRequests );
+            mCondition.notify_all();
+            mCondition.wait ( lLock , [this, lRequest] () { return ( mFlushesDone >= lRequest ) or not mRunning; } );
+          }
+
+          void push ( AsyncLogRecord& aRecord , const std::vector< uint8_t >& aPayload )
+          {
+            thread_local std::shared_ptr< AsyncLogRing > tRing;
+
+            if ( not tRing )
+            {
+              tRing.reset ( new AsyncLogRing ( mBufferSize ) );
+              std::lock_guard< std::mutex > lLock ( mMutex );
+              mRings.push_back ( tRing );
+            }
+
+            bool lHalfFull ( false );
+
+            if ( not tRing->push ( aRecord , aPayload , lHalfFull ) )
+            {
+              gDroppedLogEntries.fetch_add ( 1 , std::memory_order_relaxed );
+              return;
+            }
+
+            // Wake up the background thread early rather than waiting for its next poll, to avoid entries being dropped
+            if ( lHalfFull )
+            {
+              mCondition.notify_one();
+            }
+          }
+
+          size_t maxRecordSize() const
+          {
+            // Entries which could block a buffer on their own are written out synchronously instead
+            return std::max< size_t > ( mBufferSize , 4096 ) / 2;
+          }
+
+        private:
+          AsyncLogger() :
+            mBufferSize ( 65536 ),
+            mStop ( false ),
+            mRunning ( false ),
+            mFlushRequests ( 0 ),
+            mFlushesDone ( 0 )
+          {
+          }
+
+          void run()
+          {
+            std::unique_lock< std::mutex > lLock ( mMutex );
+
+            while ( true )
+            {
+              const uint64_t lFlushRequest ( mFlushRequests );
+              const bool lStop ( mStop );
+              lLock.unlock();
+
+              while ( drain() == kBatchSize )
+              {
+              }
+
+              lLock.lock();
+              mFlushesDone = lFlushRequest;
+              mCondition.notify_all();
+
+              if ( lStop )
+              {
+                break;
+              }
+
+              if ( ( mFlushRequests == lFlushRequest ) and not mStop )
+              {
+                mCondition.wait_for ( lLock , std::chrono::milliseconds ( 10 ) );
+              }
+            }
+
+            mRunning = false;
+            mCondition.notify_all();
+          }
+
+          /**
+            Writes out up to kBatchSize entries from the per-thread buffers, oldest first
+            @return the number of entries written out
+          */
+          size_t drain()
+          {
+            std::vector< std::shared_ptr< AsyncLogRing > > lRings;
+            {
+              std::lock_guard< std::mutex > lLock ( mMutex );
+              lRings = mRings;
+            }
+
+            size_t lCount ( 0 );
+            {
+              std::lock_guard< std::mutex > lLock ( GetLoggingMutex() );
+
+              for ( ; lCount != kBatchSize ; lCount++ )
+              {
+                AsyncLogRing* lRing ( NULL );
+                const AsyncLogRecord* lRecord ( NULL );
+
+                for ( const std::shared_ptr< AsyncLogRing >& lCandidate : lRings )
+                {
+                  const AsyncLogRecord* lFront ( lCandidate->front() );
+
+                  if ( lFront and ( ( not lRecord ) or timercmp ( &lFront->time , &lRecord->time , < ) ) )
+                  {
+                    lRing = lCandidate.get();
+                    lRecord = lFront;
+                  }
+                }
+
+                if ( not lRecord )
+                {
+                  break;
+                }
+
+                lRecord->writer ( lRecord->level , lRecord->time , lRecord->thread , reinterpret_cast< const uint8_t* > ( lRecord + 1 ) );
+                lRing->pop ( *lRecord );
+              }
+            }
+
+            // Release the buffers of threads that have exited, once they have been emptied
+            std::lock_guard< std::mutex > lLock ( mMutex );
+
+            for ( std::vector< std::shared_ptr< AsyncLogRing > >::iterator lIt = mRings.begin(); lIt != mRings.end(); )
+            {
+              if ( ( lIt->use_count() == 2 ) and std::find ( lRings.begin() , lRings.end() , *lIt ) != lRings.end() and not ( *lIt )->front() )
+              {
+                lIt = mRings.erase ( lIt );
+              }
+              else
+              {
+                lIt++;
+              }
+            }
+
+            return lCount;
+          }
+
+          static const size_t kBatchSize = 1024;
+
+          std::mutex mControlMutex;
+          std::mutex mMutex;
+          std::condition_variable mCondition;
+          std::vector< std::shared_ptr< AsyncLogRing > > mRings;
+          std::thread mThread;
+          std::atomic< size_t > mBufferSize;
+          bool mStop;
+          bool mRunning;
+          uint64_t mFlushRequests;
+          uint64_t mFlushesDone;
+      };
+
+      const size_t AsyncLogger::kBatchSize;
+    }
+
+
+    std::vector< uint8_t >& LogPayload()
+    {
+      thread_local std::vector< uint8_t > tPayload;
+      tPayload.clear();
+      return tPayload;
+    }
+
+
+    bool commitAsyncLogEntry ( AsyncLogWriterPtr aWriter , void* aLevel , const std::vector< uint8_t >& aPayload )
+    {
+      AsyncLogger& lLogger ( AsyncLogger::getInstance() );
+      const size_t lSize ( ( sizeof ( AsyncLogRecord ) + aPayload.size() + 7 ) & ~size_t ( 7 ) );
+
+      if ( lSize > lLogger.maxRecordSize() )
+      {
+        return false;
+      }
+
+      AsyncLogRecord lRecord;
+      lRecord.size = lSize;
+      lRecord.skip = 0;
+      lRecord.writer = aWriter;
+      lRecord.level = aLevel;
+      lRecord.time = Now();
+      lRecord.thread = std::this_thread::get_id();
+      lLogger.push ( lRecord , aPayload );
+      return true;
+    }
+
+
+    void captureLogString ( std::vector< uint8_t >& aPayload , const char* aData , const size_t aSize )
+    {
+      const uint32_t lSize ( aSize );
+      captureLogBytes ( aPayload , &lSize , sizeof ( lSize ) );
+      captureLogBytes ( aPayload , aData , aSize );
+    }
+
+
+    void writeLogString ( std::ostream& aStr , const uint8_t*& aPayload )
+    {
+      uint32_t lSize;
+      std::memcpy ( &lSize , aPayload , sizeof ( lSize ) );
+      aStr.write ( reinterpret_cast< const char* > ( aPayload + sizeof ( lSize ) ) , lSize );
+      aPayload += sizeof ( lSize ) + lSize;
+    }
+
+
+    std::ostringstream& LogScratchStream()
+    {
+      thread_local std::ostringstream tStream;
+      tStream.str ( "" );
+      tStream.clear();
+      return tStream;
+    }
+
+
+    void AsyncLogArgument< const char* >::capture ( std::vector< uint8_t >& aPayload , const char* aArg )
+    {
+      captureLogString ( aPayload , aArg , aArg ? strlen ( aArg ) : 0 );
+    }
+
+    void AsyncLogArgument< const char* >::write ( std::ostream& aStr , const uint8_t*& aPayload )
+    {
+      writeLogString ( aStr , aPayload );
+    }
+
+
+    void AsyncLogArgument< std::string >::capture ( std::vector< uint8_t >& aPayload , const std::string& aArg )
+    {
+      captureLogString ( aPayload , aArg.data() , aArg.size() );
+    }
+
+    void AsyncLogArgument< std::string >::write ( std::ostream& aStr , const uint8_t*& aPayload )
+    {
+      writeLogString ( aStr , aPayload );
+    }
+
+  }
+
+
+  void enableAsyncLogging ( const size_t aBufferSize )
+  {
+    detail::AsyncLogger::getInstance().start ( aBufferSize );
+  }
+
+
+  void disableAsyncLogging()
+  {
+    detail::AsyncLogger::getInstance().stop();
+  }
+
+
+  bool LoggingIsAsync()
+  {
+    return detail::gAsyncLogging.load ( std::memory_order_relaxed );
+  }
+
+
+  void flushLog()
+  {
+    detail::AsyncLogger::getInstance().flush();
+  }
+
+
+  uint64_t GetDroppedLogEntryCount()
+  {
+    return detail::gDroppedLogEntries.load ( std::memory_order_relaxed );
+  }
+
+}
@@ -0,0 +1,865 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/log/log_binary.hpp"
+
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "uhal/log/log.hpp"
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    std::atomic< bool > gBinaryLogging ( false );
+
+
+    namespace
+    {
+      const char kBinaryLogMagic[ 8 ] = { 'U' , 'H' , 'A' , 'L' , 'B' , 'L' , 'O' , 'G' };
+      const uint32_t kBinaryLogVersion = 1;
+      //! Files consist of a header followed by chunks, each of which is filled with entries by a single thread
+      const size_t kBinaryLogHeaderSize = 4096;
+      const size_t kBinaryLogChunkSize = 65536;
+      //! Entries with this format ID describe a format, rather than being a log entry
+      const uint32_t kBinaryLogFormatRecord = 0;
+
+      struct BinaryLogFileHeader
+      {
+        char magic[ 8 ];
+        uint32_t version;
+        uint32_t chunkSize;
+        uint64_t sequence;
+      };
+
+      //! The fixed-size part of each entry in a chunk, followed by the captured argument values (or format descriptor)
+      struct BinaryLogEntryHeader
+      {
+        //! Size of the entry, including padding to an 8-byte boundary; zero marks the end of the entries in a chunk
+        uint32_t size;
+        uint32_t format;
+        int64_t seconds;
+        int64_t microseconds;
+        uint64_t thread;
+      };
+
+      static_assert ( sizeof ( std::thread::id ) <= sizeof ( uint64_t ) , "Thread IDs must fit in the thread field of binary log entries" );
+
+
+      //! A memory-mapped binary log file, unmapped once no thread is writing to it
+      class BinaryLogFile
+      {
+        public:
+          static std::shared_ptr< BinaryLogFile > create ( const std::string& aPath , const size_t aSize , const uint64_t aSequence , std::string& aError )
+          {
+            // Files left by an earlier call to enableBinaryLogging may still be mapped, so are replaced rather than truncated
+            unlink ( aPath.c_str() );
+            const int lFd ( open ( aPath.c_str() , O_RDWR | O_CREAT | O_TRUNC , 0644 ) );
+
+            if ( lFd < 0 )
+            {
+              aError = strerror ( errno );
+              return std::shared_ptr< BinaryLogFile >();
+            }
+
+            void* lMapping ( MAP_FAILED );
+
+            if ( ftruncate ( lFd , aSize ) == 0 )
+            {
+              lMapping = mmap ( NULL , aSize , PROT_READ | PROT_WRITE , MAP_SHARED , lFd , 0 );
+            }
+
+            if ( lMapping == MAP_FAILED )
+            {
+              aError = strerror ( errno );
+              close ( lFd );
+              unlink ( aPath.c_str() );
+              return std::shared_ptr< BinaryLogFile >();
+            }
+
+            BinaryLogFileHeader lHeader;
+            std::memcpy ( lHeader.magic , kBinaryLogMagic , sizeof ( kBinaryLogMagic ) );
+            lHeader.version = kBinaryLogVersion;
+            lHeader.chunkSize = kBinaryLogChunkSize;
+            lHeader.sequence = aSequence;
+            std::memcpy ( lMapping , &lHeader , sizeof ( lHeader ) );
+            return std::shared_ptr< BinaryLogFile > ( new BinaryLogFile ( lFd , static_cast< uint8_t* > ( lMapping ) , aSize , aSequence ) );
+          }
+
+          ~BinaryLogFile()
+          {
+            munmap ( mMapping , mSize );
+            // Nothing can be writing to the file any more, so the unused chunks at the end can be discarded
+            ( void ) ftruncate ( mFd , kBinaryLogHeaderSize + mNextChunk * kBinaryLogChunkSize );
+            close ( mFd );
+          }
+
+          //! @return the next unused chunk, or NULL if the file is full
+          uint8_t* nextChunk()
+          {
+            if ( kBinaryLogHeaderSize + ( mNextChunk + 1 ) * kBinaryLogChunkSize > mSize )
+            {
+              return NULL;
+            }
+
+            return mMapping + kBinaryLogHeaderSize + ( mNextChunk++ ) * kBinaryLogChunkSize;
+          }
+
+          const uint64_t sequence;
+          //! Identifies the file among all those created by the process (starting from 1)
+          const uint64_t index;
+
+        private:
+          BinaryLogFile ( const int aFd , uint8_t* aMapping , const size_t aSize , const uint64_t aSequence ) :
+            sequence ( aSequence ),
+            index ( ++sIndex ),
+            mFd ( aFd ),
+            mMapping ( aMapping ),
+            mSize ( aSize ),
+            mNextChunk ( 0 )
+          {
+          }
+
+          int mFd;
+          uint8_t* mMapping;
+          size_t mSize;
+          //! Index of the next unused chunk (protected by the BinaryLogger's mutex)
+          size_t mNextChunk;
+
+          static std::atomic< uint64_t > sIndex;
+      };
+
+
+      std::atomic< uint64_t > BinaryLogFile::sIndex ( 0 );
+
+
+      //! The chunk that a thread is currently writing entries to
+      struct BinaryLogChunk
+      {
+        std::shared_ptr< BinaryLogFile > file;
+        uint8_t* position;
+        uint8_t* end;
+      };
+
+
+      //! Owns the current binary log file, and hands out chunks of it to the logging threads
+      class BinaryLogger
+      {
+        public:
+          static BinaryLogger& getInstance()
+          {
+            static BinaryLogger lInstance;
+            return lInstance;
+          }
+
+          void start ( const std::string& aPath , const size_t aFileSize , const size_t aFileCount )
+          {
+            std::lock_guard< std::mutex > lControlLock ( mControlMutex );
+            stop();
+            const size_t lFileSize ( kBinaryLogHeaderSize + std::max< size_t > ( ( aFileSize - std::min ( aFileSize , kBinaryLogHeaderSize ) ) / kBinaryLogChunkSize , 1 ) * kBinaryLogChunkSize );
+            std::string lError;
+            std::shared_ptr< BinaryLogFile > lFile ( BinaryLogFile::create ( getPath ( aPath , 0 ) , lFileSize , 0 , lError ) );
+
+            if ( not lFile )
+            {
+              exception::BinaryLogFileError lExc;
+              log ( lExc , "Could not create binary log file " , Quote ( getPath ( aPath , 0 ) ) , ": " , lError );
+              throw lExc;
+            }
+
+            std::lock_guard< std::mutex > lLock ( mMutex );
+            mPath = aPath;
+            mFileSize = lFileSize;
+            mFileCount = std::max< size_t > ( aFileCount , 1 );
+            mFile = lFile;
+            mCurrent.store ( lFile.get() , std::memory_order_release );
+            gBinaryLogging = true;
+          }
+
+          void stop()
+          {
+            std::lock_guard< std::mutex > lLock ( mMutex );
+            gBinaryLogging = false;
+            mCurrent.store ( NULL , std::memory_order_release );
+            mFile.reset();
+          }
+
+          /**
+            Makes sure that there is enough space in the calling thread's chunk for an entry, moving to a new chunk if required
+            @return false if the binary backend has been disabled
+          */
+          bool reserve ( BinaryLogChunk& aChunk , const size_t aSize )
+          {
+            if ( aChunk.file and ( aChunk.file.get() == mCurrent.load ( std::memory_order_acquire ) ) and ( aChunk.position + aSize <= aChunk.end ) )
+            {
+              return true;
+            }
+
+            std::string lError , lPath;
+            {
+              std::lock_guard< std::mutex > lLock ( mMutex );
+
+              if ( not mFile )
+              {
+                aChunk.file.reset();
+                return false;
+              }
+
+              uint8_t* lChunk ( mFile->nextChunk() );
+
+              if ( not lChunk )
+              {
+                // Current file is full: move on to the next, removing the oldest one
+                const uint64_t lSequence ( mFile->sequence + 1 );
+                lPath = getPath ( mPath , lSequence );
+                std::shared_ptr< BinaryLogFile > lFile ( BinaryLogFile::create ( lPath , mFileSize , lSequence , lError ) );
+
+                if ( lFile )
+                {
+                  if ( lSequence >= mFileCount )
+                  {
+                    unlink ( getPath ( mPath , lSequence - mFileCount ).c_str() );
+                  }
+
+                  mFile = lFile;
+                  mCurrent.store ( lFile.get() , std::memory_order_release );
+                  lChunk = mFile->nextChunk();
+                }
+                else
+                {
+                  gBinaryLogging = false;
+                  mCurrent.store ( NULL , std::memory_order_release );
+                  mFile.reset();
+                }
+              }
+
+              if ( lChunk )
+              {
+                aChunk.file = mFile;
+                aChunk.position = lChunk;
+                aChunk.end = lChunk + kBinaryLogChunkSize;
+                return true;
+              }
+            }
+
+            // Logged after releasing the lock, since this entry is written as text
+            aChunk.file.reset();
+            log ( Error() , "Could not create binary log file " , Quote ( lPath ) , " (" , lError , "); switching back to text logging" );
+            return false;
+          }
+
+          static std::string getPath ( const std::string& aPath , const uint64_t aSequence )
+          {
+            return aPath + "." + std::to_string ( aSequence );
+          }
+
+        private:
+          BinaryLogger() :
+            mFileSize ( 0 ),
+            mFileCount ( 0 ),
+            mCurrent ( NULL )
+          {
+          }
+
+          std::mutex mControlMutex;
+          std::mutex mMutex;
+          std::string mPath;
+          size_t mFileSize;
+          size_t mFileCount;
+          std::shared_ptr< BinaryLogFile > mFile;
+          //! The current file, so that threads can check whether their chunk is still in it without locking (a chunk's shared pointer keeps its file's address from being reused)
+          std::atomic< BinaryLogFile* > mCurrent;
+      };
+
+
+      void writeEntryHeader ( uint8_t* aPosition , const uint32_t aSize , const uint32_t aFormat )
+      {
+        BinaryLogEntryHeader lHeader;
+        lHeader.size = aSize;
+        lHeader.format = aFormat;
+        const timeval lTime ( Now() );
+        lHeader.seconds = lTime.tv_sec;
+        lHeader.microseconds = lTime.tv_usec;
+        lHeader.thread = 0;
+        const std::thread::id lThreadID ( std::this_thread::get_id() );
+        std::memcpy ( &lHeader.thread , &lThreadID , sizeof ( lThreadID ) );
+        std::memcpy ( aPosition , &lHeader , sizeof ( lHeader ) );
+      }
+
+
+      size_t alignedSize ( const size_t aSize )
+      {
+        return ( sizeof ( BinaryLogEntryHeader ) + aSize + 7 ) & ~size_t ( 7 );
+      }
+
+
+      uint32_t nextFormatId()
+      {
+        static std::atomic< uint32_t > lNextId ( kBinaryLogFormatRecord + 1 );
+        return lNextId++;
+      }
+
+
+      std::string concatenate ( const std::initializer_list< std::string >& aStrings )
+      {
+        std::string lResult;
+
+        for ( const std::string& lString : aStrings )
+        {
+          lResult += lString;
+        }
+
+        return lResult;
+      }
+    }
+
+
+    BinaryLogFormat::BinaryLogFormat ( const uint8_t aLevel , const std::initializer_list< std::string >& aArguments ) :
+      id ( nextFormatId() ),
+      level ( aLevel ),
+      argumentCount ( aArguments.size() ),
+      descriptor ( concatenate ( aArguments ) ),
+      file ( 0 )
+    {
+    }
+
+
+    void commitBinaryLogEntry ( BinaryLogFormat& aFormat , const std::vector< uint8_t >& aPayload )
+    {
+      thread_local BinaryLogChunk tChunk;
+      BinaryLogger& lLogger ( BinaryLogger::getInstance() );
+      const size_t lSize ( alignedSize ( aPayload.size() ) );
+      const size_t lFormatSize ( alignedSize ( 8 + aFormat.descriptor.size() ) );
+
+      if ( lSize + lFormatSize > kBinaryLogChunkSize )
+      {
+        gDroppedLogEntries.fetch_add ( 1 , std::memory_order_relaxed );
+        return;
+      }
+
+      if ( not lLogger.reserve ( tChunk , lSize ) )
+      {
+        return;
+      }
+
+      // Each file must contain the description of each format used in it, written before any entry using the format. The file is only
+      // recorded in the format once its description has been written, so threads that race to use a format first each write a copy.
+      if ( aFormat.file.load ( std::memory_order_acquire ) != tChunk.file->index )
+      {
+        if ( not lLogger.reserve ( tChunk , lSize + lFormatSize ) )
+        {
+          return;
+        }
+
+        uint8_t* lPosition ( tChunk.position + sizeof ( BinaryLogEntryHeader ) );
+        const uint8_t lFields[] = { aFormat.level , aFormat.argumentCount };
+        const uint16_t lDescriptorSize ( aFormat.descriptor.size() );
+        std::memcpy ( lPosition , &aFormat.id , 4 );
+        std::memcpy ( lPosition + 4 , lFields , 2 );
+        std::memcpy ( lPosition + 6 , &lDescriptorSize , 2 );
+        std::memcpy ( lPosition + 8 , aFormat.descriptor.data() , aFormat.descriptor.size() );
+        writeEntryHeader ( tChunk.position , lFormatSize , kBinaryLogFormatRecord );
+        tChunk.position += lFormatSize;
+        aFormat.file.store ( tChunk.file->index , std::memory_order_release );
+      }
+
+      if ( not aPayload.empty() )
+      {
+        std::memcpy ( tChunk.position + sizeof ( BinaryLogEntryHeader ) , aPayload.data() , aPayload.size() );
+      }
+
+      writeEntryHeader ( tChunk.position , lSize , aFormat.id );
+      tChunk.position += lSize;
+    }
+
+
+
+    std::string BinaryLogArgument< const char* >::descriptor()
+    {
+      return std::string ( 1 , char ( kBinaryLogString ) );
+    }
+
+    void BinaryLogArgument< const char* >::capture ( std::vector< uint8_t >& aPayload , const char* aArg )
+    {
+      captureLogString ( aPayload , aArg , aArg ? strlen ( aArg ) : 0 );
+    }
+
+
+    std::string BinaryLogArgument< std::string >::descriptor()
+    {
+      return std::string ( 1 , char ( kBinaryLogString ) );
+    }
+
+    void BinaryLogArgument< std::string >::capture ( std::vector< uint8_t >& aPayload , const std::string& aArg )
+    {
+      captureLogString ( aPayload , aArg.data() , aArg.size() );
+    }
+
+
+    std::string BinaryLogArgument< _Quote< const char* > >::descriptor()
+    {
+      return std::string ( 1 , char ( kBinaryLogQuotedString ) );
+    }
+
+    void BinaryLogArgument< _Quote< const char* > >::capture ( std::vector< uint8_t >& aPayload , const _Quote< const char* >& aArg )
+    {
+      captureLogString ( aPayload , aArg.value() , aArg.value() ? strlen ( aArg.value() ) : 0 );
+    }
+
+
+    std::string BinaryLogArgument< _Quote< std::string > >::descriptor()
+    {
+      return std::string ( 1 , char ( kBinaryLogQuotedString ) );
+    }
+
+    void BinaryLogArgument< _Quote< std::string > >::capture ( std::vector< uint8_t >& aPayload , const _Quote< std::string >& aArg )
+    {
+      captureLogString ( aPayload , aArg.value().data() , aArg.value().size() );
+    }
+
+
+    namespace
+    {
+      //! A decoded log entry, pointing into the contents of a binary log file
+      struct BinaryLogEntry
+      {
+        timeval time;
+        std::thread::id thread;
+        uint32_t formatId;
+        const BinaryLogFormat* format;
+        const uint8_t* payload;
+        const uint8_t* end;
+      };
+
+
+      //! Thrown by the decoder functions when an entry does not match its format
+      struct BinaryLogCorruption {};
+
+
+      template< typename T >
+      T readValue ( const uint8_t*& aPosition , const uint8_t* aEnd )
+      {
+        T lValue;
+
+        if ( aPosition + sizeof ( T ) > aEnd )
+        {
+          throw BinaryLogCorruption();
+        }
+
+        std::memcpy ( &lValue , aPosition , sizeof ( T ) );
+        aPosition += sizeof ( T );
+        return lValue;
+      }
+
+
+      void writeString ( std::ostream& aStr , const uint8_t*& aPosition , const uint8_t* aEnd )
+      {
+        const uint32_t lSize ( readValue< uint32_t > ( aPosition , aEnd ) );
+
+        if ( aPosition + lSize > aEnd )
+        {
+          throw BinaryLogCorruption();
+        }
+
+        aStr.write ( reinterpret_cast< const char* > ( aPosition ) , lSize );
+        aPosition += lSize;
+      }
+
+
+      template< typename T >
+      void writeIntegral ( std::ostream& aStr , const uint8_t aFlags , const uint8_t*& aPosition , const uint8_t* aEnd )
+      {
+        const T lValue ( readValue< T > ( aPosition , aEnd ) );
+
+        if ( aFlags & kBinaryLogBoolean )
+        {
+          aStr << bool ( lValue );
+        }
+        else if ( aFlags & kBinaryLogCharacter )
+        {
+          aStr << char ( lValue );
+        }
+        else
+        {
+          aStr << lValue;
+        }
+      }
+
+
+      template< typename T , integer_base BASE , integer_format FORMAT >
+      void writeInteger ( std::ostream& aStr , const uint32_t aWidth , const uint8_t*& aPosition , const uint8_t* aEnd )
+      {
+        const T lValue ( readValue< T > ( aPosition , aEnd ) );
+
+        if ( FORMAT == variable )
+        {
+          aStr << Integer ( lValue , IntFmt< BASE , FORMAT >() );
+          return;
+        }
+
+        // The width is a template parameter of the formatter, so the zero padding is added here instead
+        std::ostringstream& lStr ( LogScratchStream() );
+        lStr << Integer ( lValue , IntFmt< BASE , FORMAT >() );
+        const std::string lString ( lStr.str() );
+        const size_t lPrefix ( ( BASE == dec ) ? ( ( lString [ 0 ] == '-' or lString [ 0 ] == '+' ) ? 1 : 0 ) : 2 );
+        aStr.write ( lString.data() , lPrefix );
+
+        for ( size_t i = lString.size() - lPrefix; i < aWidth; i++ )
+        {
+          aStr.put ( '0' );
+        }
+
+        aStr.write ( lString.data() + lPrefix , lString.size() - lPrefix );
+      }
+
+
+      template< typename T >
+      void writeInteger ( std::ostream& aStr , const uint8_t aBase , const uint8_t aFormat , const uint32_t aWidth , const uint8_t*& aPosition , const uint8_t* aEnd )
+      {
+        switch ( aBase * 2 + ( aFormat == fixed ? 0 : 1 ) )
+        {
+          case bin * 2 :
+            return writeInteger< T , bin , fixed > ( aStr , aWidth , aPosition , aEnd );
+          case bin * 2 + 1 :
+            return writeInteger< T , bin , variable > ( aStr , aWidth , aPosition , aEnd );
+          case dec * 2 :
+            return writeInteger< T , dec , fixed > ( aStr , aWidth , aPosition , aEnd );
+          case dec * 2 + 1 :
+            return writeInteger< T , dec , variable > ( aStr , aWidth , aPosition , aEnd );
+          case hex * 2 :
+            return writeInteger< T , hex , fixed > ( aStr , aWidth , aPosition , aEnd );
+          case hex * 2 + 1 :
+            return writeInteger< T , hex , variable > ( aStr , aWidth , aPosition , aEnd );
+          default:
+            throw BinaryLogCorruption();
+        }
+      }
+
+
+      //! Writes the argument values of an entry, according to the descriptor of its format
+      void writeArguments ( std::ostream& aStr , const BinaryLogEntry& aEntry )
+      {
+        const uint8_t* lDescriptor ( reinterpret_cast< const uint8_t* > ( aEntry.format->descriptor.data() ) );
+        const uint8_t* lDescriptorEnd ( lDescriptor + aEntry.format->descriptor.size() );
+        const uint8_t* lPosition ( aEntry.payload );
+
+        while ( lDescriptor != lDescriptorEnd )
+        {
+          switch ( readValue< uint8_t > ( lDescriptor , lDescriptorEnd ) )
+          {
+            case kBinaryLogIntegral :
+            {
+              const uint8_t lSize ( readValue< uint8_t > ( lDescriptor , lDescriptorEnd ) );
+              const uint8_t lFlags ( readValue< uint8_t > ( lDescriptor , lDescriptorEnd ) );
+              const bool lSigned ( lFlags & kBinaryLogSigned );
+
+              switch ( lSize )
+              {
+                case 1 :
+                  lSigned ? writeIntegral< int8_t > ( aStr , lFlags , lPosition , aEntry.end ) : writeIntegral< uint8_t > ( aStr , lFlags , lPosition , aEntry.end );
+                  break;
+                case 2 :
+                  lSigned ? writeIntegral< int16_t > ( aStr , lFlags , lPosition , aEntry.end ) : writeIntegral< uint16_t > ( aStr , lFlags , lPosition , aEntry.end );
+                  break;
+                case 4 :
+                  lSigned ? writeIntegral< int32_t > ( aStr , lFlags , lPosition , aEntry.end ) : writeIntegral< uint32_t > ( aStr , lFlags , lPosition , aEntry.end );
+                  break;
+                case 8 :
+                  lSigned ? writeIntegral< int64_t > ( aStr , lFlags , lPosition , aEntry.end ) : writeIntegral< uint64_t > ( aStr , lFlags , lPosition , aEntry.end );
+                  break;
+                default:
+                  throw BinaryLogCorruption();
+              }
+
+              break;
+            }
+            case kBinaryLogFloatingPoint :
+            {
+              switch ( readValue< uint8_t > ( lDescriptor , lDescriptorEnd ) )
+              {
+                case sizeof ( float ) :
+                  aStr << readValue< float > ( lPosition , aEntry.end );
+                  break;
+                case sizeof ( double ) :
+                  aStr << readValue< double > ( lPosition , aEntry.end );
+                  break;
+                case sizeof ( long double ) :
+                  aStr << readValue< long double > ( lPosition , aEntry.end );
+                  break;
+                default:
+                  throw BinaryLogCorruption();
+              }
+
+              break;
+            }
+            case kBinaryLogInteger :
+            {
+              const uint8_t lSize ( readValue< uint8_t > ( lDescriptor , lDescriptorEnd ) );
+              const bool lSigned ( readValue< uint8_t > ( lDescriptor , lDescriptorEnd ) );
+              const uint8_t lBase ( readValue< uint8_t > ( lDescriptor , lDescriptorEnd ) );
+              const uint8_t lFormat ( readValue< uint8_t > ( lDescriptor , lDescriptorEnd ) );
+              const uint32_t lWidth ( readValue< uint32_t > ( lDescriptor , lDescriptorEnd ) );
+
+              switch ( lSize )
+              {
+                case 1 :
+                  lSigned ? writeInteger< int8_t > ( aStr , lBase , lFormat , lWidth , lPosition , aEntry.end ) : writeInteger< uint8_t > ( aStr , lBase , lFormat , lWidth , lPosition , aEntry.end );
+                  break;
+                case 2 :
+                  lSigned ? writeInteger< int16_t > ( aStr , lBase , lFormat , lWidth , lPosition , aEntry.end ) : writeInteger< uint16_t > ( aStr , lBase , lFormat , lWidth , lPosition , aEntry.end );
+                  break;
+                case 4 :
+                  lSigned ? writeInteger< int32_t > ( aStr , lBase , lFormat , lWidth , lPosition , aEntry.end ) : writeInteger< uint32_t > ( aStr , lBase , lFormat , lWidth , lPosition , aEntry.end );
+                  break;
+                case 8 :
+                  lSigned ? writeInteger< int64_t > ( aStr , lBase , lFormat , lWidth , lPosition , aEntry.end ) : writeInteger< uint64_t > ( aStr , lBase , lFormat , lWidth , lPosition , aEntry.end );
+                  break;
+                default:
+                  throw BinaryLogCorruption();
+              }
+
+              break;
+            }
+            case kBinaryLogString :
+              writeString ( aStr , lPosition , aEntry.end );
+              break;
+            case kBinaryLogQuotedString :
+              aStr.put ( '"' );
+              writeString ( aStr , lPosition , aEntry.end );
+              aStr.put ( '"' );
+              break;
+            default:
+              throw BinaryLogCorruption();
+          }
+        }
+      }
+
+
+      typedef void ( *BinaryLogHeadFunction ) ( std::ostream& , const timeval& , const std::thread::id& );
+      typedef void ( *BinaryLogTailFunction ) ( std::ostream& );
+
+      //! The head and tail functions of each level, indexed by BinaryLogLevel::code
+      const std::pair< BinaryLogHeadFunction , BinaryLogTailFunction > kBinaryLogLevels[] = {
+        { &FatalLevel::colour_head , &FatalLevel::colour_tail },
+        { &ErrorLevel::colour_head , &ErrorLevel::colour_tail },
+        { &WarningLevel::colour_head , &WarningLevel::colour_tail },
+        { &NoticeLevel::colour_head , &NoticeLevel::colour_tail },
+        { &InfoLevel::colour_head , &InfoLevel::colour_tail },
+        { &DebugLevel::colour_head , &DebugLevel::colour_tail }
+      };
+
+
+      //! Reads the formats and entries from one file's contents
+      void readBinaryLogFile ( const std::string& aPath , const std::vector< uint8_t >& aContents , std::vector< std::unique_ptr< BinaryLogFormat > >& aFormats , std::vector< BinaryLogEntry >& aEntries )
+      {
+        BinaryLogFileHeader lHeader;
+
+        if ( aContents.size() < kBinaryLogHeaderSize or ( std::memcpy ( &lHeader , aContents.data() , sizeof ( lHeader ) ) , std::memcmp ( lHeader.magic , kBinaryLogMagic , sizeof ( kBinaryLogMagic ) ) != 0 ) or lHeader.version != kBinaryLogVersion or lHeader.chunkSize == 0 )
+        {
+          exception::BinaryLogFileError lExc;
+          log ( lExc , Quote ( aPath ) , " is not a uHAL binary log file" );
+          throw lExc;
+        }
+
+        // Format IDs are only unique within the process that wrote the file
+        std::map< uint32_t , const BinaryLogFormat* > lFormats;
+        const size_t lFirstEntry ( aEntries.size() );
+
+        for ( size_t lChunk = kBinaryLogHeaderSize; lChunk < aContents.size(); lChunk += lHeader.chunkSize )
+        {
+          const uint8_t* lPosition ( aContents.data() + lChunk );
+          const uint8_t* lChunkEnd ( aContents.data() + std::min< size_t > ( lChunk + lHeader.chunkSize , aContents.size() ) );
+
+          while ( lPosition + sizeof ( BinaryLogEntryHeader ) <= lChunkEnd )
+          {
+            BinaryLogEntryHeader lEntryHeader;
+            std::memcpy ( &lEntryHeader , lPosition , sizeof ( lEntryHeader ) );
+
+            if ( lEntryHeader.size < sizeof ( BinaryLogEntryHeader ) or lPosition + lEntryHeader.size > lChunkEnd )
+            {
+              // Either the end of the entries in this chunk, or an entry that was still being written
+              break;
+            }
+
+            BinaryLogEntry lEntry;
+            lEntry.payload = lPosition + sizeof ( BinaryLogEntryHeader );
+            lEntry.end = lPosition + lEntryHeader.size;
+            lPosition = lEntry.end;
+
+            if ( lEntryHeader.format == kBinaryLogFormatRecord )
+            {
+              const uint8_t* lFormatPosition ( lEntry.payload );
+              const uint32_t lId ( readValue< uint32_t > ( lFormatPosition , lEntry.end ) );
+              const uint8_t lLevel ( readValue< uint8_t > ( lFormatPosition , lEntry.end ) );
+              readValue< uint8_t > ( lFormatPosition , lEntry.end );
+              const uint16_t lDescriptorSize ( readValue< uint16_t > ( lFormatPosition , lEntry.end ) );
+
+              if ( lLevel >= sizeof ( kBinaryLogLevels ) / sizeof ( kBinaryLogLevels [ 0 ] ) or lFormatPosition + lDescriptorSize > lEntry.end )
+              {
+                throw BinaryLogCorruption();
+              }
+
+              // A format can be described more than once in a file (if several threads first used it at the same time)
+              if ( lFormats.count ( lId ) == 0 )
+              {
+                aFormats.push_back ( std::unique_ptr< BinaryLogFormat > ( new BinaryLogFormat ( lLevel , { std::string ( reinterpret_cast< const char* > ( lFormatPosition ) , lDescriptorSize ) } ) ) );
+                lFormats [ lId ] = aFormats.back().get();
+              }
+
+              continue;
+            }
+
+            lEntry.formatId = lEntryHeader.format;
+            lEntry.time.tv_sec = lEntryHeader.seconds;
+            lEntry.time.tv_usec = lEntryHeader.microseconds;
+            std::memcpy ( static_cast< void* > ( &lEntry.thread ) , &lEntryHeader.thread , sizeof ( lEntry.thread ) );
+            aEntries.push_back ( lEntry );
+          }
+        }
+
+        // A format's record can be in a different chunk (written by another thread) to the entries using it
+        for ( std::vector< BinaryLogEntry >::iterator lIt = aEntries.begin() + lFirstEntry; lIt != aEntries.end(); lIt++ )
+        {
+          std::map< uint32_t , const BinaryLogFormat* >::const_iterator lFormat ( lFormats.find ( lIt->formatId ) );
+
+          if ( lFormat == lFormats.end() )
+          {
+            throw BinaryLogCorruption();
+          }
+
+          lIt->format = lFormat->second;
+        }
+      }
+    }
+
+  }
+
+
+  void enableBinaryLogging ( const std::string& aPath , const size_t aFileSize , const size_t aFileCount )
+  {
+    detail::BinaryLogger::getInstance().start ( aPath , aFileSize , aFileCount );
+  }
+
+
+  void disableBinaryLogging()
+  {
+    detail::BinaryLogger::getInstance().stop();
+  }
+
+
+  bool LoggingIsBinary()
+  {
+    return detail::gBinaryLogging;
+  }
+
+
+  size_t decodeBinaryLog ( const std::vector< std::string >& aFiles , std::ostream& aStr )
+  {
+    std::vector< std::vector< uint8_t > > lContents ( aFiles.size() );
+    std::vector< std::unique_ptr< detail::BinaryLogFormat > > lFormats;
+    std::vector< detail::BinaryLogEntry > lEntries;
+
+    for ( size_t i = 0; i < aFiles.size(); i++ )
+    {
+      std::ifstream lStr ( aFiles [ i ].c_str() , std::ios::binary );
+
+      if ( lStr.is_open() )
+      {
+        lStr.seekg ( 0 , std::ios::end );
+        lContents [ i ].resize ( lStr.tellg() );
+        lStr.seekg ( 0 , std::ios::beg );
+        lStr.read ( reinterpret_cast< char* > ( lContents [ i ].data() ) , lContents [ i ].size() );
+      }
+
+      if ( not lStr.is_open() or not lStr )
+      {
+        exception::BinaryLogFileError lExc;
+        log ( lExc , "Could not read binary log file " , Quote ( aFiles [ i ] ) );
+        throw lExc;
+      }
+
+      try
+      {
+        detail::readBinaryLogFile ( aFiles [ i ] , lContents [ i ] , lFormats , lEntries );
+      }
+      catch ( const detail::BinaryLogCorruption& )
+      {
+        exception::BinaryLogFileError lExc;
+        log ( lExc , "Binary log file " , Quote ( aFiles [ i ] ) , " is corrupt" );
+        throw lExc;
+      }
+    }
+
+    // Each thread writes to its own chunks, so the entries must be merged by time
+    std::stable_sort ( lEntries.begin() , lEntries.end() , [] ( const detail::BinaryLogEntry& aLhs , const detail::BinaryLogEntry& aRhs )
+    {
+      return timercmp ( &aLhs.time , &aRhs.time , < );
+    } );
+
+    for ( const detail::BinaryLogEntry& lEntry : lEntries )
+    {
+      const std::pair< detail::BinaryLogHeadFunction , detail::BinaryLogTailFunction >& lLevel ( detail::kBinaryLogLevels [ lEntry.format->level ] );
+      lLevel.first ( aStr , lEntry.time , lEntry.thread );
+
+      try
+      {
+        detail::writeArguments ( aStr , lEntry );
+      }
+      catch ( const detail::BinaryLogCorruption& )
+      {
+        aStr << "<corrupt entry>";
+      }
+
+      lLevel.second ( aStr );
+    }
+
+    return lEntries.size();
+  }
+
+}
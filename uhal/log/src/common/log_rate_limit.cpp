@@ -0,0 +1,103 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/log/log_rate_limit.hpp"
+
+
+#include <algorithm>
+#include <chrono>
+
+
+namespace uhal
+{
+
+  namespace
+  {
+    const uint64_t kCountBits = 24;
+    const uint64_t kCountMask = ( uint64_t ( 1 ) << kCountBits ) - 1;
+  }
+
+
+  LogRateLimit::LogRateLimit ( const uint32_t aMaxEntries , const uint32_t aPeriod ) :
+    mMaxEntries ( std::min< uint64_t > ( aMaxEntries , kCountMask ) ),
+    mPeriod ( std::max< uint32_t > ( aPeriod , 1 ) ),
+    mState ( 0 ),
+    mPending ( 0 ),
+    mTotal ( 0 )
+  {
+  }
+
+
+  bool LogRateLimit::allow ( uint64_t& aSuppressed )
+  {
+    const uint64_t lNow ( std::chrono::duration_cast< std::chrono::milliseconds > ( std::chrono::steady_clock::now().time_since_epoch() ).count() );
+    // Period indices start from 1, so that the initial state does not correspond to a period
+    const uint64_t lPeriod ( lNow / mPeriod + 1 );
+    uint64_t lState ( mState.load ( std::memory_order_relaxed ) );
+
+    while ( true )
+    {
+      uint64_t lNewState;
+
+      if ( ( lState >> kCountBits ) != lPeriod )
+      {
+        lNewState = ( lPeriod << kCountBits ) | 1;
+      }
+      else if ( ( lState & kCountMask ) < mMaxEntries )
+      {
+        lNewState = lState + 1;
+      }
+      else
+      {
+        mPending.fetch_add ( 1 , std::memory_order_relaxed );
+        mTotal.fetch_add ( 1 , std::memory_order_relaxed );
+        return false;
+      }
+
+      if ( mState.compare_exchange_weak ( lState , lNewState , std::memory_order_relaxed ) )
+      {
+        aSuppressed = mPending.exchange ( 0 , std::memory_order_relaxed );
+        return true;
+      }
+    }
+  }
+
+
+  uint64_t LogRateLimit::suppressed() const
+  {
+    return mTotal.load ( std::memory_order_relaxed );
+  }
+
+}
@@ -0,0 +1,85 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+/**
+  Renders binary log files (see uhal::enableBinaryLogging) into the text format, ordering the entries by time
+
+  Usage: uhal_log_decode.exe FILE...
+*/
+
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "uhal/log/log.hpp"
+
+
+int main ( int argc , char* argv[] )
+{
+  std::vector< std::string > lFiles;
+
+  for ( int i = 1; i < argc; i++ )
+  {
+    if ( std::strcmp ( argv [ i ] , "-h" ) == 0 or std::strcmp ( argv [ i ] , "--help" ) == 0 )
+    {
+      lFiles.clear();
+      break;
+    }
+
+    lFiles.push_back ( argv [ i ] );
+  }
+
+  if ( lFiles.empty() )
+  {
+    std::cerr << "Usage: " << argv [ 0 ] << " FILE..." << std::endl;
+    std::cerr << "Renders uHAL binary log files into text, ordering the entries by time" << std::endl;
+    return 1;
+  }
+
+  try
+  {
+    uhal::decodeBinaryLog ( lFiles , std::cout );
+  }
+  catch ( const uhal::exception::exception& aExc )
+  {
+    std::cerr << "ERROR: " << aExc.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
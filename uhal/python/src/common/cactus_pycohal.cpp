@@ -11,6 +11,8 @@
 #include "uhal/ClientFactory.hpp"
 #include "uhal/ClientInterface.hpp"
 #include "uhal/ConnectionManager.hpp"
+#include "uhal/MetricsExporter.hpp"
+#include "uhal/PacketCapture.hpp"
 #include "uhal/ProtocolControlHub.hpp"
 #include "uhal/ProtocolIPbus.hpp"
 #include "uhal/ProtocolTCP.hpp"
@@ -18,6 +20,7 @@
 #include "uhal/SigBusGuard.hpp"
 #include "uhal/Node.hpp"
 #include "uhal/tests/tools.hpp"
+#include "uhal/utilities/ClientStatistics.hpp"
 
 // pycohal includes
 #include "uhal/pycohal/enums_logging.hpp"
@@ -302,6 +305,8 @@ PYBIND11_MODULE(_core, m)
     .def ( "getNode",         static_cast<const uhal::Node& ( uhal::Node::* ) ( const std::string& ) const>( &uhal::Node::getNode ), pycohal::norm_ref_return_policy )
     .def ( "getNodes",        static_cast<std::vector<std::string> ( uhal::Node::* ) ( const std::string& ) const>(&uhal::Node::getNodes) )
     .def ( "getNodes",        static_cast<std::vector<std::string> ( uhal::Node::* ) () const>(&uhal::Node::getNodes) )
+    .def ( "getNodesMatchingGlob", &uhal::Node::getNodesMatchingGlob )
+    .def ( "getNodesWithPrefix", &uhal::Node::getNodesWithPrefix )
     .def ( "getId",           &uhal::Node::getId,         pycohal::const_ref_return_policy )
     .def ( "getPath",         &uhal::Node::getPath )
     .def ( "getParameters",   &uhal::Node::getParameters, pycohal::const_ref_return_policy )
@@ -330,6 +335,49 @@ PYBIND11_MODULE(_core, m)
     .def("__iter__" , pass_through , pycohal::norm_ref_return_policy )
     ;
 
+  // Wrap performance counters and latency histograms
+  py::class_<uhal::LatencyHistogram::Snapshot>(m, "LatencyHistogram")
+    .def_readonly ( "count",  &uhal::LatencyHistogram::Snapshot::count )
+    .def_readonly ( "sum",    &uhal::LatencyHistogram::Snapshot::sum )
+    .def_readonly ( "min",    &uhal::LatencyHistogram::Snapshot::min )
+    .def_readonly ( "max",    &uhal::LatencyHistogram::Snapshot::max )
+    .def_readonly ( "counts", &uhal::LatencyHistogram::Snapshot::counts )
+    .def ( "mean",       &uhal::LatencyHistogram::Snapshot::mean )
+    .def ( "percentile", &uhal::LatencyHistogram::Snapshot::percentile )
+    .def_static ( "lowerBound", &uhal::LatencyHistogram::lowerBound )
+    .def_static ( "upperBound", &uhal::LatencyHistogram::upperBound )
+    .def ( "__str__", [](const uhal::LatencyHistogram::Snapshot& s) { return boost::lexical_cast<std::string>(s); } )
+    ;
+
+  py::class_<uhal::ClientStatistics::Snapshot>(m, "ClientStatistics")
+    .def_readonly ( "packetsSent",         &uhal::ClientStatistics::Snapshot::packetsSent )
+    .def_readonly ( "packetsReceived",     &uhal::ClientStatistics::Snapshot::packetsReceived )
+    .def_readonly ( "bytesSent",           &uhal::ClientStatistics::Snapshot::bytesSent )
+    .def_readonly ( "bytesReceived",       &uhal::ClientStatistics::Snapshot::bytesReceived )
+    .def_readonly ( "transactions",        &uhal::ClientStatistics::Snapshot::transactions )
+    .def_readonly ( "inFlight",            &uhal::ClientStatistics::Snapshot::inFlight )
+    .def_readonly ( "maxInFlight",         &uhal::ClientStatistics::Snapshot::maxInFlight )
+    .def_readonly ( "dispatches",          &uhal::ClientStatistics::Snapshot::dispatches )
+    .def_readonly ( "timeouts",            &uhal::ClientStatistics::Snapshot::timeouts )
+    .def_readonly ( "packetRoundTripTime", &uhal::ClientStatistics::Snapshot::packetRoundTripTime )
+    .def_readonly ( "dispatchTime",        &uhal::ClientStatistics::Snapshot::dispatchTime )
+    .def ( "__str__", [](const uhal::ClientStatistics::Snapshot& s) { return boost::lexical_cast<std::string>(s); } )
+    ;
+
+  py::class_<uhal::MetricsExporter>(m, "MetricsExporter")
+    .def ( py::init<uint16_t, const std::string&>(), py::arg("port"), py::arg("address") = "127.0.0.1" )
+    .def ( py::init([](const std::string& aPath, uint32_t aPeriod) { return new uhal::MetricsExporter(boost::filesystem::path(aPath), std::chrono::milliseconds(aPeriod)); }), py::arg("path"), py::arg("period_ms") = 15000 )
+    .def ( "getPort", &uhal::MetricsExporter::getPort )
+    .def_static ( "metrics", [](bool aOpenMetrics) { std::ostringstream lStream; uhal::MetricsExporter::write(lStream, aOpenMetrics); return lStream.str(); }, py::arg("openmetrics") = true )
+    ;
+
+  py::class_<uhal::PacketCapture>(m, "PacketCapture")
+    .def_static ( "start", [](const std::string& aPath, size_t aRingSize) { uhal::PacketCapture::start(boost::filesystem::path(aPath), aRingSize); }, py::arg("path"), py::arg("ring_size") = size_t(1 << 20) )
+    .def_static ( "stop", &uhal::PacketCapture::stop )
+    .def_static ( "isEnabled", &uhal::PacketCapture::isEnabled )
+    .def_static ( "getDroppedPacketCount", &uhal::PacketCapture::getDroppedPacketCount )
+    ;
+
   // Wrap uhal::ClientInterface
   py::class_<uhal::ClientInterface, std::shared_ptr<uhal::ClientInterface>>(m, "ClientInterface")
     .def ( "id",     &uhal::ClientInterface::id, pycohal::const_ref_return_policy )
@@ -347,6 +395,8 @@ PYBIND11_MODULE(_core, m)
     .def ( "dispatch", &uhal::ClientInterface::dispatch )
     .def ( "setTimeoutPeriod", &uhal::ClientInterface::setTimeoutPeriod )
     .def ( "getTimeoutPeriod", &uhal::ClientInterface::getTimeoutPeriod )
+    .def ( "getStatistics", &uhal::ClientInterface::getStatistics )
+    .def ( "resetStatistics", &uhal::ClientInterface::resetStatistics )
     .def ( "__str__", &uhal::ClientInterface::id, pycohal::const_ref_return_policy )
     ;
 
@@ -379,6 +429,8 @@ PYBIND11_MODULE(_core, m)
     .def ( "getNode", static_cast< const uhal::Node& ( uhal::HwInterface::* ) ( const std::string& ) const > ( &uhal::HwInterface::getNode ), pycohal::norm_ref_return_policy )
     .def ( "getNodes", static_cast< std::vector<std::string> ( uhal::HwInterface::* ) () const > ( &uhal::HwInterface::getNodes ) )
     .def ( "getNodes", static_cast< std::vector<std::string> ( uhal::HwInterface::* ) ( const std::string& ) const > ( &uhal::HwInterface::getNodes ) )
+    .def ( "getNodesMatchingGlob", &uhal::HwInterface::getNodesMatchingGlob )
+    .def ( "getNodesWithPrefix", &uhal::HwInterface::getNodesWithPrefix )
     .def ( "__str__", &uhal::HwInterface::id, pycohal::const_ref_return_policy )
     ;
 
@@ -389,7 +441,10 @@ PYBIND11_MODULE(_core, m)
     .def ( "getDevice", static_cast< uhal::HwInterface ( uhal::ConnectionManager::* ) ( const std::string& ) > ( &uhal::ConnectionManager::getDevice ) )
     .def ( "getDevices", static_cast< std::vector<std::string> ( uhal::ConnectionManager::* ) ()                   const > ( &uhal::ConnectionManager::getDevices ) )
     .def ( "getDevices", static_cast< std::vector<std::string> ( uhal::ConnectionManager::* ) ( const std::string& ) const > ( &uhal::ConnectionManager::getDevices ) )
+    .def ( "getDevices", static_cast< std::vector<uhal::HwInterface> ( uhal::ConnectionManager::* ) ( const std::vector<std::string>& ) > ( &uhal::ConnectionManager::getDevices ) )
+    .def ( "getAllDevices", &uhal::ConnectionManager::getAllDevices )
     .def_static ( "clearAddressFileCache", &uhal::ConnectionManager::clearAddressFileCache )
+    .def_static ( "reloadAddressFiles", &uhal::ConnectionManager::reloadAddressFiles )
     ;
 
   m.def ( "getDevice", static_cast<uhal::HwInterface (* ) ( const std::string&, const std::string&, const std::string& ) > ( &uhal::ConnectionManager::getDevice ) );
@@ -91,6 +91,14 @@ void pycohal::wrap_logging_functions(pybind11::module_& aModule)
   aModule.def ( "disableLogging", uhal::disableLogging );
   aModule.def ( "setLogLevelTo", pycohal::setLogLevelTo );
   aModule.def ( "LoggingIncludes", pycohal::LoggingIncludes, py::return_value_policy::copy );
+  aModule.def ( "enableAsyncLogging", uhal::enableAsyncLogging, py::arg ( "buffer_size" ) = 65536 );
+  aModule.def ( "disableAsyncLogging", uhal::disableAsyncLogging );
+  aModule.def ( "LoggingIsAsync", uhal::LoggingIsAsync );
+  aModule.def ( "flushLog", uhal::flushLog );
+  aModule.def ( "GetDroppedLogEntryCount", uhal::GetDroppedLogEntryCount );
+  aModule.def ( "enableBinaryLogging", uhal::enableBinaryLogging, py::arg ( "path" ), py::arg ( "file_size" ) = 64 << 20, py::arg ( "file_count" ) = 2 );
+  aModule.def ( "disableBinaryLogging", uhal::disableBinaryLogging );
+  aModule.def ( "LoggingIsBinary", uhal::LoggingIsBinary );
 }
 
 
@@ -5,7 +5,9 @@
 
 // uhal includes
 #include "uhal/log/exception.hpp"
+#include "uhal/MetricsExporter.hpp"
 #include "uhal/Node.hpp"
+#include "uhal/PacketCapture.hpp"
 #include "uhal/ProtocolTCP.hpp"
 #include "uhal/ProtocolUDP.hpp"
 #include "uhal/ValMem.hpp"
@@ -28,5 +30,7 @@ void pycohal::wrap_exceptions(pybind11::module_& aModule)
   py::register_exception<uhal::exception::ValidationError> ( aModule, "ValidationError", baseException );
   py::register_exception<uhal::exception::TcpTimeout> ( aModule, "TcpTimeout", baseException );
   py::register_exception<uhal::exception::UdpTimeout> ( aModule, "UdpTimeout", baseException );
+  py::register_exception<uhal::exception::MetricsExporterError> ( aModule, "MetricsExporterError", baseException );
+  py::register_exception<uhal::exception::PacketCaptureError> ( aModule, "PacketCaptureError", baseException );
   py::register_exception<pycohal::PycohalLogLevelEnumError> ( aModule, "PycohalLogLevelEnumError", baseException );
 }
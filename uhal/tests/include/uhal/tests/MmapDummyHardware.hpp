@@ -0,0 +1,151 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_tests_MmapDummyHardware_hpp_
+#define _uhal_tests_MmapDummyHardware_hpp_
+
+
+#include <atomic>
+#include <chrono>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "uhal/ProtocolMmap.hpp"
+#include "uhal/tests/DummyHardware.hpp"
+
+
+namespace uhal {
+namespace tests {
+
+/**
+  Dummy hardware for the ipbusmmap-2.0 client, which emulates the IPbus page ring of the AXI transport firmware
+  in a memory-mapped file (e.g. under /dev/shm). Unlike the firmware, requests and replies cannot occupy separate
+  address spaces at the same addresses, so the request pages are placed at REQUEST_OFFSET.
+
+  The firmware knows when a request has been completely written from the AXI write transactions, whereas here the
+  client's stores are only visible in memory (and possibly out of order). So clients increment the word at
+  REQUEST_DOORBELL_OFFSET after each request, and a request is only read once the doorbell shows that it has been
+  completely written.
+
+  Both differences are handled by MmapDummyClient, which is registered as the ipbusmmapdummy-2.0 protocol (see getClientURI).
+*/
+class MmapDummyHardware : public DummyHardware<2, 0>
+{
+public:
+  typedef DummyHardware<2, 0> base_type;
+
+  //! Types of error that can be injected into replies
+  enum ErrorType {
+    NO_ERROR,
+    //! The request is consumed, but the reply is never published (i.e. client will time out)
+    DROP_REPLY,
+    //! The reply's IPbus packet header is corrupted (i.e. client will fail to validate the reply)
+    CORRUPT_REPLY
+  };
+
+  //! Byte offset of the request pages within the file
+  static const size_t REQUEST_OFFSET = 0x4000;
+
+  //! Byte offset of the doorbell word, to which the client writes the number of requests sent after each request
+  static const size_t REQUEST_DOORBELL_OFFSET = REQUEST_OFFSET - 4;
+
+  MmapDummyHardware(const std::string& aFilePath, const uint32_t& aReplyDelay, const bool& aBigEndianHack);
+
+  ~MmapDummyHardware();
+
+  void run();
+
+  void stop();
+
+  //! Returns the URI that an ipbusmmap-2.0 client should use to communicate with dummy hardware at the specified path
+  static std::string getClientURI(const std::string& aFilePath);
+
+  //! Sets the delay between reading each request and publishing its reply (unlike the reply delay, applied to every packet)
+  void setReplyLatency(const std::chrono::microseconds& aLatency);
+
+  /**
+    Configures error injection; should be called before the client sends the affected requests
+    @param aType type of error to inject
+    @param aPeriod the error is injected into every aPeriod'th reply (0 disables error injection)
+  */
+  void setErrorInjection(const ErrorType aType, const uint32_t aPeriod);
+
+private:
+  //! Copies the specified number of words from the mapped file, starting at the given word address
+  void readWords(const size_t aAddr, const size_t aNrWords, std::vector<uint32_t>& aValues) const;
+
+  void publishReply();
+
+  std::string mFilePath;
+  size_t mFileSize;
+  int mFd;
+  volatile uint32_t* mMemory;
+
+  const uint32_t mNumberOfPages;
+  const uint32_t mWordsPerPage;
+  uint32_t mNextPageIndex;
+  uint32_t mPublishedPageCount;
+
+  std::atomic<bool> mStop;
+
+  //! Settings that can be changed while the responder thread is running
+  std::atomic<std::chrono::microseconds> mReplyLatency;
+  std::atomic<ErrorType> mErrorType;
+  std::atomic<uint32_t> mErrorPeriod;
+
+  uint32_t mNrPacketsReceived;
+};
+
+
+
+//! ipbusmmap-2.0 client for MmapDummyHardware, which writes requests at its REQUEST_OFFSET and rings its doorbell after each request
+class MmapDummyClient : public Mmap
+{
+public:
+  MmapDummyClient(const std::string& aId, const URI& aUri);
+
+  ~MmapDummyClient();
+
+private:
+  uint32_t getRequestOffset() const;
+
+  void notifyRequestWritten();
+};
+
+} // end ns tests
+} // end ns uhal
+
+#endif
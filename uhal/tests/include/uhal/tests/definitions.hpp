@@ -43,7 +43,8 @@ enum DeviceType {
   IPBUS_2_0_UDP, 
   IPBUS_2_0_TCP,
   IPBUS_2_0_CONTROLHUB,
-  IPBUS_2_0_PCIE
+  IPBUS_2_0_PCIE,
+  IPBUS_2_0_MMAP
 };
 
 } // end ns tests
@@ -147,6 +148,20 @@ enum DeviceType {
   \
   BOOST_AUTO_TEST_SUITE_END() \
   \
+  BOOST_AUTO_TEST_SUITE_END() \
+  \
+  \
+  BOOST_AUTO_TEST_SUITE( ipbusmmap_2_0 ) \
+  \
+  BOOST_AUTO_TEST_SUITE( test_suite_name ) \
+  \
+  BOOST_FIXTURE_TEST_CASE( test_case_name , test_fixture<IPBUS_2_0_MMAP> ) \
+  {\
+    test_case_contents \
+  }\
+  \
+  BOOST_AUTO_TEST_SUITE_END() \
+  \
   BOOST_AUTO_TEST_SUITE_END()
 
 
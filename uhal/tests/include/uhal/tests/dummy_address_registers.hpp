@@ -0,0 +1,169 @@
+// Generated by gen_uhal_register_header from dummy_address.xml
+// Do not edit this file; re-generate it whenever the address table changes.
+
+#ifndef _dummy_address_registers_hpp_
+#define _dummy_address_registers_hpp_
+
+
+#include "uhal/HwInterface.hpp"
+#include "uhal/RegisterDescriptor.hpp"
+
+
+namespace dummy_address
+{
+  constexpr uhal::RegisterDescriptor REG { "REG", 0x00000001, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor REG_READ_ONLY { "REG_READ_ONLY", 0x00000002, 0xffffffff, uhal::defs::READ, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor REG_WRITE_ONLY { "REG_WRITE_ONLY", 0x00000003, 0xffffffff, uhal::defs::WRITE, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor REG_UPPER_MASK { "REG_UPPER_MASK", 0x00000004, 0xffff0000, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor REG_LOWER_MASK { "REG_LOWER_MASK", 0x00000004, 0x0000ffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor REG_MASKED_READ_ONLY { "REG_MASKED_READ_ONLY", 0x00000005, 0xffff0000, uhal::defs::READ, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor REG_MASKED_WRITE_ONLY { "REG_MASKED_WRITE_ONLY", 0x00000005, 0x0000ffff, uhal::defs::WRITE, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor REG_PARS { "REG_PARS", 0x00000006, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor REG_OUT_OF_ORDER { "REG_OUT_OF_ORDER", 0x00000006, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor FIFO { "FIFO", 0x00000100, 0xffffffff, uhal::defs::READWRITE, uhal::defs::NON_INCREMENTAL, 268435456 };
+  constexpr uhal::RegisterDescriptor MEM { "MEM", 0x00100000, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 262144 };
+
+  namespace SUBSYSTEM1
+  {
+    constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM1.REG", 0x00210002, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    constexpr uhal::RegisterDescriptor MEM { "SUBSYSTEM1.MEM", 0x00210003, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 262144 };
+
+    namespace SUBMODULE
+    {
+      constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM1.SUBMODULE.REG", 0x00270002, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor MEM { "SUBSYSTEM1.SUBMODULE.MEM", 0x00270003, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 256 };
+    }
+  }
+
+  namespace SUBSYSTEM2
+  {
+    constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM2.REG", 0x00310002, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    constexpr uhal::RegisterDescriptor MEM { "SUBSYSTEM2.MEM", 0x00310003, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 262144 };
+
+    namespace SUBMODULE
+    {
+      constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM2.SUBMODULE.REG", 0x00370002, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor MEM { "SUBSYSTEM2.SUBMODULE.MEM", 0x00370003, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 256 };
+    }
+  }
+
+  constexpr uhal::RegisterDescriptor SMALL_MEM { "SMALL_MEM", 0x00400000, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 256 };
+
+  namespace SUBSYSTEM3
+  {
+    namespace DERIVEDNODE
+    {
+      constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM3.DERIVEDNODE.REG", 0x00600001, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_WRITE_ONLY { "SUBSYSTEM3.DERIVEDNODE.REG_WRITE_ONLY", 0x00600003, 0xffffffff, uhal::defs::WRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_UPPER_MASK { "SUBSYSTEM3.DERIVEDNODE.REG_UPPER_MASK", 0x00600004, 0xffff0000, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_LOWER_MASK { "SUBSYSTEM3.DERIVEDNODE.REG_LOWER_MASK", 0x00600004, 0x0000ffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    }
+
+    namespace BADNODE
+    {
+      constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM3.BADNODE.REG", 0x00600101, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_WRITE_ONLY { "SUBSYSTEM3.BADNODE.REG_WRITE_ONLY", 0x00600103, 0xffffffff, uhal::defs::WRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_UPPER_MASK { "SUBSYSTEM3.BADNODE.REG_UPPER_MASK", 0x00600104, 0xffff0000, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_LOWER_MASK { "SUBSYSTEM3.BADNODE.REG_LOWER_MASK", 0x00600104, 0x0000ffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    }
+
+    namespace DERIVEDMODULE1
+    {
+      constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM3.DERIVEDMODULE1.REG", 0x00610011, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor MEM { "SUBSYSTEM3.DERIVEDMODULE1.MEM", 0x00610012, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 262144 };
+    }
+
+    namespace DERIVEDMODULE2
+    {
+      constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM3.DERIVEDMODULE2.REG", 0x00610031, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_WRITE_ONLY { "SUBSYSTEM3.DERIVEDMODULE2.REG_WRITE_ONLY", 0x00610033, 0xffffffff, uhal::defs::WRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_UPPER_MASK { "SUBSYSTEM3.DERIVEDMODULE2.REG_UPPER_MASK", 0x00610034, 0xffff0000, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_LOWER_MASK { "SUBSYSTEM3.DERIVEDMODULE2.REG_LOWER_MASK", 0x00610034, 0x0000ffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    }
+
+    namespace DERIVEDMODULE3
+    {
+      constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM3.DERIVEDMODULE3.REG", 0x00610051, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_WRITE_ONLY { "SUBSYSTEM3.DERIVEDMODULE3.REG_WRITE_ONLY", 0x00610053, 0xffffffff, uhal::defs::WRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_UPPER_MASK { "SUBSYSTEM3.DERIVEDMODULE3.REG_UPPER_MASK", 0x00610054, 0xffff0000, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_LOWER_MASK { "SUBSYSTEM3.DERIVEDMODULE3.REG_LOWER_MASK", 0x00610054, 0x0000ffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    }
+
+    namespace DERIVEDMODULE4
+    {
+      constexpr uhal::RegisterDescriptor REG { "SUBSYSTEM3.DERIVEDMODULE4.REG", 0x00610071, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_WRITE_ONLY { "SUBSYSTEM3.DERIVEDMODULE4.REG_WRITE_ONLY", 0x00610073, 0xffffffff, uhal::defs::WRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_UPPER_MASK { "SUBSYSTEM3.DERIVEDMODULE4.REG_UPPER_MASK", 0x00610074, 0xffff0000, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+      constexpr uhal::RegisterDescriptor REG_LOWER_MASK { "SUBSYSTEM3.DERIVEDMODULE4.REG_LOWER_MASK", 0x00610074, 0x0000ffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    }
+  }
+
+  constexpr uhal::RegisterDescriptor IPBUS_ENDPOINT { "IPBUS_ENDPOINT", 0x00700000, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  constexpr uhal::RegisterDescriptor LARGE_MEM { "LARGE_MEM", 0x01000000, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 26214400 };
+
+
+  //! All register descriptors declared in this file
+  constexpr const uhal::RegisterDescriptor* kRegisters[] = {
+    &REG,
+    &REG_READ_ONLY,
+    &REG_WRITE_ONLY,
+    &REG_UPPER_MASK,
+    &REG_LOWER_MASK,
+    &REG_MASKED_READ_ONLY,
+    &REG_MASKED_WRITE_ONLY,
+    &REG_PARS,
+    &REG_OUT_OF_ORDER,
+    &FIFO,
+    &MEM,
+    &SUBSYSTEM1::REG,
+    &SUBSYSTEM1::MEM,
+    &SUBSYSTEM1::SUBMODULE::REG,
+    &SUBSYSTEM1::SUBMODULE::MEM,
+    &SUBSYSTEM2::REG,
+    &SUBSYSTEM2::MEM,
+    &SUBSYSTEM2::SUBMODULE::REG,
+    &SUBSYSTEM2::SUBMODULE::MEM,
+    &SMALL_MEM,
+    &SUBSYSTEM3::DERIVEDNODE::REG,
+    &SUBSYSTEM3::DERIVEDNODE::REG_WRITE_ONLY,
+    &SUBSYSTEM3::DERIVEDNODE::REG_UPPER_MASK,
+    &SUBSYSTEM3::DERIVEDNODE::REG_LOWER_MASK,
+    &SUBSYSTEM3::BADNODE::REG,
+    &SUBSYSTEM3::BADNODE::REG_WRITE_ONLY,
+    &SUBSYSTEM3::BADNODE::REG_UPPER_MASK,
+    &SUBSYSTEM3::BADNODE::REG_LOWER_MASK,
+    &SUBSYSTEM3::DERIVEDMODULE1::REG,
+    &SUBSYSTEM3::DERIVEDMODULE1::MEM,
+    &SUBSYSTEM3::DERIVEDMODULE2::REG,
+    &SUBSYSTEM3::DERIVEDMODULE2::REG_WRITE_ONLY,
+    &SUBSYSTEM3::DERIVEDMODULE2::REG_UPPER_MASK,
+    &SUBSYSTEM3::DERIVEDMODULE2::REG_LOWER_MASK,
+    &SUBSYSTEM3::DERIVEDMODULE3::REG,
+    &SUBSYSTEM3::DERIVEDMODULE3::REG_WRITE_ONLY,
+    &SUBSYSTEM3::DERIVEDMODULE3::REG_UPPER_MASK,
+    &SUBSYSTEM3::DERIVEDMODULE3::REG_LOWER_MASK,
+    &SUBSYSTEM3::DERIVEDMODULE4::REG,
+    &SUBSYSTEM3::DERIVEDMODULE4::REG_WRITE_ONLY,
+    &SUBSYSTEM3::DERIVEDMODULE4::REG_UPPER_MASK,
+    &SUBSYSTEM3::DERIVEDMODULE4::REG_LOWER_MASK,
+    &IPBUS_ENDPOINT,
+    &LARGE_MEM
+  };
+
+
+  //! Checks that the descriptors in this file match the device's address table, throwing uhal::exception::RegisterDescriptorMismatch if not
+  inline void validate ( const uhal::HwInterface& aHw )
+  {
+    uhal::validateRegisterDescriptors ( aHw.getNode() , kRegisters );
+  }
+
+
+  namespace
+  {
+    //! Registers the descriptors, so that each HwInterface created from dummy_address.xml checks them against its address table
+    const uhal::RegisterDescriptorRegistration kRegistration ( "dummy_address.xml" , kRegisters );
+  }
+}
+
+
+#endif
@@ -35,6 +35,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 #include "uhal/ConnectionManager.hpp"
 #include "uhal/HwInterface.hpp"
@@ -54,6 +55,8 @@ protected:
 
 public:
   static std::string connectionFileURI;
+  // Protocols of user-defined clients used in the connection file (i.e. mmap dummy hardware client)
+  static const std::vector<std::string> userClientActivationList;
   // HW client timeout in milliseconds
   static size_t timeout;
   static bool quickTest;
@@ -92,6 +95,18 @@ struct MinimalFixture<IPBUS_2_0_PCIE> : public AbstractFixture {
   std::string deviceId;
 };
 
+template <>
+struct MinimalFixture<IPBUS_2_0_MMAP> : public AbstractFixture {
+  MinimalFixture();
+  ~MinimalFixture();
+
+  uhal::HwInterface getHwInterface() const;
+
+  static const DeviceType deviceType;
+  std::string filePath;
+  std::string deviceId;
+};
+
 template <DeviceType type>
 const DeviceType MinimalFixture<type>::deviceType = type;
 
@@ -122,7 +137,7 @@ MinimalFixture<type>::~MinimalFixture()
 template <DeviceType type>
 HwInterface MinimalFixture<type>::getHwInterface() const
 {
-  ConnectionManager manager(connectionFileURI);
+  ConnectionManager manager(connectionFileURI, userClientActivationList);
   HwInterface hw(manager.getDevice(deviceId));
   hw.setTimeoutPeriod(timeout);
   return hw;
@@ -161,6 +176,9 @@ DummyHardwareFixture<IPBUS_2_0_CONTROLHUB>::DummyHardwareFixture();
 template <>
 DummyHardwareFixture<IPBUS_2_0_PCIE>::DummyHardwareFixture();
 
+template <>
+DummyHardwareFixture<IPBUS_2_0_MMAP>::DummyHardwareFixture();
+
 
 } // end ns tests
 } // end ns uhal
@@ -144,6 +144,14 @@ def get_commands(conn_file, controlhub_scripts_dir, uhal_tools_etc_path):
               ["run_uhal_tests.exe -c %s --run_test=ipbuspcie_2_0 --log_level=test_suite" % (conn_file)]
             ]]
 
+    cmds += [["TEST IPBUS 2.0 MMAP",
+              ["run_uhal_tests.exe -c %s --run_test=ipbusmmap_2_0 --log_level=test_suite" % (conn_file)]
+            ]]
+
+    cmds += [["TEST MMAP DIRECT ACCESS",
+              ["run_uhal_tests.exe -c %s --run_test=mmap_direct_access --log_level=test_suite" % (conn_file)]
+            ]]
+
     cmds += [["TEST PYCOHAL",
               ["DummyHardwareUdp.exe --version 1 --port 50001",
                sys.executable + " $(which test_pycohal) -c %s -v" % (conn_file),
@@ -165,6 +173,8 @@ def get_commands(conn_file, controlhub_scripts_dir, uhal_tools_etc_path):
                "diff -I '^-- START' %s %s" % (join( uhal_tools_test_refs_dir, 'ipbus_decode_addr_table_b.vhd' ) , 'ipbus_decode_addr_table_b.vhd' ),
                sys.executable + " $(which gen_ipbus_addr_decode) -t %s %s" % (uhal_tools_template_vhdl, join( uhal_tools_test_inputs_dir, 'addr_table_c.xml')),
                "diff -I '^-- START' %s %s" % (join( uhal_tools_test_refs_dir, 'ipbus_decode_addr_table_c.vhd' ) , 'ipbus_decode_addr_table_c.vhd' ),
+               sys.executable + " $(which gen_uhal_register_header) %s" % (join( uhal_tools_test_inputs_dir, 'addr_table_b.xml')),
+               "diff -I '^// Generated' %s %s" % (join( uhal_tools_test_refs_dir, 'addr_table_b.hpp' ) , 'addr_table_b.hpp' ),
               ]
             ]]
 
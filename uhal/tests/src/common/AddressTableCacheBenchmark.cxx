@@ -0,0 +1,171 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+/**
+  Benchmark of address table loading time, with and without the on-disk node tree cache, for a synthetic
+  address table (a top-level file that includes a configurable number of module files).
+*/
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include "uhal/log/log.hpp"
+#include "uhal/Node.hpp"
+#include "uhal/NodeTreeBuilder.hpp"
+
+
+namespace po = boost::program_options;
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock_t;
+
+void writeAddressTable(const boost::filesystem::path& aDirectory, const size_t aNrModules, const size_t aNrRegisters)
+{
+  std::ofstream lTopFile((aDirectory / "top.xml").c_str());
+  lTopFile << "<node>\n";
+
+  for (size_t i = 0; i < aNrModules; i++) {
+    const std::string lModuleName("module" + std::to_string(i) + ".xml");
+    lTopFile << "  <node id=\"MODULE" << i << "\" address=\"0x" << std::hex << (i << 20) << std::dec << "\" module=\"file://" << lModuleName << "\"/>\n";
+
+    std::ofstream lModuleFile((aDirectory / lModuleName).c_str());
+    lModuleFile << "<node description=\"Synthetic module " << i << "\">\n";
+    for (size_t j = 0; j < aNrRegisters; j++) {
+      if (j % 4 == 0)
+        lModuleFile << "  <node id=\"CSR" << j << "\" address=\"0x" << std::hex << j << std::dec << "\">\n"
+                    << "    <node id=\"ENABLE\" mask=\"0x1\" tags=\"ctrl\"/>\n"
+                    << "    <node id=\"MODE\" mask=\"0xe\" parameters=\"default=2\"/>\n"
+                    << "    <node id=\"COUNT\" mask=\"0xffff0000\" permission=\"r\"/>\n"
+                    << "  </node>\n";
+      else
+        lModuleFile << "  <node id=\"REG" << j << "\" address=\"0x" << std::hex << j << std::dec << "\" permission=\"rw\" description=\"Register " << j << "\"/>\n";
+    }
+    lModuleFile << "</node>\n";
+  }
+
+  lTopFile << "</node>\n";
+}
+
+double measureLoadTime(const std::string& aURI, size_t& aNrNodes)
+{
+  // Clear in-memory cache, to emulate a fresh process
+  uhal::NodeTreeBuilder::getInstance().clearAddressFileCache();
+
+  const Clock_t::time_point lStart = Clock_t::now();
+  uhal::Node* lNode = uhal::NodeTreeBuilder::getInstance().getNodeTree(aURI, boost::filesystem::current_path() / ".");
+  const Clock_t::time_point lEnd = Clock_t::now();
+
+  aNrNodes = 0;
+  for (uhal::Node::const_iterator lIt = lNode->begin(); lIt != lNode->end(); lIt++)
+    aNrNodes++;
+  delete lNode;
+
+  return std::chrono::duration<double, std::milli>(lEnd - lStart).count();
+}
+
+void measureAndPrint(const std::string& aName, const std::string& aURI)
+{
+  size_t lNrNodes = 0;
+  const double lTime = measureLoadTime(aURI, lNrNodes);
+
+  std::cout << "  " << std::left << std::setw(32) << aName << std::right << std::fixed << std::setprecision(1)
+            << std::setw(12) << lTime << std::setw(12) << lNrNodes << std::endl;
+}
+
+}
+
+
+int main ( int argc, char* argv[] )
+{
+  std::string lDirectory;
+  size_t lNrModules, lNrRegisters;
+
+  po::options_description lDescriptions ( "Allowed options" );
+  lDescriptions.add_options()
+  ( "help,h", "Produce help message" )
+  ( "directory,d", po::value<std::string> ( &lDirectory )->default_value ( "/tmp/uhal_address_table_cache_benchmark" ), "Directory in which the synthetic address table and cache are created" )
+  ( "modules,m", po::value<size_t> ( &lNrModules )->default_value ( 100 ), "Number of module files" )
+  ( "registers,r", po::value<size_t> ( &lNrRegisters )->default_value ( 500 ), "Number of registers per module (every fourth register has 3 bit-field children)" );
+
+  po::variables_map lArgMap;
+  po::store ( po::parse_command_line ( argc, argv, lDescriptions ), lArgMap );
+  po::notify ( lArgMap );
+
+  if ( lArgMap.count ( "help" ) )
+  {
+    std::cout << lDescriptions << std::endl;
+    return 0;
+  }
+
+  uhal::setLogLevelTo ( uhal::Warning() );
+
+  const boost::filesystem::path lTableDir ( boost::filesystem::path ( lDirectory ) / "table" );
+  const boost::filesystem::path lCacheDir ( boost::filesystem::path ( lDirectory ) / "cache" );
+  boost::filesystem::remove_all ( lDirectory );
+  boost::filesystem::create_directories ( lTableDir );
+  writeAddressTable ( lTableDir , lNrModules , lNrRegisters );
+  const std::string lURI ( "file://" + ( lTableDir / "top.xml" ).string() );
+
+  uhal::NodeTreeBuilder& lBuilder ( uhal::NodeTreeBuilder::getInstance() );
+
+  std::cout << "Loading " << lURI << " (" << lNrModules << " modules, " << lNrRegisters << " registers per module)" << std::endl;
+  std::cout << "  " << std::left << std::setw(32) << "Method" << std::right << std::setw(12) << "Time (ms)" << std::setw(12) << "Nodes" << std::endl;
+
+  lBuilder.setCacheDirectory ( "" );
+  measureAndPrint ( "XML, cache disabled" , lURI );
+
+  lBuilder.setCacheDirectory ( lCacheDir );
+  measureAndPrint ( "XML, writing cache entry" , lURI );
+  measureAndPrint ( "Cache entry" , lURI );
+
+  for ( boost::filesystem::directory_iterator lIt ( lCacheDir ); lIt != boost::filesystem::directory_iterator(); lIt++ )
+  {
+    std::cout << "Cache entry size: " << boost::filesystem::file_size ( lIt->path() ) << " bytes" << std::endl;
+  }
+
+  lBuilder.setCacheDirectory ( "" );
+  boost::filesystem::remove_all ( lDirectory );
+  return 0;
+}
@@ -0,0 +1,147 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+/**
+  Benchmark of the time taken to create many devices from a connection file (as in a crate controller), by calling
+  getDevice for each device and by creating them all at once with getAllDevices. The devices use a configurable
+  number of synthetic address tables; the hostname in the device URIs can be set in order to include DNS look-ups.
+*/
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include "uhal/ConnectionManager.hpp"
+#include "uhal/log/log.hpp"
+#include "uhal/NodeTreeBuilder.hpp"
+
+
+namespace po = boost::program_options;
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock_t;
+
+void writeFiles(const boost::filesystem::path& aDirectory, const size_t aNrDevices, const size_t aNrTables, const std::string& aHostname)
+{
+  std::ofstream lConnectionFile((aDirectory / "connections.xml").c_str());
+  lConnectionFile << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<connections>\n";
+  for (size_t i = 0; i < aNrDevices; i++)
+    lConnectionFile << "  <connection id=\"device" << i << "\" uri=\"ipbusudp-2.0://" << aHostname << ":" << (50001 + i)
+                    << "\" address_table=\"file://table" << (i % aNrTables) << ".xml\"/>\n";
+  lConnectionFile << "</connections>\n";
+
+  for (size_t i = 0; i < aNrTables; i++) {
+    std::ofstream lTableFile((aDirectory / ("table" + std::to_string(i) + ".xml")).c_str());
+    lTableFile << "<node>\n";
+    for (size_t j = 0; j < 200; j++)
+      lTableFile << "  <node id=\"REG" << j << "\" address=\"0x" << std::hex << j << std::dec << "\"/>\n";
+    lTableFile << "</node>\n";
+  }
+}
+
+void printResult(const std::string& aName, const Clock_t::time_point& aStart, const size_t aNrDevices)
+{
+  const double lTime = std::chrono::duration<double, std::milli>(Clock_t::now() - aStart).count();
+  std::cout << "  " << std::left << std::setw(32) << aName << std::right << std::fixed << std::setprecision(1)
+            << std::setw(12) << lTime << std::setw(12) << aNrDevices << std::endl;
+}
+
+}
+
+
+int main ( int argc, char* argv[] )
+{
+  std::string lDirectory, lHostname;
+  size_t lNrDevices, lNrTables;
+
+  po::options_description lDescriptions ( "Allowed options" );
+  lDescriptions.add_options()
+  ( "help,h", "Produce help message" )
+  ( "directory,d", po::value<std::string> ( &lDirectory )->default_value ( "/tmp/uhal_device_startup_benchmark" ), "Directory in which the connection and address files are created" )
+  ( "devices,n", po::value<size_t> ( &lNrDevices )->default_value ( 500 ), "Number of devices" )
+  ( "tables,t", po::value<size_t> ( &lNrTables )->default_value ( 4 ), "Number of distinct address tables" )
+  ( "hostname", po::value<std::string> ( &lHostname )->default_value ( "localhost" ), "Hostname used in the device URIs" );
+
+  po::variables_map lArgMap;
+  po::store ( po::parse_command_line ( argc, argv, lDescriptions ), lArgMap );
+  po::notify ( lArgMap );
+
+  if ( lArgMap.count ( "help" ) )
+  {
+    std::cout << lDescriptions << std::endl;
+    return 0;
+  }
+
+  uhal::setLogLevelTo ( uhal::Warning() );
+
+  boost::filesystem::remove_all ( lDirectory );
+  boost::filesystem::create_directories ( lDirectory );
+  writeFiles ( lDirectory , lNrDevices , lNrTables , lHostname );
+  const std::string lConnectionFile ( "file://" + ( boost::filesystem::path ( lDirectory ) / "connections.xml" ).string() );
+
+  std::cout << "Creating " << lNrDevices << " devices (" << lNrTables << " address tables, hostname " << lHostname << ")" << std::endl;
+  std::cout << "  " << std::left << std::setw(32) << "Method" << std::right << std::setw(12) << "Time (ms)" << std::setw(12) << "Devices" << std::endl;
+
+  {
+    uhal::NodeTreeBuilder::getInstance().clearAddressFileCache();
+    const Clock_t::time_point lStart = Clock_t::now();
+    uhal::ConnectionManager lManager ( lConnectionFile );
+    std::vector<uhal::HwInterface> lDevices;
+    for ( const std::string& lId : lManager.getDevices() )
+      lDevices.push_back ( lManager.getDevice ( lId ) );
+    printResult ( "getDevice, for each device" , lStart , lDevices.size() );
+  }
+
+  {
+    uhal::NodeTreeBuilder::getInstance().clearAddressFileCache();
+    const Clock_t::time_point lStart = Clock_t::now();
+    uhal::ConnectionManager lManager ( lConnectionFile );
+    const std::vector<uhal::HwInterface> lDevices ( lManager.getAllDevices() );
+    printResult ( "getAllDevices" , lStart , lDevices.size() );
+  }
+
+  boost::filesystem::remove_all ( lDirectory );
+  return 0;
+}
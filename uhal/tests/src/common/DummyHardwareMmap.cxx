@@ -0,0 +1,114 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+#include "uhal/log/log.hpp"
+#include "uhal/tests/MmapDummyHardware.hpp"
+
+
+namespace po = boost::program_options;
+using namespace uhal;
+using namespace uhal::tests;
+
+
+int main ( int argc, char* argv[] )
+{
+  std::string lPath, lErrorType;
+  uint32_t lDelay, lLatency, lErrorPeriod;
+
+  po::options_description lDescriptions ( "Allowed options" );
+  lDescriptions.add_options()
+  ( "help,h", "Produce help message" )
+  ( "file,f", po::value<std::string> ( &lPath )->default_value ( "/dev/shm/uhal_mmap_dummy" ), "Path of memory-mapped file shared with the client" )
+  ( "delay,d", po::value<uint32_t> ( &lDelay )->default_value ( 0 ), "Reply delay for first packet (in seconds) - optional" )
+  ( "latency,l", po::value<uint32_t> ( &lLatency )->default_value ( 0 ), "Latency added to every reply (in microseconds) - optional" )
+  ( "error,e", po::value<std::string> ( &lErrorType ), "Type of error to inject into replies ('drop' or 'corrupt') - optional" )
+  ( "error-period,p", po::value<uint32_t> ( &lErrorPeriod )->default_value ( 100 ), "Error is injected into every N'th reply" )
+  ( "verbose,v", "Verbose output" );
+
+  po::variables_map lArgMap;
+  try
+  {
+    po::store ( po::parse_command_line ( argc, argv, lDescriptions ), lArgMap );
+    po::notify ( lArgMap );
+  }
+  catch ( std::exception& e )
+  {
+    std::cerr << "ERROR : " << e.what() << std::endl << std::endl;
+    std::cout << "Usage : " << argv[0] << " [OPTIONS]" << std::endl;
+    std::cout << lDescriptions << std::endl;
+    return 1;
+  }
+
+  if ( lArgMap.count ( "help" ) )
+  {
+    std::cout << "Usage : " << argv[0] << " [OPTIONS]" << std::endl;
+    std::cout << lDescriptions << std::endl;
+    return 0;
+  }
+
+  MmapDummyHardware::ErrorType lError = MmapDummyHardware::NO_ERROR;
+  if ( lArgMap.count ( "error" ) )
+  {
+    if ( lErrorType == "drop" )
+      lError = MmapDummyHardware::DROP_REPLY;
+    else if ( lErrorType == "corrupt" )
+      lError = MmapDummyHardware::CORRUPT_REPLY;
+    else
+    {
+      std::cerr << "ERROR : Invalid error type '" << lErrorType << "' (must be 'drop' or 'corrupt')" << std::endl;
+      return 1;
+    }
+  }
+
+  if ( lArgMap.count ( "verbose" ) )
+    setLogLevelTo ( Debug() );
+  else
+    setLogLevelTo ( Notice() );
+
+  MmapDummyHardware lDummyHardware ( lPath, lDelay, false );
+  lDummyHardware.setReplyLatency ( std::chrono::microseconds ( lLatency ) );
+  if ( lError != MmapDummyHardware::NO_ERROR )
+    lDummyHardware.setErrorInjection ( lError, lErrorPeriod );
+
+  std::cout << "Clients should use URI: " << MmapDummyHardware::getClientURI ( lPath ) << " (user-defined client from the uHAL tests library)" << std::endl;
+  lDummyHardware.run();
+
+  return 0;
+}
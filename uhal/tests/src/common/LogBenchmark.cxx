@@ -0,0 +1,150 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+/**
+  Benchmark of the logging backends: the rate of log calls made by several threads concurrently, with entries written
+  synchronously under the global logging mutex, with the asynchronous backend and with the binary backend. Text output is
+  written to /dev/null, and binary output to files in /tmp; the time taken by the log calls themselves is reported separately
+  from the total time (i.e. until all entries have been written).
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <boost/program_options.hpp>
+
+#include "uhal/log/log.hpp"
+
+
+namespace po = boost::program_options;
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock_t;
+
+// Representative of the warnings logged on the transport threads, e.g. for timeouts
+template <typename Level>
+void logEntries(Level& aLevel, const size_t aThreadIndex, const size_t aNrEntries)
+{
+  const std::string lTarget("board-" + std::to_string(aThreadIndex) + ".crate.example.org:50001");
+  for (size_t i = 0; i < aNrEntries; i++)
+    uhal::log(aLevel, "Timeout after ", uhal::Integer(uint32_t(1000 + i % 20)), " ms waiting for reply to packet ",
+              uhal::Integer(uint32_t(i), uhal::IntFmt<uhal::hex, uhal::fixed>()), " from ", lTarget);
+}
+
+template <typename Level>
+void run(const std::string& aName, Level& aLevel, const size_t aNrThreads, const size_t aNrEntries, std::streambuf* aConsole)
+{
+  std::ofstream lNull("/dev/null");
+  std::streambuf* lStdout = std::cout.rdbuf(lNull.rdbuf());
+  const uint64_t lDroppedBefore = uhal::GetDroppedLogEntryCount();
+
+  const Clock_t::time_point lStart = Clock_t::now();
+  std::vector<std::thread> lThreads;
+  for (size_t i = 0; i < aNrThreads; i++)
+    lThreads.push_back(std::thread(logEntries<Level>, std::ref(aLevel), i, aNrEntries));
+  for (std::thread& lThread : lThreads)
+    lThread.join();
+  const double lCallTime = std::chrono::duration<double>(Clock_t::now() - lStart).count();
+  uhal::flushLog();
+  const double lTotalTime = std::chrono::duration<double>(Clock_t::now() - lStart).count();
+
+  std::cout.rdbuf(lStdout);
+  const uint64_t lDropped = uhal::GetDroppedLogEntryCount() - lDroppedBefore;
+  const double lNrCalls = aNrThreads * aNrEntries;
+  std::ostream lConsole(aConsole);
+  lConsole << "  " << std::left << std::setw(24) << aName << std::right << std::fixed << std::setprecision(2)
+           << std::setw(16) << (lNrCalls / lCallTime / 1e6) << std::setw(16) << (1e3 * lCallTime) << std::setw(16) << (1e3 * lTotalTime)
+           << std::setw(16) << lDropped << std::endl;
+}
+
+}
+
+
+int main ( int argc, char* argv[] )
+{
+  size_t lNrThreads, lNrEntries, lBufferSize;
+
+  po::options_description lDescriptions ( "Allowed options" );
+  lDescriptions.add_options()
+  ( "help,h", "Produce help message" )
+  ( "threads,t", po::value<size_t> ( &lNrThreads )->default_value ( 16 ), "Number of logging threads" )
+  ( "entries,n", po::value<size_t> ( &lNrEntries )->default_value ( 100000 ), "Number of log entries per thread" )
+  ( "buffer,b", po::value<size_t> ( &lBufferSize )->default_value ( 1 << 20 ), "Size of each thread's buffer (bytes) in asynchronous mode" );
+
+  po::variables_map lArgMap;
+  po::store ( po::parse_command_line ( argc, argv, lDescriptions ), lArgMap );
+  po::notify ( lArgMap );
+
+  if ( lArgMap.count ( "help" ) )
+  {
+    std::cout << lDescriptions << std::endl;
+    return 0;
+  }
+
+  uhal::setLogLevelTo(uhal::Notice());
+
+  std::cout << "Logging " << lNrEntries << " entries from each of " << lNrThreads << " threads" << std::endl;
+  std::cout << "  " << std::left << std::setw(24) << "Backend" << std::right << std::setw(16) << "Calls/s (M)" << std::setw(16) << "Calls (ms)"
+            << std::setw(16) << "Total (ms)" << std::setw(16) << "Dropped" << std::endl;
+
+  // Entries below the log level should only cost a check of the level
+  run("Disabled level", uhal::Debug(), lNrThreads, lNrEntries, std::cout.rdbuf());
+  run("Synchronous", uhal::Notice(), lNrThreads, lNrEntries, std::cout.rdbuf());
+  uhal::enableAsyncLogging(lBufferSize);
+  run("Asynchronous", uhal::Notice(), lNrThreads, lNrEntries, std::cout.rdbuf());
+  uhal::disableAsyncLogging();
+  const std::string lBinaryPath("/tmp/uhal_log_benchmark_" + std::to_string(getpid()));
+  uhal::enableBinaryLogging(lBinaryPath);
+  run("Binary", uhal::Notice(), lNrThreads, lNrEntries, std::cout.rdbuf());
+  uhal::disableBinaryLogging();
+  // Only the most recent files are kept, so remove files until one is missing after the first that is found
+  for (size_t i = 0, lFound = 0; lFound < 2; i++)
+    lFound = (std::remove((lBinaryPath + "." + std::to_string(i)).c_str()) == 0) ? 1 : 2 * lFound;
+
+  return 0;
+}
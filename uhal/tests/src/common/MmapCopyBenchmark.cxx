@@ -0,0 +1,166 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+/**
+  Benchmark of the MMIO block copy kernels used by the mmap client, against an emulated BAR
+  (i.e. a file in /dev/shm that is mapped into memory in the same way as a device file).
+*/
+
+#include <chrono>
+#include <fcntl.h>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string.h>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "uhal/utilities/mmio.hpp"
+
+
+namespace po = boost::program_options;
+using namespace uhal::utilities;
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock_t;
+
+double measureThroughput(const std::function<void ()>& aFunction, const size_t aNrBytes, const size_t aIterations)
+{
+  aFunction();
+
+  const Clock_t::time_point lStart = Clock_t::now();
+  for (size_t i = 0; i < aIterations; i++)
+    aFunction();
+  const Clock_t::time_point lEnd = Clock_t::now();
+
+  const double lSeconds = std::chrono::duration<double>(lEnd - lStart).count();
+  return (double(aNrBytes) * aIterations) / lSeconds / 1e6;
+}
+
+void printResult(const std::string& aName, const double aReadThroughput, const double aWriteThroughput)
+{
+  std::cout << "  " << std::left << std::setw(24) << aName << std::right << std::fixed << std::setprecision(1)
+            << std::setw(12) << aReadThroughput << std::setw(12) << aWriteThroughput << std::endl;
+}
+
+}
+
+
+int main ( int argc, char* argv[] )
+{
+  std::string lPath;
+  size_t lNrWords, lIterations;
+
+  po::options_description lDescriptions ( "Allowed options" );
+  lDescriptions.add_options()
+  ( "help,h", "Produce help message" )
+  ( "file,f", po::value<std::string> ( &lPath )->default_value ( "/dev/shm/uhal_mmap_copy_benchmark" ), "Path of file used to emulate the BAR" )
+  ( "words,w", po::value<size_t> ( &lNrWords )->default_value ( 8192 ), "Number of 32-bit words per transfer" )
+  ( "iterations,i", po::value<size_t> ( &lIterations )->default_value ( 10000 ), "Number of transfers per measurement" );
+
+  po::variables_map lArgMap;
+  po::store ( po::parse_command_line ( argc, argv, lDescriptions ), lArgMap );
+  po::notify ( lArgMap );
+
+  if ( lArgMap.count ( "help" ) )
+  {
+    std::cout << lDescriptions << std::endl;
+    return 0;
+  }
+
+  const size_t lNrBytes = 4 * lNrWords;
+  const int lFd = open ( lPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600 );
+  if ( ( lFd == -1 ) || ( ftruncate ( lFd, lNrBytes ) == -1 ) )
+  {
+    std::cerr << "ERROR: Could not create " << lNrBytes << "-byte file " << lPath << std::endl;
+    return 1;
+  }
+
+  void* lMmapPtr = mmap ( 0, lNrBytes, PROT_READ | PROT_WRITE, MAP_SHARED, lFd, 0 );
+  if ( lMmapPtr == MAP_FAILED )
+  {
+    std::cerr << "ERROR: Could not map " << lPath << " into memory" << std::endl;
+    close ( lFd );
+    unlink ( lPath.c_str() );
+    return 1;
+  }
+
+  std::vector<uint32_t> lSource ( lNrWords ), lReadValues;
+  for ( size_t i = 0; i < lNrWords; i++ )
+    lSource.at(i) = i;
+
+  std::cout << "Copying " << lNrBytes << " bytes to/from " << lPath << ", " << lIterations << " iterations" << std::endl;
+  std::cout << "  " << std::left << std::setw(24) << "Kernel" << std::right << std::setw(12) << "Read MB/s" << std::setw(12) << "Write MB/s" << std::endl;
+
+  // Baseline: word-by-word push_back loop used by Mmap::File::read before the copy kernels were introduced
+  const double lBaselineRead = measureThroughput([&] () {
+      lReadValues.clear();
+      const uint32_t* lSrc = static_cast<const uint32_t*>(lMmapPtr);
+      for (size_t i = 0; i < lNrWords; i++)
+        lReadValues.push_back(lSrc[i]);
+    }, lNrBytes, lIterations);
+  const double lBaselineWrite = measureThroughput([&] () { memcpy ( lMmapPtr, lSource.data(), lNrBytes ); }, lNrBytes, lIterations);
+  printResult ( "baseline (loop/memcpy)", lBaselineRead, lBaselineWrite );
+
+  const std::vector<mmio::CopyKernel> lKernels = mmio::getSupportedKernels();
+  for ( std::vector<mmio::CopyKernel>::const_iterator lIt = lKernels.begin(); lIt != lKernels.end(); lIt++ )
+  {
+    const mmio::CopyKernel lKernel = *lIt;
+    const double lRead = measureThroughput([&] () {
+        lReadValues.resize(lNrWords);
+        mmio::read ( lReadValues.data(), lMmapPtr, lNrWords, lKernel );
+      }, lNrBytes, lIterations);
+    const double lWrite = measureThroughput([&] () { mmio::write ( lMmapPtr, lSource.data(), lNrBytes, lKernel ); }, lNrBytes, lIterations);
+    printResult ( mmio::getName ( lKernel ) + ( lKernel == mmio::getDefaultKernel() ? " (default)" : "" ), lRead, lWrite );
+
+    if ( lReadValues != lSource )
+    {
+      std::cerr << "ERROR: Data read back using " << mmio::getName ( lKernel ) << " kernel does not match data written" << std::endl;
+      return 1;
+    }
+  }
+
+  munmap ( lMmapPtr, lNrBytes );
+  close ( lFd );
+  unlink ( lPath.c_str() );
+  return 0;
+}
@@ -0,0 +1,258 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/tests/MmapDummyHardware.hpp"
+
+
+#include <atomic>
+#include <cassert>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdexcept>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include "uhal/ClientFactory.hpp"
+#include "uhal/log/LogLevels.hpp"
+#include "uhal/log/log_inserters.integer.hpp"
+#include "uhal/log/log_inserters.quote.hpp"
+#include "uhal/log/log.hpp"
+
+
+namespace uhal {
+namespace tests {
+
+MmapDummyHardware::MmapDummyHardware(const std::string& aFilePath, const uint32_t& aReplyDelay, const bool& aBigEndianHack) :
+  DummyHardware<2, 0>(aReplyDelay, aBigEndianHack),
+  mFilePath(aFilePath),
+  // Same size as default mapped region in mmap client
+  mFileSize(32 * 1024 + 16),
+  mFd(-1),
+  mMemory(NULL),
+  mNumberOfPages(4),
+  mWordsPerPage(512),
+  mNextPageIndex(0),
+  mPublishedPageCount(0),
+  mStop(false),
+  mReplyLatency(std::chrono::microseconds(0)),
+  mErrorType(NO_ERROR),
+  mErrorPeriod(0),
+  mNrPacketsReceived(0)
+{
+  assert ((4 + mNumberOfPages * mWordsPerPage) * 4 <= REQUEST_DOORBELL_OFFSET);
+  assert (REQUEST_OFFSET + mNumberOfPages * mWordsPerPage * 4 <= mFileSize);
+
+  log(Debug(), "mmap dummy hardware is creating file ", Quote (mFilePath));
+  mFd = open(mFilePath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+  if ( mFd < 0 )
+    throw std::runtime_error("Cannot create mmap dummy hardware file '" + mFilePath + "', errno=" + std::to_string(errno));
+
+  if ( ftruncate(mFd, mFileSize) != 0 ) {
+    close(mFd);
+    throw std::runtime_error("Cannot resize mmap dummy hardware file '" + mFilePath + "', errno=" + std::to_string(errno));
+  }
+
+  void* lPtr = mmap(0, mFileSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+  if ( lPtr == MAP_FAILED ) {
+    close(mFd);
+    throw std::runtime_error("Cannot map mmap dummy hardware file '" + mFilePath + "' into memory, errno=" + std::to_string(errno));
+  }
+  mMemory = static_cast<volatile uint32_t*>(lPtr);
+
+  mMemory[0] = mNumberOfPages;
+  mMemory[1] = mWordsPerPage;
+  mMemory[2] = mNextPageIndex;
+  mMemory[3] = mPublishedPageCount;
+  mMemory[REQUEST_DOORBELL_OFFSET / 4] = mNrPacketsReceived;
+
+  log(Notice(), "Starting IPbus 2.0 mmap dummy hardware ", Quote(mFilePath), "; ", Integer(mNumberOfPages), " pages, ", Integer(mWordsPerPage), " words per page");
+}
+
+
+MmapDummyHardware::~MmapDummyHardware()
+{
+  log(Notice(), "Destroying IPbus 2.0 mmap dummy hardware ", Quote(mFilePath));
+
+  if (munmap(const_cast<uint32_t*>(mMemory), mFileSize))
+    log(Fatal(), "Problem occurred when unmapping ", Quote(mFilePath), " during dummy hardware destruction");
+  if (close(mFd))
+    log(Fatal(), "Problem occurred when closing ", Quote(mFilePath), " during dummy hardware destruction");
+  if (remove(mFilePath.c_str()))
+    log(Fatal(), "Problem occurred when removing ", Quote(mFilePath), " during dummy hardware destruction");
+}
+
+
+void MmapDummyHardware::run()
+{
+  log(Info(), "Entering run method for IPbus 2.0 mmap dummy hardware ", Quote(mFilePath));
+
+  while ( !mStop ) {
+    // The doorbell is written after the request, so once it has been incremented the whole request is visible
+    if (mMemory[REQUEST_DOORBELL_OFFSET / 4] == mNrPacketsReceived) {
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+      continue;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    const uint32_t lPageHeader = mMemory[(REQUEST_OFFSET / 4) + mNextPageIndex * mWordsPerPage];
+    const uint32_t lNrWordsInRequestPacket = (lPageHeader >> 16) + (lPageHeader & 0xFFFF);
+    if (lNrWordsInRequestPacket >= mWordsPerPage) {
+      log(Fatal(), "MmapDummyHardware::run  -  returning early since receiving ", Integer(lNrWordsInRequestPacket), "-word packet, but there's only ", Integer(mWordsPerPage), " words per page");
+      return;
+    }
+
+    mReceive.clear();
+    readWords(REQUEST_OFFSET / 4 + mNextPageIndex * mWordsPerPage + 1, lNrWordsInRequestPacket, mReceive);
+    mNrPacketsReceived++;
+
+    log(Info(), "IPbus 2.0 mmap dummy hardware ", Quote(mFilePath), " : read ", Integer(lNrWordsInRequestPacket), "-word packet from page ", Integer(mNextPageIndex));
+
+    const std::chrono::microseconds lReplyLatency(mReplyLatency.load());
+    if (lReplyLatency > std::chrono::microseconds(0))
+      std::this_thread::sleep_for(lReplyLatency);
+
+    mReply.clear();
+    AnalyzeReceivedAndCreateReply(4 * lNrWordsInRequestPacket);
+
+    const uint32_t lErrorPeriod = mErrorPeriod.load(std::memory_order_acquire);
+    const ErrorType lErrorType = mErrorType.load(std::memory_order_relaxed);
+    const bool lInjectError = (lErrorPeriod != 0) and ((mNrPacketsReceived % lErrorPeriod) == 0);
+    if (lInjectError and (lErrorType == DROP_REPLY)) {
+      log(Notice(), "IPbus 2.0 mmap dummy hardware ", Quote(mFilePath), " : dropping reply to packet ", Integer(mNrPacketsReceived), " (error injection)");
+      continue;
+    }
+    if (lInjectError and (lErrorType == CORRUPT_REPLY) and (not mReply.empty())) {
+      log(Notice(), "IPbus 2.0 mmap dummy hardware ", Quote(mFilePath), " : corrupting reply to packet ", Integer(mNrPacketsReceived), " (error injection)");
+      mReply.at(0) ^= 0xFFFF0000;
+    }
+
+    publishReply();
+  }
+
+  log(Info(), "Exiting run method for IPbus 2.0 mmap dummy hardware ", Quote(mFilePath));
+}
+
+
+void MmapDummyHardware::stop()
+{
+  log(Info(), "Stopping IPbus 2.0 mmap dummy hardware ", Quote(mFilePath));
+  mStop = true;
+}
+
+
+std::string MmapDummyHardware::getClientURI(const std::string& aFilePath)
+{
+  return "ipbusmmapdummy-2.0://" + aFilePath;
+}
+
+
+void MmapDummyHardware::setReplyLatency(const std::chrono::microseconds& aLatency)
+{
+  mReplyLatency = aLatency;
+}
+
+
+void MmapDummyHardware::setErrorInjection(const ErrorType aType, const uint32_t aPeriod)
+{
+  // Period is published last (and read first), so that the responder thread never sees it with the previous error type
+  mErrorPeriod.store(0, std::memory_order_relaxed);
+  mErrorType.store(aType, std::memory_order_relaxed);
+  mErrorPeriod.store(aPeriod, std::memory_order_release);
+}
+
+
+void MmapDummyHardware::readWords(const size_t aAddr, const size_t aNrWords, std::vector<uint32_t>& aValues) const
+{
+  for (size_t i = 0; i < aNrWords; i++)
+    aValues.push_back(uint32_t(mMemory[aAddr + i]));
+}
+
+
+void MmapDummyHardware::publishReply()
+{
+  log(Info(), "IPbus 2.0 mmap dummy hardware ", Quote(mFilePath), " : writing ", Integer(mReply.size()), "-word reply to page ", Integer(mNextPageIndex));
+
+  volatile uint32_t* lReplyPage = mMemory + 4 + mNextPageIndex * mWordsPerPage;
+  lReplyPage[0] = 0x10000 | ((mReply.size() - 1) & 0xFFFF);
+  for (size_t i = 0; i < mReply.size(); i++)
+    lReplyPage[1 + i] = mReply.at(i);
+
+  mNextPageIndex = (mNextPageIndex + 1) % mNumberOfPages;
+  mPublishedPageCount++;
+
+  // Reply must be visible before the updated status
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  mMemory[2] = mNextPageIndex;
+  mMemory[3] = mPublishedPageCount;
+}
+
+
+
+
+MmapDummyClient::MmapDummyClient(const std::string& aId, const URI& aUri) :
+  Mmap(aId, aUri)
+{
+}
+
+
+MmapDummyClient::~MmapDummyClient()
+{
+}
+
+
+uint32_t MmapDummyClient::getRequestOffset() const
+{
+  return MmapDummyHardware::REQUEST_OFFSET;
+}
+
+
+void MmapDummyClient::notifyRequestWritten()
+{
+  // Request is written with a burst of (possibly weakly-ordered) stores, so must be visible before the doorbell.
+  // Clients only write requests while they hold the device lock, so the doorbell is never incremented concurrently.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  volatile uint32_t* lDoorbell = getWordPtr(MmapDummyHardware::REQUEST_DOORBELL_OFFSET / 4);
+  *lDoorbell = *lDoorbell + 1;
+}
+
+} // end ns tests
+} // end ns uhal
+
+
+UHAL_REGISTER_EXTERNAL_CLIENT(uhal::tests::MmapDummyClient, "ipbusmmapdummy-2.0", "Access to mmap dummy hardware (for tests), using IPbus version 2.0")
@@ -0,0 +1,320 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+/**
+  Benchmark of the memory footprint of node trees, and of the time taken by common tree walks (iteration, getNodes,
+  getNode and address look-ups, and copying), of the cost of creating and copying devices, and of the rate of look-ups of deep paths
+  (by full path, level by level, and via node handles), for a synthetic address table. Also measures the time taken to load a
+  synthetic hierarchy of module files, with the module files read sequentially and in parallel, and to reload it into a device.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <malloc.h>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include "uhal/ConnectionManager.hpp"
+#include "uhal/log/log.hpp"
+#include "uhal/Node.hpp"
+#include "uhal/NodeTreeBuilder.hpp"
+
+
+namespace po = boost::program_options;
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock_t;
+
+size_t getHeapUsage()
+{
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 33)))
+  return mallinfo2().uordblks;
+#else
+  return mallinfo().uordblks;
+#endif
+}
+
+void writeAddressTable(const boost::filesystem::path& aDirectory, const size_t aNrModules, const size_t aNrRegisters)
+{
+  std::ofstream lTopFile((aDirectory / "top.xml").c_str());
+  lTopFile << "<node>\n";
+
+  // All modules instances use the same file, as is typical for large address tables (e.g. one module per channel/link)
+  for (size_t i = 0; i < aNrModules; i++)
+    lTopFile << "  <node id=\"MODULE" << i << "\" address=\"0x" << std::hex << (i << 20) << std::dec << "\" module=\"file://module.xml\" fwinfo=\"endpoint;width=14\"/>\n";
+  lTopFile << "</node>\n";
+
+  std::ofstream lModuleFile((aDirectory / "module.xml").c_str());
+  lModuleFile << "<node description=\"Synthetic module\">\n";
+  for (size_t j = 0; j < aNrRegisters; j++) {
+    if (j % 4 == 0)
+      lModuleFile << "  <node id=\"CSR" << j << "\" address=\"0x" << std::hex << j << std::dec << "\">\n"
+                  << "    <node id=\"ENABLE\" mask=\"0x1\" tags=\"ctrl\"/>\n"
+                  << "    <node id=\"MODE\" mask=\"0xe\" parameters=\"default=2\"/>\n"
+                  << "    <node id=\"COUNT\" mask=\"0xffff0000\" permission=\"r\"/>\n"
+                  << "  </node>\n";
+    else
+      lModuleFile << "  <node id=\"REG" << j << "\" address=\"0x" << std::hex << j << std::dec << "\" permission=\"rw\" description=\"Register " << j << "\"/>\n";
+  }
+  lModuleFile << "</node>\n";
+}
+
+// Writes a two-level hierarchy of distinct module files (top -> groups -> leaves), returning the number of files
+size_t writeModuleHierarchy(const boost::filesystem::path& aDirectory, const size_t aNrGroups, const size_t aNrLeaves, const size_t aNrRegisters)
+{
+  boost::filesystem::create_directories(aDirectory / "leaves");
+
+  std::ofstream lTopFile((aDirectory / "top.xml").c_str());
+  lTopFile << "<node>\n";
+  for (size_t i = 0; i < aNrGroups; i++) {
+    lTopFile << "  <node id=\"GROUP" << i << "\" address=\"0x" << std::hex << (i << 24) << std::dec << "\" module=\"file://group" << i << ".xml\"/>\n";
+
+    std::ofstream lGroupFile((aDirectory / ("group" + std::to_string(i) + ".xml")).c_str());
+    lGroupFile << "<node>\n";
+    for (size_t j = 0; j < aNrLeaves; j++) {
+      lGroupFile << "  <node id=\"LEAF" << j << "\" address=\"0x" << std::hex << (j << 16) << std::dec << "\" module=\"file://leaves/leaf" << i << "_" << j << ".xml\"/>\n";
+
+      std::ofstream lLeafFile((aDirectory / "leaves" / ("leaf" + std::to_string(i) + "_" + std::to_string(j) + ".xml")).c_str());
+      lLeafFile << "<node>\n";
+      for (size_t k = 0; k < aNrRegisters; k++)
+        lLeafFile << "  <node id=\"REG" << k << "\" address=\"0x" << std::hex << k << std::dec << "\" description=\"Register " << k << " of leaf " << j << "\"/>\n";
+      lLeafFile << "</node>\n";
+    }
+    lGroupFile << "</node>\n";
+  }
+  lTopFile << "</node>\n";
+
+  return 1 + aNrGroups * (1 + aNrLeaves);
+}
+
+template <typename T>
+double measureTime(const T& aFunction, const size_t aIterations)
+{
+  const Clock_t::time_point lStart = Clock_t::now();
+  for (size_t i = 0; i < aIterations; i++)
+    aFunction();
+  const Clock_t::time_point lEnd = Clock_t::now();
+
+  return std::chrono::duration<double, std::milli>(lEnd - lStart).count() / aIterations;
+}
+
+void printResult(const std::string& aName, const double aTime)
+{
+  std::cout << "  " << std::left << std::setw(32) << aName << std::right << std::fixed << std::setprecision(2) << std::setw(12) << aTime << std::endl;
+}
+
+void printRate(const std::string& aName, const double aTime, const size_t aLookups)
+{
+  std::cout << "  " << std::left << std::setw(32) << aName << std::right << std::fixed << std::setprecision(2) << std::setw(12) << (aLookups / aTime / 1e3) << std::endl;
+}
+
+}
+
+
+int main ( int argc, char* argv[] )
+{
+  std::string lDirectory;
+  size_t lNrModules, lNrRegisters, lIterations, lNrGroups, lNrLeaves;
+
+  po::options_description lDescriptions ( "Allowed options" );
+  lDescriptions.add_options()
+  ( "help,h", "Produce help message" )
+  ( "directory,d", po::value<std::string> ( &lDirectory )->default_value ( "/tmp/uhal_node_tree_benchmark" ), "Directory in which the synthetic address table is created" )
+  ( "modules,m", po::value<size_t> ( &lNrModules )->default_value ( 50 ), "Number of module instances" )
+  ( "registers,r", po::value<size_t> ( &lNrRegisters )->default_value ( 1140 ), "Number of registers per module (every fourth register has 3 bit-field children)" )
+  ( "iterations,i", po::value<size_t> ( &lIterations )->default_value ( 10 ), "Number of iterations per measurement" )
+  ( "groups", po::value<size_t> ( &lNrGroups )->default_value ( 20 ), "Number of group module files in the module hierarchy" )
+  ( "leaves", po::value<size_t> ( &lNrLeaves )->default_value ( 24 ), "Number of leaf module files per group in the module hierarchy" );
+
+  po::variables_map lArgMap;
+  po::store ( po::parse_command_line ( argc, argv, lDescriptions ), lArgMap );
+  po::notify ( lArgMap );
+
+  if ( lArgMap.count ( "help" ) )
+  {
+    std::cout << lDescriptions << std::endl;
+    return 0;
+  }
+
+  uhal::setLogLevelTo ( uhal::Warning() );
+
+  boost::filesystem::remove_all ( lDirectory );
+  boost::filesystem::create_directories ( lDirectory );
+  writeAddressTable ( lDirectory , lNrModules , lNrRegisters );
+  const std::string lURI ( "file://" + ( boost::filesystem::path ( lDirectory ) / "top.xml" ).string() );
+
+  // First call parses the XML and stores tree in the builder's cache; subsequent calls return copies of that tree
+  uhal::NodeTreeBuilder& lBuilder ( uhal::NodeTreeBuilder::getInstance() );
+  std::unique_ptr<uhal::Node> lFirstNode ( lBuilder.getNodeTree ( lURI , boost::filesystem::current_path() / "." ) );
+
+  const size_t lHeapBefore = getHeapUsage();
+  std::unique_ptr<uhal::Node> lNode ( lBuilder.getNodeTree ( lURI , boost::filesystem::current_path() / "." ) );
+  const size_t lHeapAfter = getHeapUsage();
+
+  std::vector<std::string> lPaths ( lNode->getNodes() );
+  const size_t lNrNodes = lPaths.size() + 1;
+
+  std::cout << "Address table " << lURI << std::endl;
+  std::cout << "  Nodes:          " << lNrNodes << std::endl;
+  std::cout << "  Heap per tree:  " << ( lHeapAfter - lHeapBefore ) << " bytes" << std::endl;
+  std::cout << "  Heap per node:  " << std::fixed << std::setprecision(1) << double ( lHeapAfter - lHeapBefore ) / lNrNodes << " bytes" << std::endl;
+  std::cout << "  sizeof(Node):   " << sizeof ( uhal::Node ) << " bytes" << std::endl;
+  std::cout << std::endl;
+  std::cout << "  " << std::left << std::setw(32) << "Operation" << std::right << std::setw(12) << "Time (ms)" << std::endl;
+
+  uint32_t lChecksum = 0;
+  printResult ( "Iterate over all nodes" , measureTime ( [&] () {
+      for ( uhal::Node::const_iterator lIt = lNode->begin(); lIt != lNode->end(); lIt++ )
+        lChecksum += lIt->getAddress() ^ lIt->getMask();
+    }, lIterations ) );
+  printResult ( "getNodes()" , measureTime ( [&] () { lChecksum += lNode->getNodes().size(); } , lIterations ) );
+  printResult ( "getNode(path) for all nodes" , measureTime ( [&] () {
+      for ( std::vector<std::string>::const_iterator lIt = lPaths.begin(); lIt != lPaths.end(); lIt++ )
+        lChecksum += lNode->getNode ( *lIt ).getAddress();
+    }, lIterations ) );
+  printResult ( "getNodes(regex)" , measureTime ( [&] () { lChecksum += lNode->getNodes ( "MODULE1[0-9]\\..*\\.ENABLE" ).size(); } , lIterations ) );
+  printResult ( "getNodesMatchingGlob" , measureTime ( [&] () { lChecksum += lNode->getNodesMatchingGlob ( "MODULE1?.*.ENABLE" ).size(); } , lIterations ) );
+  printResult ( "getNodesWithPrefix" , measureTime ( [&] () { lChecksum += lNode->getNodesWithPrefix ( "MODULE1." ).size(); } , lIterations ) );
+  printResult ( "getNodesAtAddress, 1000 addresses" , measureTime ( [&] () {
+      for ( uint32_t i = 0; i < 1000; i++ )
+        lChecksum += lNode->getNodesAtAddress ( ( ( i % lNrModules ) << 20 ) + i ).size();
+    }, lIterations ) );
+  printResult ( "getPath() for all nodes" , measureTime ( [&] () {
+      for ( uhal::Node::const_iterator lIt = lNode->begin(); lIt != lNode->end(); lIt++ )
+        lChecksum += lIt->getPath().size();
+    }, lIterations ) );
+  printResult ( "Copy tree" , measureTime ( [&] () {
+      std::unique_ptr<uhal::Node> lCopy ( lBuilder.getNodeTree ( lURI , boost::filesystem::current_path() / "." ) );
+      lChecksum += lCopy->getSize();
+    }, lIterations ) );
+
+  const uhal::HwInterface lHw ( uhal::ConnectionManager::getDevice ( "device" , "ipbusudp-2.0://localhost:50001" , lURI ) );
+  lChecksum += lHw.getNode().getSize();
+  printResult ( "getDevice" , measureTime ( [&] () {
+      const uhal::HwInterface lDevice ( uhal::ConnectionManager::getDevice ( "device" , "ipbusudp-2.0://localhost:50001" , lURI ) );
+      lChecksum += lDevice.id().size();
+    }, lIterations ) );
+  printResult ( "getDevice, then getNode" , measureTime ( [&] () {
+      const uhal::HwInterface lDevice ( uhal::ConnectionManager::getDevice ( "device" , "ipbusudp-2.0://localhost:50001" , lURI ) );
+      lChecksum += lDevice.getNode ( lPaths.back() ).getAddress();
+    }, lIterations ) );
+  printResult ( "Copy HwInterface" , measureTime ( [&] () {
+      const uhal::HwInterface lCopy ( lHw );
+      lChecksum += lCopy.getNode().getSize();
+    }, lIterations ) );
+
+  // Deep paths (i.e. bit-fields within registers within modules), as typically used in polling loops
+  std::vector<std::string> lDeepPaths;
+  std::vector<uhal::Node::Handle> lHandles;
+  for ( std::vector<std::string>::const_iterator lIt = lPaths.begin(); lIt != lPaths.end(); lIt++ )
+  {
+    if ( std::count ( lIt->begin() , lIt->end() , '.' ) == 2 )
+    {
+      lDeepPaths.push_back ( *lIt );
+      lHandles.push_back ( lHw.getHandle ( *lIt ) );
+    }
+  }
+
+  std::cout << std::endl;
+  std::cout << "  " << std::left << std::setw(32) << "Deep path look-ups" << std::right << std::setw(12) << "(M/s)" << std::endl;
+  printRate ( "getNode(path)" , measureTime ( [&] () {
+      for ( std::vector<std::string>::const_iterator lIt = lDeepPaths.begin(); lIt != lDeepPaths.end(); lIt++ )
+        lChecksum += lHw.getNode ( *lIt ).getAddress();
+    }, lIterations ) , lDeepPaths.size() );
+  printRate ( "getNode(id) level by level" , measureTime ( [&] () {
+      for ( std::vector<std::string>::const_iterator lIt = lDeepPaths.begin(); lIt != lDeepPaths.end(); lIt++ )
+      {
+        const size_t lDot1 ( lIt->find ( '.' ) ) , lDot2 ( lIt->find ( '.' , lDot1 + 1 ) );
+        lChecksum += lHw.getNode ( lIt->substr ( 0 , lDot1 ) ).getNode ( lIt->substr ( lDot1 + 1 , lDot2 - lDot1 - 1 ) ).getNode ( lIt->substr ( lDot2 + 1 ) ).getAddress();
+      }
+    }, lIterations ) , lDeepPaths.size() );
+  printRate ( "getNode(handle)" , measureTime ( [&] () {
+      for ( std::vector<uhal::Node::Handle>::const_iterator lIt = lHandles.begin(); lIt != lHandles.end(); lIt++ )
+        lChecksum += lHw.getNode ( *lIt ).getAddress();
+    }, lIterations ) , lHandles.size() );
+
+  // Loading a hierarchy of distinct module files, from scratch each time
+  const boost::filesystem::path lHierarchyDirectory ( boost::filesystem::path ( lDirectory ) / "hierarchy" );
+  const size_t lNrFiles ( writeModuleHierarchy ( lHierarchyDirectory , lNrGroups , lNrLeaves , 100 ) );
+  const std::string lHierarchyURI ( "file://" + ( lHierarchyDirectory / "top.xml" ).string() );
+  const size_t lDefaultThreadCount ( lBuilder.getFileLoaderThreadCount() );
+  const size_t lThreadCounts[] = { 0 , 1 , 2 , 4 , 8 };
+
+  std::cout << std::endl;
+  std::cout << "  " << std::left << std::setw(32) << ( "Load " + std::to_string ( lNrFiles ) + " module files" ) << std::right << std::setw(12) << "Time (ms)" << std::endl;
+  for ( const size_t lThreadCount : lThreadCounts )
+  {
+    lBuilder.setFileLoaderThreadCount ( lThreadCount );
+    printResult ( lThreadCount == 0 ? std::string ( "Sequential" ) : ( "Parallel, " + std::to_string ( lThreadCount ) + " thread(s)" ) , measureTime ( [&] () {
+        lBuilder.clearAddressFileCache();
+        std::unique_ptr<uhal::Node> lHierarchy ( lBuilder.getNodeTree ( lHierarchyURI , boost::filesystem::current_path() / "." ) );
+        lChecksum += lHierarchy->getNodes().size();
+      }, lIterations ) );
+  }
+  lBuilder.setFileLoaderThreadCount ( lDefaultThreadCount );
+
+  // Reloading the hierarchy into a live device, when nothing has changed and when one leaf file has changed
+  lBuilder.clearAddressFileCache();
+  const uhal::HwInterface lHierarchyHw ( uhal::ConnectionManager::getDevice ( "device" , "ipbusudp-2.0://localhost:50001" , lHierarchyURI ) );
+  lChecksum += lHierarchyHw.getNode().getNodes().size();
+  uhal::ConnectionManager::reloadAddressFiles();
+  const boost::filesystem::path lLeafPath ( lHierarchyDirectory / "leaves" / "leaf0_0.xml" );
+  size_t lLeafVersion ( 0 );
+
+  std::cout << std::endl;
+  std::cout << "  " << std::left << std::setw(32) << "Reload into device" << std::right << std::setw(12) << "Time (ms)" << std::endl;
+  printResult ( "No changes" , measureTime ( [&] () {
+      lChecksum += uhal::ConnectionManager::reloadAddressFiles();
+    }, lIterations ) );
+  printResult ( "One leaf file changed" , measureTime ( [&] () {
+      std::ofstream ( lLeafPath.c_str() ) << "<node>\n  <node id=\"REG\" address=\"0x" << std::hex << ( ++lLeafVersion ) << std::dec << "\"/>\n</node>\n";
+      lChecksum += uhal::ConnectionManager::reloadAddressFiles();
+      lChecksum += lHierarchyHw.getNode ( "GROUP0.LEAF0.REG" ).getAddress();
+    }, lIterations ) );
+
+  std::cout << std::endl << "(Checksum: " << lChecksum << ")" << std::endl;
+
+  boost::filesystem::remove_all ( lDirectory );
+  return 0;
+}
@@ -85,7 +85,7 @@ PCIeDummyHardware::PCIeDummyHardware(const std::string& aDevicePathHostToFPGA, c
   fcntl(mDeviceFileHostToFPGA, F_SETFL, lFileFlags & ~O_NONBLOCK);
 
   log(Debug(), "PCIe dummy hardware is creating device-to-client file ", Quote (mDevicePathFPGAToHost));
-  mDeviceFileFPGAToHost = open(mDevicePathFPGAToHost.c_str(), O_RDWR | O_CREAT | O_DIRECTORY, 0666 /* permission */);
+  mDeviceFileFPGAToHost = open(mDevicePathFPGAToHost.c_str(), O_RDWR | O_CREAT, 0666 /* permission */);
   if ( mDeviceFileFPGAToHost < 0 ) {
     std::runtime_error lExc("Cannot open FPGA-to-host device file '" + mDevicePathFPGAToHost + "' (dummy hw)");
     throw lExc;
@@ -0,0 +1,172 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+
+/**
+  Benchmark of the parsers used when connecting to devices and building node trees: the time taken to parse device URIs
+  and node parameter/firmware info attribute strings with the boost::spirit grammars and with the hand-written parsers.
+*/
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/spirit/include/qi.hpp>
+
+#include "uhal/grammars/NodeTreeFirmwareInfoAttributeGrammar.hpp"
+#include "uhal/grammars/NodeTreeParametersGrammar.hpp"
+#include "uhal/grammars/Parsers.hpp"
+#include "uhal/grammars/URIGrammar.hpp"
+
+
+namespace po = boost::program_options;
+
+
+namespace {
+
+typedef std::chrono::steady_clock Clock_t;
+
+// Grammars are constructed once per string, as in ClientFactory::getClient
+template <typename Grammar, typename AttributeType>
+size_t parseWithGrammar(const std::vector<std::string>& aStrings)
+{
+  size_t lCount = 0;
+  for (const std::string& lString : aStrings) {
+    Grammar lGrammar;
+    AttributeType lAttribute;
+    std::string::const_iterator lBegin(lString.begin());
+    lCount += boost::spirit::qi::phrase_parse(lBegin, lString.end(), lGrammar, boost::spirit::ascii::space, lAttribute);
+  }
+  return lCount;
+}
+
+// ... or once in total, as in NodeTreeBuilder
+template <typename Grammar, typename AttributeType>
+size_t parseWithSharedGrammar(const std::vector<std::string>& aStrings)
+{
+  size_t lCount = 0;
+  Grammar lGrammar;
+  for (const std::string& lString : aStrings) {
+    AttributeType lAttribute;
+    std::string::const_iterator lBegin(lString.begin());
+    lCount += boost::spirit::qi::phrase_parse(lBegin, lString.end(), lGrammar, boost::spirit::ascii::space, lAttribute);
+  }
+  return lCount;
+}
+
+template <typename AttributeType, typename Parser>
+size_t parseWithParser(const std::vector<std::string>& aStrings, const Parser& aParser)
+{
+  size_t lCount = 0;
+  for (const std::string& lString : aStrings) {
+    AttributeType lAttribute;
+    lCount += aParser(lString, lAttribute);
+  }
+  return lCount;
+}
+
+template <typename Function>
+void run(const std::string& aName, const Function& aFunction, const size_t aNrStrings, const size_t aIterations)
+{
+  double lBestTime = 0;
+  size_t lCount = 0;
+  for (size_t i = 0; i < aIterations; i++) {
+    const Clock_t::time_point lStart = Clock_t::now();
+    lCount = aFunction();
+    const double lTime = std::chrono::duration<double, std::milli>(Clock_t::now() - lStart).count();
+    if (i == 0 or lTime < lBestTime)
+      lBestTime = lTime;
+  }
+
+  if (lCount != aNrStrings)
+    std::cout << "WARNING: Only " << lCount << " of " << aNrStrings << " strings parsed successfully" << std::endl;
+  std::cout << "  " << std::left << std::setw(40) << aName << std::right << std::fixed << std::setprecision(1)
+            << std::setw(12) << lBestTime << std::setw(16) << std::setprecision(0) << (1e6 * lBestTime / aNrStrings) << std::endl;
+}
+
+}
+
+
+int main ( int argc, char* argv[] )
+{
+  size_t lNrURIs, lNrAttributes, lIterations;
+
+  po::options_description lDescriptions ( "Allowed options" );
+  lDescriptions.add_options()
+  ( "help,h", "Produce help message" )
+  ( "uris,u", po::value<size_t> ( &lNrURIs )->default_value ( 10000 ), "Number of device URIs" )
+  ( "attributes,a", po::value<size_t> ( &lNrAttributes )->default_value ( 200000 ), "Number of node attribute strings (of each type)" )
+  ( "iterations,i", po::value<size_t> ( &lIterations )->default_value ( 5 ), "Number of iterations (the fastest is reported)" );
+
+  po::variables_map lArgMap;
+  po::store ( po::parse_command_line ( argc, argv, lDescriptions ), lArgMap );
+  po::notify ( lArgMap );
+
+  if ( lArgMap.count ( "help" ) )
+  {
+    std::cout << lDescriptions << std::endl;
+    return 0;
+  }
+
+  std::vector<std::string> lURIs, lParameters, lFirmwareInfo;
+  for (size_t i = 0; i < lNrURIs; i++) {
+    if (i % 2)
+      lURIs.push_back("ipbusudp-2.0://board-" + std::to_string(i) + ".crate.example.org:" + std::to_string(50001 + i % 1000));
+    else
+      lURIs.push_back("chtcp-2.0://localhost:10203?target=192.168." + std::to_string(i / 256 % 256) + "." + std::to_string(i % 256) + ":50001");
+  }
+  for (size_t i = 0; i < lNrAttributes; i++) {
+    lParameters.push_back("size=" + std::to_string(i % 4096) + ";depth=" + std::to_string(i % 32) + ";mode_" + std::to_string(i % 3) + "=fifo");
+    lFirmwareInfo.push_back("ipbus_ported_dpram;addr_width=" + std::to_string(i % 16) + ";data_width=32");
+  }
+
+  std::cout << "Parsing " << lNrURIs << " URIs and " << lNrAttributes << " node attribute strings of each type" << std::endl;
+  std::cout << "  " << std::left << std::setw(40) << "Method" << std::right << std::setw(12) << "Time (ms)" << std::setw(16) << "Per item (ns)" << std::endl;
+
+  run("URIs: URIGrammar", [&] () { return parseWithGrammar<uhal::grammars::URIGrammar, uhal::URI>(lURIs); }, lNrURIs, lIterations);
+  run("URIs: parseURI", [&] () { return parseWithParser<uhal::URI>(lURIs, uhal::grammars::parseURI); }, lNrURIs, lIterations);
+  run("Parameters: NodeTreeParametersGrammar", [&] () { return parseWithSharedGrammar<uhal::grammars::NodeTreeParametersGrammar, std::unordered_map<std::string, std::string> >(lParameters); }, lNrAttributes, lIterations);
+  run("Parameters: parseNodeTreeParameters", [&] () { return parseWithParser<std::unordered_map<std::string, std::string> >(lParameters, uhal::grammars::parseNodeTreeParameters); }, lNrAttributes, lIterations);
+  run("Firmware info: grammar", [&] () { return parseWithSharedGrammar<uhal::grammars::NodeTreeFirmwareinfoAttributeGrammar, uhal::NodeTreeFirmwareInfoAttribute>(lFirmwareInfo); }, lNrAttributes, lIterations);
+  run("Firmware info: parser", [&] () { return parseWithParser<uhal::NodeTreeFirmwareInfoAttribute>(lFirmwareInfo, uhal::grammars::parseNodeTreeFirmwareInfoAttribute); }, lNrAttributes, lIterations);
+
+  return 0;
+}
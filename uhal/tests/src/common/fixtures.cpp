@@ -2,6 +2,7 @@
 #include "uhal/tests/fixtures.hpp"
 
 
+#include "uhal/tests/MmapDummyHardware.hpp"
 #include "uhal/tests/PCIeDummyHardware.hpp"
 #include "uhal/tests/TCPDummyHardware.hpp"
 #include "uhal/tests/UDPDummyHardware.hpp"
@@ -12,6 +13,7 @@ namespace tests {
 
 
 std::string AbstractFixture::connectionFileURI = "";
+const std::vector<std::string> AbstractFixture::userClientActivationList(1, "ipbusmmapdummy-2.0");
 size_t AbstractFixture::timeout = 1;
 bool AbstractFixture::quickTest = false;
 
@@ -79,7 +81,7 @@ MinimalFixture<IPBUS_2_0_PCIE>::~MinimalFixture()
 
 HwInterface MinimalFixture<IPBUS_2_0_PCIE>::getHwInterface() const
 {
-  ConnectionManager manager(connectionFileURI);
+  ConnectionManager manager(connectionFileURI, userClientActivationList);
   HwInterface hw(manager.getDevice(deviceId));
   hw.setTimeoutPeriod(timeout);
   return hw;
@@ -89,6 +91,30 @@ HwInterface MinimalFixture<IPBUS_2_0_PCIE>::getHwInterface() const
 const DeviceType MinimalFixture<IPBUS_2_0_PCIE>::deviceType = IPBUS_2_0_PCIE;
 
 
+MinimalFixture<IPBUS_2_0_MMAP>::MinimalFixture() :
+  filePath("/dev/shm/uhal_mmap_dummy"),
+  deviceId("dummy.mmap2")
+{
+}
+
+
+MinimalFixture<IPBUS_2_0_MMAP>::~MinimalFixture()
+{
+}
+
+
+HwInterface MinimalFixture<IPBUS_2_0_MMAP>::getHwInterface() const
+{
+  ConnectionManager manager(connectionFileURI, userClientActivationList);
+  HwInterface hw(manager.getDevice(deviceId));
+  hw.setTimeoutPeriod(timeout);
+  return hw;
+}
+
+
+const DeviceType MinimalFixture<IPBUS_2_0_MMAP>::deviceType = IPBUS_2_0_MMAP;
+
+
 
 
 template <>
@@ -143,5 +169,11 @@ DummyHardwareFixture<IPBUS_2_0_PCIE>::DummyHardwareFixture() :
 {
 }
 
+template <>
+DummyHardwareFixture<IPBUS_2_0_MMAP>::DummyHardwareFixture() :
+  hwRunner(new MmapDummyHardware(filePath, 0, false))
+{
+}
+
 } // end ns tests
 } // end ns uhal
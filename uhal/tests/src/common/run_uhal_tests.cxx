@@ -58,6 +58,7 @@
 #include "uhal/tests/fixtures.hpp"
 #include "uhal/tests/tools.hpp"
 #include "uhal/log/log.hpp"
+#include "uhal/SigBusGuard.hpp"
 
 
 #ifdef BOOST_TEST_DYN_LINK
@@ -187,6 +188,9 @@ main( int argc, char* argv[] )
   }
   std::cout << std::endl << std::endl;
 
+  // The mmap client requires SIGBUS to be blocked in all threads (including those started by dummy hardware)
+  uhal::SigBusGuard::blockSIGBUS();
+
 
   std::vector<const char*> lArgvForBoostUTF;
   lArgvForBoostUTF.push_back(argv[0]);
@@ -0,0 +1,129 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/utilities/AdaptivePoller.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <thread>
+
+
+namespace uhal {
+namespace tests {
+
+
+BOOST_AUTO_TEST_SUITE( adaptive_poller )
+
+
+BOOST_AUTO_TEST_CASE( statistics )
+{
+  AdaptivePoller lPoller(std::chrono::microseconds(50));
+  BOOST_CHECK(lPoller.isAdaptive());
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPackets(), uint64_t(0));
+  BOOST_CHECK_EQUAL(lPoller.getMeanPollsPerPacket(), 0.0);
+
+  // Reply ready after 5 polls
+  size_t lNrPolls = 0;
+  lPoller.notifySent();
+  BOOST_CHECK(lPoller.wait([&] () { return (++lNrPolls == 5); }, std::chrono::seconds(1)));
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPackets(), uint64_t(1));
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPolls(), uint64_t(5));
+  BOOST_CHECK_EQUAL(lPoller.getLastPollsPerPacket(), uint32_t(5));
+  BOOST_CHECK(lPoller.getEstimatedRTT() > AdaptivePoller::Clock_t::duration::zero());
+
+  // Reply ready immediately
+  lPoller.notifySent();
+  BOOST_CHECK(lPoller.wait([] () { return true; }, std::chrono::seconds(1)));
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPackets(), uint64_t(2));
+  BOOST_CHECK_EQUAL(lPoller.getLastPollsPerPacket(), uint32_t(1));
+  BOOST_CHECK_EQUAL(lPoller.getMeanPollsPerPacket(), 3.0);
+
+  // Reply ready without polling
+  lPoller.notifySent();
+  lPoller.notifyReady();
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPackets(), uint64_t(3));
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPolls(), uint64_t(6));
+
+  lPoller.clearStats();
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPackets(), uint64_t(0));
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPolls(), uint64_t(0));
+  BOOST_CHECK(lPoller.getEstimatedRTT() == AdaptivePoller::Clock_t::duration::zero());
+}
+
+
+BOOST_AUTO_TEST_CASE( timeout )
+{
+  AdaptivePoller lPoller(std::chrono::microseconds(200));
+
+  const AdaptivePoller::Clock_t::time_point lStart = AdaptivePoller::Clock_t::now();
+  BOOST_CHECK(not lPoller.wait([] () { return false; }, std::chrono::milliseconds(20)));
+  BOOST_CHECK(AdaptivePoller::Clock_t::now() - lStart >= std::chrono::milliseconds(20));
+  BOOST_CHECK_EQUAL(lPoller.getNumberOfPackets(), uint64_t(0));
+  BOOST_CHECK(lPoller.getLastPollsPerPacket() > 0);
+}
+
+
+BOOST_AUTO_TEST_CASE( backoff )
+{
+  // Reply published 5ms after request sent: adaptive poller should take far fewer polls than pure spinning,
+  // but far more than fixed polling with the maximum sleep duration
+  const std::chrono::milliseconds lReplyDelay(5);
+
+  for (size_t i = 0; i < 2; i++) {
+    const bool lAdaptive = (i == 0);
+    AdaptivePoller lPoller(std::chrono::milliseconds(2));
+    lPoller.setAdaptive(lAdaptive);
+
+    lPoller.notifySent();
+    const AdaptivePoller::Clock_t::time_point lReplyTime = AdaptivePoller::Clock_t::now() + lReplyDelay;
+    BOOST_CHECK(lPoller.wait([&] () { return AdaptivePoller::Clock_t::now() >= lReplyTime; }, std::chrono::seconds(1)));
+    BOOST_CHECK(lPoller.getEstimatedRTT() >= lReplyDelay);
+
+    BOOST_TEST_MESSAGE((lAdaptive ? "Adaptive" : "Fixed") << " polling: " << lPoller.getLastPollsPerPacket() << " polls");
+    if (lAdaptive)
+      BOOST_CHECK(lPoller.getLastPollsPerPacket() < 1000);
+    else
+      BOOST_CHECK(lPoller.getLastPollsPerPacket() <= 4);
+  }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+} // end ns tests
+} // end ns uhal
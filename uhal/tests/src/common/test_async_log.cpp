@@ -0,0 +1,171 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+#include "uhal/log/log.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace uhal {
+namespace tests {
+
+
+struct AsyncLogFixture {
+  AsyncLogFixture() :
+    level(stream)
+  {
+    enableAsyncLogging();
+  }
+
+  ~AsyncLogFixture()
+  {
+    disableAsyncLogging();
+  }
+
+  // Returns the logged entries, without the head (i.e. time and thread ID) or tail
+  std::vector<std::string> getEntries()
+  {
+    std::vector<std::string> lEntries;
+    std::string lLine;
+    while (std::getline(stream, lLine)) {
+      const size_t lPos = lLine.find(" FATAL - ");
+      BOOST_REQUIRE(lPos != std::string::npos);
+      lEntries.push_back(lLine.substr(lPos + 9, lLine.size() - lPos - 9 - 4));
+    }
+    stream.clear();
+    return lEntries;
+  }
+
+  std::stringstream stream;
+  FatalLevel level;
+};
+
+
+BOOST_AUTO_TEST_SUITE( async_log )
+
+
+BOOST_FIXTURE_TEST_CASE(formatting, AsyncLogFixture)
+{
+  const std::string lString("string");
+  const char* lChars = "chars";
+  const uint32_t lValue = 0xC0FFEE;
+  const double lDouble = 1.5;
+
+  disableAsyncLogging();
+  log(level, "literal ", lString, ' ', lChars, ' ', Integer(lValue, IntFmt<hex, fixed>()), ' ', Quote(lString), ' ', lDouble, ' ', Integer(-1));
+  const std::vector<std::string> lExpected = getEntries();
+  BOOST_REQUIRE_EQUAL(lExpected.size(), size_t(1));
+
+  enableAsyncLogging();
+  log(level, "literal ", lString, ' ', lChars, ' ', Integer(lValue, IntFmt<hex, fixed>()), ' ', Quote(lString), ' ', lDouble, ' ', Integer(-1));
+  flushLog();
+  BOOST_CHECK(getEntries() == lExpected);
+
+  // Entries record the thread that made them
+  std::thread::id lThreadID;
+  std::thread lThread([&] () { lThreadID = std::this_thread::get_id(); log(level, "from thread"); });
+  lThread.join();
+  flushLog();
+  std::ostringstream lThreadIDString;
+  lThreadIDString << "[" << lThreadID << "]";
+  BOOST_CHECK(stream.str().find(lThreadIDString.str() + " FATAL - from thread") != std::string::npos);
+}
+
+
+BOOST_FIXTURE_TEST_CASE(ordering, AsyncLogFixture)
+{
+  const size_t lNrThreads = 4, lNrEntries = 1000;
+  std::vector<std::thread> lThreads;
+  for (size_t i = 0; i < lNrThreads; i++) {
+    lThreads.push_back(std::thread([this, i] () {
+      for (size_t j = 0; j < lNrEntries; j++)
+        log(level, Integer(uint32_t(i)), " ", Integer(uint32_t(j)));
+    }));
+  }
+  for (std::thread& lThread : lThreads)
+    lThread.join();
+  flushLog();
+
+  // Each thread's entries should all be written out, in order
+  std::vector<size_t> lNextEntry(lNrThreads, 0);
+  for (const std::string& lEntry : getEntries()) {
+    const size_t lThread = std::stoul(lEntry.substr(0, lEntry.find(' ')));
+    BOOST_REQUIRE(lThread < lNrThreads);
+    BOOST_CHECK_EQUAL(std::stoul(lEntry.substr(lEntry.find(' ') + 1)), lNextEntry.at(lThread)++);
+  }
+  BOOST_CHECK(lNextEntry == std::vector<size_t>(lNrThreads, lNrEntries));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(bounded_buffer, AsyncLogFixture)
+{
+  const size_t lNrEntries = 1000;
+  const uint64_t lDroppedBefore = GetDroppedLogEntryCount();
+  enableAsyncLogging(4096);
+
+  std::thread lThread([this] () {
+    // Stop the background thread from writing out entries, so that the buffer fills up
+    std::lock_guard<std::mutex> lLock(GetLoggingMutex());
+    for (size_t i = 0; i < lNrEntries; i++)
+      log(level, "entry ", Integer(uint32_t(i)));
+  });
+  lThread.join();
+  flushLog();
+
+  const std::vector<std::string> lEntries = getEntries();
+  const uint64_t lDropped = GetDroppedLogEntryCount() - lDroppedBefore;
+  BOOST_CHECK(lDropped > 0);
+  BOOST_CHECK_EQUAL(lEntries.size() + lDropped, lNrEntries);
+  for (size_t i = 0; i < lEntries.size(); i++)
+    BOOST_CHECK_EQUAL(lEntries.at(i), "entry " + std::to_string(i));
+
+  // Entries that are larger than half of the buffer are written out synchronously
+  std::thread lThread2([this] () { log(level, std::string(4000, 'x')); });
+  lThread2.join();
+  BOOST_CHECK(getEntries() == std::vector<std::string>(1, std::string(4000, 'x')));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
@@ -0,0 +1,218 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+
+#include "uhal/log/log.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+
+namespace uhal {
+namespace tests {
+
+
+struct BinaryLogArgument {
+  int value;
+};
+
+std::ostream& operator<<(std::ostream& aStr, const BinaryLogArgument& aArg)
+{
+  return aStr << "<" << aArg.value << ">";
+}
+
+
+struct BinaryLogFixture {
+  BinaryLogFixture() :
+    level(stream),
+    directory(boost::filesystem::temp_directory_path() / ("uhal_binary_log_" + std::to_string(getpid()))),
+    path((directory / "log").string())
+  {
+    boost::filesystem::create_directories(directory);
+  }
+
+  ~BinaryLogFixture()
+  {
+    disableBinaryLogging();
+    boost::filesystem::remove_all(directory);
+  }
+
+  // Returns the logged entries, without the head (i.e. time and thread ID) or tail
+  static std::vector<std::string> getEntries(std::istream& aStr)
+  {
+    std::vector<std::string> lEntries;
+    std::string lLine;
+    while (std::getline(aStr, lLine)) {
+      const size_t lPos = lLine.find(" FATAL - ");
+      BOOST_REQUIRE(lPos != std::string::npos);
+      lEntries.push_back(lLine.substr(lPos + 9, lLine.size() - lPos - 9 - 4));
+    }
+    return lEntries;
+  }
+
+  std::vector<std::string> decode(const std::vector<std::string>& aFiles)
+  {
+    std::stringstream lStr;
+    decodeBinaryLog(aFiles, lStr);
+    return getEntries(lStr);
+  }
+
+  std::stringstream stream;
+  FatalLevel level;
+  boost::filesystem::path directory;
+  std::string path;
+};
+
+
+BOOST_AUTO_TEST_SUITE( binary_log )
+
+
+BOOST_FIXTURE_TEST_CASE(formatting, BinaryLogFixture)
+{
+  const std::string lString("string");
+  const char* lChars = "chars";
+  const uint32_t lValue = 0xC0FFEE;
+  const int16_t lNegative = -42;
+  const double lDouble = 1.5;
+  const BinaryLogArgument lArgument = { 7 };
+
+  const auto lLogEntries = [&] () {
+    log(level, "literal ", lString, ' ', lChars, ' ', 'c', ' ', lNegative, ' ', uint64_t(1) << 40, ' ', lDouble, ' ', 0.25f);
+    log(level, Integer(lValue, IntFmt<hex, fixed>()), ' ', Integer(lValue, IntFmt<hex, fixed, 12>()), ' ', Integer(uint8_t(5), IntFmt<bin, variable>()), ' ',
+        Integer(uint8_t(5), IntFmt<bin, fixed, 10>()), ' ', Integer(lNegative, IntFmt<dec, fixed, 6>()), ' ', Integer(-1));
+    log(level, Quote(lString), ' ', Quote(lChars), ' ', Quote("literal"), ' ', lArgument);
+    log(level);
+  };
+
+  lLogEntries();
+  const std::vector<std::string> lExpected = getEntries(stream);
+  BOOST_REQUIRE_EQUAL(lExpected.size(), size_t(4));
+
+  enableBinaryLogging(path);
+  BOOST_CHECK(LoggingIsBinary());
+  lLogEntries();
+  // Entries from other threads record the thread that made them
+  std::thread::id lThreadID;
+  std::thread lThread([&] () { lThreadID = std::this_thread::get_id(); log(level, "from thread"); });
+  lThread.join();
+  disableBinaryLogging();
+  BOOST_CHECK(not LoggingIsBinary());
+
+  std::vector<std::string> lEntries = decode({path + ".0"});
+  BOOST_REQUIRE_EQUAL(lEntries.size(), size_t(5));
+  BOOST_CHECK_EQUAL(lEntries.back(), "from thread");
+  lEntries.pop_back();
+  BOOST_CHECK_EQUAL_COLLECTIONS(lEntries.begin(), lEntries.end(), lExpected.begin(), lExpected.end());
+
+  std::stringstream lDecoded;
+  decodeBinaryLog({path + ".0"}, lDecoded);
+  std::ostringstream lThreadIDString;
+  lThreadIDString << "[" << lThreadID << "]";
+  BOOST_CHECK(lDecoded.str().find(lThreadIDString.str() + " FATAL - from thread") != std::string::npos);
+
+  // Nothing should have been written to the level's stream while the binary backend was enabled
+  stream.clear();
+  BOOST_CHECK(getEntries(stream).empty());
+}
+
+
+BOOST_FIXTURE_TEST_CASE(rotation, BinaryLogFixture)
+{
+  // Each file has room for a single 64 kB chunk
+  const size_t lNrEntries = 10000;
+  enableBinaryLogging(path, 1, 2);
+  for (size_t i = 0; i < lNrEntries; i++)
+    log(level, "entry ", Integer(uint32_t(i)));
+  disableBinaryLogging();
+
+  // Only the two most recent files are kept, and the entries in them should be the most recent ones
+  std::vector<size_t> lSequences;
+  for (boost::filesystem::directory_iterator lIt(directory); lIt != boost::filesystem::directory_iterator(); lIt++)
+    lSequences.push_back(std::stoul(lIt->path().extension().string().substr(1)));
+  std::sort(lSequences.begin(), lSequences.end());
+  BOOST_REQUIRE_EQUAL(lSequences.size(), size_t(2));
+  BOOST_CHECK(lSequences.at(0) > 0);
+  BOOST_CHECK_EQUAL(lSequences.at(1), lSequences.at(0) + 1);
+  const std::vector<std::string> lEntries = decode({path + "." + std::to_string(lSequences.at(0)), path + "." + std::to_string(lSequences.at(1))});
+  BOOST_REQUIRE(not lEntries.empty());
+  BOOST_CHECK(lEntries.size() < lNrEntries);
+  for (size_t i = 0; i < lEntries.size(); i++)
+    BOOST_CHECK_EQUAL(lEntries.at(i), "entry " + std::to_string(lNrEntries - lEntries.size() + i));
+
+  // Files that are not binary logs are rejected
+  BOOST_CHECK_THROW(decode({path + ".missing"}), exception::BinaryLogFileError);
+  std::ofstream(path + ".text") << "not a binary log\n";
+  BOOST_CHECK_THROW(decode({path + ".text"}), exception::BinaryLogFileError);
+}
+
+
+BOOST_FIXTURE_TEST_CASE(concurrent_first_use, BinaryLogFixture)
+{
+  // Threads that first use a format at the same time each write its description, so every entry can be decoded
+  const size_t lNrThreads = 8;
+  std::atomic<bool> lGo(false);
+  enableBinaryLogging(path);
+  std::vector<std::thread> lThreads;
+  for (size_t i = 0; i < lNrThreads; i++)
+    lThreads.push_back(std::thread([&, i] () { while (not lGo) {} log(level, "first use ", Integer(uint32_t(i))); }));
+  lGo = true;
+  for (std::thread& lThread : lThreads)
+    lThread.join();
+  disableBinaryLogging();
+
+  std::vector<std::string> lEntries = decode({path + ".0"});
+  std::sort(lEntries.begin(), lEntries.end());
+  BOOST_REQUIRE_EQUAL(lEntries.size(), lNrThreads);
+  for (size_t i = 0; i < lNrThreads; i++)
+    BOOST_CHECK_EQUAL(lEntries.at(i), "first use " + std::to_string(i));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
@@ -0,0 +1,186 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+#include "uhal/uhal.hpp"
+#include "uhal/utilities/ClientStatistics.hpp"
+
+
+#include <sstream>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "uhal/tests/definitions.hpp"
+#include "uhal/tests/fixtures.hpp"
+#include "uhal/tests/tools.hpp"
+
+
+namespace uhal {
+namespace tests {
+
+
+BOOST_AUTO_TEST_SUITE( client_statistics )
+
+
+BOOST_AUTO_TEST_CASE(histogram_buckets)
+{
+  // Every value lies within the limits of its bucket, and the buckets are contiguous
+  for (size_t i = 0; i < LatencyHistogram::kBucketCount; i++) {
+    BOOST_CHECK_EQUAL(LatencyHistogram::getBucket(LatencyHistogram::lowerBound(i)), i);
+    if (i + 1 < LatencyHistogram::kBucketCount) {
+      BOOST_CHECK_EQUAL(LatencyHistogram::upperBound(i), LatencyHistogram::lowerBound(i + 1));
+      BOOST_CHECK_EQUAL(LatencyHistogram::getBucket(LatencyHistogram::upperBound(i) - 1), i);
+    }
+  }
+
+  // Relative bucket width is at most 1/16
+  for (uint64_t lValue : std::vector<uint64_t>{ 17, 1000, 123456, 987654321 }) {
+    const size_t lBucket = LatencyHistogram::getBucket(lValue);
+    BOOST_CHECK_LE(LatencyHistogram::lowerBound(lBucket), lValue);
+    BOOST_CHECK_GT(LatencyHistogram::upperBound(lBucket), lValue);
+    BOOST_CHECK_LE(16 * (LatencyHistogram::upperBound(lBucket) - LatencyHistogram::lowerBound(lBucket)), lValue);
+  }
+
+  BOOST_CHECK_EQUAL(LatencyHistogram::getBucket(uint64_t(1) << 50), LatencyHistogram::kBucketCount - 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(histogram_percentiles)
+{
+  LatencyHistogram lHistogram;
+  BOOST_CHECK_EQUAL(lHistogram.snapshot().count, uint64_t(0));
+  BOOST_CHECK_EQUAL(lHistogram.snapshot().percentile(50), uint64_t(0));
+
+  for (uint64_t i = 1; i <= 1000; i++)
+    lHistogram.add(i * 1000);
+
+  const LatencyHistogram::Snapshot lSnapshot(lHistogram.snapshot());
+  BOOST_CHECK_EQUAL(lSnapshot.count, uint64_t(1000));
+  BOOST_CHECK_EQUAL(lSnapshot.min, uint64_t(1000));
+  BOOST_CHECK_EQUAL(lSnapshot.max, uint64_t(1000000));
+  BOOST_CHECK_CLOSE(lSnapshot.mean(), 500500.0, 1e-6);
+  BOOST_CHECK_CLOSE(double(lSnapshot.percentile(50)), 500000.0, 6.25);
+  BOOST_CHECK_CLOSE(double(lSnapshot.percentile(99)), 990000.0, 6.25);
+  BOOST_CHECK_EQUAL(lSnapshot.percentile(100), uint64_t(1000000));
+  BOOST_CHECK_EQUAL(lSnapshot.percentile(0), uint64_t(1000));
+
+  std::ostringstream lStream;
+  lStream << lSnapshot;
+  BOOST_CHECK(lStream.str().find("1000 values") != std::string::npos);
+
+  lHistogram.clear();
+  BOOST_CHECK_EQUAL(lHistogram.snapshot().count, uint64_t(0));
+  BOOST_CHECK_EQUAL(lHistogram.snapshot().max, uint64_t(0));
+}
+
+
+BOOST_AUTO_TEST_CASE(counters)
+{
+  ClientStatistics lStatistics;
+  lStatistics.setTransactionTypeName(1, "read");
+
+  const ClientStatistics::Clock_t::time_point lSendTime(ClientStatistics::Clock_t::now());
+  lStatistics.recordTransaction(1);
+  lStatistics.recordTransaction(1);
+  lStatistics.recordTransaction(2);
+  lStatistics.recordPacketSent(100);
+  lStatistics.recordPacketSent(50);
+  lStatistics.recordPacketReceived(20, lSendTime);
+
+  ClientStatistics::Snapshot lSnapshot(lStatistics.snapshot());
+  BOOST_CHECK_EQUAL(lSnapshot.packetsSent, uint64_t(2));
+  BOOST_CHECK_EQUAL(lSnapshot.packetsReceived, uint64_t(1));
+  BOOST_CHECK_EQUAL(lSnapshot.bytesSent, uint64_t(150));
+  BOOST_CHECK_EQUAL(lSnapshot.bytesReceived, uint64_t(20));
+  BOOST_CHECK_EQUAL(lSnapshot.inFlight, uint32_t(1));
+  BOOST_CHECK_EQUAL(lSnapshot.maxInFlight, uint32_t(2));
+  BOOST_CHECK_EQUAL(lSnapshot.packetRoundTripTime.count, uint64_t(1));
+  // Only transaction types with names are reported
+  BOOST_REQUIRE_EQUAL(lSnapshot.transactions.size(), size_t(1));
+  BOOST_CHECK_EQUAL(lSnapshot.transactions.at("read"), uint64_t(2));
+
+  lStatistics.recordPacketsAbandoned();
+  lStatistics.recordTimeout();
+  lSnapshot = lStatistics.snapshot();
+  BOOST_CHECK_EQUAL(lSnapshot.inFlight, uint32_t(0));
+  BOOST_CHECK_EQUAL(lSnapshot.timeouts, uint64_t(1));
+
+  lStatistics.clear();
+  lSnapshot = lStatistics.snapshot();
+  BOOST_CHECK_EQUAL(lSnapshot.packetsSent, uint64_t(0));
+  BOOST_CHECK_EQUAL(lSnapshot.maxInFlight, uint32_t(0));
+  BOOST_CHECK_EQUAL(lSnapshot.timeouts, uint64_t(0));
+  BOOST_CHECK_EQUAL(lSnapshot.transactions.at("read"), uint64_t(0));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(ClientStatisticsTestSuite, dispatch, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+  ClientInterface& lClient = hw.getClient();
+  lClient.resetStatistics();
+
+  const std::vector<uint32_t> lValues(1000, 0xCAFE);
+  hw.getNode("REG").write(42);
+  hw.getNode("MEM").writeBlock(lValues);
+  ValVector<uint32_t> lReadValues = hw.getNode("MEM").readBlock(lValues.size());
+  hw.dispatch();
+  BOOST_CHECK(lReadValues.valid());
+
+  ClientStatistics::Snapshot lSnapshot(lClient.getStatistics());
+  BOOST_CHECK_EQUAL(lSnapshot.dispatches, uint64_t(1));
+  BOOST_CHECK_EQUAL(lSnapshot.dispatchTime.count, uint64_t(1));
+  BOOST_CHECK_EQUAL(lSnapshot.timeouts, uint64_t(0));
+  BOOST_CHECK_GT(lSnapshot.packetsSent, uint64_t(0));
+  BOOST_CHECK_EQUAL(lSnapshot.packetsReceived, lSnapshot.packetsSent);
+  BOOST_CHECK_EQUAL(lSnapshot.packetRoundTripTime.count, lSnapshot.packetsSent);
+  BOOST_CHECK_EQUAL(lSnapshot.inFlight, uint32_t(0));
+  BOOST_CHECK_GE(lSnapshot.maxInFlight, uint32_t(1));
+  BOOST_CHECK_GT(lSnapshot.bytesSent, 4 * lValues.size());
+  BOOST_CHECK_GT(lSnapshot.bytesReceived, 4 * lValues.size());
+  BOOST_CHECK_GE(lSnapshot.transactions.at("Incrementing write"), uint64_t(2));
+  BOOST_CHECK_GE(lSnapshot.transactions.at("Incrementing read"), uint64_t(1));
+  BOOST_CHECK_EQUAL(lSnapshot.transactions.at("Read-Modify-Write bits"), uint64_t(0));
+}
+)
+
+
+} // end ns tests
+} // end ns uhal
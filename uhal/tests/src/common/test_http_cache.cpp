@@ -0,0 +1,301 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+#include "uhal/ConnectionManager.hpp"
+#include "uhal/HttpFileCache.hpp"
+#include "uhal/tests/fixtures.hpp"
+#include "uhal/utilities/files.hpp"
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+
+
+namespace uhal {
+namespace tests {
+
+
+//! Minimal HTTP server which serves files from memory, and records the headers of each request
+class HttpStandInServer {
+public:
+  struct File {
+    std::string contents;
+    std::string etag;
+    std::string lastModified;
+  };
+
+  HttpStandInServer() :
+    mAcceptor(mIOService, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+    mStop(false),
+    mThread(&HttpStandInServer::run, this)
+  {
+  }
+
+  ~HttpStandInServer()
+  {
+    stop();
+  }
+
+  uint16_t getPort() const
+  {
+    return mAcceptor.local_endpoint().port();
+  }
+
+  std::string getURL(const std::string& aPath) const
+  {
+    return "localhost:" + std::to_string(getPort()) + "/" + aPath;
+  }
+
+  void setFile(const std::string& aPath, const File& aFile)
+  {
+    std::lock_guard<std::mutex> lLock(mMutex);
+    mFiles[aPath] = aFile;
+  }
+
+  void removeFile(const std::string& aPath)
+  {
+    std::lock_guard<std::mutex> lLock(mMutex);
+    mFiles.erase(aPath);
+  }
+
+  std::vector<std::string> getRequests()
+  {
+    std::lock_guard<std::mutex> lLock(mMutex);
+    return mRequests;
+  }
+
+  //! Stops the server, so that subsequent connections are refused
+  void stop()
+  {
+    if (not mThread.joinable())
+      return;
+    mStop = true;
+    // Unblock the accept call
+    boost::asio::ip::tcp::socket lSocket(mIOService);
+    boost::system::error_code lErrorCode;
+    lSocket.connect(mAcceptor.local_endpoint(), lErrorCode);
+    mThread.join();
+    mAcceptor.close();
+  }
+
+private:
+  void run()
+  {
+    while (true) {
+      boost::asio::ip::tcp::socket lSocket(mIOService);
+      boost::system::error_code lErrorCode;
+      mAcceptor.accept(lSocket, lErrorCode);
+      if (mStop)
+        return;
+      if (lErrorCode)
+        continue;
+
+      boost::asio::streambuf lBuffer;
+      boost::asio::read_until(lSocket, lBuffer, "\r\n\r\n", lErrorCode);
+      const std::string lRequest(boost::asio::buffers_begin(lBuffer.data()), boost::asio::buffers_end(lBuffer.data()));
+      const std::string lPath(lRequest.substr(5, lRequest.find(' ', 5) - 5));
+
+      std::string lResponse("HTTP/1.0 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+      {
+        std::lock_guard<std::mutex> lLock(mMutex);
+        mRequests.push_back(lRequest);
+        std::map<std::string, File>::const_iterator lIt = mFiles.find(lPath);
+        if (lIt != mFiles.end()) {
+          const File& lFile(lIt->second);
+          const std::string lIfNoneMatch(HttpFileCache::getHeader(lRequest, "If-None-Match"));
+          const std::string lIfModifiedSince(HttpFileCache::getHeader(lRequest, "If-Modified-Since"));
+          const bool lNotModified = lIfNoneMatch.empty() ? (not lIfModifiedSince.empty() and lIfModifiedSince == lFile.lastModified) : (lIfNoneMatch == lFile.etag);
+
+          lResponse = lNotModified ? "HTTP/1.0 304 Not Modified\r\n" : "HTTP/1.0 200 OK\r\n";
+          if (not lFile.etag.empty())
+            lResponse += "ETag: " + lFile.etag + "\r\n";
+          if (not lFile.lastModified.empty())
+            lResponse += "Last-Modified: " + lFile.lastModified + "\r\n";
+          lResponse += "Content-Length: " + std::to_string(lNotModified ? 0 : lFile.contents.size()) + "\r\n\r\n";
+          if (not lNotModified)
+            lResponse += lFile.contents;
+        }
+      }
+
+      boost::asio::write(lSocket, boost::asio::buffer(lResponse), lErrorCode);
+    }
+  }
+
+  boost::asio::io_service mIOService;
+  boost::asio::ip::tcp::acceptor mAcceptor;
+  std::atomic<bool> mStop;
+  std::mutex mMutex;
+  std::map<std::string, File> mFiles;
+  std::vector<std::string> mRequests;
+  std::thread mThread;
+};
+
+
+struct HttpCacheFixture {
+  HttpCacheFixture() :
+    directory(boost::filesystem::temp_directory_path() / ("uhal_http_cache_" + std::to_string(getpid()))),
+    originalCacheDirectory(utilities::GetHttpCacheDirectory()),
+    originalOfflineMode(utilities::GetHttpOfflineMode())
+  {
+    utilities::SetHttpCacheDirectory(directory);
+    utilities::SetHttpOfflineMode(false);
+  }
+
+  ~HttpCacheFixture()
+  {
+    utilities::SetHttpCacheDirectory(originalCacheDirectory);
+    utilities::SetHttpOfflineMode(originalOfflineMode);
+    ConnectionManager::clearAddressFileCache();
+    boost::filesystem::remove_all(directory);
+  }
+
+  static std::string get(const std::string& aURL)
+  {
+    std::vector<uint8_t> lContents;
+    BOOST_REQUIRE(utilities::HttpGetFile<false>(aURL, lContents));
+    return std::string(lContents.begin(), lContents.end());
+  }
+
+  HttpStandInServer server;
+  const boost::filesystem::path directory;
+  const boost::filesystem::path originalCacheDirectory;
+  const bool originalOfflineMode;
+};
+
+
+BOOST_AUTO_TEST_SUITE( http_cache )
+
+
+BOOST_FIXTURE_TEST_CASE(etag_revalidation, HttpCacheFixture)
+{
+  server.setFile("a.xml", {"<node id=\"A\"/>", "\"v1\"", ""});
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"A\"/>");
+  BOOST_CHECK(boost::filesystem::exists(HttpFileCache(directory).getEntryPath(server.getURL("a.xml"))));
+  BOOST_CHECK_EQUAL(HttpFileCache::getHeader(server.getRequests().at(0), "If-None-Match"), "");
+
+  // Unchanged file: request should be conditional, and the server responds with 304 (no body)
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"A\"/>");
+  BOOST_CHECK_EQUAL(HttpFileCache::getHeader(server.getRequests().at(1), "If-None-Match"), "\"v1\"");
+
+  // Modified file
+  server.setFile("a.xml", {"<node id=\"B\"/>", "\"v2\"", ""});
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"B\"/>");
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"B\"/>");
+  BOOST_CHECK_EQUAL(HttpFileCache::getHeader(server.getRequests().at(3), "If-None-Match"), "\"v2\"");
+
+  // Removed file: cached copy should not be used
+  server.removeFile("a.xml");
+  std::vector<uint8_t> lContents;
+  BOOST_CHECK(not utilities::HttpGetFile<false>(server.getURL("a.xml"), lContents));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(last_modified_revalidation, HttpCacheFixture)
+{
+  server.setFile("a.xml", {"<node id=\"A\"/>", "", "Wed, 21 Oct 2015 07:28:00 GMT"});
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"A\"/>");
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"A\"/>");
+  BOOST_REQUIRE_EQUAL(server.getRequests().size(), size_t(2));
+  BOOST_CHECK_EQUAL(HttpFileCache::getHeader(server.getRequests().at(1), "If-Modified-Since"), "Wed, 21 Oct 2015 07:28:00 GMT");
+
+  // Corrupt cached contents should be ignored, and the file re-downloaded
+  HttpFileCache lCache(directory);
+  HttpFileCache::Entry lEntry;
+  std::vector<uint8_t> lContents;
+  BOOST_REQUIRE(lCache.load(server.getURL("a.xml"), lEntry, lContents));
+  boost::filesystem::resize_file(lCache.getContentPath(lEntry.hash), 3);
+  BOOST_CHECK(not lCache.load(server.getURL("a.xml"), lEntry, lContents));
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"A\"/>");
+  BOOST_CHECK_EQUAL(HttpFileCache::getHeader(server.getRequests().at(2), "If-Modified-Since"), "");
+  BOOST_CHECK(lCache.load(server.getURL("a.xml"), lEntry, lContents));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(offline, HttpCacheFixture)
+{
+  server.setFile("a.xml", {"<node id=\"A\"/>", "\"v1\"", ""});
+  server.setFile("b.xml", {"<node id=\"B\"/>", "\"v1\"", ""});
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"A\"/>");
+
+  // Offline mode: cached files are used without contacting the server
+  utilities::SetHttpOfflineMode(true);
+  BOOST_CHECK_EQUAL(get(server.getURL("a.xml")), "<node id=\"A\"/>");
+  std::vector<uint8_t> lContents;
+  BOOST_CHECK(not utilities::HttpGetFile<false>(server.getURL("b.xml"), lContents));
+  BOOST_CHECK_EQUAL(server.getRequests().size(), size_t(1));
+  utilities::SetHttpOfflineMode(false);
+
+  // Unreachable server: cached files are used
+  const std::string lURL(server.getURL("a.xml"));
+  server.stop();
+  BOOST_CHECK_EQUAL(get(lURL), "<node id=\"A\"/>");
+
+  // ... but only if the cache is enabled
+  utilities::SetHttpCacheDirectory("");
+  BOOST_CHECK(not utilities::HttpGetFile<false>(lURL, lContents));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(address_table, HttpCacheFixture)
+{
+  server.setFile("top.xml", {"<node><node id=\"SUB1\" module=\"http://" + server.getURL("sub.xml") + "\" address=\"0x100\"/><node id=\"SUB2\" module=\"http://" + server.getURL("sub.xml") + "\" address=\"0x200\"/></node>", "\"t1\"", ""});
+  server.setFile("sub.xml", {"<node><node id=\"REG\" address=\"0x1\"/></node>", "\"s1\"", ""});
+
+  const std::string lAddressFile("http://" + server.getURL("top.xml"));
+  BOOST_CHECK_EQUAL(ConnectionManager::getDevice("hw", "ipbusudp-2.0://localhost:50001", lAddressFile).getNode("SUB2.REG").getAddress(), uint32_t(0x201));
+
+  // Address tables can be loaded from the cache once the server is unreachable
+  server.stop();
+  ConnectionManager::clearAddressFileCache();
+  BOOST_CHECK_EQUAL(ConnectionManager::getDevice("hw", "ipbusudp-2.0://localhost:50001", lAddressFile).getNode("SUB1.REG").getAddress(), uint32_t(0x101));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
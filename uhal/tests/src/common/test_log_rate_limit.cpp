@@ -0,0 +1,184 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+
+#include "uhal/log/log.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace uhal {
+namespace tests {
+
+
+UHAL_DEFINE_EXCEPTION_CLASS ( RateLimitTestException , "Exception class used in the log rate limit tests." )
+
+
+// Counts the number of times that it is formatted
+struct FormatCounter {
+  mutable size_t count;
+};
+
+std::ostream& operator<<(std::ostream& aStr, const FormatCounter& aCounter)
+{
+  aCounter.count++;
+  return aStr << "counter";
+}
+
+
+struct LogRateLimitFixture {
+  LogRateLimitFixture() :
+    level(stream)
+  {
+  }
+
+  // Returns the logged entries, without the head (i.e. time and thread ID) or tail
+  std::vector<std::string> getEntries()
+  {
+    std::vector<std::string> lEntries;
+    std::string lLine;
+    while (std::getline(stream, lLine)) {
+      const size_t lPos = lLine.find(" FATAL - ");
+      BOOST_REQUIRE(lPos != std::string::npos);
+      lEntries.push_back(lLine.substr(lPos + 9, lLine.size() - lPos - 9 - 4));
+    }
+    stream.clear();
+    return lEntries;
+  }
+
+  std::stringstream stream;
+  FatalLevel level;
+};
+
+
+BOOST_AUTO_TEST_SUITE( log_rate_limit )
+
+
+BOOST_FIXTURE_TEST_CASE(suppression, LogRateLimitFixture)
+{
+  LogRateLimit lRateLimit(2, 3600000);
+  FormatCounter lCounter = { 0 };
+  for (size_t i = 0; i < 10; i++)
+    log(lRateLimit, level, "entry ", Integer(uint32_t(i)), " ", lCounter);
+
+  // Suppressed entries should not be formatted
+  BOOST_CHECK_EQUAL(lCounter.count, size_t(2));
+  BOOST_CHECK_EQUAL(lRateLimit.suppressed(), uint64_t(8));
+  const std::vector<std::string> lExpected = { "entry 0 counter", "entry 1 counter" };
+  const std::vector<std::string> lEntries = getEntries();
+  BOOST_CHECK_EQUAL_COLLECTIONS(lEntries.begin(), lEntries.end(), lExpected.begin(), lExpected.end());
+
+  // Each call site has its own limit
+  LogRateLimit lOtherRateLimit(2, 3600000);
+  log(lOtherRateLimit, level, "other");
+  BOOST_CHECK(getEntries() == std::vector<std::string>(1, "other"));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(repeat_count, LogRateLimitFixture)
+{
+  // Periods are aligned to multiples of their length, so start just after the beginning of one
+  const uint32_t lPeriod = 200;
+  const uint64_t lNow = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  std::this_thread::sleep_for(std::chrono::milliseconds(lPeriod - lNow % lPeriod + 10));
+
+  LogRateLimit lRateLimit(1, lPeriod);
+  for (size_t i = 0; i < 5; i++)
+    log(lRateLimit, level, "entry ", Integer(uint32_t(i)));
+  std::this_thread::sleep_for(std::chrono::milliseconds(lPeriod + 50));
+  log(lRateLimit, level, "entry 5");
+  std::this_thread::sleep_for(std::chrono::milliseconds(lPeriod + 50));
+  log(lRateLimit, level, "entry 6");
+
+  // The number of entries suppressed since the last one that was written is appended to the next one
+  const std::vector<std::string> lExpected = { "entry 0", "entry 5 [4 similar entries suppressed]", "entry 6" };
+  const std::vector<std::string> lEntries = getEntries();
+  BOOST_CHECK_EQUAL_COLLECTIONS(lEntries.begin(), lEntries.end(), lExpected.begin(), lExpected.end());
+  BOOST_CHECK_EQUAL(lRateLimit.suppressed(), uint64_t(4));
+}
+
+
+BOOST_AUTO_TEST_CASE(concurrent)
+{
+  const size_t lNrThreads = 4, lNrEntries = 10000;
+  LogRateLimit lRateLimit(3, 3600000);
+  std::atomic<size_t> lWritten(0);
+  std::vector<std::thread> lThreads;
+  for (size_t i = 0; i < lNrThreads; i++) {
+    lThreads.push_back(std::thread([&] () {
+      for (size_t j = 0; j < lNrEntries; j++) {
+        uint64_t lSuppressed;
+        if (lRateLimit.allow(lSuppressed))
+          lWritten++;
+      }
+    }));
+  }
+  for (std::thread& lThread : lThreads)
+    lThread.join();
+
+  BOOST_CHECK_EQUAL(lWritten.load(), size_t(3));
+  BOOST_CHECK_EQUAL(lRateLimit.suppressed(), uint64_t(lNrThreads * lNrEntries - 3));
+}
+
+
+BOOST_AUTO_TEST_CASE(exceptions)
+{
+  // Suppressed messages are neither formatted nor appended to the exception
+  LogRateLimit lRateLimit(1, 3600000);
+  FormatCounter lCounter = { 0 };
+  for (size_t i = 0; i < 3; i++) {
+    RateLimitTestException lExc;
+    log(lRateLimit, lExc, "message ", Integer(uint32_t(i)), " ", lCounter);
+    BOOST_CHECK_EQUAL(std::string(lExc.what()).find("message " + std::to_string(i)) != std::string::npos, i == 0);
+  }
+
+  BOOST_CHECK_EQUAL(lCounter.count, size_t(1));
+  BOOST_CHECK_EQUAL(lRateLimit.suppressed(), uint64_t(2));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
@@ -0,0 +1,227 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+#include "uhal/MetricsExporter.hpp"
+
+
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio/connect.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "uhal/ClientFactory.hpp"
+#include "uhal/ClientInterface.hpp"
+#include "uhal/ProtocolIPbus.hpp"
+#include "uhal/ProtocolUDP.hpp"
+
+
+namespace uhal {
+namespace tests {
+
+
+namespace {
+
+bool isExported(const std::string& aId)
+{
+  std::ostringstream lStream;
+  MetricsExporter::write(lStream);
+  return lStream.str().find("id=\"" + aId + "\"") != std::string::npos;
+}
+
+std::string httpGet(const uint16_t aPort, const std::string& aPath, const std::string& aHeaders = "")
+{
+  boost::asio::io_service lIOservice;
+  boost::asio::ip::tcp::socket lSocket(lIOservice);
+  lSocket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string("127.0.0.1"), aPort));
+
+  const std::string lRequest("GET " + aPath + " HTTP/1.1\r\nHost: localhost\r\n" + aHeaders + "\r\n");
+  boost::asio::write(lSocket, boost::asio::buffer(lRequest));
+
+  boost::asio::streambuf lResponse;
+  boost::system::error_code lError;
+  boost::asio::read(lSocket, lResponse, lError);
+  BOOST_CHECK(lError == boost::asio::error::eof);
+  return std::string(std::istreambuf_iterator<char>(&lResponse), std::istreambuf_iterator<char>());
+}
+
+}
+
+
+//! Client that records whether it is exported while it is being constructed and destroyed
+class MetricsTestClient : public UDP< IPbus< 2 , 0 > > {
+public:
+  MetricsTestClient(const std::string& aId, const URI& aUri) :
+    UDP< IPbus< 2 , 0 > >(aId, aUri)
+  {
+    sExportedDuringConstruction = isExported(aId);
+  }
+
+  ~MetricsTestClient()
+  {
+    sExportedDuringDestruction = isExported(id());
+  }
+
+  static bool sExportedDuringConstruction;
+  static bool sExportedDuringDestruction;
+};
+
+bool MetricsTestClient::sExportedDuringConstruction = true;
+bool MetricsTestClient::sExportedDuringDestruction = true;
+
+UHAL_REGISTER_EXTERNAL_CLIENT(uhal::tests::MetricsTestClient, "__metrics_test__", "Client for testing metrics exporter registration")
+
+
+BOOST_AUTO_TEST_SUITE( metrics_exporter )
+
+
+BOOST_AUTO_TEST_CASE(registration)
+{
+  // Clients should only be exported while they are fully constructed
+  std::shared_ptr<ClientInterface> lClient(ClientFactory::getInstance().getClient("metrics_registration", "__metrics_test__://localhost:50001", std::vector<std::string>(1, "__metrics_test__")));
+  BOOST_CHECK(not MetricsTestClient::sExportedDuringConstruction);
+  BOOST_CHECK(isExported("metrics_registration"));
+
+  lClient.reset();
+  BOOST_CHECK(not MetricsTestClient::sExportedDuringDestruction);
+  BOOST_CHECK(not isExported("metrics_registration"));
+}
+
+
+BOOST_AUTO_TEST_CASE(format)
+{
+  std::shared_ptr<ClientInterface> lClient(ClientFactory::getInstance().getClient("metrics_\"test\"", "ipbusudp-2.0://localhost:50001"));
+  const std::string lLabels("{id=\"metrics_\\\"test\\\"\",uri=\"ipbusudp-2.0://localhost:50001\"");
+
+  std::ostringstream lStream;
+  MetricsExporter::write(lStream);
+  const std::string lOpenMetrics(lStream.str());
+  BOOST_CHECK(lOpenMetrics.find("# TYPE uhal_client_packets_sent counter\n") != std::string::npos);
+  BOOST_CHECK(lOpenMetrics.find("uhal_client_packets_sent_total" + lLabels + "} 0\n") != std::string::npos);
+  BOOST_CHECK(lOpenMetrics.find("uhal_client_transactions_total" + lLabels + ",type=\"Incrementing read\"} 0\n") != std::string::npos);
+  BOOST_CHECK(lOpenMetrics.find("uhal_client_packets_in_flight" + lLabels + "} 0\n") != std::string::npos);
+  BOOST_CHECK(lOpenMetrics.find("# TYPE uhal_client_dispatch_seconds histogram\n") != std::string::npos);
+  BOOST_CHECK(lOpenMetrics.find("uhal_client_dispatch_seconds_bucket" + lLabels + ",le=\"1.024e-06\"} 0\n") != std::string::npos);
+  BOOST_CHECK(lOpenMetrics.find("uhal_client_dispatch_seconds_bucket" + lLabels + ",le=\"+Inf\"} 0\n") != std::string::npos);
+  BOOST_CHECK(lOpenMetrics.find("uhal_client_dispatch_seconds_count" + lLabels + "} 0\n") != std::string::npos);
+  BOOST_CHECK_EQUAL(lOpenMetrics.substr(lOpenMetrics.size() - 6), "# EOF\n");
+
+  // Prometheus text format: counter families are named with the '_total' suffix, and there's no EOF marker
+  lStream.str("");
+  MetricsExporter::write(lStream, false);
+  const std::string lPrometheus(lStream.str());
+  BOOST_CHECK(lPrometheus.find("# TYPE uhal_client_packets_sent_total counter\n") != std::string::npos);
+  BOOST_CHECK(lPrometheus.find("uhal_client_packets_sent_total" + lLabels + "} 0\n") != std::string::npos);
+  BOOST_CHECK(lPrometheus.find("# EOF") == std::string::npos);
+
+  // Destroyed clients are no longer exported
+  lClient.reset();
+  lStream.str("");
+  MetricsExporter::write(lStream);
+  BOOST_CHECK(lStream.str().find(lLabels) == std::string::npos);
+}
+
+
+BOOST_AUTO_TEST_CASE(http)
+{
+  std::shared_ptr<ClientInterface> lClient(ClientFactory::getInstance().getClient("metrics_http", "ipbustcp-2.0://localhost:50002"));
+  MetricsExporter lExporter(0);
+  BOOST_REQUIRE_NE(lExporter.getPort(), 0);
+
+  const std::string lPrometheus(httpGet(lExporter.getPort(), "/metrics"));
+  BOOST_CHECK_EQUAL(lPrometheus.substr(0, 15), "HTTP/1.1 200 OK");
+  BOOST_CHECK(lPrometheus.find("Content-Type: text/plain; version=0.0.4") != std::string::npos);
+  BOOST_CHECK(lPrometheus.find("uhal_client_dispatches_total{id=\"metrics_http\"") != std::string::npos);
+  BOOST_CHECK(lPrometheus.find("# EOF") == std::string::npos);
+
+  const std::string lOpenMetrics(httpGet(lExporter.getPort(), "/metrics", "Accept: application/openmetrics-text; version=1.0.0,text/plain;q=0.5\r\n"));
+  BOOST_CHECK_EQUAL(lOpenMetrics.substr(0, 15), "HTTP/1.1 200 OK");
+  BOOST_CHECK(lOpenMetrics.find("Content-Type: application/openmetrics-text") != std::string::npos);
+  BOOST_CHECK(lOpenMetrics.find("uhal_client_dispatches_total{id=\"metrics_http\"") != std::string::npos);
+  BOOST_CHECK_EQUAL(lOpenMetrics.substr(lOpenMetrics.size() - 6), "# EOF\n");
+
+  BOOST_CHECK_EQUAL(httpGet(lExporter.getPort(), "/other").substr(0, 22), "HTTP/1.1 404 Not Found");
+
+  // Port already in use
+  BOOST_CHECK_THROW(MetricsExporter lOther(lExporter.getPort()), exception::MetricsExporterError);
+}
+
+
+BOOST_AUTO_TEST_CASE(text_file)
+{
+  std::shared_ptr<ClientInterface> lClient(ClientFactory::getInstance().getClient("metrics_file", "ipbusudp-2.0://localhost:50001"));
+  const boost::filesystem::path lPath(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("uhal-metrics-%%%%-%%%%.prom"));
+
+  {
+    // Metrics are written immediately, and then periodically
+    MetricsExporter lExporter(lPath, std::chrono::milliseconds(20));
+    for (size_t i = 0; (i < 100) and not boost::filesystem::exists(lPath); i++)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    BOOST_REQUIRE(boost::filesystem::exists(lPath));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+
+  std::ifstream lFile(lPath.c_str());
+  const std::string lContents((std::istreambuf_iterator<char>(lFile)), std::istreambuf_iterator<char>());
+  BOOST_CHECK(lContents.find("uhal_client_packets_sent_total{id=\"metrics_file\"") != std::string::npos);
+  BOOST_CHECK(lContents.find("# EOF") == std::string::npos);
+
+  // No temporary files are left behind
+  size_t lNrFiles = 0;
+  for (boost::filesystem::directory_iterator lIt(lPath.parent_path()); lIt != boost::filesystem::directory_iterator(); lIt++) {
+    if (lIt->path().string().find(lPath.string()) == 0)
+      lNrFiles++;
+  }
+  BOOST_CHECK_EQUAL(lNrFiles, size_t(1));
+  boost::filesystem::remove(lPath);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
@@ -0,0 +1,164 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/ClientFactory.hpp"
+#include "uhal/ProtocolMmap.hpp"
+#include "uhal/SigBusGuard.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <vector>
+
+
+namespace uhal {
+namespace tests {
+
+
+struct MmapDirectAccessFixture {
+  MmapDirectAccessFixture() :
+    filePath("/tmp/uhal_mmap_direct_test"),
+    nrWords(1024)
+  {
+    SigBusGuard::blockSIGBUS();
+
+    const std::vector<uint32_t> lZeros(nrWords, 0);
+    int lFd = open(filePath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0666);
+    BOOST_REQUIRE(lFd >= 0);
+    BOOST_REQUIRE_EQUAL(pwrite(lFd, lZeros.data(), 4 * nrWords, 0), ssize_t(4 * nrWords));
+    close(lFd);
+  }
+
+  ~MmapDirectAccessFixture()
+  {
+    remove(filePath.c_str());
+  }
+
+  uint32_t readFromFile(const uint32_t aAddr) const
+  {
+    uint32_t lValue = 0;
+    int lFd = open(filePath.c_str(), O_RDONLY);
+    BOOST_REQUIRE(lFd >= 0);
+    BOOST_REQUIRE_EQUAL(pread(lFd, &lValue, 4, 4 * aAddr), ssize_t(4));
+    close(lFd);
+    return lValue;
+  }
+
+  std::shared_ptr<ClientInterface> getClient() const
+  {
+    return ClientFactory::getInstance().getClient("mmap.direct", "ipbusmmap-2.0://" + filePath + "?mode=direct&size=" + std::to_string(4 * nrWords));
+  }
+
+  const std::string filePath;
+  const uint32_t nrWords;
+};
+
+
+BOOST_AUTO_TEST_SUITE( mmap_direct_access )
+
+
+BOOST_FIXTURE_TEST_CASE(single_write_read, MmapDirectAccessFixture)
+{
+  std::shared_ptr<ClientInterface> lClient(getClient());
+
+  ValHeader lWrite = lClient->write(0x10, 0xDEADBEEF);
+  ValWord<uint32_t> lRead = lClient->read(0x10);
+  ValWord<uint32_t> lMaskedRead = lClient->read(0x10, 0xFF00);
+  BOOST_CHECK(!lWrite.valid());
+  BOOST_CHECK(!lRead.valid());
+  BOOST_CHECK_EQUAL(readFromFile(0x10), uint32_t(0));
+
+  lClient->dispatch();
+  BOOST_CHECK(lWrite.valid());
+  BOOST_CHECK(lRead.valid());
+  BOOST_CHECK_EQUAL(lRead.value(), uint32_t(0xDEADBEEF));
+  BOOST_CHECK_EQUAL(lMaskedRead.value(), uint32_t(0xBE));
+  BOOST_CHECK_EQUAL(readFromFile(0x10), uint32_t(0xDEADBEEF));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(block_write_read, MmapDirectAccessFixture)
+{
+  std::shared_ptr<ClientInterface> lClient(getClient());
+
+  std::vector<uint32_t> lValues;
+  for (uint32_t i = 0; i < 100; i++)
+    lValues.push_back(0x1000 + i);
+
+  lClient->writeBlock(0x20, lValues);
+  ValVector<uint32_t> lBlock = lClient->readBlock(0x20, lValues.size());
+  ValVector<uint32_t> lPort = lClient->readBlock(0x21, 3, defs::NON_INCREMENTAL);
+  lClient->writeBlock(0x200, lValues, defs::NON_INCREMENTAL);
+  lClient->dispatch();
+
+  BOOST_REQUIRE(lBlock.valid());
+  BOOST_CHECK_EQUAL_COLLECTIONS(lBlock.begin(), lBlock.end(), lValues.begin(), lValues.end());
+  BOOST_CHECK_EQUAL(lPort.size(), size_t(3));
+  for (size_t i = 0; i < lPort.size(); i++)
+    BOOST_CHECK_EQUAL(lPort.at(i), uint32_t(0x1001));
+  BOOST_CHECK_EQUAL(readFromFile(0x200), lValues.back());
+  BOOST_CHECK_EQUAL(readFromFile(0x201), uint32_t(0));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(rmw, MmapDirectAccessFixture)
+{
+  std::shared_ptr<ClientInterface> lClient(getClient());
+
+  lClient->write(0x5, 0x0F0F0F0F);
+  ValWord<uint32_t> lBits = lClient->rmw_bits(0x5, 0xFFFF0000, 0x00001234);
+  ValWord<uint32_t> lSum = lClient->rmw_sum(0x5, 1);
+  lClient->write(0x6, 0x3, 0x30);
+  lClient->dispatch();
+
+  BOOST_CHECK_EQUAL(lBits.value(), uint32_t(0x0F0F0F0F));
+  BOOST_CHECK_EQUAL(lSum.value(), uint32_t(0x0F0F1234));
+  BOOST_CHECK_EQUAL(readFromFile(0x5), uint32_t(0x0F0F1235));
+  BOOST_CHECK_EQUAL(readFromFile(0x6), uint32_t(0x30));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(out_of_range, MmapDirectAccessFixture)
+{
+  std::shared_ptr<ClientInterface> lClient(getClient());
+
+  BOOST_CHECK_THROW(lClient->read(nrWords), exception::MmapCommunicationError);
+  BOOST_CHECK_THROW(lClient->readBlock(nrWords - 1, 2), exception::MmapCommunicationError);
+  BOOST_CHECK_NO_THROW(lClient->readBlock(nrWords - 1, 2, defs::NON_INCREMENTAL));
+  BOOST_CHECK_NO_THROW(lClient->dispatch());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
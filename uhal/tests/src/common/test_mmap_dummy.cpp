@@ -0,0 +1,147 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/ClientFactory.hpp"
+#include "uhal/ClientInterface.hpp"
+#include "uhal/ProtocolMmap.hpp"
+#include "uhal/tests/fixtures.hpp"
+#include "uhal/tests/MmapDummyHardware.hpp"
+#include "uhal/tests/tools.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <stdint.h>
+
+
+namespace uhal {
+namespace tests {
+
+
+struct MmapDummyHardwareFixture {
+  MmapDummyHardwareFixture() :
+    filePath("/dev/shm/uhal_mmap_dummy_errors"),
+    hw(new MmapDummyHardware(filePath, 0, false))
+  {
+  }
+
+  std::shared_ptr<ClientInterface> getClient() const
+  {
+    std::shared_ptr<ClientInterface> lClient(ClientFactory::getInstance().getClient("mmap.dummy", MmapDummyHardware::getClientURI(filePath), AbstractFixture::userClientActivationList));
+    lClient->setTimeoutPeriod(200);
+    return lClient;
+  }
+
+  const std::string filePath;
+  // Raw pointer retained to configure the dummy hardware; owned by the runner (which must be started after configuration)
+  MmapDummyHardware* hw;
+};
+
+
+BOOST_AUTO_TEST_SUITE( mmap_dummy_hardware )
+
+
+BOOST_FIXTURE_TEST_CASE(reply_latency, MmapDummyHardwareFixture)
+{
+  hw->setReplyLatency(std::chrono::milliseconds(20));
+  DummyHardwareRunner lRunner(hw);
+  std::shared_ptr<ClientInterface> lClient(getClient());
+
+  lClient->write(0x1, 0xCAFE);
+  lClient->dispatch();
+
+  const std::chrono::steady_clock::time_point lStart = std::chrono::steady_clock::now();
+  ValWord<uint32_t> lRead = lClient->read(0x1);
+  lClient->dispatch();
+  BOOST_CHECK(std::chrono::steady_clock::now() - lStart >= std::chrono::milliseconds(20));
+  BOOST_CHECK_EQUAL(lRead.value(), uint32_t(0xCAFE));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(packet_trace, MmapDummyHardwareFixture)
+{
+  DummyHardwareRunner lRunner(hw);
+  std::shared_ptr<ClientInterface> lClient(ClientFactory::getInstance().getClient("mmap.dummy", MmapDummyHardware::getClientURI(filePath) + "?trace=16", AbstractFixture::userClientActivationList));
+  const Mmap& lMmapClient = dynamic_cast<const Mmap&>(*lClient);
+
+  for (size_t i = 0; i < 3; i++) {
+    lClient->write(0x1, i);
+    lClient->dispatch();
+  }
+
+  const PacketTrace& lTrace = lMmapClient.getPacketTrace();
+  BOOST_CHECK_EQUAL(lTrace.getDepth(), size_t(16));
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfRequests(), lTrace.getNumberOfReplies());
+  BOOST_CHECK(lTrace.getNumberOfRequests() >= 3);
+  BOOST_CHECK_EQUAL(lTrace.getEntries().size(), size_t(2 * lTrace.getNumberOfRequests()));
+  BOOST_CHECK_EQUAL(lTrace.getEntries().back().type, PacketTrace::REPLY);
+}
+
+
+BOOST_FIXTURE_TEST_CASE(drop_reply, MmapDummyHardwareFixture)
+{
+  hw->setErrorInjection(MmapDummyHardware::DROP_REPLY, 2);
+  DummyHardwareRunner lRunner(hw);
+  std::shared_ptr<ClientInterface> lClient(getClient());
+
+  lClient->write(0x1, 0x1234);
+  BOOST_CHECK_NO_THROW(lClient->dispatch());
+
+  lClient->read(0x1);
+  BOOST_CHECK_THROW(lClient->dispatch(), exception::MmapTimeout);
+
+  // Client should recover on the next dispatch, since the dropped request has been consumed
+  ValWord<uint32_t> lRead = lClient->read(0x1);
+  BOOST_CHECK_NO_THROW(lClient->dispatch());
+  BOOST_CHECK_EQUAL(lRead.value(), uint32_t(0x1234));
+}
+
+
+BOOST_FIXTURE_TEST_CASE(corrupt_reply, MmapDummyHardwareFixture)
+{
+  hw->setErrorInjection(MmapDummyHardware::CORRUPT_REPLY, 1);
+  DummyHardwareRunner lRunner(hw);
+  std::shared_ptr<ClientInterface> lClient(getClient());
+
+  ValWord<uint32_t> lRead = lClient->read(0x1);
+  BOOST_CHECK_THROW(lClient->dispatch(), uhal::exception::exception);
+  BOOST_CHECK(!lRead.valid());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
@@ -0,0 +1,110 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/utilities/mmio.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+
+namespace uhal {
+namespace tests {
+
+
+BOOST_AUTO_TEST_SUITE( mmio_copy )
+
+
+BOOST_AUTO_TEST_CASE( read )
+{
+  const std::vector<utilities::mmio::CopyKernel> lKernels = utilities::mmio::getSupportedKernels();
+  BOOST_REQUIRE(not lKernels.empty());
+  BOOST_CHECK(utilities::mmio::isSupported(utilities::mmio::getDefaultKernel()));
+
+  // 64-bit elements, so that source is 8-byte aligned at offset 0
+  std::vector<uint64_t> lStorage(64);
+  uint32_t* lSource = reinterpret_cast<uint32_t*>(lStorage.data());
+  for (size_t i = 0; i < 128; i++)
+    lSource[i] = 0xCAFE0000 + i;
+
+  for (std::vector<utilities::mmio::CopyKernel>::const_iterator lIt = lKernels.begin(); lIt != lKernels.end(); lIt++) {
+    BOOST_TEST_MESSAGE("Kernel: " << utilities::mmio::getName(*lIt));
+    for (size_t lOffset = 0; lOffset < 17; lOffset++) {
+      for (size_t lNrWords = 0; lNrWords < 100; lNrWords++) {
+        std::vector<uint32_t> lDest(lNrWords + 1, 0xDEADBEEF);
+        utilities::mmio::read(lDest.data(), lSource + lOffset, lNrWords, *lIt);
+
+        BOOST_REQUIRE(std::equal(lDest.begin(), lDest.begin() + lNrWords, lSource + lOffset));
+        BOOST_REQUIRE_EQUAL(lDest.back(), uint32_t(0xDEADBEEF));
+      }
+    }
+  }
+}
+
+
+BOOST_AUTO_TEST_CASE( write )
+{
+  const std::vector<utilities::mmio::CopyKernel> lKernels = utilities::mmio::getSupportedKernels();
+
+  std::vector<uint32_t> lSource(100);
+  for (size_t i = 0; i < lSource.size(); i++)
+    lSource.at(i) = 0xCAFE0000 + i;
+
+  for (std::vector<utilities::mmio::CopyKernel>::const_iterator lIt = lKernels.begin(); lIt != lKernels.end(); lIt++) {
+    BOOST_TEST_MESSAGE("Kernel: " << utilities::mmio::getName(*lIt));
+    for (size_t lOffset = 0; lOffset < 17; lOffset++) {
+      for (size_t lNrWords = 0; lNrWords < 100; lNrWords++) {
+        std::vector<uint64_t> lStorage(64 + 1, 0xDEADBEEFDEADBEEF);
+        uint32_t* lDest = reinterpret_cast<uint32_t*>(lStorage.data());
+        utilities::mmio::write(lDest + lOffset, lSource.data(), 4 * lNrWords, *lIt);
+
+        for (size_t i = 0; i < lOffset; i++)
+          BOOST_REQUIRE_EQUAL(lDest[i], uint32_t(0xDEADBEEF));
+        BOOST_REQUIRE(std::equal(lSource.begin(), lSource.begin() + lNrWords, lDest + lOffset));
+        // Trailing odd word is written as a zero-extended 64-bit store
+        BOOST_REQUIRE_EQUAL(lDest[lOffset + lNrWords], uint32_t((lNrWords % 2) == 1 ? 0 : 0xDEADBEEF));
+      }
+    }
+  }
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+} // end ns tests
+} // end ns uhal
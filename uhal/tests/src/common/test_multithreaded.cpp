@@ -67,7 +67,7 @@ void job_multiple ( const std::string& connection, const std::string& id, const
   for ( size_t iter=0; iter!= N_ITERATIONS ; ++iter )
   {
     log ( Info() , "Iteration " , Integer ( iter ) );
-    ConnectionManager manager ( connection );
+    ConnectionManager manager ( connection , AbstractFixture::userClientActivationList );
     HwInterface hw = manager.getDevice ( id );
     hw.setTimeoutPeriod ( TIMEOUT_MULTIPLIER * timeout );
 
@@ -0,0 +1,378 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+#include "uhal/ConnectionManager.hpp"
+#include "uhal/detail/utilities.hpp"
+#include "uhal/NodeTreeBuilder.hpp"
+#include "uhal/NodeTreeCache.hpp"
+#include "uhal/Node.hpp"
+#include "uhal/ProtocolIPbusCore.hpp"
+#include "uhal/tests/fixtures.hpp"
+#include "uhal/utilities/files.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <typeinfo>
+#include <unistd.h>
+
+
+namespace uhal {
+namespace tests {
+
+
+struct NodeTreeCacheFixture : public AbstractFixture {
+  NodeTreeCacheFixture();
+  ~NodeTreeCacheFixture();
+
+  std::shared_ptr<Node> getNodeTree(const std::string& aFileName) const
+  {
+    // Clear in-memory cache, so that tree is taken from the node tree cache (or from XML)
+    NodeTreeBuilder::getInstance().clearAddressFileCache();
+    return std::shared_ptr<Node>(NodeTreeBuilder::getInstance().getNodeTree("file://" + (directory / aFileName).string(), boost::filesystem::current_path() / "."));
+  }
+
+  boost::filesystem::path getEntryPath(const std::string& aFileName) const
+  {
+    return NodeTreeCache(directory / "cache").getEntryPath("file" + (directory / aFileName).string());
+  }
+
+  static std::string readFile(const boost::filesystem::path& aPath)
+  {
+    std::ifstream lFile(aPath.c_str(), std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(lFile)), std::istreambuf_iterator<char>());
+  }
+
+  static void writeFile(const boost::filesystem::path& aPath, const std::string& aContents)
+  {
+    std::ofstream lFile(aPath.c_str(), std::ios::binary | std::ios::trunc);
+    lFile << aContents;
+  }
+
+  static void replaceInFile(const boost::filesystem::path& aPath, const std::string& aOld, const std::string& aNew)
+  {
+    std::string lContents(readFile(aPath));
+    const size_t lPos = lContents.find(aOld);
+    BOOST_REQUIRE(lPos != std::string::npos);
+    lContents.replace(lPos, aOld.size(), aNew);
+    writeFile(aPath, lContents);
+  }
+
+  static void checkEqual(const Node& aNode1, const Node& aNode2);
+
+  const boost::filesystem::path directory;
+  const boost::filesystem::path originalCacheDirectory;
+  const size_t originalFileLoaderThreadCount;
+  const bool originalLazyLoading;
+};
+
+
+NodeTreeCacheFixture::NodeTreeCacheFixture() :
+  directory(boost::filesystem::temp_directory_path() / ("uhal_node_tree_cache_" + std::to_string(getpid()))),
+  originalCacheDirectory(NodeTreeBuilder::getInstance().getCacheDirectory()),
+  originalFileLoaderThreadCount(NodeTreeBuilder::getInstance().getFileLoaderThreadCount()),
+  originalLazyLoading(NodeTreeBuilder::getInstance().getLazyLoading())
+{
+  // Copy all of the test address files, so that they can be modified
+  const boost::filesystem::path lSourceDir(boost::filesystem::path(getAddressFileURI().substr(7)).parent_path());
+  boost::filesystem::create_directories(directory);
+
+  for (boost::filesystem::directory_iterator lIt(lSourceDir); lIt != boost::filesystem::directory_iterator(); lIt++) {
+    if (lIt->path().extension() == ".xml")
+      boost::filesystem::copy_file(lIt->path(), directory / lIt->path().filename());
+  }
+
+  NodeTreeBuilder::getInstance().setCacheDirectory(directory / "cache");
+}
+
+
+NodeTreeCacheFixture::~NodeTreeCacheFixture()
+{
+  NodeTreeBuilder::getInstance().setCacheDirectory(originalCacheDirectory);
+  NodeTreeBuilder::getInstance().setFileLoaderThreadCount(originalFileLoaderThreadCount);
+  NodeTreeBuilder::getInstance().setLazyLoading(originalLazyLoading);
+  NodeTreeBuilder::getInstance().clearAddressFileCache();
+  boost::filesystem::remove_all(directory);
+}
+
+
+void NodeTreeCacheFixture::checkEqual(const Node& aNode1, const Node& aNode2)
+{
+  Node::const_iterator lIt2 = aNode2.begin();
+  for (Node::const_iterator lIt1 = aNode1.begin(); lIt1 != aNode1.end(); lIt1++, lIt2++) {
+    BOOST_REQUIRE(lIt2 != aNode2.end());
+    BOOST_CHECK_EQUAL(lIt1->getPath(), lIt2->getPath());
+    BOOST_CHECK_MESSAGE(typeid(*lIt1) == typeid(*lIt2), lIt1->getPath() << " " << typeid(*lIt1).name() << " " << typeid(*lIt2).name());
+    BOOST_CHECK_EQUAL(lIt1->getAddress(), lIt2->getAddress());
+    BOOST_CHECK_EQUAL(lIt1->getMask(), lIt2->getMask());
+    BOOST_CHECK_EQUAL(lIt1->getPermission(), lIt2->getPermission());
+    BOOST_CHECK_EQUAL(lIt1->getMode(), lIt2->getMode());
+    BOOST_CHECK_EQUAL(lIt1->getSize(), lIt2->getSize());
+    BOOST_CHECK_EQUAL(lIt1->getTags(), lIt2->getTags());
+    BOOST_CHECK_EQUAL(lIt1->getDescription(), lIt2->getDescription());
+    BOOST_CHECK_EQUAL(lIt1->getModule(), lIt2->getModule());
+    BOOST_CHECK(lIt1->getParameters() == lIt2->getParameters());
+    BOOST_CHECK(lIt1->getFirmwareInfo() == lIt2->getFirmwareInfo());
+
+    std::vector<std::string> lChildren1(lIt1->getNodes()), lChildren2(lIt2->getNodes());
+    std::sort(lChildren1.begin(), lChildren1.end());
+    std::sort(lChildren2.begin(), lChildren2.end());
+    BOOST_CHECK_EQUAL_COLLECTIONS(lChildren1.begin(), lChildren1.end(), lChildren2.begin(), lChildren2.end());
+  }
+  BOOST_CHECK(lIt2 == aNode2.end());
+}
+
+
+BOOST_AUTO_TEST_SUITE( node_tree_cache )
+
+
+BOOST_FIXTURE_TEST_CASE(round_trip, NodeTreeCacheFixture)
+{
+  const std::string lFileNames[] = {"dummy_address.xml", "dummy_derived_address.xml"};
+
+  for (const std::string& lFileName : lFileNames) {
+    BOOST_TEST_MESSAGE("Address file: " << lFileName);
+    BOOST_REQUIRE(not boost::filesystem::exists(getEntryPath(lFileName)));
+
+    std::shared_ptr<Node> lNodeFromXml(getNodeTree(lFileName));
+    BOOST_REQUIRE(boost::filesystem::exists(getEntryPath(lFileName)));
+
+    std::shared_ptr<Node> lNodeFromCache(getNodeTree(lFileName));
+    checkEqual(*lNodeFromXml, *lNodeFromCache);
+  }
+}
+
+
+BOOST_FIXTURE_TEST_CASE(entry_used, NodeTreeCacheFixture)
+{
+  BOOST_CHECK_EQUAL(getNodeTree("dummy_address.xml")->getNode("MEM").getDescription(), "A block memory in an example XML file");
+
+  // Modify the description stored in the cache entry, to check that the entry is used on the next load
+  replaceInFile(getEntryPath("dummy_address.xml"), "A block memory in an example XML file", "A block memory in an example bin file");
+  BOOST_CHECK_EQUAL(getNodeTree("dummy_address.xml")->getNode("MEM").getDescription(), "A block memory in an example bin file");
+}
+
+
+BOOST_FIXTURE_TEST_CASE(stale_entry, NodeTreeCacheFixture)
+{
+  const uint32_t lAddress(getNodeTree("dummy_address.xml")->getNode("SUBSYSTEM1.REG").getAddress());
+
+  // Modifying a module file should invalidate the entry for the top-level file
+  replaceInFile(directory / "dummy_level2_address.xml", "address=\"0x0001\"", "address=\"0x0002\"");
+  BOOST_CHECK_EQUAL(getNodeTree("dummy_address.xml")->getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 1);
+  BOOST_CHECK_EQUAL(getNodeTree("dummy_address.xml")->getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 1);
+
+  // ... as should modifying the top-level file itself
+  replaceInFile(directory / "dummy_address.xml", "address=\"0x200000\"", "address=\"0x280000\"");
+  BOOST_CHECK_EQUAL(getNodeTree("dummy_address.xml")->getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 0x80001);
+}
+
+
+BOOST_FIXTURE_TEST_CASE(corrupt_entry, NodeTreeCacheFixture)
+{
+  std::shared_ptr<Node> lNodeFromXml(getNodeTree("dummy_address.xml"));
+  const std::string lEntry(readFile(getEntryPath("dummy_address.xml")));
+
+  // Truncated entries (of various lengths) should be ignored, and replaced
+  const size_t lLengths[] = {0, 4, 40, lEntry.size() / 2, lEntry.size() - 1};
+  for (const size_t lLength : lLengths) {
+    writeFile(getEntryPath("dummy_address.xml"), lEntry.substr(0, lLength));
+    checkEqual(*lNodeFromXml, *getNodeTree("dummy_address.xml"));
+    BOOST_CHECK_EQUAL(readFile(getEntryPath("dummy_address.xml")).size(), lEntry.size());
+  }
+
+  // Same for entries with an invalid header
+  writeFile(getEntryPath("dummy_address.xml"), "xHALNTC1" + lEntry.substr(8));
+  checkEqual(*lNodeFromXml, *getNodeTree("dummy_address.xml"));
+  BOOST_CHECK(readFile(getEntryPath("dummy_address.xml")) == lEntry);
+
+  // Huge counts and invalid enum values should be detected, rather than resulting in exceptions from memory allocation
+  for (size_t i = 12; i + 4 <= lEntry.size(); i += 3) {
+    writeFile(getEntryPath("dummy_address.xml"), lEntry.substr(0, i) + std::string(4, char(0xFF)) + lEntry.substr(i + 4));
+    BOOST_CHECK_NO_THROW(getNodeTree("dummy_address.xml"));
+  }
+}
+
+
+BOOST_FIXTURE_TEST_CASE(parallel_loading, NodeTreeCacheFixture)
+{
+  NodeTreeBuilder::getInstance().setCacheDirectory("");
+
+  const std::string lFileNames[] = {"dummy_address.xml", "dummy_derived_address.xml"};
+  for (const std::string& lFileName : lFileNames) {
+    BOOST_TEST_MESSAGE("Address file: " << lFileName);
+    NodeTreeBuilder::getInstance().setFileLoaderThreadCount(0);
+    std::shared_ptr<Node> lSequentialNode(getNodeTree(lFileName));
+
+    const size_t lThreadCounts[] = {1, 4};
+    for (const size_t lThreadCount : lThreadCounts) {
+      NodeTreeBuilder::getInstance().setFileLoaderThreadCount(lThreadCount);
+      checkEqual(*lSequentialNode, *getNodeTree(lFileName));
+    }
+  }
+
+  // Module files that cannot be loaded should result in the same errors as when loading sequentially
+  replaceInFile(directory / "dummy_level2_address.xml", "dummy_level3_address.xml", "missing_address.xml");
+  const size_t lThreadCounts[] = {0, 4};
+  for (const size_t lThreadCount : lThreadCounts) {
+    NodeTreeBuilder::getInstance().setFileLoaderThreadCount(lThreadCount);
+    BOOST_CHECK_THROW(getNodeTree("dummy_address.xml"), uhal::exception::FileNotFound);
+  }
+}
+
+
+BOOST_FIXTURE_TEST_CASE(lazy_loading, NodeTreeCacheFixture)
+{
+  NodeTreeBuilder::getInstance().setCacheDirectory("");
+
+  const std::string lFileNames[] = {"dummy_address.xml", "dummy_derived_address.xml"};
+  for (const std::string& lFileName : lFileNames) {
+    BOOST_TEST_MESSAGE("Address file: " << lFileName);
+    NodeTreeBuilder::getInstance().setLazyLoading(false);
+    std::shared_ptr<Node> lEagerNode(getNodeTree(lFileName));
+    NodeTreeBuilder::getInstance().setLazyLoading(true);
+
+    // Look-up of a deep node (building only the modules along its path), then all nodes
+    std::shared_ptr<Node> lLazyNode(getNodeTree(lFileName));
+    const std::string lPath(lEagerNode->getNodes().back());
+    BOOST_CHECK_EQUAL(lLazyNode->getNode(lPath).getAddress(), lEagerNode->getNode(lPath).getAddress());
+    BOOST_CHECK(lLazyNode->getNodes() == lEagerNode->getNodes());
+    checkEqual(*lEagerNode, *lLazyNode);
+
+    // Iteration, and look-up by address
+    lLazyNode = getNodeTree(lFileName);
+    checkEqual(*lEagerNode, *lLazyNode);
+    BOOST_CHECK_EQUAL(lLazyNode->getNodesAtAddress(0, 0xFFFFFFFF).size(), lEagerNode->getNodesAtAddress(0, 0xFFFFFFFF).size());
+    BOOST_CHECK_THROW(lLazyNode->getHandle(lPath), exception::InvalidNodeHandle);
+  }
+
+  // Nodes built lazily should send transactions through the device's client
+  HwInterface lHw(ConnectionManager::getDevice("hw", "ipbusudp-2.0://localhost:50001", "file://" + (directory / "dummy_address.xml").string()));
+  BOOST_CHECK_EQUAL(&lHw.getNode("SUBSYSTEM3.DERIVEDMODULE2.REG").getClient(), &lHw.getClient());
+  BOOST_CHECK_EQUAL(&lHw.getNode("SUBSYSTEM1.SUBMODULE.REG").getClient(), &lHw.getClient());
+
+  // Children accessed for the first time from several threads concurrently (whilst other trees are being built) must only be added once
+  NodeTreeBuilder::getInstance().setLazyLoading(false);
+  const std::vector<std::string> lExpectedNodes(getNodeTree("dummy_address.xml")->getNodes());
+  NodeTreeBuilder::getInstance().setLazyLoading(true);
+  const HwInterface lSharedHw(ConnectionManager::getDevice("hw", "ipbusudp-2.0://localhost:50001", "file://" + (directory / "dummy_address.xml").string()));
+  std::vector<std::vector<std::string> > lNodes(4);
+  std::vector<std::thread> lThreads;
+  for (size_t i = 0; i < lNodes.size(); i++) {
+    lThreads.push_back(std::thread([this, &lSharedHw, &lNodes, i] () {
+      lNodes.at(i) = lSharedHw.getNode("SUBSYSTEM3").getNodes();
+      getNodeTree("dummy_derived_address.xml");
+    }));
+  }
+  for (std::thread& lThread : lThreads)
+    lThread.join();
+  for (const std::vector<std::string>& lThreadNodes : lNodes)
+    BOOST_CHECK(lThreadNodes == lNodes.front());
+  BOOST_CHECK_EQUAL(lSharedHw.getNodes().size(), lExpectedNodes.size());
+
+  // Errors in a module's contents should only be reported once the module is accessed
+  replaceInFile(directory / "dummy_level2_address.xml", "dummy_level3_address.xml", "missing_address.xml");
+  std::shared_ptr<Node> lNode;
+  BOOST_REQUIRE_NO_THROW(lNode = getNodeTree("dummy_address.xml"));
+  BOOST_CHECK_NO_THROW(lNode->getNode("REG"));
+  BOOST_CHECK_NO_THROW(lNode->getNode("SUBSYSTEM3.DERIVEDMODULE1.REG"));
+  BOOST_CHECK_THROW(lNode->getNode("SUBSYSTEM1.REG"), uhal::exception::FileNotFound);
+  BOOST_CHECK_THROW(lNode->getNode("SUBSYSTEM1.REG"), uhal::exception::FileNotFound);
+
+  NodeTreeBuilder::getInstance().setLazyLoading(false);
+  BOOST_CHECK_THROW(getNodeTree("dummy_address.xml"), uhal::exception::FileNotFound);
+}
+
+
+BOOST_FIXTURE_TEST_CASE(reload, NodeTreeCacheFixture)
+{
+  NodeTreeBuilder::getInstance().setCacheDirectory("");
+  NodeTreeBuilder::getInstance().setLazyLoading(false);
+  NodeTreeBuilder::getInstance().clearAddressFileCache();
+
+  // Descriptors generated from dummy_address.xml are registered (and checked on device creation), so the modified table is loaded under another name
+  boost::filesystem::copy_file(directory / "dummy_address.xml", directory / "reloaded_address.xml");
+  const std::string lAddressFile("file://" + (directory / "reloaded_address.xml").string());
+  HwInterface lHw(ConnectionManager::getDevice("hw", "ipbusudp-2.0://localhost:50001", lAddressFile));
+  HwInterface lUnboundHw(ConnectionManager::getDevice("hw", "ipbusudp-2.0://localhost:50001", lAddressFile));
+  const Node& lOldNode(lHw.getNode("SUBSYSTEM1.REG"));
+  const uint32_t lAddress(lOldNode.getAddress());
+  const uint32_t lOtherAddress(lHw.getNode("SUBSYSTEM3.DERIVEDMODULE1.REG").getAddress());
+
+  // Nothing should be reloaded if the files are unchanged, or have only been touched
+  BOOST_CHECK_EQUAL(ConnectionManager::reloadAddressFiles(), size_t(0));
+  writeFile(directory / "dummy_level2_address.xml", readFile(directory / "dummy_level2_address.xml"));
+  BOOST_CHECK_EQUAL(ConnectionManager::reloadAddressFiles(), size_t(0));
+  BOOST_CHECK_EQUAL(&lHw.getNode("SUBSYSTEM1.REG"), &lOldNode);
+
+  // Modifying a module file should replace the tree of existing devices (and their copies), but nodes from the old tree remain valid
+  replaceInFile(directory / "dummy_level2_address.xml", "address=\"0x0001\"", "address=\"0x0002\"");
+  HwInterface lHwCopy(lHw);
+  BOOST_CHECK_EQUAL(ConnectionManager::reloadAddressFiles(), size_t(1));
+  BOOST_CHECK_EQUAL(lHw.getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 1);
+  BOOST_CHECK_EQUAL(lHwCopy.getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 1);
+  BOOST_CHECK_EQUAL(&lHw.getNode("SUBSYSTEM1.REG").getClient(), &lHw.getClient());
+  BOOST_CHECK_EQUAL(lHw.getNode("SUBSYSTEM3.DERIVEDMODULE1.REG").getAddress(), lOtherAddress);
+  BOOST_CHECK_EQUAL(lUnboundHw.getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 1);
+  BOOST_CHECK_EQUAL(lOldNode.getAddress(), lAddress);
+  BOOST_CHECK_EQUAL(ConnectionManager::getDevice("hw", "ipbusudp-2.0://localhost:50001", lAddressFile).getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 1);
+
+  // Errors reported by the client (e.g. bus errors) should describe addresses using the new tree
+  for (const uint32_t lErrorAddress : {lAddress, lAddress + 1}) {
+    const exception::IPbusCoreResponseCodeSet lBusError(lHw.getClient(), 0, READ, 0, 0x4, "bus error on read", lErrorAddress, std::make_pair(0u, 0u), std::make_pair(0u, 0u));
+    BOOST_CHECK_EQUAL(detail::getAddressDescription(lHw.getClient(), lErrorAddress, 5), detail::getAddressDescription(lHw.getNode(), lErrorAddress, 5));
+    BOOST_CHECK(std::string(lBusError.what()).find(detail::getAddressDescription(lHw.getNode(), lErrorAddress, 5)) != std::string::npos);
+  }
+  BOOST_CHECK_EQUAL(detail::getAddressDescription(lHw.getClient(), lAddress + 1, 5), "nodes \"REG\", \"MEM\" under \"SUBSYSTEM1\"");
+
+  // If an address table cannot be rebuilt, devices should keep their current tree until the files are fixed
+  replaceInFile(directory / "dummy_level2_address.xml", "dummy_level3_address.xml", "missing_address.xml");
+  BOOST_CHECK_THROW(ConnectionManager::reloadAddressFiles(), uhal::exception::FileNotFound);
+  BOOST_CHECK_EQUAL(lHw.getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 1);
+  replaceInFile(directory / "dummy_level2_address.xml", "missing_address.xml", "dummy_level3_address.xml");
+  BOOST_CHECK_EQUAL(ConnectionManager::reloadAddressFiles(), size_t(0));
+  BOOST_CHECK_EQUAL(lHw.getNode("SUBSYSTEM1.REG").getAddress(), lAddress + 1);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
@@ -26,13 +26,17 @@
 ---------------------------------------------------------------------------
 */
 
+#include <algorithm>
 #include <iomanip>
+#include <random>
+#include <sstream>
 #include <typeinfo>
 
 #include "uhal/NodeTreeBuilder.hpp"
 #include "uhal/utilities/xml.hpp"
 #include "uhal/uhal.hpp"
 
+#include "uhal/detail/StringPool.hpp"
 #include "uhal/detail/utilities.hpp"
 #include "uhal/tests/DummyDerivedNode.hpp"
 #include "uhal/tests/fixtures.hpp"
@@ -748,6 +752,234 @@ BOOST_FIXTURE_TEST_CASE (address_description, DummyAddressFileFixture) {
 }
 
 
+BOOST_FIXTURE_TEST_CASE (nodes_at_address, DummyAddressFileFixture) {
+  const std::shared_ptr<uhal::Node> lTopNode(NodeTreeBuilder::getInstance().getNodeTree(addrFileURI, boost::filesystem::current_path() / "."));
+
+  BOOST_CHECK(lTopNode->getNodesAtAddress(0).empty());
+  BOOST_REQUIRE_EQUAL(lTopNode->getNodesAtAddress(4).size(), size_t(2));
+  BOOST_CHECK_EQUAL(lTopNode->getNodesAtAddress(4).at(0), &lTopNode->getNode("REG_UPPER_MASK"));
+  BOOST_CHECK_EQUAL(lTopNode->getNodesAtAddress(4).at(1), &lTopNode->getNode("REG_LOWER_MASK"));
+  BOOST_CHECK(lTopNode->getNodesAtAddress(4, 0).empty());
+  BOOST_CHECK(lTopNode->getNode("SUBSYSTEM1").getNodesAtAddress(4).empty());
+
+  // Compare look-ups against a brute-force search, for a randomly-generated tree with many overlaps, from both the root and a sub-tree
+  std::mt19937 lRandom(42);
+  std::ostringstream lXml;
+  lXml << "<node>";
+  for (size_t i = 0; i < 20; i++) {
+    lXml << "<node id=\"G" << i << "\" address=\"" << (lRandom() % 4096) << "\">";
+    for (size_t j = 0; j < 50; j++) {
+      const char* lModes[] = {"single", "incremental", "non-incremental"};
+      lXml << "<node id=\"N" << j << "\" address=\"" << (lRandom() % 1024) << "\" mode=\"" << lModes[j % 3] << "\"";
+      if (j % 3 != 0)
+        lXml << " size=\"" << (1 + lRandom() % 300) << "\"";
+      lXml << "/>";
+    }
+    lXml << "</node>";
+  }
+  lXml << "<node id=\"TOP\" address=\"0xFFFFFF00\" mode=\"incremental\" size=\"0x100\"/></node>";
+
+  pugi::xml_document lDoc;
+  lDoc.load_string(lXml.str().c_str());
+  const std::shared_ptr<Node> lTree(NodeTreeBuilder::getInstance().build(lDoc.child("node"), boost::filesystem::path()));
+
+  const Node* lRoots[] = {lTree.get(), &lTree->getNode("G3")};
+  for (const Node* lRoot : lRoots) {
+    for (size_t i = 0; i < 500; i++) {
+      const uint32_t lAddress(i == 0 ? 0xFFFFFFF0 : lRandom() % 6000);
+      const uint32_t lSize(1 + lRandom() % 100);
+
+      std::vector<const Node*> lExpected;
+      for (Node::const_iterator lIt = lRoot->begin(); lIt != lRoot->end(); lIt++) {
+        if (lIt->getMode() == defs::HIERARCHICAL)
+          continue;
+        const uint64_t lFirst(lIt->getAddress());
+        const uint64_t lLast(lFirst + (lIt->getMode() == defs::INCREMENTAL ? lIt->getSize() : 1) - 1);
+        if ((lFirst < uint64_t(lAddress) + lSize) and (lLast >= lAddress))
+          lExpected.push_back(&*lIt);
+      }
+
+      BOOST_CHECK(lRoot->getNodesAtAddress(lAddress, lSize) == lExpected);
+    }
+  }
+}
+
+
+BOOST_FIXTURE_TEST_CASE (node_lookup, DummyAddressFileFixture) {
+  const std::shared_ptr<uhal::Node> lTopNode(NodeTreeBuilder::getInstance().getNodeTree(addrFileURI, boost::filesystem::current_path() / "."));
+
+  // getNodes should list paths in same order as iterator, and each path should resolve to the corresponding node
+  const std::vector<std::string> lPaths(lTopNode->getNodes());
+  Node::const_iterator lIt = ++lTopNode->begin();
+  for (std::vector<std::string>::const_iterator lPathIt = lPaths.begin(); lPathIt != lPaths.end(); lPathIt++, lIt++) {
+    BOOST_REQUIRE(lIt != lTopNode->end());
+    BOOST_CHECK_EQUAL(*lPathIt, lIt->getPath());
+    BOOST_CHECK_EQUAL(&lTopNode->getNode(*lPathIt), &*lIt);
+  }
+  BOOST_CHECK(lIt == lTopNode->end());
+
+  // Look-ups should match whole IDs only
+  const std::string lInvalidPaths[] = {"RE", "REGX", "REG.X", "REG_", "SUBSYSTEM1.RE", "SUBSYSTEM1.REG ", "SUBSYSTEM1..REG", "SUBSYSTEM1."};
+  for (const std::string& lPath : lInvalidPaths)
+    BOOST_CHECK_THROW(lTopNode->getNode(lPath), uhal::exception::NoBranchFoundWithGivenUID);
+
+  BOOST_CHECK_EQUAL(&lTopNode->getNode("SUBSYSTEM1").getNode("REG"), &lTopNode->getNode("SUBSYSTEM1.REG"));
+}
+
+
+BOOST_FIXTURE_TEST_CASE (node_queries, DummyAddressFileFixture) {
+  const HwInterface lHw = ConnectionManager::getDevice("hw1", "ipbusudp-2.0://localhost:50001", addrFileURI);
+  const std::shared_ptr<uhal::Node> lTreeCopy(NodeTreeBuilder::getInstance().getNodeTree(addrFileURI, boost::filesystem::current_path() / "."));
+
+  // Queries should give the same results for top-level nodes (using the cached path list) and for sub-trees
+  const Node* lNodes[] = {&lHw.getNode(), lTreeCopy.get(), &lHw.getNode("SUBSYSTEM1")};
+  for (const Node* lNode : lNodes) {
+    const std::vector<std::string> lPaths(lNode->getNodes());
+    std::vector<std::string> lSortedPaths(lPaths);
+    std::sort(lSortedPaths.begin(), lSortedPaths.end());
+
+    BOOST_CHECK(lNode->getNodes(".*") == lSortedPaths);
+    BOOST_CHECK(lNode->getNodesMatchingGlob("*") == lSortedPaths);
+    BOOST_CHECK(lNode->getNodesWithPrefix("") == lSortedPaths);
+
+    std::vector<std::string> lExpected;
+    for (const std::string& lPath : lSortedPaths)
+      if (lPath.find("REG") == 0)
+        lExpected.push_back(lPath);
+    BOOST_CHECK(lNode->getNodes("REG.*") == lExpected);
+    BOOST_CHECK(lNode->getNodesMatchingGlob("REG*") == lExpected);
+    BOOST_CHECK(lNode->getNodesWithPrefix("REG") == lExpected);
+  }
+
+  std::vector<std::string> lExpected;
+  lExpected.push_back("SUBSYSTEM1.REG");
+  lExpected.push_back("SUBSYSTEM2.REG");
+  BOOST_CHECK(lHw.getNodes("SUBSYSTEM[0-9]\\.REG") == lExpected);
+  BOOST_CHECK(lHw.getNodesMatchingGlob("SUBSYSTEM?.REG") == lExpected);
+  BOOST_CHECK(lHw.getNodesMatchingGlob("*M1.REG") == std::vector<std::string>(1, "SUBSYSTEM1.REG"));
+  BOOST_CHECK(lHw.getNodesMatchingGlob("S*M1.RE?") == std::vector<std::string>(1, "SUBSYSTEM1.REG"));
+  BOOST_CHECK_EQUAL(lHw.getNodesMatchingGlob("SUBSYSTEM3.*.REG").size(), size_t(6));
+  BOOST_CHECK(lHw.getNodesMatchingGlob("SUBSYSTEM1.REG?").empty());
+  BOOST_CHECK(lHw.getNodesMatchingGlob("").empty());
+  BOOST_CHECK(lHw.getNodesWithPrefix("SUBSYSTEM1.REG_").empty());
+  BOOST_CHECK(lHw.getNodesWithPrefix("SUBSYSTEM1.") == lHw.getNodes("SUBSYSTEM1\\..*"));
+}
+
+
+BOOST_FIXTURE_TEST_CASE (shared_node_tree, DummyAddressFileFixture) {
+  HwInterface lHw1 = ConnectionManager::getDevice("hw1", "ipbusudp-2.0://localhost:50001", addrFileURI);
+  HwInterface lHw2 = ConnectionManager::getDevice("hw2", "ipbusudp-2.0://localhost:50002", addrFileURI);
+  const HwInterface lHw1Copy(lHw1);
+
+  // Copies of a device share its node tree (even if copied before the tree is first accessed) ...
+  BOOST_CHECK_EQUAL(&lHw1Copy.getNode(), &lHw1.getNode());
+  BOOST_CHECK_EQUAL(&lHw1Copy.getNode("SUBSYSTEM1.REG"), &lHw1.getNode("SUBSYSTEM1.REG"));
+
+  // ... whilst each device has its own tree, bound to its own client
+  BOOST_CHECK(&lHw2.getNode() != &lHw1.getNode());
+  BOOST_CHECK(lHw2.getNodes() == lHw1.getNodes());
+  BOOST_CHECK_EQUAL(&lHw1.getNode("SUBSYSTEM1.REG").getClient(), &lHw1.getClient());
+  BOOST_CHECK_EQUAL(&lHw2.getNode("SUBSYSTEM1.REG").getClient(), &lHw2.getClient());
+  BOOST_CHECK_EQUAL(&lHw1.getNode().getClient(), &lHw1.getClient());
+
+  // Nodes are bound to the client as they are accessed, so the same node must be returned however it is reached
+  const Node& lSubsystem(lHw2.getNode("SUBSYSTEM1"));
+  const Node& lReg(lHw2.getNode("SUBSYSTEM1.REG"));
+  BOOST_CHECK_EQUAL(&lSubsystem.getNode("REG"), &lReg);
+  BOOST_CHECK_EQUAL(&lHw2.getNode(lHw1.getHandle("SUBSYSTEM1.REG")), &lReg);
+  BOOST_CHECK_EQUAL(lReg.getPath(), "SUBSYSTEM1.REG");
+  BOOST_CHECK(lReg.isChildOf(lSubsystem));
+  const std::vector<const Node*> lNodesAtAddress(lHw2.getNode().getNodesAtAddress(lReg.getAddress()));
+  BOOST_CHECK(std::find(lNodesAtAddress.begin(), lNodesAtAddress.end(), &lReg) != lNodesAtAddress.end());
+
+  size_t lNodeCount = 0;
+  for (Node::const_iterator lIt = lHw2.getNode().begin(); lIt != lHw2.getNode().end(); lIt++, lNodeCount++) {
+    BOOST_CHECK_EQUAL(&lIt->getClient(), &lHw2.getClient());
+    if (lNodeCount > 0)
+      BOOST_CHECK_EQUAL(&lHw2.getNode(lIt->getPath()), &*lIt);
+  }
+  BOOST_CHECK_EQUAL(lNodeCount, lHw2.getNodes().size() + 1);
+
+  // Clearing the address file cache must not invalidate devices whose trees have not yet been accessed
+  HwInterface lHw3 = ConnectionManager::getDevice("hw3", "ipbusudp-2.0://localhost:50003", addrFileURI);
+  ConnectionManager::clearAddressFileCache();
+  BOOST_CHECK_EQUAL(lHw3.getNode("SUBSYSTEM1.REG").getAddress(), lHw1.getNode("SUBSYSTEM1.REG").getAddress());
+  BOOST_CHECK_EQUAL(&lHw3.getNode("SUBSYSTEM1.REG").getClient(), &lHw3.getClient());
+}
+
+
+
+BOOST_FIXTURE_TEST_CASE (node_handles, DummyAddressFileFixture) {
+  HwInterface lHw1 = ConnectionManager::getDevice("hw1", "ipbusudp-2.0://localhost:50001", addrFileURI);
+  HwInterface lHw2 = ConnectionManager::getDevice("hw2", "ipbusudp-2.0://localhost:50002", addrFileURI);
+
+  // Handles should resolve to the same node as the path, in every device using the same address file
+  const std::vector<std::string> lPaths(lHw1.getNodes());
+  for (const std::string& lPath : lPaths) {
+    const Node::Handle lHandle(lHw1.getHandle(lPath));
+    BOOST_CHECK(lHandle.valid());
+    BOOST_CHECK_EQUAL(&lHw1.getNode(lHandle), &lHw1.getNode(lPath));
+    BOOST_CHECK_EQUAL(&lHw2.getNode(lHandle), &lHw2.getNode(lPath));
+  }
+
+  // Handles can also be created from, and resolved by, nodes below the top level
+  const Node& lSubsystem(lHw1.getNode("SUBSYSTEM1"));
+  const Node::Handle lHandle(lSubsystem.getHandle("REG"));
+  BOOST_CHECK_EQUAL(&lSubsystem.getNode(lHandle), &lHw1.getNode("SUBSYSTEM1.REG"));
+  BOOST_CHECK_EQUAL(&lHw2.getNode(lHandle), &lHw2.getNode("SUBSYSTEM1.REG"));
+  BOOST_CHECK_THROW(lHw1.getNode("SUBSYSTEM2").getNode(lHandle), uhal::exception::InvalidNodeHandle);
+
+  BOOST_CHECK(not Node::Handle().valid());
+  BOOST_CHECK_THROW(lHw1.getNode(Node::Handle()), uhal::exception::InvalidNodeHandle);
+  BOOST_CHECK_THROW(lHw1.getHandle("SUBSYSTEM1.REGX"), uhal::exception::NoBranchFoundWithGivenUID);
+
+  // Handles from other address files, and from unindexed trees, are rejected
+  HwInterface lOther = ConnectionManager::getDevice("other", "ipbusudp-2.0://localhost:50001", "file://" + addrFileLevel2AbsPath);
+  BOOST_CHECK_THROW(lOther.getNode(lHandle), uhal::exception::InvalidNodeHandle);
+
+  // ... as are handles from trees that have been destroyed, even if a tree loaded later from the same file reuses their memory
+  const Node::Handle lRegHandle(lHw1.getHandle("SUBSYSTEM1.REG"));
+  ConnectionManager::clearAddressFileCache();
+  HwInterface lReloaded = ConnectionManager::getDevice("hw3", "ipbusudp-2.0://localhost:50003", addrFileURI);
+  BOOST_CHECK_THROW(lReloaded.getNode(lRegHandle), uhal::exception::InvalidNodeHandle);
+  BOOST_CHECK_EQUAL(&lReloaded.getNode(lReloaded.getHandle("SUBSYSTEM1.REG")), &lReloaded.getNode("SUBSYSTEM1.REG"));
+  BOOST_CHECK_EQUAL(&lHw1.getNode(lRegHandle), &lHw1.getNode("SUBSYSTEM1.REG"));
+
+  pugi::xml_document lDoc;
+  lDoc.load_string("<node><node id=\"A\" address=\"0x1\"><node id=\"X\" address=\"0x0\"/></node><node id=\"A\" address=\"0x2\"><node id=\"Y\" address=\"0x0\"/></node></node>");
+  const std::shared_ptr<Node> lTree(NodeTreeBuilder::getInstance().build(lDoc.child("node"), boost::filesystem::path()));
+
+  // With duplicate IDs, path look-ups must still return the first matching sibling, but every node has a handle
+  BOOST_CHECK_EQUAL(lTree->getNode("A.X").getAddress(), uint32_t(0x1));
+  BOOST_CHECK_THROW(lTree->getNode("A.Y"), uhal::exception::NoBranchFoundWithGivenUID);
+  std::vector<const Node*> lNodes;
+  for (Node::const_iterator lIt = lTree->begin(); lIt != lTree->end(); lIt++)
+    lNodes.push_back(&*lIt);
+  BOOST_REQUIRE_EQUAL(lNodes.size(), size_t(5));
+  const Node::Handle lHiddenHandle(lNodes.at(3)->getHandle("Y"));
+  BOOST_CHECK_EQUAL(&lTree->getNode(lHiddenHandle), lNodes.at(4));
+}
+
+
+BOOST_AUTO_TEST_CASE (pooled_strings_freed) {
+  const size_t lInitialPoolSize = detail::PooledString::poolSize();
+
+  pugi::xml_document lDoc;
+  lDoc.load_string("<node><node id=\"POOL_TEST_A\" address=\"0x1\" description=\"Pool test\"/><node id=\"POOL_TEST_B\" address=\"0x2\" tags=\"pool_test\"/></node>");
+  std::shared_ptr<Node> lTree(NodeTreeBuilder::getInstance().build(lDoc.child("node"), boost::filesystem::path()));
+  std::shared_ptr<Node> lCopy(NodeTreeBuilder::getInstance().build(lDoc.child("node"), boost::filesystem::path()));
+  BOOST_CHECK_EQUAL(detail::PooledString::poolSize(), lInitialPoolSize + 4);
+  BOOST_CHECK_EQUAL(lCopy->getNode("POOL_TEST_B").getTags(), "pool_test");
+
+  // Strings must remain in the pool while any node refers to them, and be removed once all nodes referring to them are destroyed
+  lTree.reset();
+  BOOST_CHECK_EQUAL(detail::PooledString::poolSize(), lInitialPoolSize + 4);
+  BOOST_CHECK_EQUAL(lCopy->getNode("POOL_TEST_A").getDescription(), "Pool test");
+  lCopy.reset();
+  BOOST_CHECK_EQUAL(detail::PooledString::poolSize(), lInitialPoolSize);
+}
+
+
 BOOST_AUTO_TEST_SUITE( simple )
 
 BOOST_FIXTURE_TEST_CASE (valid_default, SimpleAddressTableFixture)
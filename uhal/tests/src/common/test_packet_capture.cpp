@@ -0,0 +1,221 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+
+#include "uhal/PacketCapture.hpp"
+
+
+#include <fstream>
+#include <iterator>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "uhal/uhal.hpp"
+#include "uhal/tests/definitions.hpp"
+#include "uhal/tests/fixtures.hpp"
+#include "uhal/tests/tools.hpp"
+
+
+namespace uhal {
+namespace tests {
+
+
+namespace {
+
+//! Type and body of each block in a pcapng file
+typedef std::vector<std::pair<uint32_t, std::vector<uint8_t> > > PcapngBlocks_t;
+
+template <typename T>
+T get(const std::vector<uint8_t>& aData, const size_t aOffset)
+{
+  T lValue;
+  memcpy(&lValue, aData.data() + aOffset, sizeof(T));
+  return lValue;
+}
+
+//! Returns the value of the specified option in a pcapng block, starting the search at the specified offset
+std::string getOption(const std::vector<uint8_t>& aBlock, size_t aOffset, const uint16_t aCode)
+{
+  while (aOffset + 4 <= aBlock.size()) {
+    const uint16_t lCode = get<uint16_t>(aBlock, aOffset);
+    const uint16_t lLength = get<uint16_t>(aBlock, aOffset + 2);
+    if (lCode == 0)
+      break;
+    if (lCode == aCode)
+      return std::string(aBlock.begin() + aOffset + 4, aBlock.begin() + aOffset + 4 + lLength);
+    aOffset += 4 + ((lLength + 3) & ~3);
+  }
+  return "";
+}
+
+//! Reads the blocks in a pcapng file, returning each one's type and body
+PcapngBlocks_t readBlocks(const boost::filesystem::path& aPath)
+{
+  std::ifstream lFile(aPath.c_str(), std::ios::binary);
+  const std::vector<uint8_t> lContents((std::istreambuf_iterator<char>(lFile)), std::istreambuf_iterator<char>());
+
+  PcapngBlocks_t lBlocks;
+  for (size_t lOffset = 0; lOffset + 12 <= lContents.size(); ) {
+    const uint32_t lLength = get<uint32_t>(lContents, lOffset + 4);
+    BOOST_REQUIRE_EQUAL(lLength % 4, uint32_t(0));
+    BOOST_REQUIRE_LE(lOffset + lLength, lContents.size());
+    BOOST_REQUIRE_EQUAL(get<uint32_t>(lContents, lOffset + lLength - 4), lLength);
+    lBlocks.push_back(std::make_pair(get<uint32_t>(lContents, lOffset), std::vector<uint8_t>(lContents.begin() + lOffset + 8, lContents.begin() + lOffset + lLength - 4)));
+    lOffset += lLength;
+  }
+  return lBlocks;
+}
+
+//! Stops capturing packets on destruction, so that a failed test doesn't leave capture running
+struct CaptureGuard {
+  ~CaptureGuard()
+  {
+    PacketCapture::stop();
+  }
+};
+
+}
+
+
+BOOST_AUTO_TEST_SUITE( packet_capture )
+
+
+BOOST_AUTO_TEST_CASE(invalid_path)
+{
+  BOOST_CHECK_THROW(PacketCapture::start("/non/existent/directory/capture.pcapng"), exception::PacketCaptureError);
+  BOOST_CHECK(not PacketCapture::isEnabled());
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(PacketCaptureTestSuite, capture, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+  ClientInterface& lClient = hw.getClient();
+  const boost::filesystem::path lPath(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("uhal-capture-%%%%-%%%%.pcapng"));
+
+  CaptureGuard lGuard;
+  PacketCapture::start(lPath);
+  BOOST_CHECK(PacketCapture::isEnabled());
+  lClient.resetStatistics();
+
+  const std::vector<uint32_t> lValues(1000, 0xCAFE);
+  hw.getNode("REG").write(42);
+  hw.getNode("MEM").writeBlock(lValues);
+  ValVector<uint32_t> lReadValues = hw.getNode("MEM").readBlock(lValues.size());
+  hw.dispatch();
+  BOOST_CHECK(lReadValues.valid());
+
+  const ClientStatistics::Snapshot lStatistics(lClient.getStatistics());
+  PacketCapture::stop();
+  BOOST_CHECK(not PacketCapture::isEnabled());
+  BOOST_CHECK_EQUAL(PacketCapture::getDroppedPacketCount(), uint64_t(0));
+
+  const PcapngBlocks_t lBlocks(readBlocks(lPath));
+  boost::filesystem::remove(lPath);
+
+  // Section header block, with byte-order magic and version 1.0
+  BOOST_REQUIRE(not lBlocks.empty());
+  BOOST_CHECK_EQUAL(lBlocks.at(0).first, uint32_t(0x0A0D0D0A));
+  BOOST_CHECK_EQUAL(get<uint32_t>(lBlocks.at(0).second, 0), uint32_t(0x1A2B3C4D));
+  BOOST_CHECK_EQUAL(get<uint16_t>(lBlocks.at(0).second, 4), uint16_t(1));
+  BOOST_CHECK_EQUAL(get<uint16_t>(lBlocks.at(0).second, 6), uint16_t(0));
+
+  // Interface description block per client, followed by enhanced packet blocks
+  std::vector<std::string> lInterfaces;
+  uint64_t lPacketsSent = 0;
+  uint64_t lPacketsReceived = 0;
+  uint64_t lBytesSent = 0;
+  uint64_t lBytesReceived = 0;
+  uint64_t lLastTime = 0;
+  for (size_t i = 1; i < lBlocks.size(); i++) {
+    const std::vector<uint8_t>& lBody = lBlocks.at(i).second;
+    if (lBlocks.at(i).first == 1) {
+      BOOST_CHECK_EQUAL(get<uint16_t>(lBody, 0), uint16_t(228));
+      BOOST_CHECK_EQUAL(getOption(lBody, 8, 9), std::string(1, char(9)));
+      lInterfaces.push_back(getOption(lBody, 8, 2));
+      continue;
+    }
+
+    BOOST_REQUIRE_EQUAL(lBlocks.at(i).first, uint32_t(6));
+    const uint32_t lInterface = get<uint32_t>(lBody, 0);
+    BOOST_REQUIRE_LT(lInterface, lInterfaces.size());
+    // Packets from all clients and both directions are written in time order
+    const uint64_t lTime = (uint64_t(get<uint32_t>(lBody, 4)) << 32) | get<uint32_t>(lBody, 8);
+    BOOST_CHECK_GE(lTime, lLastTime);
+    lLastTime = lTime;
+    if (lInterfaces.at(lInterface) != lClient.id())
+      continue;
+
+    const uint32_t lLength = get<uint32_t>(lBody, 12);
+    BOOST_REQUIRE_GE(lLength, uint32_t(28));
+    BOOST_CHECK_EQUAL(get<uint32_t>(lBody, 16), lLength);
+    // IPv4 header (big endian) with UDP protocol, then UDP header
+    BOOST_CHECK_EQUAL(lBody.at(20), uint8_t(0x45));
+    BOOST_CHECK_EQUAL(lBody.at(20 + 9), uint8_t(17));
+    BOOST_CHECK_EQUAL((uint32_t(lBody.at(22)) << 8) | lBody.at(23), lLength);
+
+    const std::string lFlags = getOption(lBody, 20 + ((lLength + 3) & ~3), 2);
+    BOOST_REQUIRE_EQUAL(lFlags.size(), size_t(4));
+    if (lFlags.at(0) == 2) {
+      lPacketsSent++;
+      lBytesSent += lLength - 28;
+    }
+    else {
+      BOOST_CHECK_EQUAL(lFlags.at(0), 1);
+      lPacketsReceived++;
+      lBytesReceived += lLength - 28;
+    }
+  }
+
+  BOOST_CHECK_GT(lPacketsSent, uint64_t(0));
+  BOOST_CHECK_EQUAL(lPacketsSent, lStatistics.packetsSent);
+  BOOST_CHECK_EQUAL(lPacketsReceived, lStatistics.packetsReceived);
+  BOOST_CHECK_EQUAL(lBytesSent, lStatistics.bytesSent);
+  BOOST_CHECK_EQUAL(lBytesReceived, lStatistics.bytesReceived);
+}
+)
+
+
+} // end ns tests
+} // end ns uhal
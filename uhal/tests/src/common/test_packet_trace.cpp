@@ -0,0 +1,115 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+#include "uhal/utilities/PacketTrace.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <sstream>
+
+
+namespace uhal {
+namespace tests {
+
+
+BOOST_AUTO_TEST_SUITE( packet_trace )
+
+
+BOOST_AUTO_TEST_CASE(counters)
+{
+  PacketTrace lTrace;
+  BOOST_CHECK_EQUAL(lTrace.getDepth(), size_t(0));
+
+  lTrace.recordRequest(0, 10);
+  lTrace.recordRequest(1, 20);
+  lTrace.recordReply(0, 5, 3);
+  lTrace.recordInterrupt(1);
+  lTrace.recordReply(1, 7, 0);
+
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfRequests(), uint64_t(2));
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfRequestWords(), uint64_t(30));
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfReplies(), uint64_t(2));
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfReplyWords(), uint64_t(12));
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfInterrupts(), uint64_t(1));
+  // Entries are not recorded when tracing is disabled
+  BOOST_CHECK(lTrace.getEntries().empty());
+
+  lTrace.clear();
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfRequests(), uint64_t(0));
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfReplyWords(), uint64_t(0));
+}
+
+
+BOOST_AUTO_TEST_CASE(ring_buffer)
+{
+  PacketTrace lTrace(4);
+  BOOST_CHECK_EQUAL(lTrace.getDepth(), size_t(4));
+
+  lTrace.recordRequest(0, 1);
+  lTrace.recordReply(0, 2, 9);
+  std::vector<PacketTrace::Entry> lEntries(lTrace.getEntries());
+  BOOST_REQUIRE_EQUAL(lEntries.size(), size_t(2));
+  BOOST_CHECK_EQUAL(lEntries.at(0).type, PacketTrace::REQUEST);
+  BOOST_CHECK_EQUAL(lEntries.at(1).type, PacketTrace::REPLY);
+  BOOST_CHECK_EQUAL(lEntries.at(1).nrWords, uint32_t(2));
+  BOOST_CHECK_EQUAL(lEntries.at(1).nrPolls, uint32_t(9));
+  BOOST_CHECK(lEntries.at(0).time <= lEntries.at(1).time);
+
+  // Once full, the oldest entries are overwritten
+  for (uint32_t i = 1; i <= 5; i++)
+    lTrace.recordRequest(i, 10 * i);
+  lEntries = lTrace.getEntries();
+  BOOST_REQUIRE_EQUAL(lEntries.size(), size_t(4));
+  for (uint32_t i = 0; i < 4; i++) {
+    BOOST_CHECK_EQUAL(lEntries.at(i).type, PacketTrace::REQUEST);
+    BOOST_CHECK_EQUAL(lEntries.at(i).pageIndex, i + 2);
+    BOOST_CHECK_EQUAL(lEntries.at(i).nrWords, 10 * (i + 2));
+  }
+
+  std::ostringstream lStream;
+  lStream << lTrace;
+  BOOST_CHECK(lStream.str().find("last 4 transfers") != std::string::npos);
+
+  lTrace.setDepth(2);
+  BOOST_CHECK(lTrace.getEntries().empty());
+  BOOST_CHECK_EQUAL(lTrace.getNumberOfRequests(), uint64_t(6));
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // end ns tests
+} // end ns uhal
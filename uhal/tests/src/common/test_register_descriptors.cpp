@@ -0,0 +1,169 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/uhal.hpp"
+#include "uhal/RegisterDescriptor.hpp"
+#include "uhal/tests/definitions.hpp"
+#include "uhal/tests/dummy_address_registers.hpp"
+#include "uhal/tests/fixtures.hpp"
+#include "uhal/tests/tools.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <vector>
+
+
+namespace uhal {
+namespace tests {
+
+
+struct RegisterDescriptorFixture : public AbstractFixture {
+  RegisterDescriptorFixture() :
+    hw(ConnectionManager::getDevice("dummy", "ipbusudp-2.0://localhost:50001", getAddressFileURI()))
+  {
+  }
+
+  HwInterface hw;
+};
+
+
+BOOST_AUTO_TEST_SUITE( register_descriptors )
+
+
+BOOST_FIXTURE_TEST_CASE (validation, RegisterDescriptorFixture) {
+  // Header generated from the same address table should match
+  BOOST_CHECK_NO_THROW(dummy_address::validate(hw));
+
+  constexpr RegisterDescriptor lWrongAddress { "REG", 0x00000002, 0xffffffff, defs::READWRITE, defs::SINGLE, 1 };
+  constexpr RegisterDescriptor lWrongMask { "REG_UPPER_MASK", 0x00000004, 0x0000ffff, defs::READWRITE, defs::SINGLE, 1 };
+  constexpr RegisterDescriptor lWrongPermission { "REG_READ_ONLY", 0x00000002, 0xffffffff, defs::READWRITE, defs::SINGLE, 1 };
+  constexpr RegisterDescriptor lWrongSize { "SUBSYSTEM1.SUBMODULE.MEM", 0x00270003, 0xffffffff, defs::READWRITE, defs::INCREMENTAL, 512 };
+  constexpr RegisterDescriptor lMissing { "SUBSYSTEM1.MISSING", 0x00210002, 0xffffffff, defs::READWRITE, defs::SINGLE, 1 };
+
+  const RegisterDescriptor* const lWrongDescriptors[] = { &lWrongAddress, &lWrongMask, &lWrongPermission, &lWrongSize, &lMissing };
+  for (const RegisterDescriptor* lDescriptor : lWrongDescriptors) {
+    const RegisterDescriptor* const lDescriptors[] = { &dummy_address::REG, lDescriptor };
+    BOOST_CHECK_THROW(validateRegisterDescriptors(hw.getNode(), lDescriptors), exception::RegisterDescriptorMismatch);
+  }
+}
+
+
+BOOST_FIXTURE_TEST_CASE (checked_on_creation, AbstractFixture) {
+  // Copy the test address files, so that descriptors can be registered under file names that no other test uses
+  const boost::filesystem::path lSourceDir(boost::filesystem::path(getAddressFileURI().substr(7)).parent_path());
+  const boost::filesystem::path lDirectory(boost::filesystem::temp_directory_path() / ("uhal_register_descriptors_" + std::to_string(getpid())));
+  boost::filesystem::create_directories(lDirectory);
+  for (boost::filesystem::directory_iterator lIt(lSourceDir); lIt != boost::filesystem::directory_iterator(); lIt++) {
+    if (lIt->path().extension() == ".xml")
+      boost::filesystem::copy_file(lIt->path(), lDirectory / lIt->path().filename());
+  }
+  boost::filesystem::copy_file(lSourceDir / "dummy_address.xml", lDirectory / "registered_matching.xml");
+  boost::filesystem::copy_file(lSourceDir / "dummy_address.xml", lDirectory / "registered_mismatching.xml");
+
+  static constexpr RegisterDescriptor lWrongAddress { "REG", 0x00000002, 0xffffffff, defs::READWRITE, defs::SINGLE, 1 };
+  static const RegisterDescriptor* const lMismatching[] = { &dummy_address::REG, &lWrongAddress };
+  registerRegisterDescriptors("registered_matching.xml", dummy_address::kRegisters, dummy_address::kRegisters + sizeof(dummy_address::kRegisters) / sizeof(dummy_address::kRegisters[0]));
+  registerRegisterDescriptors("registered_mismatching.xml", lMismatching, lMismatching + 2);
+
+  BOOST_CHECK_NO_THROW(ConnectionManager::getDevice("dummy", "ipbusudp-2.0://localhost:50001", "file://" + (lDirectory / "registered_matching.xml").string()));
+  BOOST_CHECK_THROW(ConnectionManager::getDevice("dummy", "ipbusudp-2.0://localhost:50001", "file://" + (lDirectory / "registered_mismatching.xml").string()), exception::RegisterDescriptorMismatch);
+
+  boost::filesystem::remove_all(lDirectory);
+}
+
+
+BOOST_FIXTURE_TEST_CASE (access_checks, RegisterDescriptorFixture) {
+  ClientInterface& lClient = hw.getClient();
+
+  BOOST_CHECK_THROW(lClient.write(dummy_address::REG_READ_ONLY, 1), exception::WriteAccessDenied);
+  BOOST_CHECK_THROW(lClient.write(dummy_address::REG_MASKED_WRITE_ONLY, 1), exception::WriteAccessDenied);
+  BOOST_CHECK_THROW(lClient.writeBlock(dummy_address::REG_READ_ONLY, std::vector<uint32_t>(1)), exception::WriteAccessDenied);
+  BOOST_CHECK_THROW(lClient.read(dummy_address::REG_WRITE_ONLY), exception::ReadAccessDenied);
+  BOOST_CHECK_THROW(lClient.readBlock(dummy_address::REG_WRITE_ONLY, 1), exception::ReadAccessDenied);
+
+  BOOST_CHECK_THROW(lClient.readBlock(dummy_address::REG, 2), exception::BulkTransferOnSingleRegister);
+  BOOST_CHECK_THROW(lClient.writeBlock(dummy_address::REG, std::vector<uint32_t>(2)), exception::BulkTransferOnSingleRegister);
+  BOOST_CHECK_THROW(lClient.readBlock(dummy_address::SMALL_MEM, dummy_address::SMALL_MEM.size + 1), exception::BulkTransferRequestedTooLarge);
+  BOOST_CHECK_THROW(lClient.writeBlock(dummy_address::SMALL_MEM, std::vector<uint32_t>(dummy_address::SMALL_MEM.size + 1)), exception::BulkTransferRequestedTooLarge);
+}
+
+
+BOOST_AUTO_TEST_SUITE_END()
+
+
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(RegisterDescriptorTestSuite, write_read, DummyHardwareFixture,
+{
+  HwInterface hw = getHwInterface();
+  dummy_address::validate(hw);
+  ClientInterface& lClient = hw.getClient();
+
+  // Write via descriptors, read back via nodes (and vice versa)
+  const uint32_t x = static_cast<uint32_t> ( rand() );
+  lClient.write ( dummy_address::REG, x );
+  ValWord< uint32_t > lReg = hw.getNode ( "REG" ).read();
+
+  const uint32_t lUpper = static_cast<uint32_t> ( rand() ) & 0xffff;
+  const uint32_t lLower = static_cast<uint32_t> ( rand() ) & 0xffff;
+  hw.getNode ( "REG_UPPER_MASK" ).write ( lUpper );
+  lClient.write ( dummy_address::REG_LOWER_MASK, lLower );
+  ValWord< uint32_t > lRegUpper = lClient.read ( dummy_address::REG_UPPER_MASK );
+  ValWord< uint32_t > lRegLower = hw.getNode ( "REG_LOWER_MASK" ).read();
+
+  const uint32_t lSize = dummy_address::SUBSYSTEM1::SUBMODULE::MEM.size;
+  std::vector<uint32_t> xx;
+  for ( size_t i = 0; i != lSize; ++i )
+  {
+    xx.push_back ( static_cast<uint32_t> ( rand() ) );
+  }
+
+  lClient.writeBlock ( dummy_address::SUBSYSTEM1::SUBMODULE::MEM, xx );
+  ValVector< uint32_t > lMem = hw.getNode ( "SUBSYSTEM1.SUBMODULE.MEM" ).readBlock ( lSize );
+  ValVector< uint32_t > lMem2 = lClient.readBlock ( dummy_address::SUBSYSTEM1::SUBMODULE::MEM, lSize );
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+
+  BOOST_CHECK_EQUAL ( lReg.value(), x );
+  BOOST_CHECK_EQUAL ( lRegUpper.value(), lUpper );
+  BOOST_CHECK_EQUAL ( lRegLower.value(), lLower );
+  BOOST_CHECK ( std::vector<uint32_t> ( lMem.begin(), lMem.end() ) == xx );
+  BOOST_CHECK ( std::vector<uint32_t> ( lMem2.begin(), lMem2.end() ) == xx );
+}
+)
+
+
+} // end ns tests
+} // end ns uhal
@@ -87,7 +87,7 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, on_the_fly_connect
   }
   //get the parameters from the file
   std::string uri = getHwInterface().uri();
-  HwInterface hw=ConnectionManager::getDevice ( "test_device_id", uri, address_file );
+  HwInterface hw=ConnectionManager::getDevice ( "test_device_id", uri, address_file, userClientActivationList );
   hw.setTimeoutPeriod(timeout);
 
   uint32_t x = static_cast<uint32_t> ( rand() );
@@ -104,13 +104,45 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, on_the_fly_connect
 
 UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, search_device_id, MinimalFixture,
 {
-  ConnectionManager manager (connectionFileURI);
+  ConnectionManager manager (connectionFileURI, userClientActivationList);
   std::vector<std::string> ids = manager.getDevices ( "^" + deviceId + "$" );
   BOOST_CHECK ( std::find ( ids.begin(),ids.end(), deviceId ) != ids.end() );
 }
 )
 
 
+UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(SingleReadWriteTestSuite, bulk_connect_write_read, DummyHardwareFixture,
+{
+  ConnectionManager manager (connectionFileURI, userClientActivationList);
+  std::vector<std::string> lIds (2, deviceId);
+  std::vector<HwInterface> lDevices = manager.getDevices ( lIds );
+  BOOST_REQUIRE_EQUAL ( lDevices.size(), size_t(2) );
+  BOOST_CHECK ( &lDevices.at(0).getClient() != &lDevices.at(1).getClient() );
+
+  BOOST_CHECK_EQUAL ( lDevices.at(0).id(), deviceId );
+  BOOST_CHECK_EQUAL ( lDevices.at(1).id(), deviceId );
+  BOOST_CHECK_EQUAL ( &lDevices.at(1).getNode ( "REG" ).getClient(), &lDevices.at(1).getClient() );
+
+  // Dummy TCP hardware only accepts one connection at a time, so only the first device is used
+  HwInterface& hw = lDevices.at(0);
+  hw.setTimeoutPeriod(timeout);
+  uint32_t x = static_cast<uint32_t> ( rand() );
+  hw.getNode ( "REG" ).write ( x );
+  ValWord< uint32_t > mem = hw.getNode ( "REG" ).read();
+  BOOST_CHECK_NO_THROW ( hw.dispatch() );
+  BOOST_CHECK ( mem.valid() );
+  BOOST_CHECK_EQUAL ( mem.value(), x );
+
+  std::vector<HwInterface> lAllDevices = manager.getAllDevices();
+  BOOST_CHECK_EQUAL ( lAllDevices.size(), manager.getDevices().size() );
+  BOOST_CHECK_EQUAL ( lAllDevices.front().id(), manager.getDevices().front() );
+
+  lIds.push_back ( "missing.device" );
+  BOOST_CHECK_THROW ( manager.getDevices ( lIds ), uhal::exception::ConnectionUIDDoesNotExist );
+}
+)
+
+
 } // end ns tests
 } // end ns uhal
 
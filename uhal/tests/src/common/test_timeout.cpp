@@ -64,6 +64,8 @@ UHAL_TESTS_DEFINE_CLIENT_TEST_CASES(TimeoutTestSuite, check_timeout, DummyHardwa
 
   // Check we get an exception when first packet timeout occurs (dummy hardware only has delay on first packet)
   BOOST_CHECK_THROW ( { hw.getNode ( "REG" ).read();  hw.dispatch(); } , uhal::exception::ClientTimeout );
+  BOOST_CHECK_EQUAL ( hw.getClient().getStatistics().timeouts , uint64_t ( 1 ) );
+  BOOST_CHECK_EQUAL ( hw.getClient().getStatistics().inFlight , uint32_t ( 0 ) );
 
   const std::chrono::milliseconds sleepDuration = std::chrono::milliseconds(timeout) + std::chrono::seconds(1);
   BOOST_TEST_MESSAGE("Sleeping for " << sleepDuration.count() << "ms to allow DummyHardware to clear itself");
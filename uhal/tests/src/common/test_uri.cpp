@@ -26,11 +26,19 @@
 ---------------------------------------------------------------------------
 */
 
+#include "uhal/grammars/NodeTreeFirmwareInfoAttributeGrammar.hpp"
+#include "uhal/grammars/NodeTreeParametersGrammar.hpp"
+#include "uhal/grammars/Parsers.hpp"
+#include "uhal/grammars/SemicolonDelimitedUriListGrammar.hpp"
 #include "uhal/grammars/URI.hpp"
 #include "uhal/grammars/URIGrammar.hpp"
+#include "uhal/ProtocolControlHub.hpp"
 
+#include <boost/spirit/include/qi.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <map>
+
 
 namespace uhal {
 namespace tests {
@@ -48,6 +56,58 @@ URI parseURI(const std::string& aUri)
 }
 
 
+//! Parses a string with both a boost::spirit grammar and the equivalent hand-written parser, and checks that the results are identical
+template <typename Grammar, typename AttributeType, typename Parser, typename ResultFormatter>
+void checkParsersEqual(const std::string& aString, const Parser& aParser, const ResultFormatter& aFormatter)
+{
+  std::string lSpiritResult, lParserResult;
+  AttributeType lSpiritAttribute, lParserAttribute;
+
+  try {
+    Grammar lGrammar;
+    std::string::const_iterator lBegin(aString.begin());
+    lSpiritResult = boost::spirit::qi::phrase_parse(lBegin, aString.end(), lGrammar, boost::spirit::ascii::space, lSpiritAttribute) ? aFormatter(lSpiritAttribute) : "no match";
+  }
+  catch (const std::exception& aExc) {
+    lSpiritResult = "exception";
+  }
+
+  try {
+    lParserResult = aParser(aString, lParserAttribute) ? aFormatter(lParserAttribute) : "no match";
+  }
+  catch (const uhal::grammars::ParsingError& aExc) {
+    lParserResult = "exception";
+  }
+
+  BOOST_CHECK_MESSAGE(lSpiritResult == lParserResult, "Parsing " << aString << ": grammar gives '" << lSpiritResult << "', parser gives '" << lParserResult << "'");
+}
+
+
+std::string format(const NameValuePairVectorType& aPairs)
+{
+  std::string lResult;
+  for (const auto& lPair : aPairs)
+    lResult += " [" + lPair.first + "]=[" + lPair.second + "]";
+  return lResult;
+}
+
+std::string formatURI(const URI& aURI)
+{
+  return "[" + aURI.mProtocol + "][" + aURI.mHostname + "][" + aURI.mPort + "][" + aURI.mPath + "][" + aURI.mExtension + "]" + format(aURI.mArguments);
+}
+
+std::string formatParameters(const std::unordered_map<std::string, std::string>& aParameters)
+{
+  const std::map<std::string, std::string> lSorted(aParameters.begin(), aParameters.end());
+  return format(NameValuePairVectorType(lSorted.begin(), lSorted.end()));
+}
+
+std::string formatFirmwareInfo(const NodeTreeFirmwareInfoAttribute& aAttribute)
+{
+  return "[" + aAttribute.mType + "]" + format(aAttribute.mArguments);
+}
+
+
 BOOST_AUTO_TEST_SUITE( grammars )
 
 BOOST_AUTO_TEST_SUITE( uri )
@@ -114,6 +174,117 @@ BOOST_AUTO_TEST_CASE (pcie)
 }
 
 
+BOOST_AUTO_TEST_SUITE_END()
+
+
+BOOST_AUTO_TEST_SUITE( parsers )
+
+BOOST_AUTO_TEST_CASE (uri)
+{
+  const std::string lStrings[] = {
+    "ipbusudp-2.0://someHost.xyz:2468",
+    "chtcp-2.0://someHost.xyz:2468?target=other-host.domain:3579",
+    "ipbuspcie-2.0:///dev/aFile,/dev/anotherFile?events=/path/to/someOtherFile&sleep=20",
+    "ipbusmmap-2.0:///dev/uio0?offset=0x100",
+    "http://host:8080/path/to/file.xml?a=1&b=&c=3",
+    " ipbusudp-2.0 :// some Host : 2468 ",
+    "protocol://host:",
+    "protocol://host:/path",
+    "protocol://host:1234/",
+    "protocol://host:1234/path.",
+    "protocol://host?key",
+    "protocol://host?=value",
+    "protocol://host?a=b=c&&d=e",
+    "protocol://",
+    "protocol:/host",
+    "protocol",
+    "://host",
+    ""
+  };
+
+  for (const std::string& lString : lStrings)
+    checkParsersEqual<uhal::grammars::URIGrammar, URI>(lString, uhal::grammars::parseURI, formatURI);
+}
+
+BOOST_AUTO_TEST_CASE (uri_list)
+{
+  const std::string lStrings[] = {
+    "file://connections.xml",
+    "file://a.xml;file://b*.xml ; http://host:8080/c.xml;;",
+    ";;file://a.xml",
+    "file://a b.xml",
+    "file:/a.xml",
+    "file://a.xml;b.xml",
+    ""
+  };
+
+  for (const std::string& lString : lStrings)
+    checkParsersEqual<uhal::grammars::SemicolonDelimitedUriListGrammar, NameValuePairVectorType>(lString, uhal::grammars::parseSemicolonDelimitedUriList, format);
+}
+
+BOOST_AUTO_TEST_CASE (node_attributes)
+{
+  const std::string lParameters[] = {
+    "a=1;b=2&c=3",
+    " x_1=abc;x_1=def;flag",
+    "a=1; b=2",
+    "a=;b=2",
+    "a=1;;b=2",
+    "1a=2",
+    "a=b-c",
+    ""
+  };
+
+  for (const std::string& lString : lParameters)
+    checkParsersEqual<uhal::grammars::NodeTreeParametersGrammar, std::unordered_map<std::string, std::string> >(lString, uhal::grammars::parseNodeTreeParameters, formatParameters);
+
+  const std::string lFirmwareInfo[] = {
+    "endpoint",
+    "endpoint;width=32;",
+    " endpoint ; width = 32 ; depth=1024",
+    "endpoint;width",
+    "endpoint;=32",
+    ";width=32",
+    ""
+  };
+
+  for (const std::string& lString : lFirmwareInfo)
+    checkParsersEqual<uhal::grammars::NodeTreeFirmwareinfoAttributeGrammar, NodeTreeFirmwareInfoAttribute>(lString, uhal::grammars::parseNodeTreeFirmwareInfoAttribute, formatFirmwareInfo);
+}
+
+BOOST_AUTO_TEST_CASE (controlhub_target)
+{
+  URI lURI = parseURI("chtcp-2.0://localhost:10203?target=192.168.10.200:50001");
+  BOOST_CHECK(ExtractTargetID(lURI) == std::make_pair(uint32_t(0xC0A80AC8), uint16_t(50001)));
+
+  lURI = parseURI("chtcp-2.0://localhost:10203?target=localhost:50002");
+  BOOST_CHECK(ExtractTargetID(lURI) == std::make_pair(uint32_t(0x7F000001), uint16_t(50002)));
+
+  lURI = parseURI("chtcp-2.0://localhost:10203?target=localhost");
+  BOOST_CHECK_THROW(ExtractTargetID(lURI), exception::ParsingTargetURLfailed);
+}
+
+BOOST_AUTO_TEST_CASE (host_port)
+{
+  std::pair<std::string, std::string> lHostPort;
+  uhal::grammars::parseHostPort("localhost:8080", lHostPort);
+  BOOST_CHECK(lHostPort == std::make_pair(std::string("localhost"), std::string("8080")));
+
+  uhal::grammars::parseHostPort("[::1]:8080", lHostPort);
+  BOOST_CHECK(lHostPort == std::make_pair(std::string("::1"), std::string("8080")));
+
+  uhal::grammars::parseHostPort("[fe80::1]", lHostPort, false);
+  BOOST_CHECK(lHostPort == std::make_pair(std::string("fe80::1"), std::string()));
+
+  uhal::grammars::parseHostPort("localhost", lHostPort, false);
+  BOOST_CHECK(lHostPort == std::make_pair(std::string("localhost"), std::string()));
+
+  BOOST_CHECK_THROW(uhal::grammars::parseHostPort("localhost", lHostPort), uhal::grammars::ParsingError);
+  BOOST_CHECK_THROW(uhal::grammars::parseHostPort("[::1]", lHostPort), uhal::grammars::ParsingError);
+  BOOST_CHECK_THROW(uhal::grammars::parseHostPort("[::1:8080", lHostPort, false), uhal::grammars::ParsingError);
+  BOOST_CHECK_THROW(uhal::grammars::parseHostPort("[::1]8080", lHostPort, false), uhal::grammars::ParsingError);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,73 @@
+// Generated by gen_uhal_register_header from addr_table_b.xml
+// Do not edit this file; re-generate it whenever the address table changes.
+
+#ifndef _addr_table_b_registers_hpp_
+#define _addr_table_b_registers_hpp_
+
+
+#include "uhal/HwInterface.hpp"
+#include "uhal/RegisterDescriptor.hpp"
+
+
+namespace addr_table_b
+{
+  constexpr uhal::RegisterDescriptor reg1 { "reg1", 0x00000000, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+
+  namespace reg2
+  {
+    constexpr uhal::RegisterDescriptor self { "reg2", 0x00000002, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    constexpr uhal::RegisterDescriptor upper { "reg2.upper", 0x00000002, 0xffff0000, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    constexpr uhal::RegisterDescriptor lower { "reg2.lower", 0x00000002, 0x0000ffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  }
+
+  constexpr uhal::RegisterDescriptor mem1 { "mem1", 0x00001000, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 1024 };
+  constexpr uhal::RegisterDescriptor mem2 { "mem2", 0x00001400, 0xffffffff, uhal::defs::READWRITE, uhal::defs::INCREMENTAL, 1024 };
+
+  namespace submodule1
+  {
+    constexpr uhal::RegisterDescriptor reg1 { "submodule1.reg1", 0x00008000, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    constexpr uhal::RegisterDescriptor reg2 { "submodule1.reg2", 0x00008001, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    constexpr uhal::RegisterDescriptor reg3 { "submodule1.reg3", 0x00008002, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  }
+
+  namespace submodule2
+  {
+    constexpr uhal::RegisterDescriptor reg1 { "submodule2.reg1", 0x00008004, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    constexpr uhal::RegisterDescriptor reg2 { "submodule2.reg2", 0x00008005, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+    constexpr uhal::RegisterDescriptor reg3 { "submodule2.reg3", 0x00008006, 0xffffffff, uhal::defs::READWRITE, uhal::defs::SINGLE, 1 };
+  }
+
+
+  //! All register descriptors declared in this file
+  constexpr const uhal::RegisterDescriptor* kRegisters[] = {
+    &reg1,
+    &reg2::self,
+    &reg2::upper,
+    &reg2::lower,
+    &mem1,
+    &mem2,
+    &submodule1::reg1,
+    &submodule1::reg2,
+    &submodule1::reg3,
+    &submodule2::reg1,
+    &submodule2::reg2,
+    &submodule2::reg3
+  };
+
+
+  //! Checks that the descriptors in this file match the device's address table, throwing uhal::exception::RegisterDescriptorMismatch if not
+  inline void validate ( const uhal::HwInterface& aHw )
+  {
+    uhal::validateRegisterDescriptors ( aHw.getNode() , kRegisters );
+  }
+
+
+  namespace
+  {
+    //! Registers the descriptors, so that each HwInterface created from addr_table_b.xml checks them against its address table
+    const uhal::RegisterDescriptorRegistration kRegistration ( "addr_table_b.xml" , kRegisters );
+  }
+}
+
+
+#endif
@@ -40,6 +40,7 @@
 #define _uhal_Buffers_hpp_
 
 
+#include <chrono>
 #include <deque>
 #include <stdint.h>         // for uint32_t, uint8_t
 #include <utility>          // for pair
@@ -159,12 +160,21 @@ namespace uhal
       //! Clear the counters and the reply buffers
       void clear();
 
+      //! Record the time at which the buffer is handed to the transport layer
+      void setDispatchTime ( const std::chrono::steady_clock::time_point& aTime );
+
+      //! Get the time at which the buffer was handed to the transport layer
+      const std::chrono::steady_clock::time_point& getDispatchTime() const;
+
     private:
       //! The number of bytes that are currently in the send buffer
       uint32_t mSendCounter;
       //! The number of bytes that are currently expected by the reply buffer
       uint32_t mReplyCounter;
 
+      //! The time at which the buffer was handed to the transport layer
+      std::chrono::steady_clock::time_point mDispatchTime;
+
       //! The start location of the memory buffer
       std::vector<uint8_t> mSendBuffer;
       //! The queue of reply destinations
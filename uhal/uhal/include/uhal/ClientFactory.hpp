@@ -137,6 +137,9 @@ namespace uhal
       template <class T>
       void add ( const std::string& aProtocol , const std::string& aDescription, bool aUserDefined );
 
+      //! Deleter of the clients returned by getClient, which deregisters each client from the metrics exporter before destroying it
+      static void deleteClient ( ClientInterface* aClient );
+
       //! An abstract base class for defining the interface to the creators
       class CreatorInterface
       {
@@ -155,9 +158,9 @@ namespace uhal
           	Interface to a function which create a new IPbus client based on the protocol identifier specified
           	@param aId the uinique identifier that the client will be given.
           	@param aUri a string containing the full URI of the target. This string is parsed to extract the protocol, and it is this which is used to identify the relevent creator which is then used to create the client.
-          	@return a shared pointer to the newly created client
+          	@return a pointer to the newly created client
           */
-          virtual std::shared_ptr<ClientInterface> create ( const std::string& aId , const URI& aUri ) = 0;
+          virtual std::unique_ptr<ClientInterface> create ( const std::string& aId , const URI& aUri ) = 0;
       };
 
       //! Templated concrete implementation with a CreatorInterface interface
@@ -180,9 +183,9 @@ namespace uhal
           	Concrete function which creates a new IPbus client based on the protocol identifier specified
           	@param aId the uinique identifier that the client will be given.
           	@param aUri a string containing the full URI of the target. This string is parsed to extract the protocol, and it is this which is used to identify the relevent creator which is then used to create the client.
-          	@return a shared pointer to the newly created client
+          	@return a pointer to the newly created client
           */
-          std::shared_ptr<ClientInterface> create ( const std::string& aId , const URI& aUri );
+          std::unique_ptr<ClientInterface> create ( const std::string& aId , const URI& aUri );
       };
 
 
@@ -41,6 +41,7 @@
 #define _uhal_ClientInterface_hpp_
 
 
+#include <atomic>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -54,6 +55,9 @@
 #include "uhal/grammars/URI.hpp"
 #include "uhal/log/exception.hpp"
 #include "uhal/definitions.hpp"
+#include "uhal/PacketCapture.hpp"
+#include "uhal/RegisterDescriptor.hpp"
+#include "uhal/utilities/ClientStatistics.hpp"
 #include "uhal/ValMem.hpp"
 
 
@@ -163,6 +167,17 @@ namespace uhal
       */
       uint64_t getTimeoutPeriod();
 
+      /**
+        Returns a snapshot of this client's performance counters and latency histograms (packets, bytes and transactions
+        sent, packet round-trip times, dispatch durations, etc.)
+        @note Not protected by user mutex, so can be called from any thread, including while dispatching
+        @return a copy of the current values of the counters and histograms
+      */
+      ClientStatistics::Snapshot getStatistics() const;
+
+      //! Resets this client's performance counters and latency histograms
+      void resetStatistics();
+
     protected:
       /**
       	A method to retrieve the timeout period currently being used
@@ -237,6 +252,35 @@ namespace uhal
       */
       ValWord< uint32_t > rmw_sum ( const uint32_t& aAddr , const int32_t& aAddend );
 
+      /**
+      	Write a single word to a register described by a (generated) register descriptor, applying the same checks as Node::write
+      	@param aRegister the descriptor of the register to write
+      	@param aValue the value to write to the register
+      */
+      ValHeader write ( const RegisterDescriptor& aRegister, const uint32_t& aValue );
+
+      /**
+      	Write a block of data to a memory or FIFO described by a (generated) register descriptor, applying the same checks as Node::writeBlock
+      	@param aRegister the descriptor of the memory or FIFO to write
+      	@param aValues the values to write
+      */
+      ValHeader writeBlock ( const RegisterDescriptor& aRegister, const std::vector< uint32_t >& aValues );
+
+      /**
+      	Read a single word from a register described by a (generated) register descriptor, applying the same checks as Node::read
+      	@param aRegister the descriptor of the register to read
+      	@return a Validated Memory which wraps the location to which the reply data is to be written
+      */
+      ValWord< uint32_t > read ( const RegisterDescriptor& aRegister );
+
+      /**
+      	Read a block of data from a memory or FIFO described by a (generated) register descriptor, applying the same checks as Node::readBlock
+      	@param aRegister the descriptor of the memory or FIFO to read
+      	@param aSize the number of words to read
+      	@return a Validated Memory which wraps the location to which the reply data is to be written
+      */
+      ValVector< uint32_t > readBlock ( const RegisterDescriptor& aRegister, const uint32_t& aSize );
+
     protected:
       /**
         Pure virtual function which actually performs the dispatch operation
@@ -247,6 +291,9 @@ namespace uhal
       //! Virtual function to dispatch all buffers and block until all replies are received
       virtual void Flush( );
 
+      //! Virtual function to complete any queued transactions that are not carried in IPbus buffers; called at the end of every dispatch
+      virtual void dispatchUnbufferedTransactions( );
+
 
       //! Send a byte order transaction
       virtual ValHeader implementBOT( ) = 0;
@@ -388,6 +435,12 @@ namespace uhal
       void updateCurrentBuffers();
       void deleteBuffers();
 
+      /**
+        Updates the performance counters, stamps the buffer with the current time, and captures the packet (if enabled), when it is handed to the transport layer
+        @param aBuffers the buffer that is about to be dispatched
+      */
+      void recordPacketSent ( Buffers& aBuffers );
+
 
     private:
       //! A MutEx lock used to make sure the access functions are thread safe
@@ -413,7 +466,17 @@ namespace uhal
       //! Timeout period for transactions
       boost::posix_time::time_duration mTimeoutPeriod;
 
-      std::weak_ptr<Node> mNode;
+      //! Node tree used to describe addresses in error messages (replaced when the address file is reloaded)
+      std::weak_ptr<const Node> mNode;
+
+      //! Protects mNode, which is read when errors are reported from the transport's threads
+      mutable std::mutex mNodeMutex;
+
+      //! Performance counters and latency histograms
+      ClientStatistics mStatistics;
+
+      //! Stream in which this client's packets are captured (created when the first packet is captured)
+      std::atomic< PacketCapture::Stream* > mCaptureStream;
 
       friend class IPbusCore;
       friend class HwInterface;
@@ -145,6 +145,21 @@ namespace uhal
       */
       std::vector<std::string> getDevices ( const std::string& aRegex ) const;
 
+      /**
+        Creates HwInterfaces for several devices at once, which is much faster than calling getDevice for each of them: the node tree
+        is only built once for each distinct address table, and the clients (whose construction includes resolving the hostname) are
+        created in parallel.
+        @param aIds the unique identifiers of the connections
+        @return HwInterfaces for the devices, in the same order as the identifiers
+      */
+      std::vector<HwInterface> getDevices ( const std::vector<std::string>& aIds );
+
+      /**
+        Creates HwInterfaces for all devices known to this connection manager (see getDevices)
+        @return HwInterfaces for all devices, ordered by identifier
+      */
+      std::vector<HwInterface> getAllDevices ( );
+
       /**
       	Use the specified protocol, host, and port to create an IPbus Client
       	Use the specified address table to create the Node tree
@@ -161,6 +176,17 @@ namespace uhal
       //! Clears cache of Node tree structure for previously-opened address files (thread safe)
       static void clearAddressFileCache();
 
+      /**
+        Reloads the address files that have changed since they were loaded (see NodeTreeBuilder::reloadAddressFiles), and replaces the
+        node trees of existing HwInterfaces that use them without affecting their connections (thread safe). Each replacement is atomic,
+        i.e. concurrent node look-ups return nodes from either the old or new tree; nodes obtained from the old tree (which describe the
+        old layout) remain valid until the tree is replaced again by a later reload, or the HwInterface is destroyed, whereas node
+        handles must be re-created. If any address table cannot
+        be rebuilt, no node trees are replaced and the exception is re-thrown.
+        @return the number of address tables that have been reloaded
+      */
+      static size_t reloadAddressFiles();
+
     private:
       //! A mutex lock to protect access to the factory methods in multithreaded environments
       static std::mutex mMutex;
@@ -56,13 +56,20 @@
   { \
     static_assert((std::is_base_of<uhal::Node, classname>::value), "Derived node class must be a descendant of uhal::Node"); \
     return new classname ( static_cast<const classname&> ( *this ) ); \
+  } \
+  uhal::Node* classname::cloneUnbound() const \
+  { \
+    classname* lNode ( new classname ( static_cast<const classname&> ( *this ) ) ); \
+    lNode->discardChildren(); \
+    return lNode; \
   }
 
 
-//! Macro which adds the clone method implementation for derived classes
+//! Macro which adds the declarations of the clone methods for derived classes
 #define UHAL_DERIVEDNODE(DerivedType) \
 protected: \
-  virtual uhal::Node* clone() const;
+  virtual uhal::Node* clone() const; \
+  virtual uhal::Node* cloneUnbound() const;
 
   
 namespace uhal
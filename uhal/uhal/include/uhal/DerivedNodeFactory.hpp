@@ -43,6 +43,7 @@
 
 #include <memory>
 #include <string>
+#include <typeindex>
 #include <unordered_map>
 
 
@@ -62,6 +63,7 @@ namespace uhal
   class DerivedNodeFactory
   {
     friend class NodeTreeBuilder;
+    friend class NodeTreeCache;
 
     public:
 
@@ -94,6 +96,15 @@ namespace uhal
 
       Node* convertToClassType( Node* aNode );
 
+      //! Converts a node to the derived type registered under the specified name, rather than under the node's class name
+      Node* convertToClassType( Node* aNode , const std::string& aClassName );
+
+      /**
+        Returns the name under which the node's derived type was registered (which can differ from the node's class name, e.g. for modules)
+        @return the registered name, or an empty string if the node is not of a registered derived type
+      */
+      std::string getRegisteredClassName( const Node& aNode ) const;
+
       /**
         Method to create an associate between a node type identifier and a Creator of that particular node type
         @param aNodeClassName the node type identifier
@@ -156,6 +167,9 @@ namespace uhal
 
       //! Hash map associating a creator for a particular node type with a string identifier for that node type
       std::unordered_map< std::string , std::shared_ptr< CreatorInterface > > mCreators;
+
+      //! Hash map associating each registered derived node type with its string identifier
+      std::unordered_map< std::type_index , std::string > mClassNames;
   };
 }
 
@@ -0,0 +1,125 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_HttpFileCache_hpp_
+#define _uhal_HttpFileCache_hpp_
+
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+
+namespace uhal
+{
+  struct HttpResponseType;
+
+
+  /**
+    On-disk cache of files retrieved over HTTP, which allows processes to revalidate remote address tables rather than
+    re-downloading them, and to keep working when the server is unreachable.
+
+    The cache is content-addressed: each distinct file body is stored once, in a file named after the hash of its contents,
+    and each URL has a small text entry (named after a hash of the URL) recording the URL, the ETag and Last-Modified headers
+    from the server's response, and the size and hash of the body. Files are written to a temporary path and then renamed, so
+    the cache can be shared by concurrent threads and processes.
+  */
+  class HttpFileCache
+  {
+    public:
+      //! The cache entry for a URL
+      struct Entry
+      {
+        //! The URL (without the protocol prefix)
+        std::string url;
+        //! Value of the ETag header in the server's response (empty if absent)
+        std::string etag;
+        //! Value of the Last-Modified header in the server's response (empty if absent)
+        std::string lastModified;
+        //! Size of the file, in bytes
+        uint64_t size;
+        //! Hash of the file's contents
+        uint64_t hash;
+      };
+
+      //! @param aDirectory directory in which cache entries are stored (created if it doesn't exist)
+      HttpFileCache ( const boost::filesystem::path& aDirectory );
+
+      ~HttpFileCache ();
+
+      const boost::filesystem::path& getDirectory() const;
+
+      /**
+        Loads a file from the cache, if a valid entry exists
+        @param aURL the URL (without the protocol prefix)
+        @param aEntry the URL's cache entry (only set if entry is valid)
+        @param aContents the file's contents (only set if entry is valid)
+        @return whether a valid entry exists
+      */
+      bool load ( const std::string& aURL , Entry& aEntry , std::vector<uint8_t>& aContents ) const;
+
+      /**
+        Writes a file to the cache, replacing any existing entry for the URL. Failures are logged, but not thrown.
+        @param aURL the URL (without the protocol prefix)
+        @param aResponse the server's response
+      */
+      void store ( const std::string& aURL , const HttpResponseType& aResponse ) const;
+
+      //! Returns the path of the entry for the specified URL
+      boost::filesystem::path getEntryPath ( const std::string& aURL ) const;
+
+      //! Returns the path of the file used to store contents with the specified hash
+      boost::filesystem::path getContentPath ( const uint64_t aHash ) const;
+
+      /**
+        Extracts the value of a header from an HTTP response
+        @param aHeaders the response's headers (one per line)
+        @param aName the header's name (case insensitive)
+        @return the header's value, or an empty string if it is not present
+      */
+      static std::string getHeader ( const std::string& aHeaders , const std::string& aName );
+
+    private:
+      //! Writes a file via a temporary path; returns whether successful
+      static bool write ( const boost::filesystem::path& aPath , const void* aData , const size_t aSize );
+
+      boost::filesystem::path mDirectory;
+  };
+
+}
+
+#endif
@@ -40,9 +40,12 @@
 #define _uhal_HwInterface_hpp_
 
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <stdint.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "uhal/ClientInterface.hpp" // IWYU pragma: keep
@@ -51,6 +54,11 @@
 
 namespace uhal
 {
+  namespace detail
+  {
+    class NodeBinding;
+  }
+
   //! A class which bundles a node tree and an IPbus client interface together providing everything you need to navigate and perform hardware access
   class HwInterface
   {
@@ -62,10 +70,16 @@ namespace uhal
       */
       HwInterface ( const std::shared_ptr<ClientInterface>& aClientInterface , const std::shared_ptr< Node >& aNode );
 
+      /**
+      	Constructor
+      	@param aClientInterface a shared pointer to a client interface which performs the transport
+      	@param aNode a shared pointer to an unbound node tree representing the >>full<< endpoint structure, which may be shared with other HwInterfaces and is never copied. Nodes are bound to the client as they are first accessed (see detail::NodeBinding), so that neither construction nor the memory used by each device depends on the size of the tree
+      */
+      HwInterface ( const std::shared_ptr<ClientInterface>& aClientInterface , const std::shared_ptr< const Node >& aNode );
+
       /**
       	Copy Constructor
-        Calls the copy constructor on the ClientInterface
-        Calls the clone method on the Node Tree
+        Shares both the ClientInterface and the (client-bound) node tree with the original
         @param hwInterface a Hardware Interface instance to copy
       */
       HwInterface ( const HwInterface& );
@@ -133,6 +147,28 @@ namespace uhal
       template< typename T>
       const T& getNode ( const std::string& aId ) const;
 
+      /**
+        Resolve a full-stop delimeted name path, relative to the top-level node, into a handle that can be used to retrieve the node without path look-ups
+        @param aId a full-stop delimeted name path to a node, relative to the top-level node
+        @return handle to the Node given by the identifier; valid for all devices using the same address file
+      */
+      Node::Handle getHandle ( const std::string& aId ) const;
+
+      /**
+        Retrieve the Node referred to by a handle
+        @param aHandle a handle returned by getHandle
+        @return the Node referred to by the handle
+      */
+      const Node& getNode ( const Node::Handle& aHandle ) const;
+
+      /**
+        Retrieve the Node referred to by a handle, and cast it to a particular node type
+        @param aHandle a handle returned by getHandle
+        @return the Node referred to by the handle
+      */
+      template< typename T>
+      const T& getNode ( const Node::Handle& aHandle ) const;
+
       /**
       	Return all node IDs known to this HwInterface
       	@return all node IDs known to this HwInterface
@@ -146,18 +182,89 @@ namespace uhal
       */
       std::vector<std::string> getNodes ( const std::string& aRegex ) const;
 
+      /**
+        Return all node IDs known to this HwInterface which match a glob pattern; faster than a regular expression for simple queries
+        @param aPattern a pattern against which the node IDs are tested, in which '*' matches any sequence of characters (including '.') and '?' matches any single character
+        @return all matching node IDs, sorted alphabetically
+      */
+      std::vector<std::string> getNodesMatchingGlob ( const std::string& aPattern ) const;
+
+      /**
+        Return all node IDs known to this HwInterface which start with the specified string
+        @param aPrefix the string with which the node IDs must start (e.g. "SUBSYSTEM1." for all descendants of SUBSYSTEM1)
+        @return all matching node IDs, sorted alphabetically
+      */
+      std::vector<std::string> getNodesWithPrefix ( const std::string& aPrefix ) const;
+
     private:
+      friend class ConnectionManager;
+
+      //! The node tree of a HwInterface and its copies, which is bound to their client as nodes are accessed
+      struct NodeTree
+      {
+        NodeTree ( ClientInterface* aClient , const std::shared_ptr< const Node >& aPrototype );
+
+        ~NodeTree();
+
+        //! The client to which the node tree is bound
+        ClientInterface* mClient;
+
+        //! The shared, unbound node tree (NULL if the HwInterface was constructed from an already-bound tree)
+        std::shared_ptr< const Node > mPrototype;
+
+        //! The top-level node of the current bound tree (NULL until first access)
+        std::atomic< Node* > mNode;
+
+        //! The already-bound tree that the HwInterface was constructed from, if any
+        std::shared_ptr< Node > mClaimedNode;
+
+        //! Binding of the shared tree to the client (NULL until first access)
+        std::unique_ptr< detail::NodeBinding > mBinding;
+
+        /**
+          Binding replaced by the most recent reload of the address file. It is kept so that references to nodes obtained before a
+          reload remain valid until the next reload, whilst the memory used by each device is bounded (i.e. at most two bindings)
+        */
+        std::unique_ptr< detail::NodeBinding > mRetiredBinding;
+
+        //! Flag ensuring that the node tree is only bound once
+        std::once_flag mBindFlag;
+
+        //! Protects the prototype and bound trees, which are replaced when the address file is reloaded
+        std::mutex mMutex;
+      };
+
       /**
-      	A function which sets the HwInterface pointer in the Node to point to this HwInterface
+      	A function which sets the client pointer in the Node and its descendants to point to the specified client
       	@param aNode a Node that is to be claimed
+      	@param aClient the client
+      */
+      static void claimNode ( Node& aNode , ClientInterface* aClient );
+
+      //! Returns the top-level node of the tree bound to the client, creating the binding on first call
+      Node& getBoundNode() const;
+
+      /**
+        Replaces the node trees of all HwInterfaces that were created from the specified prototype trees; called after address files have been reloaded
+        @param aReplacements each prototype tree that has been rebuilt, paired with its replacement
+        @return the number of HwInterfaces (excluding copies) whose node tree has been replaced
       */
-      void claimNode ( Node& aNode );
+      static size_t replaceNodeTrees ( const std::vector< std::pair< std::shared_ptr< const Node > , std::shared_ptr< const Node > > >& aReplacements );
 
       //! A shared pointer to the IPbus client through which the transactions will be sent
       std::shared_ptr<ClientInterface> mClientInterface;
 
-      //! A node tree
-      std::shared_ptr<Node> mNode;
+      //! The node tree
+      std::shared_ptr<NodeTree> mNodeTree;
+
+      //! Node trees of all HwInterfaces created from a prototype tree, so that they can be replaced when address files are reloaded
+      static std::vector< std::weak_ptr< NodeTree > > mNodeTrees;
+
+      //! Number of entries in mNodeTrees above which expired entries are removed
+      static size_t mNodeTreesSweepSize;
+
+      //! Protects mNodeTrees
+      static std::mutex mNodeTreesMutex;
   };
 
 }
@@ -0,0 +1,148 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_MetricsExporter_hpp_
+#define _uhal_MetricsExporter_hpp_
+
+
+#include <chrono>
+#include <condition_variable>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include "uhal/log/exception.hpp"
+
+
+namespace uhal
+{
+  class ClientInterface;
+
+  namespace exception
+  {
+    //! Exception class to handle the case where the metrics exporter could not be started.
+    UHAL_DEFINE_EXCEPTION_CLASS ( MetricsExporterError , "Exception class to handle the case where the metrics exporter could not be started." )
+  }
+
+
+  /**
+    Exports the statistics of all clients in the process that were created by ClientFactory (and hence by ConnectionManager),
+    labelled by device ID and URI (see ClientInterface::getStatistics), in the Prometheus / OpenMetrics text formats. The metrics can either be served over HTTP, or periodically written to a
+    file (e.g. for the node exporter's textfile collector). The statistics are only read when the metrics are formatted, so
+    the exporter adds no overhead (or locking) on the data path.
+
+    Rather than creating an exporter in code, one can also be started for the whole process by setting environment variables
+    before the first client is created: UHAL_METRICS_PORT (port, address:port or [IPv6 address]:port, on which to serve metrics
+    over HTTP; the address defaults to 127.0.0.1) and/or UHAL_METRICS_FILE (path of the file to write every 15 seconds).
+  */
+  class MetricsExporter
+  {
+    public:
+      /**
+        Serves the metrics over HTTP from a background thread, at path /metrics (and /). The OpenMetrics format is used if
+        requested in the Accept header, otherwise the Prometheus text format.
+        @param aPort the port to listen on (0 to let the OS choose, see getPort)
+        @param aAddress the address to listen on (by default, only accessible from the local host)
+      */
+      MetricsExporter ( const uint16_t aPort , const std::string& aAddress = "127.0.0.1" );
+
+      /**
+        Periodically writes the metrics in the Prometheus text format to a file from a background thread. The file is
+        written via a temporary file and then renamed, so that readers never see partially-written files.
+        @param aPath the path of the file
+        @param aPeriod the period between writes
+      */
+      MetricsExporter ( const boost::filesystem::path& aPath , const std::chrono::milliseconds& aPeriod = std::chrono::seconds ( 15 ) );
+
+      MetricsExporter ( const MetricsExporter& ) = delete;
+      MetricsExporter& operator= ( const MetricsExporter& ) = delete;
+
+      //! Stops the background thread
+      ~MetricsExporter();
+
+      //! Returns the port that the HTTP server is listening on (0 for file exporters)
+      uint16_t getPort() const;
+
+      /**
+        Writes the current metrics of all clients to a stream
+        @param aStream the stream
+        @param aOpenMetrics whether to use the OpenMetrics text format, rather than the Prometheus text format
+      */
+      static void write ( std::ostream& aStream , const bool aOpenMetrics = true );
+
+      //! Registers a client whose statistics are exported (called by ClientFactory once the client has been constructed)
+      static void registerClient ( const ClientInterface& aClient );
+
+      //! Deregisters a client (called by ClientFactory's deleter, before the client's destruction starts)
+      static void deregisterClient ( const ClientInterface& aClient );
+
+    private:
+      struct HttpSession;
+
+      void accept();
+
+      void writeFilePeriodically();
+
+      //! Writes the metrics to the file; failures are logged, but not thrown
+      void writeFile() const;
+
+      //! Starts the process-wide exporters configured by environment variables (if any)
+      static void startFromEnvironment();
+
+      boost::asio::io_service mIOservice;
+      std::unique_ptr< boost::asio::ip::tcp::acceptor > mAcceptor;
+
+      boost::filesystem::path mPath;
+      std::chrono::milliseconds mPeriod;
+      bool mStop;
+      std::mutex mMutex;
+      std::condition_variable mConditionVariable;
+
+      std::thread mThread;
+
+      static const char* const mPortEnvVariable;
+      static const char* const mFileEnvVariable;
+  };
+
+}
+
+#endif
@@ -41,7 +41,9 @@
 #define _uhal_Node_hpp_
 
 
+#include <deque>
 #include <iterator>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
@@ -49,6 +51,7 @@
 
 #include "uhal/ClientInterface.hpp"
 #include "uhal/definitions.hpp"
+#include "uhal/detail/StringPool.hpp"
 #include "uhal/log/exception.hpp"
 #include "uhal/ValMem.hpp"
 
@@ -77,6 +80,20 @@ namespace uhal
     UHAL_DEFINE_EXCEPTION_CLASS ( BulkTransferOffsetRequestedForSingleRegister , "Exception class to handle the case where an offset was requested into a Single Register." )
     //! Exception class to handle the case of an attempt to cast a node to the wrong type.
     UHAL_DEFINE_EXCEPTION_CLASS ( BadNodeCast , "Exception class to handle the case of an attempt to cast a node to the wrong type." )
+    //! Exception class to handle the case where a node handle was used with a node tree that it does not belong to.
+    UHAL_DEFINE_EXCEPTION_CLASS ( InvalidNodeHandle , "Exception class to handle the case where a node handle was used with a node tree that it does not belong to." )
+  }
+
+  class Node;
+
+  namespace detail
+  {
+    class NodeBinding;
+    class PathIndex;
+    struct BoundNode;
+    struct DeferredChildren;
+
+    std::vector<std::pair<const Node*, const Node*> > getAddressOverlaps ( const Node& aNode );
   }
 
 
@@ -86,13 +103,16 @@ namespace uhal
     private:
       friend class HwInterface;
       friend class NodeTreeBuilder;
+      friend class NodeTreeCache;
       friend class DerivedNodeFactory;
+      friend class detail::NodeBinding;
+      friend std::vector<std::pair<const Node*, const Node*> > detail::getAddressOverlaps ( const Node& aNode );
 
     public:
       class const_iterator : public std::iterator< std::forward_iterator_tag , Node , ptrdiff_t, const Node* , const Node& >
       {
           friend class Node;
-          typedef std::deque< std::vector< Node* >::const_iterator > stack;
+          typedef std::vector< std::vector< Node* >::const_iterator > stack;
 
         public:
           const_iterator();
@@ -117,9 +137,43 @@ namespace uhal
           stack mItStack;
       };
 
+      /**
+        Lightweight handle to a node, obtained from getHandle, that can be resolved back to the node without any string look-ups.
+        Handles are indices into the node table built when the address table is loaded, so remain valid for all copies of the
+        node tree (e.g. all HwInterface instances created from the same address file), until the address file cache is cleared.
+      */
+      class Handle
+      {
+          friend class Node;
+
+        public:
+          //! Invalid handle
+          Handle();
+
+          //! Returns whether the handle refers to a node
+          bool valid() const
+          {
+            return mIndex != kInvalidIndex;
+          }
+
+        private:
+          static const uint32_t kInvalidIndex = 0xFFFFFFFF;
+
+          Handle ( const uint64_t aTree , const uint32_t aIndex );
+
+          //! ID of the indexed node tree that the handle was created from (unique for each tree loaded from an address file, so never reused after the tree is destroyed)
+          uint64_t mTree;
+
+          //! Index of the node in the tree, in iteration order
+          uint32_t mIndex;
+      };
+
     private:
       friend class const_iterator;
 
+      //! Node table and path look-up table for the whole tree (only present on the root of a tree that has been loaded from an address file)
+      struct TreeIndex;
+
     protected:
       //! Empty node
       Node ( );
@@ -130,6 +184,15 @@ namespace uhal
       */
       Node ( const Node& aNode );
 
+      //! Tag type which selects the constructor that copies a node without its children
+      struct UnboundCopy {};
+
+      /**
+      	Constructor which copies a node's attributes, but not its children or tree index
+      	@param aNode a node to copy.
+      */
+      Node ( const Node& aNode , const UnboundCopy& );
+
       /**
       	Assignment operator
       	@param aNode a Node to copy
@@ -143,6 +206,16 @@ namespace uhal
       */
       virtual Node* clone() const;
 
+      /**
+      	Function to produce a copy of the current Node (of the same type) without its children or tree index, used to bind the nodes of a
+      	shared tree to a client. For derived nodes, UHAL_REGISTER_DERIVED_NODE implements this by copying the node and then discarding its children.
+      	@return a new copy of the current Node, without children
+      */
+      virtual Node* cloneUnbound() const;
+
+      //! Deletes the node's children and tree index (only used on copies that have not yet been added to a tree)
+      void discardChildren();
+
     public:
       //! Destructor
       virtual ~Node();
@@ -173,6 +246,28 @@ namespace uhal
       template< typename T>
       const T& getNode ( const std::string& aId ) const;
 
+      /**
+        Resolve a full-stop delimeted name path, relative to the current node, into a handle that can be used to retrieve the node repeatedly without path look-ups
+        @param aId a full-stop delimeted name path to a node, relative to the current node
+        @return handle to the Node given by the identifier
+      */
+      Handle getHandle ( const std::string& aId ) const;
+
+      /**
+        Retrieve the Node referred to by a handle; the node must be the current node or one of its descendants
+        @param aHandle a handle previously returned by getHandle for this node tree (or a copy of it)
+        @return the Node referred to by the handle
+      */
+      const Node& getNode ( const Handle& aHandle ) const;
+
+      /**
+        Retrieve the Node referred to by a handle, and cast it to a particular node type
+        @param aHandle a handle previously returned by getHandle for this node tree (or a copy of it)
+        @return the Node referred to by the handle
+      */
+      template< typename T>
+      const T& getNode ( const Handle& aHandle ) const;
+
       /**
       	Return all node IDs known to this HwInterface
       	@return all node IDs known to this HwInterface
@@ -186,6 +281,28 @@ namespace uhal
       */
       std::vector<std::string> getNodes ( const std::string& aRegex ) const;
 
+      /**
+        Return all node IDs known to this node which match a glob pattern; faster than a regular expression for simple queries
+        @param aPattern a pattern against which the node IDs are tested, in which '*' matches any sequence of characters (including '.') and '?' matches any single character
+        @return all matching node IDs, sorted alphabetically
+      */
+      std::vector<std::string> getNodesMatchingGlob ( const std::string& aPattern ) const;
+
+      /**
+        Return all node IDs known to this node which start with the specified string
+        @param aPrefix the string with which the node IDs must start (e.g. "SUBSYSTEM1." for all descendants of SUBSYSTEM1)
+        @return all matching node IDs, sorted alphabetically
+      */
+      std::vector<std::string> getNodesWithPrefix ( const std::string& aPrefix ) const;
+
+      /**
+        Return the nodes (this node and its descendants, excluding hierarchical nodes) whose address ranges overlap the specified range
+        @param aAddress the first address of the range
+        @param aSize the number of addresses in the range
+        @return the matching nodes, in iteration order
+      */
+      std::vector<const Node*> getNodesAtAddress ( const uint32_t& aAddress , const uint32_t& aSize = 1 ) const;
+
       /**
       	Return the unique ID of the current node
       	@return the unique ID of the current node
@@ -322,18 +439,57 @@ namespace uhal
 
     private:
 
+      //! Returns the node in the shared tree that this node is a bound copy of, or NULL if this node has not been bound by a detail::NodeBinding
+      const Node* getPrototype() const;
+
       std::string getRelativePath(const Node& aAncestor) const;
 
       //! Get the full path to the current node
       void getAncestors ( std::deque< const Node* >& aPath ) const;
 
+      //! Builds the index used to look up children by ID; must be called after children are added
+      void indexChildren();
+
+      //! Sorts the children by address, updating the index of the children
+      void sortChildrenByAddress();
+
+      //! Returns the children of this node, first building them if the node tree was loaded lazily and they haven't been built yet
+      const std::vector< Node* >& getChildren() const;
+
+      //! Returns whether the children of this node have not been built yet (i.e. it is part of a lazily-loaded node tree)
+      bool hasDeferredChildren() const;
+
+      //! Returns the child with the specified ID (specified as a substring, to avoid copies), or NULL if there is no such child
+      const Node* findChild ( const std::string& aId , const size_t aPos , const size_t aLength ) const;
+
+      //! Builds the node table and path look-up table for the tree below this node; must be called after the tree is complete
+      void indexTree();
+
+      //! Returns the nearest ancestor (or this node) that has a tree index, or NULL if there is none
+      const Node* getIndexedRoot() const;
+
+      //! Looks up a descendant by path using the tree index; returns NULL if not found (in which case the path may still be valid)
+      const Node* findIndexed ( const std::string& aId ) const;
+
+      //! Returns the paths of all descendants, in iteration order; cached for the root of an indexed tree, otherwise built in aTemporary
+      const std::vector<std::string>& getPathList ( std::vector<std::string>& aTemporary ) const;
+
+      //! Builds the paths of all descendants, in iteration order
+      void buildPathList ( std::vector<std::string>& aPaths ) const;
+
+      //! Returns this node's tree index if it has one; otherwise creates a temporary index (without path look-up table) of the tree below this node in aTemporary
+      const TreeIndex& getTreeIndex ( std::unique_ptr< TreeIndex >& aTemporary ) const;
+
+      //! Returns the pairs of nodes below this node whose address ranges overlap (see detail::getAddressOverlaps)
+      std::vector<std::pair<const Node*, const Node*> > getAddressOverlaps() const;
+
     private:
 
-      //! The parent hardware interface of which this node is a child (or rather decendent)
-      HwInterface* mHw;
+      //! The client through which this node's transactions are sent (NULL for unbound trees, which are shared between devices)
+      ClientInterface* mClient;
 
       //! The Unique ID of this node
-      std::string mUid;
+      detail::PooledString mUid;
 
       //! The register address with which this node is associated
       uint32_t mPartialAddr;
@@ -350,22 +506,22 @@ namespace uhal
       uint32_t mSize;
 
       //! Optional string which the user can specify
-      std::string mTags;
+      detail::PooledString mTags;
 
       //! Optional string which the user can specify
-      std::string mDescription;
+      detail::PooledString mDescription;
 
       //! The name of the module in which the current node resides
-      std::string mModule;
+      detail::PooledString mModule;
 
       //! Class name used to construct the derived node type
-      std::string mClassName;
+      detail::PooledString mClassName;
 
-      //! Additional parameters of the node
-      std::unordered_map< std::string, std::string > mParameters;
+      //! Additional parameters of the node (shared between copies of the node; NULL if there are none)
+      std::shared_ptr< const std::unordered_map< std::string, std::string > > mParameters;
 
-      //!  parameters to infer the VHDL address decoding
-      std::unordered_map< std::string, std::string > mFirmwareInfo;
+      //! Parameters to infer the VHDL address decoding (shared between copies of the node; NULL if there are none)
+      std::shared_ptr< const std::unordered_map< std::string, std::string > > mFirmwareInfo;
 
       //! The parent of the current node
       Node* mParent;
@@ -373,8 +529,17 @@ namespace uhal
       //! The direct children of the node
       std::vector< Node* > mChildren;
 
-      //! Helper to assist look-up of a particular child node, given a name
-      std::unordered_map< std::string , Node* > mChildrenMap;
+      //! Open-addressing hash table (keyed by ID) of indices into mChildren, to assist look-up of a particular child node given its ID
+      std::vector< uint32_t > mChildrenIndex;
+
+      //! Node table and path look-up table for the tree (NULL except for the root of a loaded tree)
+      std::unique_ptr< TreeIndex > mTreeIndex;
+
+      //! Reference to the XML from which this node's children are built when first accessed (NULL unless the tree was loaded lazily)
+      std::unique_ptr< detail::DeferredChildren > mDeferredChildren;
+
+      //! Node in the shared tree and binding that this node belongs to (NULL unless this node is a bound copy created by a detail::NodeBinding, which owns it and its children)
+      std::unique_ptr< detail::BoundNode > mBoundNode;
   };
 
   std::ostream& operator<< ( std::ostream& aStr ,  const uhal::Node& aNode );
@@ -42,6 +42,7 @@
 
 
 #include <memory>
+#include <mutex>
 
 #include <boost/filesystem/path.hpp>
 #include <boost/spirit/include/qi.hpp>
@@ -50,15 +51,21 @@
 
 #include "uhal/definitions.hpp"
 #include "uhal/grammars/NodeTreeClassAttributeGrammar.hpp"
-#include "uhal/grammars/NodeTreeParametersGrammar.hpp"
 #include "uhal/grammars/NodeTreeFirmwareInfoAttributeGrammar.hpp"
 #include "uhal/log/exception.hpp"
 #include "uhal/Node.hpp"
+#include "uhal/NodeTreeCache.hpp"
 #include "uhal/XmlParser.hpp"
 
 
 namespace uhal
 {
+  namespace detail
+  {
+    class AddressFileLoader;
+    struct AddressFileSource;
+  }
+
   namespace exception
   {
     //! Exception class to handle the case where creation of a node was attempted without it having a UID.
@@ -77,12 +84,17 @@ namespace uhal
 
     //! Exception class to handle the case when someone tries to give a bit-masked node a child.
     UHAL_DEFINE_EXCEPTION_CLASS ( MaskedNodeCannotHaveChild , "Exception class to handle the case when someone tries to give a bit-masked node a child." )
+
+    //! Exception class to handle the case where the XML describing the children of a node in a lazily-loaded tree could not be found.
+    UHAL_DEFINE_EXCEPTION_CLASS ( DeferredChildrenNotFound , "Exception class to handle the case where the XML describing the children of a node in a lazily-loaded tree could not be found." )
   }
 
 
   //! A class to build a node tree from an address table file
   class NodeTreeBuilder
   {
+      friend class Node;
+
     private:
       /**
       	Default constructor
@@ -112,9 +124,65 @@ namespace uhal
       */
       Node* getNodeTree ( const std::string& aFilenameExpr , const boost::filesystem::path& aPath );
 
+      /**
+        Retrieve the node tree from file whose name is specified, without copying it. The returned tree is shared with the
+        address file cache (and with any other caller requesting the same file), and so must not be modified or bound to a
+        client; it remains valid after the cache has been cleared. NOT thread safe; for thread-safety, use ConnectionManager getDevice/getDevices methods
+        @param aFilenameExpr a Filename Expression
+        @param aPath a path that will be prepended to relative filenames for local files. Ignored for http files.
+        @return the cached node tree
+      */
+      std::shared_ptr< const Node > getSharedNodeTree ( const std::string& aFilenameExpr , const boost::filesystem::path& aPath );
+
       //! Clears address filename -> Node tree cache. NOT thread safe; for tread-safety, use ConnectionManager method
       void clearAddressFileCache();
 
+      /**
+        Rebuilds the cached node trees of address tables whose files (or module files) have changed since they were loaded, re-using
+        the cached trees of unchanged module files. Local files are checked by modification time and size, and then by content (so a
+        file that has only been touched is not reloaded); remote files are not checked. If any address table cannot be rebuilt, the
+        cache is left unchanged and the exception is re-thrown. In lazy mode, changes are only detected in module files that were
+        loaded with the top-level node tree (i.e. not in those loaded when deferred children were built). NOT thread safe; for
+        thread-safety, and to update existing HwInterfaces, use ConnectionManager method
+        @return each top-level node tree that has been rebuilt, paired with its replacement
+      */
+      std::vector< std::pair< std::shared_ptr< const Node > , std::shared_ptr< const Node > > > reloadAddressFiles();
+
+      /**
+        Enables the on-disk cache of built node trees (see NodeTreeCache), or disables it if the path is empty. Enabled at
+        startup if the UHAL_ADDRESS_TABLE_CACHE_DIR environment variable is set. NOT thread safe.
+        @param aDirectory directory in which cache entries are stored
+      */
+      void setCacheDirectory ( const boost::filesystem::path& aDirectory );
+
+      //! Returns the directory in which cache entries are stored (empty if cache is disabled)
+      boost::filesystem::path getCacheDirectory() const;
+
+      /**
+        Sets the number of threads used to read and parse the module files referenced by an address table, before the node tree is
+        assembled; if zero, module files are instead read one by one as the tree is built. Defaults to the number of cores (up to
+        8). NOT thread safe.
+        @param aThreadCount maximum number of threads
+      */
+      void setFileLoaderThreadCount ( const size_t aThreadCount );
+
+      //! Returns the number of threads used to read and parse module files (zero if they are read as the tree is built)
+      size_t getFileLoaderThreadCount() const;
+
+      /**
+        Enables or disables lazy loading of node trees. When enabled, the children of the top-level node in each module file are
+        only built when they are first accessed (e.g. by getNode or iteration); until then, the module's parsed XML is kept in memory,
+        and shared between all instances of the module. Lazily-loaded trees are not indexed (so node handles cannot be created for
+        them), address overlaps are not checked, and errors in a module's contents are only reported when it is first accessed.
+        Enabled at startup if the UHAL_ADDRESS_TABLE_LAZY_LOADING environment variable is set (to anything other than "0").
+        Clears the address file cache if the setting changes. NOT thread safe.
+        @param aLazy whether to load node trees lazily
+      */
+      void setLazyLoading ( const bool aLazy );
+
+      //! Returns whether node trees are loaded lazily
+      bool getLazyLoading() const;
+
       Node* build(const pugi::xml_node& aNode, const boost::filesystem::path& aAddressFilePath);
 
     private:
@@ -125,7 +193,40 @@ namespace uhal
       	@param aFile A byte vector containing the content of the opened file. Done like this since the routine handles local and http files identically
       	@param aAddressTable The address table constructed from the file
       */
-      void CallBack ( const std::string& aProtocol , const boost::filesystem::path& aPath , std::vector<uint8_t>& aFile , std::vector< const Node* >& aAddressTable );
+      void CallBack ( const std::string& aProtocol , const boost::filesystem::path& aPath , std::vector<uint8_t>& aFile , std::vector< std::shared_ptr< const Node > >& aAddressTable );
+
+      /**
+        Builds the node tree from a parsed address file, adds it to the cache, and records the files it depends on
+        @param aName The protocol and path of the file, used as the cache key
+        @param aPath The fully qualified path to the file
+        @param aDependency The size and hash of the file
+        @param aXmlNode The top-level XML node in the file
+        @param aAddressTable The address table to which the node tree is appended
+        @param aSource The parsed file (only needed for lazy loading)
+      */
+      void buildTree ( const std::string& aName , const boost::filesystem::path& aPath , const NodeTreeCache::FileDependency& aDependency , const pugi::xml_node& aXmlNode , std::vector< std::shared_ptr< const Node > >& aAddressTable , const std::shared_ptr< const detail::AddressFileSource >& aSource = std::shared_ptr< const detail::AddressFileSource >() );
+
+      /**
+        Builds the node trees for a module expression from files that have already been loaded by mFileLoader
+        @param aFilenameExpr a Filename Expression
+        @param aParentPath the directory of the file containing the module attribute
+        @param aAddressTable The address table to which the node trees are appended
+        @return false if the files matching the expression were not all loaded (in which case the address table is unchanged)
+      */
+      bool buildFromLoadedFiles ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath , std::vector< std::shared_ptr< const Node > >& aAddressTable );
+
+      /**
+        Builds the children of a node in a lazily-loaded tree (called by the node when its children are first accessed, without holding any of its own locks); the node itself is not modified
+        @param aNode the node, whose DeferredChildren member refers to the XML from which its children are built
+        @param aChildren vector to which the children are added, with their parent set to aNode
+      */
+      void buildDeferredChildren ( const Node& aNode , std::vector< Node* >& aChildren );
+
+      //! Returns whether a local file still has the size and contents with which it was loaded
+      bool isUnchanged ( const NodeTreeCache::FileDependency& aFile );
+
+      //! Returns whether the children of an XML node should be deferred (i.e. it is the top-level node of a module file, in lazy mode)
+      bool deferChildren ( const pugi::xml_node& aXmlNode ) const;
 
       /**
       	Propagate the addresses down through the hierarchical structure
@@ -172,12 +273,57 @@ namespace uhal
 
       std::deque< boost::filesystem::path > mFileCallStack;
 
+      //! For each address table file currently being built, the files that it has been built from so far
+      std::deque< std::vector< NodeTreeCache::FileDependency > > mDependencyStack;
+
+      //! On-disk cache of node trees (NULL if disabled)
+      std::unique_ptr< NodeTreeCache > mCache;
+
+      //! Maximum number of threads used to load module files (zero if module files are loaded as the tree is built)
+      size_t mFileLoaderThreadCount;
+
+      //! Module files loaded for the top-level address file currently being built (NULL if none)
+      const detail::AddressFileLoader* mFileLoader;
+
+      //! Whether node trees are loaded lazily
+      bool mLazyLoading;
+
+      //! For each address file currently being built, the parsed file if its top-level node's children are to be deferred (otherwise NULL)
+      std::deque< std::shared_ptr< const detail::AddressFileSource > > mSourceStack;
+
+      //! Serialises loading of address files, since the children of lazily-loaded nodes can be built from any thread
+      std::recursive_mutex mMutex;
+
+      static const char* const mLazyLoadingEnvVariable;
+
+      static const char* const mCacheDirectoryEnvVariable;
+
     private:
       //! The single instance of the class
       static std::shared_ptr<NodeTreeBuilder> mInstance;
 
       //! Hash map associating a Node tree with a file name so that we do not need to repeatedly parse the xml documents if someone asks for a second copy of a particular node tree
-      std::unordered_map< std::string , const Node* > mNodes;
+      std::unordered_map< std::string , std::shared_ptr< const Node > > mNodes;
+
+      //! Files from which each node tree in the mNodes cache was built (local files only)
+      std::unordered_map< std::string , std::vector< NodeTreeCache::FileDependency > > mFileDependencies;
+
+      //! Protocol and path of each address file that has been loaded as a top-level file (rather than as a module), so that it can be reloaded
+      std::unordered_map< std::string , std::pair< std::string , boost::filesystem::path > > mTopLevelFiles;
+
+      //! Status of a local file, as of the last time its contents were checked by reloadAddressFiles
+      struct FileStatus
+      {
+        //! Modification time, in nanoseconds since the epoch
+        int64_t modificationTime;
+        //! Size of the file, in bytes
+        uint64_t size;
+        //! Hash of the file's contents
+        uint64_t hash;
+      };
+
+      //! Status of each local file that has been checked by reloadAddressFiles, so that unmodified files are not re-read
+      std::unordered_map< std::string , FileStatus > mFileStatus;
 
       //! A look-up table that the boost qi parser uses for associating strings ("r","w","rw","wr","read","write","readwrite","writeread") with enumerated permissions types
       static const struct permissions_lut : boost::spirit::qi::symbols<char, defs::NodePermission>
@@ -195,8 +341,6 @@ namespace uhal
       } mModeLut; //!< An instance of a look-up table that the boost qi parser uses for associating strings with enumerated permissions types
 
       grammars::NodeTreeClassAttributeGrammar mNodeTreeClassAttributeGrammar;
-      grammars::NodeTreeParametersGrammar mNodeTreeParametersGrammar;
-      grammars::NodeTreeFirmwareinfoAttributeGrammar mNodeTreeFirmwareInfoAttributeGrammar;
 
   };
 
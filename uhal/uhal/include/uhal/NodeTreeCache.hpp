@@ -0,0 +1,125 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_NodeTreeCache_hpp_
+#define _uhal_NodeTreeCache_hpp_
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+#include "uhal/log/exception.hpp"
+
+
+namespace uhal
+{
+  class Node;
+
+  namespace exception
+  {
+    //! Exception class to handle the case where a node tree cache entry is truncated or otherwise invalid.
+    UHAL_DEFINE_EXCEPTION_CLASS ( CorruptNodeTreeCacheEntry , "Exception class to handle the case where a node tree cache entry is truncated or otherwise invalid." )
+  }
+
+
+  /**
+    On-disk cache of node trees built from address table files, which allows processes to skip parsing the XML.
+
+    Each entry is a single binary file (named after a hash of the address table's URI) that stores the fully-built
+    node tree (i.e. with hierarchical addresses already calculated), along with the path, size and content hash of
+    each XML file that contributed to the tree. Entries are memory-mapped when loaded, and are only used if all of
+    these files are unchanged; otherwise the tree is rebuilt from the XML, and the entry is rewritten.
+  */
+  class NodeTreeCache
+  {
+    public:
+      //! A file that a cached node tree was built from
+      struct FileDependency
+      {
+        //! Full path to the file
+        std::string path;
+        //! Size of the file, in bytes
+        uint64_t size;
+        //! Hash of the file's contents
+        uint64_t hash;
+      };
+
+      //! @param aDirectory directory in which cache entries are stored (created if it doesn't exist)
+      NodeTreeCache ( const boost::filesystem::path& aDirectory );
+
+      ~NodeTreeCache ();
+
+      const boost::filesystem::path& getDirectory() const;
+
+      /**
+        Loads a node tree from the cache, if a valid entry exists
+        @param aName identifier for the address table (i.e. its protocol and path)
+        @param aFile contents of the address table file (used to validate the entry without re-reading that file)
+        @param aDependencies files that the cached node tree was built from (only set if entry is valid)
+        @return the cached node tree, or NULL if there is no valid entry
+      */
+      Node* load ( const std::string& aName , const std::vector<uint8_t>& aFile , std::vector<FileDependency>& aDependencies ) const;
+
+      /**
+        Writes a node tree to the cache, replacing any existing entry. Failures are logged, but not thrown.
+        @param aName identifier for the address table (i.e. its protocol and path)
+        @param aNode the node tree
+        @param aDependencies files that the node tree was built from
+      */
+      void store ( const std::string& aName , const Node& aNode , const std::vector<FileDependency>& aDependencies ) const;
+
+      //! Returns the path of the file used to cache the node tree for the specified address table
+      boost::filesystem::path getEntryPath ( const std::string& aName ) const;
+
+      //! Returns a dependency record for a file with the specified path and contents
+      static FileDependency createDependency ( const std::string& aPath , const uint8_t* aData , const size_t aSize );
+
+      //! 64-bit FNV-1a hash; used to detect changes to address table files
+      static uint64_t hash ( const uint8_t* aData , const size_t aSize );
+
+    private:
+      //! Converts between nodes and their binary representation; nested class since it requires access to Node's internals
+      class Serializer;
+
+      boost::filesystem::path mDirectory;
+  };
+
+}
+
+#endif
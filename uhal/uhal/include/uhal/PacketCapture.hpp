@@ -0,0 +1,136 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_PacketCapture_hpp_
+#define _uhal_PacketCapture_hpp_
+
+
+#include <atomic>
+#include <deque>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <utility>
+
+#include <boost/filesystem/path.hpp>
+
+#include "uhal/grammars/URI.hpp"
+#include "uhal/log/exception.hpp"
+
+
+namespace uhal
+{
+  namespace exception
+  {
+    //! Exception class to handle the case where the packet capture file could not be opened.
+    UHAL_DEFINE_EXCEPTION_CLASS ( PacketCaptureError , "Exception class to handle the case where the packet capture file could not be opened." )
+  }
+
+
+  /**
+    Captures the IPbus packets sent and received by all clients in the process to a pcapng file, which can be analysed offline
+    (e.g. with Wireshark or tshark) without needing access to tcpdump on the host. Each client is recorded as a separate interface,
+    named after its device ID and described by its URI, and each packet is recorded with a timestamp (in ns) and its direction.
+
+    Packets are captured when they are handed to the transport layer, and when their replies are validated; the contents are the
+    IPbus payload, including the ControlHub preamble for ControlHub clients. So that standard tools can decode them, each payload is
+    wrapped in synthesised IPv4 and UDP headers (with the target's address and port, if the URI specifies them numerically).
+
+    Capture is disabled by default; when disabled, the overhead is a single relaxed atomic load per packet. When enabled, each packet
+    is copied into a lock-free ring buffer (one per client and direction), from which a background thread writes them to the file in
+    time order; packets are dropped (and counted) rather than blocking the client if a ring buffer is full. The ring buffers are only
+    allocated while capturing. Capture can also be enabled for the
+    whole process by setting the UHAL_PCAP_FILE environment variable to the path of the file before the first client is created by ClientFactory (or ConnectionManager).
+  */
+  class PacketCapture
+  {
+    public:
+      //! Captured packets of a single client
+      class Stream;
+
+      enum Direction
+      {
+        SENT,
+        RECEIVED
+      };
+
+      /**
+        Starts capturing packets (stopping any capture in progress)
+        @param aPath the path of the pcapng file (overwritten if it exists)
+        @param aRingSize the size in bytes of each client's ring buffers
+      */
+      static void start ( const boost::filesystem::path& aPath , const size_t aRingSize = 1 << 20 );
+
+      //! Stops capturing packets, and closes the file after writing out all pending packets and freeing the ring buffers
+      static void stop();
+
+      //! Returns whether packets are currently being captured
+      static bool isEnabled()
+      {
+        return mEnabled.load ( std::memory_order_relaxed );
+      }
+
+      //! Returns the number of packets that have been dropped because a ring buffer was full, since capture was last started
+      static uint64_t getDroppedPacketCount();
+
+      /**
+        Creates the stream for a client, in which its packets are captured (called by ClientInterface on first use)
+        @param aId the client's device ID
+        @param aUri the client's URI
+        @return the stream, which remains valid until released
+      */
+      static Stream* createStream ( const std::string& aId , const URI& aUri );
+
+      //! Releases a client's stream (called by ClientInterface on destruction)
+      static void releaseStream ( Stream* aStream );
+
+      //! Captures a packet that is being sent; must only be called from one thread at a time for each stream
+      static void capture ( Stream& aStream , const uint8_t* aData , const size_t aSize );
+
+      //! Captures a packet that has been received, from its reply destinations; must only be called from one thread at a time for each stream
+      static void capture ( Stream& aStream , const std::deque< std::pair< uint8_t* , uint32_t > >& aReplyBuffer , const size_t aSize );
+
+      //! Starts capturing packets if the environment variable is set (called by ClientFactory before creating each client)
+      static void startFromEnvironment();
+
+    private:
+      static std::atomic< bool > mEnabled;
+
+      static const char* const mFileEnvVariable;
+  };
+
+}
+
+#endif
@@ -56,6 +56,8 @@
 #include "uhal/ClientInterface.hpp"
 #include "uhal/log/exception.hpp"
 #include "uhal/ProtocolIPbus.hpp"
+#include "uhal/utilities/AdaptivePoller.hpp"
+#include "uhal/utilities/PacketTrace.hpp"
 
 
 
@@ -72,6 +74,8 @@ namespace uhal
     UHAL_DEFINE_DERIVED_EXCEPTION_CLASS ( MmapInitialisationError , TransportLayerError , "Exception class to handle a failure to read from the specified device files during initialisation." )
     //! Exception class to handle a low-level seek/read/write error after initialisation
     UHAL_DEFINE_DERIVED_EXCEPTION_CLASS ( MmapCommunicationError , TransportLayerError , "Exception class to handle a low-level seek/read/write error after initialisation." )
+    //! Exception class to handle transactions that cannot be performed in direct register-mapped access mode
+    UHAL_DEFINE_DERIVED_EXCEPTION_CLASS ( MmapDirectAccessUnsupported , TransportLayerError , "Exception class to handle transactions that cannot be performed in direct register-mapped access mode." )
   }
 
   //! Transport protocol to transfer an IPbus buffer via device file, using mmap
@@ -98,6 +102,9 @@ namespace uhal
 
         void setOffset(size_t aOffset);
 
+        size_t getMapSize() const;
+        void setMapSize(size_t aMapSize);
+
         void open();
         void close();
 
@@ -105,13 +112,24 @@ namespace uhal
 
         void write(const uint32_t aAddr, const std::vector<std::pair<const uint8_t*, size_t> >& aData);
 
+        //! Returns pointer to the 32-bit word at the specified (word) address in the mapped region, opening the file if required
+        volatile uint32_t* getWordPtr(const uint32_t aAddr);
+
+        bool haveLock() const;
+
+        void lock();
+
+        void unlock();
+
       private:
         std::string mPath;
         int mFd;
         int mFlags;
         off_t mOffset;
+        size_t mMapSize;
         void* mMmapPtr;
         void* mMmapIOPtr;
+        bool mLocked;
       };
 
       template <typename T>
@@ -125,6 +143,18 @@ namespace uhal
         }
       };
 
+      //! Transaction queued in direct access mode, and performed as MMIO load(s)/store(s) at dispatch
+      struct DirectTransaction {
+        IPbusTransactionType type;
+        uint32_t address;
+        uint32_t nrWords;
+        uint32_t terms[2];
+        std::vector<uint32_t> writeValues;
+        //! Location of read/RMW reply data (memory owned by reply)
+        uint32_t* replyPtr;
+        ValHeader reply;
+      };
+
       Mmap ( const Mmap& aMmap );
 
       Mmap& operator= ( const Mmap& aMmap );
@@ -140,6 +170,22 @@ namespace uhal
       //!	Destructor
       virtual ~Mmap();
 
+      //! Returns the reply polling policy, including statistics on the round-trip time and number of polls per packet
+      const AdaptivePoller& getReplyPoller() const;
+
+      //! Returns the data path counters, and the most recent transfers if tracing is enabled (via the URI 'trace' attribute)
+      const PacketTrace& getPacketTrace() const;
+
+    protected:
+      //! Returns the byte offset of the request pages in the mapped region (zero for firmware, where requests and replies occupy separate address spaces)
+      virtual uint32_t getRequestOffset() const;
+
+      //! Called after each request packet has been written to the mapped region, while this client has exclusive access to the device
+      virtual void notifyRequestWritten();
+
+      //! Returns pointer to the 32-bit word at the specified (word) address in the mapped region, opening the device file if required
+      volatile uint32_t* getWordPtr(const uint32_t aAddr);
+
     private:
 
       /**
@@ -153,9 +199,28 @@ namespace uhal
       virtual void Flush( );
 
 
+      //! Performs all transactions queued in direct access mode, then marks their replies as valid
+      virtual void dispatchUnbufferedTransactions();
+
       //! Function which tidies up this protocol layer in the event of an exception
       virtual void dispatchExceptionHandler();
 
+      virtual ValHeader implementBOT();
+
+      virtual ValHeader implementWrite ( const uint32_t& aAddr, const uint32_t& aValue );
+
+      virtual ValHeader implementWriteBlock ( const uint32_t& aAddr, const std::vector< uint32_t >& aValues, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
+
+      virtual ValWord< uint32_t > implementRead ( const uint32_t& aAddr, const uint32_t& aMask = defs::NOMASK );
+
+      virtual ValVector< uint32_t > implementReadBlock ( const uint32_t& aAddr, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode=defs::INCREMENTAL );
+
+      virtual ValWord< uint32_t > implementReadConfigurationSpace ( const uint32_t& aAddr, const uint32_t& aMask = defs::NOMASK );
+
+      virtual ValWord< uint32_t > implementRMWbits ( const uint32_t& aAddr , const uint32_t& aANDterm , const uint32_t& aORterm );
+
+      virtual ValWord< uint32_t > implementRMWsum ( const uint32_t& aAddr , const int32_t& aAddend );
+
 
       typedef IPbus< 2 , 0 > InnerProtocol;
 
@@ -185,11 +250,24 @@ namespace uhal
       //! Read next pending reply packet from appropriate page of FPGA-to-host device file, and validate contents
       void read();
 
+      //! Throws if the specified range of (word) addresses lies outside of the mapped region
+      void checkDirectAccessRange(const uint32_t aAddr, const uint32_t aNrWords) const;
+
       bool mConnected;
 
+      //! Whether registers are accessed directly via loads/stores into the mapped region, rather than via IPbus packets
+      bool mDirectAccess;
+
+      //! Transactions queued in direct access mode, which will be performed at next dispatch
+      std::vector<DirectTransaction> mDirectTransactionQueue;
+
       File mDeviceFile;
 
-      std::chrono::microseconds mSleepDuration;
+      //! Policy for polling the target until each reply is ready; also records RTT & polls-per-packet statistics
+      AdaptivePoller mPoller;
+
+      //! Counts packets & words transferred, and records recent transfers (in place of per-packet logging)
+      PacketTrace mTrace;
 
       uint32_t mNumberOfPages, mPageSize, mIndexNextPage, mPublishedReplyPageCount, mReadReplyPageCount;
 
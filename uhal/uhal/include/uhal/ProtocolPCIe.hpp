@@ -58,6 +58,8 @@
 #include "uhal/ClientInterface.hpp"
 #include "uhal/log/exception.hpp"
 #include "uhal/ProtocolIPbus.hpp"
+#include "uhal/utilities/AdaptivePoller.hpp"
+#include "uhal/utilities/PacketTrace.hpp"
 
 
 namespace uhal
@@ -189,6 +191,12 @@ namespace uhal
       //!	Destructor
       virtual ~PCIe();
 
+      //! Returns the reply polling policy, including statistics on the round-trip time and number of polls per packet
+      const AdaptivePoller& getReplyPoller() const;
+
+      //! Returns the data path counters, and the most recent transfers if tracing is enabled (via the URI 'trace' attribute)
+      const PacketTrace& getPacketTrace() const;
+
     private:
 
       PCIe ( const PCIe& aPCIe );
@@ -256,7 +264,11 @@ namespace uhal
 
       bool mUseInterrupt;
 
-      std::chrono::microseconds mSleepDuration;
+      //! Policy for polling the target until each reply is ready; also records RTT & polls-per-packet statistics
+      AdaptivePoller mPoller;
+
+      //! Counts packets & words transferred, and records recent transfers (in place of per-packet logging)
+      PacketTrace mTrace;
 
       uint32_t mNumberOfPages, mMaxInFlight, mPageSize, mMaxPacketSize, mIndexNextPage, mPublishedReplyPageCount, mReadReplyPageCount;
 
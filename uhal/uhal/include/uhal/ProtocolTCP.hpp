@@ -56,6 +56,7 @@
 
 #include "uhal/ClientInterface.hpp"
 #include "uhal/log/exception.hpp"
+#include "uhal/log/log_rate_limit.hpp"
 #include "uhal/utilities/TimeIntervalStats.hpp"
 
 namespace uhal
@@ -258,6 +259,34 @@ namespace uhal
       */
       uhal::exception::exception* mAsynchronousException;
 
+      //! The log call sites whose entries are rate-limited, indexing mLogRateLimits
+      enum LogCallSite
+      {
+        RETHROW_LOG,
+        SEND_TIMEOUT_LOG,
+        SEND_TIMEOUT_ERROR_LOG,
+        SEND_ERROR_LOG,
+        SEND_CLOSE_ERROR_LOG,
+        SHORT_SEND_LOG,
+        HEADER_TIMEOUT_LOG,
+        HEADER_TIMEOUT_ERROR_LOG,
+        HEADER_RECEIVE_ERROR_LOG,
+        SHORT_HEADER_LOG,
+        RECEIVE_CLOSE_ERROR_LOG,
+        CHUNK_TIMEOUT_LOG,
+        CHUNK_RECEIVE_ERROR_LOG,
+        SHORT_CHUNK_LOG,
+        NR_LOG_CALL_SITES
+      };
+
+      /**
+        Rate limits for the errors that repeat on every dispatch while the target is unreachable; these belong to each client (rather
+        than being static at the call site) so that the errors from one unreachable device cannot suppress those from another
+      */
+      LogRateLimit mLogRateLimits [ NR_LOG_CALL_SITES ];
+      //! Rate limit for the timing statistics that are logged after a receive timeout
+      LogRateLimit mTimeoutInfoRateLimit;
+
 
       SteadyClock_t::time_point mLastSendQueued;
       SteadyClock_t::time_point mLastRecvQueued;
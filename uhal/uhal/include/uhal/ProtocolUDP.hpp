@@ -55,6 +55,7 @@
 
 #include "uhal/ClientInterface.hpp"
 #include "uhal/log/exception.hpp"
+#include "uhal/log/log_rate_limit.hpp"
 
 
 namespace boost {
@@ -236,6 +237,23 @@ namespace uhal
       */
       uhal::exception::exception* mAsynchronousException;
 
+      //! The log call sites whose entries are rate-limited, indexing mLogRateLimits
+      enum LogCallSite
+      {
+        RETHROW_LOG,
+        SEND_TIMEOUT_LOG,
+        SEND_TIMEOUT_ERROR_LOG,
+        SEND_ERROR_LOG,
+        SHORT_SEND_LOG,
+        RECEIVE_TIMEOUT_LOG,
+        RECEIVE_TIMEOUT_ERROR_LOG,
+        RECEIVE_ERROR_LOG,
+        NR_LOG_CALL_SITES
+      };
+
+      //! Per-client rate limits for the errors logged by this transport, so that one unreachable device cannot hide another's errors
+      LogRateLimit mLogRateLimits [ NR_LOG_CALL_SITES ];
+
   };
 
 
@@ -0,0 +1,142 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#ifndef _uhal_RegisterDescriptor_hpp_
+#define _uhal_RegisterDescriptor_hpp_
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+#include "uhal/definitions.hpp"
+#include "uhal/log/exception.hpp"
+
+
+namespace uhal
+{
+  class Node;
+
+  namespace exception
+  {
+    //! Exception class to handle the case where a register descriptor does not match the corresponding node of the address table.
+    UHAL_DEFINE_EXCEPTION_CLASS ( RegisterDescriptorMismatch , "Exception class to handle the case where a register descriptor does not match the corresponding node of the address table." )
+  }
+
+
+  /**
+    Description of a register, memory or FIFO in an address table, which can be evaluated at compile time.
+
+    Headers of constexpr descriptors are generated from address tables by the gen_uhal_register_header script; the
+    descriptors can then be passed to ClientInterface's read/write methods in place of a node, avoiding the look-up
+    of nodes by their path. Since the descriptors are fixed at compile time, they are checked against the address
+    table that is loaded at runtime: generated headers register their descriptors (see registerRegisterDescriptors),
+    and each HwInterface checks the descriptors registered for its address file when it is created.
+  */
+  struct RegisterDescriptor
+  {
+    //! Path of the node, relative to the top-level node
+    const char* path;
+    //! Address of the register
+    uint32_t address;
+    //! Mask of the register's bits
+    uint32_t mask;
+    //! Read/write access permissions
+    defs::NodePermission permission;
+    //! Block read/write mode
+    defs::BlockReadWriteMode mode;
+    //! Size of the memory or FIFO (1 for single registers)
+    uint32_t size;
+  };
+
+
+  /**
+    Checks that register descriptors match the corresponding nodes of an address table
+    @param aNode the top-level node of the address table
+    @param aBegin pointer to the first element of an array of register descriptor pointers
+    @param aEnd pointer to one past the last element of the array
+    @throw exception::RegisterDescriptorMismatch if a descriptor's node does not exist, or any of its properties differ from the descriptor
+  */
+  void validateRegisterDescriptors ( const Node& aNode , const RegisterDescriptor* const* aBegin , const RegisterDescriptor* const* aEnd );
+
+  /**
+    Checks that register descriptors match the corresponding nodes of an address table
+    @param aNode the top-level node of the address table
+    @param aDescriptors array of register descriptor pointers
+    @throw exception::RegisterDescriptorMismatch if a descriptor's node does not exist, or any of its properties differ from the descriptor
+  */
+  template < size_t N >
+  void validateRegisterDescriptors ( const Node& aNode , const RegisterDescriptor* const ( &aDescriptors ) [N] )
+  {
+    validateRegisterDescriptors ( aNode , aDescriptors , aDescriptors + N );
+  }
+
+  /**
+    Registers register descriptors that were generated from an address file, so that they are checked against the address table of
+    each HwInterface that is subsequently created from a file of the same name (wherever it is located)
+    @param aAddressFile the name of the address file, without its directory
+    @param aBegin pointer to the first element of an array of register descriptor pointers, which must outlive the process' HwInterfaces
+    @param aEnd pointer to one past the last element of the array
+  */
+  void registerRegisterDescriptors ( const std::string& aAddressFile , const RegisterDescriptor* const* aBegin , const RegisterDescriptor* const* aEnd );
+
+  //! Registers the descriptors of a generated header when constructed (at static initialisation)
+  struct RegisterDescriptorRegistration
+  {
+    /**
+      Constructor
+      @param aAddressFile the name of the address file, without its directory
+      @param aDescriptors array of register descriptor pointers
+    */
+    template < size_t N >
+    RegisterDescriptorRegistration ( const char* aAddressFile , const RegisterDescriptor* const ( &aDescriptors ) [N] )
+    {
+      registerRegisterDescriptors ( aAddressFile , aDescriptors , aDescriptors + N );
+    }
+  };
+
+  namespace detail
+  {
+    /**
+      Checks the register descriptors registered for the address file from which a top-level node was loaded (called by HwInterface on construction)
+      @param aNode the top-level node of the address table
+      @throw exception::RegisterDescriptorMismatch if any registered descriptor does not match the address table
+    */
+    void validateRegisteredDescriptors ( const Node& aNode );
+  }
+}
+
+
+#endif
@@ -69,9 +69,9 @@ namespace uhal
 
 
   template <class T>
-  std::shared_ptr<ClientInterface> ClientFactory::Creator<T>::create ( const std::string& aId , const URI& aUri )
+  std::unique_ptr<ClientInterface> ClientFactory::Creator<T>::create ( const std::string& aId , const URI& aUri )
   {
-    return std::shared_ptr<ClientInterface> ( new T ( aId , aUri ) );
+    return std::unique_ptr<ClientInterface> ( new T ( aId , aUri ) );
   }
 
 }
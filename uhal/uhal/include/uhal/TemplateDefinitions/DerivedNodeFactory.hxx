@@ -31,6 +31,8 @@
 */
 
 
+#include <typeinfo>
+
 #include "uhal/log/LogLevels.hpp"
 #include "uhal/log/log_inserters.quote.hpp"
 #include "uhal/log/log_inserters.type.hpp"
@@ -52,6 +54,7 @@ namespace uhal
     }
 
     mCreators[aNodeClassName] =  std::shared_ptr<CreatorInterface> ( new Creator<T>() );
+    mClassNames.insert ( std::make_pair ( std::type_index ( typeid ( T ) ) , aNodeClassName ) );
   }
 
 
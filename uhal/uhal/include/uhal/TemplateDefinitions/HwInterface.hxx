@@ -38,7 +38,14 @@ namespace uhal
   template< typename T>
   const T& HwInterface::getNode ( const std::string& aId ) const
   {
-    return mNode->getNode< T > ( aId );
+    return getBoundNode().getNode< T > ( aId );
+  }
+
+
+  template< typename T>
+  const T& HwInterface::getNode ( const Node::Handle& aHandle ) const
+  {
+    return getBoundNode().getNode< T > ( aHandle );
   }
 
 }
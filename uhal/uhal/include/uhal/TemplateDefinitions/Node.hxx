@@ -57,5 +57,23 @@ namespace uhal
     }
   }
 
+
+  template< typename T>
+  const T& Node::getNode ( const Handle& aHandle ) const
+  {
+    const Node& lNode ( getNode ( aHandle ) );
+
+    try
+    {
+      return dynamic_cast< const T& > ( lNode );
+    }
+    catch ( const std::exception& aExc )
+    {
+      exception::BadNodeCast lExc;
+      log ( lExc , "Invalid cast of Node " , Quote ( lNode.getId() ) , " from type ", Quote ( Type ( lNode ) ), " to " ,  Quote ( Type<T>() ) );
+      throw lExc;
+    }
+  }
+
 }
 
@@ -0,0 +1,136 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+
+#ifndef _uhal_detail_AddressFileLoader_hpp_
+#define _uhal_detail_AddressFileLoader_hpp_
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+#include "pugixml.hpp"
+
+#include "uhal/NodeTreeCache.hpp"
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    /**
+      Reads and parses all of the address files that are referenced (directly or indirectly) by the module attributes of an address
+      table, using a pool of threads, so that the node tree can then be assembled from the parsed documents without waiting on I/O.
+      The module graph is explored one level at a time; the files of each level are loaded in parallel, and then the module
+      expressions that they contain are resolved in the calling thread. Files which cannot be found, read or parsed are skipped, so
+      that any errors are reported when the node tree builder opens them itself.
+    */
+    class AddressFileLoader
+    {
+      public:
+        //! A loaded address file
+        struct File
+        {
+          std::string protocol;
+          boost::filesystem::path path;
+          //! Size and hash of the file's contents (calculated before the contents are modified by in-place parsing)
+          NodeTreeCache::FileDependency dependency;
+          std::vector<uint8_t> contents;
+          pugi::xml_document document;
+        };
+
+        //! Protocol and path of a file
+        typedef std::pair< std::string , boost::filesystem::path > FileId;
+
+        /**
+          Constructor
+          @param aThreadCount maximum number of threads used to load files (including the calling thread)
+        */
+        explicit AddressFileLoader ( const size_t aThreadCount );
+
+        ~AddressFileLoader();
+
+        /**
+          Loads the files referenced by the module attributes of an XML node and its descendants, and those referenced by them
+          @param aNode the top-level XML node of an address table
+          @param aPath path of the file containing the node
+          @param aSkip returns true for files that do not need to be loaded (e.g. those already built); argument is protocol + path
+        */
+        void load ( const pugi::xml_node& aNode , const boost::filesystem::path& aPath , const std::function< bool ( const std::string& ) >& aSkip );
+
+        /**
+          Returns the files matching a module expression, as found while loading, or NULL if the expression was not resolved
+          @param aFilenameExpr the value of the module attribute
+          @param aParentPath the directory of the file containing the module attribute
+        */
+        const std::vector< FileId >* find ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath ) const;
+
+        //! Returns the loaded file with the specified name (protocol + path), or NULL if it was skipped or failed to load
+        const File* get ( const std::string& aName ) const;
+
+        //! Returns the number of files loaded successfully
+        size_t size() const;
+
+      private:
+        //! Resolves a module expression into a list of files, returning false if the expression is not valid
+        static bool resolve ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath , std::vector< FileId >& aFiles );
+
+        //! Reads and parses a file, and appends the module expressions it contains; returns false if the file could not be loaded
+        static bool loadFile ( File& aFile , std::vector< std::string >& aModules );
+
+        //! Appends the module attributes of an XML node and its descendants (excluding the children of module nodes)
+        static void findModules ( const pugi::xml_node& aNode , std::vector< std::string >& aModules );
+
+        static std::string key ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath );
+
+        const size_t mThreadCount;
+
+        //! Resolved module expressions, keyed by expression and parent directory
+        std::unordered_map< std::string , std::vector< FileId > > mExpressions;
+
+        //! Files loaded successfully, keyed by protocol + path
+        std::unordered_map< std::string , std::unique_ptr< File > > mFiles;
+    };
+
+  }
+}
+
+
+#endif
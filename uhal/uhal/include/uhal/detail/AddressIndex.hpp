@@ -0,0 +1,101 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+#ifndef _uhal_detail_AddressIndex_hpp_
+#define _uhal_detail_AddressIndex_hpp_
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+
+namespace uhal
+{
+  class Node;
+
+  namespace detail
+  {
+
+    /**
+      Immutable index of the address ranges covered by the nodes of a tree (excluding hierarchical nodes), for finding the nodes
+      that cover an address or overlap an address range in logarithmic time. Entries are stored as a flat array sorted by first
+      address, which is also used as an implicit binary tree, augmented with the maximum last address in each sub-tree.
+      Nodes are identified by their indices in the node table (i.e. iteration order), so that the index can be shared between
+      copies of a tree.
+    */
+    class AddressIndex
+    {
+      public:
+        struct Entry
+        {
+          //! First address covered by the node
+          uint32_t first;
+          //! Last address covered by the node
+          uint32_t last;
+          //! Index of the node in the node table
+          uint32_t node;
+        };
+
+        /**
+          Builds the index
+          @param aNodes the node table: all nodes of the tree, in iteration order
+        */
+        explicit AddressIndex ( const std::vector< const Node* >& aNodes );
+
+        /**
+          Finds the nodes whose address ranges overlap the range [aFirst, aLast]
+          @param aFirst first address of the range
+          @param aLast last address of the range
+          @param aIndices vector to which the node table indices of matching nodes are added, in iteration order
+        */
+        void find ( const uint32_t aFirst , const uint32_t aLast , std::vector< uint32_t >& aIndices ) const;
+
+        //! Entries, ordered by first address (and then in iteration order)
+        const std::vector< Entry >& entries() const
+        {
+          return mEntries;
+        }
+
+      private:
+        std::vector< Entry > mEntries;
+
+        //! Largest last address in each entry's sub-tree of the implicit binary tree
+        std::vector< uint32_t > mMaxLast;
+
+        //! Level of the root of the implicit binary tree (-1 if empty)
+        int mRootLevel;
+    };
+
+  }
+}
+
+
+#endif
@@ -0,0 +1,95 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+
+#ifndef _uhal_detail_DeferredChildren_hpp_
+#define _uhal_detail_DeferredChildren_hpp_
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    //! Contents of an address file, kept in memory (unparsed) so that parts of a lazily-loaded node tree can be built from it later
+    struct AddressFileSource
+    {
+      boost::filesystem::path path;
+      std::vector<uint8_t> contents;
+    };
+
+
+    /**
+      Reference to the XML describing the children of a node in a lazily-loaded node tree, which are only built when first accessed.
+      Only the file and the offset of the XML element within it are kept; the file is parsed again when the children are built.
+      Each node has its own instance, but copies of a node share the file contents.
+    */
+    struct DeferredChildren
+    {
+      DeferredChildren ( const std::shared_ptr< const AddressFileSource >& aSource , const ptrdiff_t aOffset , const bool aAllMasked ) :
+        source ( aSource ),
+        offset ( aOffset ),
+        allMasked ( aAllMasked ),
+        built ( false )
+      {
+      }
+
+      //! The address file containing the XML element
+      std::shared_ptr< const AddressFileSource > source;
+
+      //! Offset of the XML element whose children have not been built yet, from the start of the file
+      ptrdiff_t offset;
+
+      //! Whether all of the children are bit-masked (used to determine the node's mode without building them)
+      bool allMasked;
+
+      //! Protects installation of the children; never held while other locks are acquired, or while the children are being built
+      std::mutex mutex;
+
+      //! Set (with release semantics) once the children have been built, so that copies can check without waiting
+      std::atomic<bool> built;
+    };
+
+  }
+}
+
+
+#endif
@@ -0,0 +1,126 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#ifndef _uhal_detail_NodeBinding_hpp_
+#define _uhal_detail_NodeBinding_hpp_
+
+
+#include <stddef.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace uhal
+{
+  class ClientInterface;
+  class Node;
+
+  namespace detail
+  {
+
+    class NodeBinding;
+
+    //! State of a node that has been bound to a client by a NodeBinding
+    struct BoundNode
+    {
+      BoundNode ( const Node& aPrototype , NodeBinding& aBinding ) :
+        prototype ( aPrototype ),
+        binding ( aBinding )
+      {
+      }
+
+      //! The node in the shared tree that this node is a bound copy of
+      const Node& prototype;
+
+      //! The binding that owns this node
+      NodeBinding& binding;
+
+      //! Flag ensuring that the bound copies of the children are only added once
+      std::once_flag childrenFlag;
+    };
+
+
+    /**
+      Binds a shared, unbound node tree to a client. The tree itself is never copied: instead, each node is copied (without its
+      children) and bound to the client when it is first accessed, so the memory used by each device scales with the number of
+      nodes that are actually used rather than the size of the address table. Bound nodes delegate navigation (path and handle
+      look-ups, listing node IDs, etc) to the shared tree, and remain valid until the binding is destroyed.
+    */
+    class NodeBinding
+    {
+      public:
+        /**
+          Constructor
+          @param aTree the top-level node of the shared tree
+          @param aClient the client through which the bound nodes' transactions are sent
+        */
+        NodeBinding ( const std::shared_ptr< const Node >& aTree , ClientInterface* aClient );
+
+        ~NodeBinding();
+
+        //! Returns the shared tree
+        const std::shared_ptr< const Node >& getTree() const
+        {
+          return mTree;
+        }
+
+        //! Returns the bound copy of the top-level node
+        Node& getRoot();
+
+        /**
+          Returns the bound copy of a node, binding it (and any of its ancestors that have not been bound yet) if necessary
+          @param aNode a node in the shared tree
+        */
+        Node& bind ( const Node& aNode );
+
+        //! Returns the number of nodes that have been bound
+        size_t size() const;
+
+      private:
+        NodeBinding ( const NodeBinding& );
+        NodeBinding& operator= ( const NodeBinding& );
+
+        Node& bindLocked ( const Node& aNode );
+
+        std::shared_ptr< const Node > mTree;
+
+        ClientInterface* mClient;
+
+        //! Bound copies, keyed by the node in the shared tree; owned by the binding
+        std::unordered_map< const Node* , Node* > mNodes;
+
+        mutable std::mutex mMutex;
+    };
+
+  }
+}
+
+
+#endif
@@ -0,0 +1,103 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+#ifndef _uhal_detail_PathIndex_hpp_
+#define _uhal_detail_PathIndex_hpp_
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    /**
+      Immutable perfect hash table (hash and displace, with the table 80% full) mapping strings to 32-bit values, used to look up nodes
+      by full dotted path with a single probe. Built once when an address table is loaded, and shared between node tree copies.
+      Look-ups of strings that are not keys return an arbitrary value (or kNotFound), so callers must verify the result.
+    */
+    class PathIndex
+    {
+      public:
+        static const uint32_t kNotFound = 0xFFFFFFFF;
+
+        /**
+          Builds the table
+          @param aKeys the keys and their values; keys must be unique
+        */
+        explicit PathIndex ( const std::vector< std::pair<std::string, uint32_t> >& aKeys );
+
+        //! Returns whether the table was built successfully; if not, all look-ups return kNotFound
+        bool valid() const
+        {
+          return not mValues.empty();
+        }
+
+        size_t size() const
+        {
+          return mSize;
+        }
+
+        //! Returns the value associated with a key, if present; otherwise either kNotFound or the value of another key
+        uint32_t find ( const char* aData , const size_t aSize ) const;
+
+        uint32_t find ( const std::string& aKey ) const
+        {
+          return find ( aKey.data() , aKey.size() );
+        }
+
+      private:
+        static uint64_t hash ( const char* aData , const size_t aSize );
+
+        static size_t reduce ( const uint64_t aValue , const size_t aRange );
+
+        static size_t slot ( const uint64_t aHash , const uint32_t aSeed , const size_t aNrSlots );
+
+        //! Number of keys
+        size_t mSize;
+
+        //! Per-bucket displacement seeds
+        std::vector< uint32_t > mSeeds;
+
+        //! Values, indexed by slot
+        std::vector< uint32_t > mValues;
+    };
+
+  }
+}
+
+
+#endif
@@ -0,0 +1,128 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+#ifndef _uhal_detail_StringPool_hpp_
+#define _uhal_detail_StringPool_hpp_
+
+
+#include <stddef.h>
+#include <atomic>
+#include <iosfwd>
+#include <string>
+#include <utility>
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    /**
+      Handle to an immutable string that is stored in a process-wide pool, so that each distinct value is only stored once.
+      Used for node attributes, since these are highly repetitive (e.g. node IDs in modules that are instantiated many times,
+      module paths), and so that node copies don't allocate. Pool entries are reference counted, and removed from the pool
+      when the last handle to them is destroyed, so the pool only ever contains the strings of node trees that are still alive.
+    */
+    class PooledString
+    {
+      public:
+        //! Empty string
+        PooledString();
+
+        PooledString ( const std::string& aString );
+
+        PooledString ( const PooledString& aOther );
+
+        PooledString ( PooledString&& aOther );
+
+        ~PooledString();
+
+        PooledString& operator= ( const std::string& aString );
+
+        PooledString& operator= ( const PooledString& aOther );
+
+        PooledString& operator= ( PooledString&& aOther );
+
+        const std::string& str() const
+        {
+          return mEntry ? mEntry->first : getEmptyString();
+        }
+
+        operator const std::string& () const
+        {
+          return str();
+        }
+
+        size_t size() const
+        {
+          return str().size();
+        }
+
+        bool empty() const
+        {
+          return mEntry == NULL;
+        }
+
+        //! Since each value is only stored once, pooled strings can be compared by address
+        bool operator== ( const PooledString& aOther ) const
+        {
+          return mEntry == aOther.mEntry;
+        }
+
+        bool operator!= ( const PooledString& aOther ) const
+        {
+          return mEntry != aOther.mEntry;
+        }
+
+        //! Returns the number of distinct strings currently in the pool
+        static size_t poolSize();
+
+      private:
+        //! Pool entry: the string, and the number of handles that refer to it
+        typedef std::pair<const std::string, std::atomic<size_t> > Entry;
+
+        static const std::string& getEmptyString();
+
+        //! Returns the pool's entry for the string (adding it to the pool if necessary) with its reference count incremented; NULL for empty strings
+        static Entry* intern ( const std::string& aString );
+
+        //! Decrements the entry's reference count, removing it from the pool when the count reaches zero
+        static void release ( Entry* aEntry );
+
+        Entry* mEntry;
+    };
+
+    std::ostream& operator<< ( std::ostream& aStream , const PooledString& aString );
+
+  }
+}
+
+
+#endif
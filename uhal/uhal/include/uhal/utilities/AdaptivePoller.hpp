@@ -0,0 +1,90 @@
+
+#ifndef _uhal_AdaptivePoller_hpp_
+#define _uhal_AdaptivePoller_hpp_
+
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <iosfwd>                          // for ostream
+#include <stddef.h>                        // for size_t
+#include <stdint.h>
+
+
+namespace uhal {
+
+/**
+  Policy for polling a target until a reply is ready. In adaptive mode, after each unsuccessful poll the poller:
+   1. spins (i.e. polls again immediately) until the expected reply time, learned from recent round trips, has passed;
+   2. then yields the CPU for a comparable period;
+   3. then sleeps, doubling the sleep duration after each poll up to the maximum sleep duration.
+  In fixed mode, it simply sleeps for the maximum sleep duration between polls.
+*/
+class AdaptivePoller {
+public:
+  typedef std::chrono::steady_clock Clock_t;
+
+  AdaptivePoller(const Clock_t::duration& aMaxSleep);
+  ~AdaptivePoller();
+
+  bool isAdaptive() const;
+
+  void setAdaptive(bool aAdaptive);
+
+  const Clock_t::duration& getMaxSleep() const;
+
+  void setMaxSleep(const Clock_t::duration& aMaxSleep);
+
+  //! Records the time at which a request was sent; used to measure the round-trip time once its reply is ready
+  void notifySent();
+
+  //! Records that the next reply was ready without any polling (e.g. because it had been published alongside an earlier reply)
+  void notifyReady();
+
+  //! Discards the send times of all requests still awaiting a reply (e.g. after an exception)
+  void reset();
+
+  /**
+    Polls until the next reply is ready
+    @param aPoll function that polls the target once, returning true if the reply is ready
+    @param aTimeout maximum time to wait for the reply
+    @return true if the reply is ready, false if timed out
+  */
+  bool wait(const std::function<bool ()>& aPoll, const Clock_t::duration& aTimeout);
+
+  //! Returns the current estimate of the round-trip time (exponentially-weighted moving average)
+  const Clock_t::duration& getEstimatedRTT() const;
+
+  //! Returns the number of replies received
+  uint64_t getNumberOfPackets() const;
+
+  //! Returns the total number of polls performed
+  uint64_t getNumberOfPolls() const;
+
+  //! Returns the mean number of polls per reply
+  double getMeanPollsPerPacket() const;
+
+  //! Returns the number of polls performed for the most recent reply
+  uint32_t getLastPollsPerPacket() const;
+
+  //! Resets the round-trip time estimate and poll counters
+  void clearStats();
+
+private:
+  bool mAdaptive;
+  Clock_t::duration mMaxSleep;
+
+  std::deque<Clock_t::time_point> mSendTimes;
+
+  Clock_t::duration mEstimatedRTT;
+  uint64_t mNrPackets;
+  uint64_t mNrPolls;
+  uint32_t mLastPolls;
+};
+
+std::ostream& operator<<(std::ostream&, const AdaptivePoller&);
+
+} // end ns uhal
+
+
+#endif
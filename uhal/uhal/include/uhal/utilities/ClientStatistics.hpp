@@ -0,0 +1,226 @@
+
+#ifndef _uhal_ClientStatistics_hpp_
+#define _uhal_ClientStatistics_hpp_
+
+
+#include <atomic>
+#include <chrono>
+#include <iosfwd>                          // for ostream
+#include <map>
+#include <stddef.h>                        // for size_t
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+namespace uhal {
+
+/**
+  Latency histogram with HdrHistogram-style log-linear buckets: values (in nanoseconds) are binned into powers of two,
+  each of which is split into 16 linear sub-buckets, giving a resolution of at most 1/16 of the value (i.e. ~6%) from
+  1 ns up to ~18 minutes (larger values are counted in the last bucket). Recording a value only updates a few relaxed
+  atomics, so it can be done concurrently from any thread without locks or memory allocation.
+*/
+class LatencyHistogram {
+public:
+  typedef std::chrono::steady_clock Clock_t;
+
+  static const size_t kSubBucketBits = 4;
+  static const size_t kSubBucketCount = size_t(1) << kSubBucketBits;
+  //! Values of 2^kMaxExponent ns or above are counted in the last bucket
+  static const size_t kMaxExponent = 40;
+  static const size_t kBucketCount = (kMaxExponent - kSubBucketBits + 1) * kSubBucketCount;
+
+  //! Copy of the contents of a histogram at a given time; all values are in nanoseconds
+  struct Snapshot {
+    Snapshot();
+
+    uint64_t count;
+    uint64_t sum;
+    uint64_t min;
+    uint64_t max;
+    //! Number of values in each bucket (see lowerBound and upperBound for the bucket limits)
+    std::vector<uint64_t> counts;
+
+    double mean() const;
+
+    //! Returns the smallest value such that at least aPercentile % of the recorded values are equal or less (to bucket resolution)
+    uint64_t percentile(const double aPercentile) const;
+  };
+
+  LatencyHistogram();
+  ~LatencyHistogram();
+
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  void add(const Clock_t::duration& aInterval)
+  {
+    const int64_t lValue = std::chrono::duration_cast<std::chrono::nanoseconds>(aInterval).count();
+    add(lValue > 0 ? uint64_t(lValue) : 0);
+  }
+
+  void add(const Clock_t::time_point& aT1, const Clock_t::time_point& aT2)
+  {
+    add(aT2 - aT1);
+  }
+
+  void add(const uint64_t aValue)
+  {
+    mCounts[getBucket(aValue)].fetch_add(1, std::memory_order_relaxed);
+    mSum.fetch_add(aValue, std::memory_order_relaxed);
+
+    uint64_t lMin = mMin.load(std::memory_order_relaxed);
+    while ((aValue < lMin) and not mMin.compare_exchange_weak(lMin, aValue, std::memory_order_relaxed)) {}
+    uint64_t lMax = mMax.load(std::memory_order_relaxed);
+    while ((aValue > lMax) and not mMax.compare_exchange_weak(lMax, aValue, std::memory_order_relaxed)) {}
+  }
+
+  Snapshot snapshot() const;
+
+  void clear();
+
+  static size_t getBucket(const uint64_t aValue)
+  {
+    if (aValue < kSubBucketCount)
+      return aValue;
+
+    const size_t lExponent = 63 - __builtin_clzll(aValue);
+    if (lExponent >= kMaxExponent)
+      return kBucketCount - 1;
+
+    const size_t lShift = lExponent - kSubBucketBits;
+    return (lShift + 1) * kSubBucketCount + ((aValue >> lShift) & (kSubBucketCount - 1));
+  }
+
+  //! Smallest value counted in the specified bucket
+  static uint64_t lowerBound(const size_t aBucket);
+
+  //! Smallest value above the specified bucket (i.e. the limit is exclusive)
+  static uint64_t upperBound(const size_t aBucket);
+
+private:
+  std::atomic<uint64_t> mCounts[kBucketCount];
+  std::atomic<uint64_t> mSum;
+  std::atomic<uint64_t> mMin;
+  std::atomic<uint64_t> mMax;
+};
+
+std::ostream& operator<<(std::ostream&, const LatencyHistogram::Snapshot&);
+
+
+/**
+  Performance counters and latency histograms for a client. Each packet is counted when it is handed to the transport
+  layer, and again when its reply is received; the round-trip time therefore also includes any time spent queueing
+  in the transport layer (e.g. when the maximum number of packets are already in flight). All counters are updated
+  using relaxed atomics, and so reading them does not disturb the client's threads; however, the values in a snapshot
+  taken during a dispatch are not necessarily consistent with each other.
+*/
+class ClientStatistics {
+public:
+  typedef LatencyHistogram::Clock_t Clock_t;
+
+  //! Maximum number of distinct transaction types that can be counted
+  static const size_t kMaxTransactionTypes = 16;
+
+  struct Snapshot {
+    Snapshot();
+
+    uint64_t packetsSent;
+    uint64_t packetsReceived;
+    uint64_t bytesSent;
+    uint64_t bytesReceived;
+    //! Number of transactions of each type, indexed by the name of the type (only includes types with registered names)
+    std::map<std::string, uint64_t> transactions;
+    //! Number of packets that have been sent, but whose replies have not yet been received
+    uint32_t inFlight;
+    //! Largest number of packets in flight at any one time
+    uint32_t maxInFlight;
+    //! Number of calls to dispatch, including those that failed
+    uint64_t dispatches;
+    //! Number of dispatches that failed due to a timeout
+    uint64_t timeouts;
+    //! Time from sending each packet to receiving its reply
+    LatencyHistogram::Snapshot packetRoundTripTime;
+    //! Duration of each call to dispatch
+    LatencyHistogram::Snapshot dispatchTime;
+  };
+
+  ClientStatistics();
+  ~ClientStatistics();
+
+  ClientStatistics(const ClientStatistics&) = delete;
+  ClientStatistics& operator=(const ClientStatistics&) = delete;
+
+  //! Sets name under which transactions of the specified type are reported in snapshots (not thread safe, so should only be called on construction)
+  void setTransactionTypeName(const size_t aType, const std::string& aName);
+
+  void recordTransaction(const size_t aType)
+  {
+    mTransactions[aType].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void recordPacketSent(const uint32_t aNrBytes)
+  {
+    mPacketsSent.fetch_add(1, std::memory_order_relaxed);
+    mBytesSent.fetch_add(aNrBytes, std::memory_order_relaxed);
+
+    const uint32_t lInFlight = mInFlight.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint32_t lMaxInFlight = mMaxInFlight.load(std::memory_order_relaxed);
+    while ((lInFlight > lMaxInFlight) and not mMaxInFlight.compare_exchange_weak(lMaxInFlight, lInFlight, std::memory_order_relaxed)) {}
+  }
+
+  void recordPacketReceived(const uint32_t aNrBytes, const Clock_t::time_point& aSendTime)
+  {
+    const Clock_t::time_point lNow = Clock_t::now();
+    mPacketsReceived.fetch_add(1, std::memory_order_relaxed);
+    mBytesReceived.fetch_add(aNrBytes, std::memory_order_relaxed);
+    uint32_t lInFlight = mInFlight.load(std::memory_order_relaxed);
+    while ((lInFlight > 0) and not mInFlight.compare_exchange_weak(lInFlight, lInFlight - 1, std::memory_order_relaxed)) {}
+    mPacketRoundTripTime.add(aSendTime, lNow);
+  }
+
+  //! Resets the in-flight count, for packets that will never get a reply (e.g. after a timeout)
+  void recordPacketsAbandoned()
+  {
+    mInFlight.store(0, std::memory_order_relaxed);
+  }
+
+  void recordDispatch(const Clock_t::time_point& aStartTime, const Clock_t::time_point& aEndTime)
+  {
+    mDispatches.fetch_add(1, std::memory_order_relaxed);
+    mDispatchTime.add(aStartTime, aEndTime);
+  }
+
+  void recordTimeout()
+  {
+    mTimeouts.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  Snapshot snapshot() const;
+
+  //! Resets all counters and histograms, apart from the number of packets currently in flight
+  void clear();
+
+private:
+  std::atomic<uint64_t> mPacketsSent;
+  std::atomic<uint64_t> mPacketsReceived;
+  std::atomic<uint64_t> mBytesSent;
+  std::atomic<uint64_t> mBytesReceived;
+  std::atomic<uint64_t> mTransactions[kMaxTransactionTypes];
+  std::vector<std::string> mTransactionTypeNames;
+  std::atomic<uint32_t> mInFlight;
+  std::atomic<uint32_t> mMaxInFlight;
+  std::atomic<uint64_t> mDispatches;
+  std::atomic<uint64_t> mTimeouts;
+
+  LatencyHistogram mPacketRoundTripTime;
+  LatencyHistogram mDispatchTime;
+};
+
+std::ostream& operator<<(std::ostream&, const ClientStatistics::Snapshot&);
+
+} // end ns uhal
+
+
+#endif
@@ -0,0 +1,120 @@
+
+#ifndef _uhal_PacketTrace_hpp_
+#define _uhal_PacketTrace_hpp_
+
+
+#include <chrono>
+#include <iosfwd>                          // for ostream
+#include <stddef.h>                        // for size_t
+#include <stdint.h>
+#include <vector>
+
+
+namespace uhal {
+
+/**
+  Lightweight instrumentation for the data path of page-based clients (i.e. mmap and PCIe): counts the packets
+  and words transferred, and optionally records the most recent transfers in a fixed-size ring buffer that can be
+  dumped on demand. Recording does not allocate memory or format any text.
+*/
+class PacketTrace {
+public:
+  typedef std::chrono::steady_clock Clock_t;
+
+  enum EntryType {
+    //! Request packet written to a page
+    REQUEST,
+    //! Reply packet read from a page
+    REPLY,
+    //! Interrupt received, indicating that a reply page is ready
+    INTERRUPT
+  };
+
+  struct Entry {
+    Clock_t::time_point time;
+    EntryType type;
+    uint32_t pageIndex;
+    uint32_t nrWords;
+    //! Number of polls before the reply was ready (only meaningful for replies)
+    uint32_t nrPolls;
+  };
+
+  //! @param aDepth number of entries kept in the ring buffer (0 disables tracing)
+  PacketTrace(const size_t aDepth = 0);
+  ~PacketTrace();
+
+  size_t getDepth() const;
+
+  //! Sets number of entries kept in the ring buffer (0 disables tracing); discards any existing entries
+  void setDepth(const size_t aDepth);
+
+  void recordRequest(const uint32_t aPageIndex, const uint32_t aNrWords)
+  {
+    mNrRequests++;
+    mNrRequestWords += aNrWords;
+    if (not mEntries.empty())
+      append(REQUEST, aPageIndex, aNrWords, 0);
+  }
+
+  void recordReply(const uint32_t aPageIndex, const uint32_t aNrWords, const uint32_t aNrPolls)
+  {
+    mNrReplies++;
+    mNrReplyWords += aNrWords;
+    if (not mEntries.empty())
+      append(REPLY, aPageIndex, aNrWords, aNrPolls);
+  }
+
+  void recordInterrupt(const uint32_t aPageIndex)
+  {
+    mNrInterrupts++;
+    if (not mEntries.empty())
+      append(INTERRUPT, aPageIndex, 0, 0);
+  }
+
+  uint64_t getNumberOfRequests() const;
+
+  uint64_t getNumberOfRequestWords() const;
+
+  uint64_t getNumberOfReplies() const;
+
+  uint64_t getNumberOfReplyWords() const;
+
+  uint64_t getNumberOfInterrupts() const;
+
+  //! Returns the entries currently in the ring buffer, oldest first
+  std::vector<Entry> getEntries() const;
+
+  //! Resets the counters and discards all entries in the ring buffer
+  void clear();
+
+private:
+  void append(const EntryType aType, const uint32_t aPageIndex, const uint32_t aNrWords, const uint32_t aNrPolls)
+  {
+    Entry& lEntry = mEntries[mNextEntry];
+    lEntry.time = Clock_t::now();
+    lEntry.type = aType;
+    lEntry.pageIndex = aPageIndex;
+    lEntry.nrWords = aNrWords;
+    lEntry.nrPolls = aNrPolls;
+    mNextEntry = (mNextEntry + 1) % mEntries.size();
+    if (mNrEntries < mEntries.size())
+      mNrEntries++;
+  }
+
+  uint64_t mNrRequests;
+  uint64_t mNrRequestWords;
+  uint64_t mNrReplies;
+  uint64_t mNrReplyWords;
+  uint64_t mNrInterrupts;
+
+  std::vector<Entry> mEntries;
+  size_t mNextEntry;
+  size_t mNrEntries;
+};
+
+std::ostream& operator<<(std::ostream&, const PacketTrace&);
+
+} // end ns uhal
+
+
+#endif
@@ -89,12 +89,44 @@ namespace uhal
 
     /**
     	Retrieve a file by HTTP
-    	@param aURL a URL to retrieve
+    	@param aURL a URL to retrieve (without the protocol prefix), optionally with an explicit port number (e.g. "host:8080/path")
     	@param aResponse a structure into which the returned HTTP packet is parsed
+    	@param aRequestHeaders additional headers to include in the request
+    	@return success/failure status (i.e. false unless the response status is 200)
+    */
+    template < bool DebugInfo >
+    bool HttpGet ( const std::string& aURL , HttpResponseType& aResponse , const std::vector< std::pair<std::string, std::string> >& aRequestHeaders = std::vector< std::pair<std::string, std::string> >() );
+
+
+    /**
+    	Retrieve the contents of a file by HTTP, via the persistent on-disk cache if it is enabled (see SetHttpCacheDirectory).
+    	Cached copies are revalidated with the server using their ETag/Last-Modified headers, and are also used if the server is
+    	unreachable (or if offline mode is enabled).
+    	@param aURL a URL to retrieve (without the protocol prefix)
+    	@param aContents a vector into which the file's contents are written
     	@return success/failure status
     */
     template < bool DebugInfo >
-    bool HttpGet ( const std::string& aURL , HttpResponseType& aResponse );
+    bool HttpGetFile ( const std::string& aURL , std::vector<uint8_t>& aContents );
+
+
+    /**
+    	Sets the directory used to cache files retrieved over HTTP (thread safe). Initially set from the UHAL_HTTP_CACHE_DIR environment variable.
+    	@param aDirectory the cache directory (created when needed); the cache is disabled if empty
+    */
+    void SetHttpCacheDirectory ( const boost::filesystem::path& aDirectory );
+
+    //! Returns the directory used to cache files retrieved over HTTP (empty if the cache is disabled)
+    boost::filesystem::path GetHttpCacheDirectory ( );
+
+    /**
+    	Enables or disables offline mode, in which files are only retrieved from the HTTP cache, without contacting the server (thread safe).
+    	Initially enabled if the UHAL_HTTP_CACHE_OFFLINE environment variable is set to a value other than 0.
+    */
+    void SetHttpOfflineMode ( const bool aOffline );
+
+    //! Returns whether offline mode is enabled for files retrieved over HTTP
+    bool GetHttpOfflineMode ( );
 
 
     namespace detail 
@@ -0,0 +1,98 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#ifndef _uhal_utilities_mmio_hpp_
+#define _uhal_utilities_mmio_hpp_
+
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+namespace uhal
+{
+  namespace utilities
+  {
+    namespace mmio
+    {
+      //! Implementations of the block copy routines between host memory and memory-mapped I/O (e.g. a PCIe BAR)
+      enum CopyKernel
+      {
+        COPY_SCALAR, ///< 32-bit loads, 64-bit stores (i.e. the original uHAL mmap implementation)
+        COPY_SSE,    ///< 128-bit non-temporal loads (SSE4.1) and stores (SSE2)
+        COPY_AVX2,   ///< 256-bit non-temporal loads and stores
+        COPY_AVX512  ///< 512-bit non-temporal loads and stores
+      };
+
+      //! Returns a short human-readable name for the specified copy kernel
+      std::string getName ( const CopyKernel aKernel );
+
+      //! Returns whether or not the specified copy kernel can be used on this CPU (determined at runtime)
+      bool isSupported ( const CopyKernel aKernel );
+
+      //! Returns the list of copy kernels that can be used on this CPU
+      std::vector<CopyKernel> getSupportedKernels();
+
+      //! Returns the widest copy kernel that is supported by this CPU; the CPU features are only queried on the first call
+      CopyKernel getDefaultKernel();
+
+      /**
+        Copies a block of 32-bit words from memory-mapped I/O into host memory
+        @param aDest destination in host memory
+        @param aSrc source address in the mapped region; must be at least 4-byte aligned
+        @param aNrWords number of 32-bit words to copy
+        @param aKernel copy implementation to use; must be supported by this CPU
+      */
+      void read ( uint32_t* aDest, const volatile void* aSrc, const size_t aNrWords, const CopyKernel aKernel = getDefaultKernel() );
+
+      /**
+        Copies a block of data from host memory into memory-mapped I/O. Stores are at least 64 bits wide, since
+        some targets (e.g. AXI-based IPbus transport) are only sensitive to 64-bit writes; for the same reason, a
+        trailing 32-bit word is written as a zero-extended 64-bit store.
+        @param aDest destination address in the mapped region; must be at least 4-byte aligned
+        @param aSrc source in host memory
+        @param aNrBytes number of bytes to copy; must be a multiple of 4
+        @param aKernel copy implementation to use; must be supported by this CPU
+      */
+      void write ( volatile void* aDest, const void* aSrc, const size_t aNrBytes, const CopyKernel aKernel = getDefaultKernel() );
+    }
+  }
+}
+
+
+#endif
@@ -127,6 +127,18 @@ namespace uhal
     mUnsignedValVectors.clear();
   }
 
+
+  void Buffers::setDispatchTime ( const std::chrono::steady_clock::time_point& aTime )
+  {
+    mDispatchTime = aTime;
+  }
+
+
+  const std::chrono::steady_clock::time_point& Buffers::getDispatchTime() const
+  {
+    return mDispatchTime;
+  }
+
 }
 
 
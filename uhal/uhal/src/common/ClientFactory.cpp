@@ -34,9 +34,9 @@
 
 #include <algorithm>
 
-#include <boost/spirit/include/qi.hpp>
-
-#include "uhal/grammars/URIGrammar.hpp"
+#include "uhal/grammars/Parsers.hpp"
+#include "uhal/MetricsExporter.hpp"
+#include "uhal/PacketCapture.hpp"
 #include "uhal/ProtocolUDP.hpp"
 #include "uhal/ProtocolTCP.hpp"
 #include "uhal/ProtocolIPbus.hpp"
@@ -99,10 +99,7 @@ namespace uhal
 
     try
     {
-      grammars::URIGrammar lGrammar;
-      std::string::const_iterator lBegin ( aUri.begin() );
-      std::string::const_iterator lEnd ( aUri.end() );
-      boost::spirit::qi::phrase_parse ( lBegin , lEnd , lGrammar , boost::spirit::ascii::space , lUri );
+      grammars::parseURI ( aUri , lUri );
     }
     catch ( const std::exception& aExc )
     {
@@ -136,7 +133,19 @@ namespace uhal
       }
     }
 
-    return lIt->second.creator->create ( aId , lUri );
+    PacketCapture::startFromEnvironment();
+
+    // Only register the client with the metrics exporter once it has been fully constructed; the deleter deregisters it before its destruction starts
+    std::unique_ptr<ClientInterface> lClient ( lIt->second.creator->create ( aId , lUri ) );
+    MetricsExporter::registerClient ( *lClient );
+    return std::shared_ptr<ClientInterface> ( lClient.release() , &ClientFactory::deleteClient );
+  }
+
+
+  void ClientFactory::deleteClient ( ClientInterface* aClient )
+  {
+    MetricsExporter::deregisterClient ( *aClient );
+    delete aClient;
   }
 
 }
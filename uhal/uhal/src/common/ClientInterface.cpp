@@ -33,6 +33,7 @@
 #include "uhal/ClientInterface.hpp"
 
 
+#include <exception>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -41,6 +42,8 @@
 #include "uhal/log/LogLevels.hpp"                              // for BaseLo...
 #include "uhal/log/log_inserters.integer.hpp"                  // for Integer
 #include "uhal/log/log.hpp"
+#include "uhal/log/log_inserters.quote.hpp"
+#include "uhal/Node.hpp"
 #include "uhal/utilities/bits.hpp"
 
 
@@ -54,6 +57,7 @@ namespace uhal
 #endif
     mId ( aId ),
     mTimeoutPeriod ( aTimeoutPeriod ),
+    mCaptureStream ( NULL ),
     mUri ( aUri ),
     mUriString( toString(aUri) )
   {
@@ -67,6 +71,7 @@ namespace uhal
 #endif
     mId ( ),
     mTimeoutPeriod ( boost::posix_time::pos_infin ),
+    mCaptureStream ( NULL ),
     mUri ( ),
     mUriString( "" )
   {
@@ -80,6 +85,7 @@ namespace uhal
 #endif
     mId ( aClientInterface.mId ),
     mTimeoutPeriod ( aClientInterface.mTimeoutPeriod ),
+    mCaptureStream ( NULL ),
     mUri ( aClientInterface.mUri ),
     mUriString( aClientInterface.mUriString )
   {
@@ -99,6 +105,11 @@ namespace uhal
 
   ClientInterface::~ClientInterface()
   {
+    if ( PacketCapture::Stream* lStream = mCaptureStream.load() )
+    {
+      PacketCapture::releaseStream ( lStream );
+    }
+
     deleteBuffers();
   }
 
@@ -140,9 +151,22 @@ namespace uhal
   }
 
 
+  ClientStatistics::Snapshot ClientInterface::getStatistics() const
+  {
+    return mStatistics.snapshot();
+  }
+
+
+  void ClientInterface::resetStatistics()
+  {
+    mStatistics.clear();
+  }
+
+
   void ClientInterface::dispatch ()
   {
     std::lock_guard<std::mutex> lLock ( mUserSideMutex );
+    const ClientStatistics::Clock_t::time_point lStartTime ( ClientStatistics::Clock_t::now() );
 
     try
     {
@@ -152,6 +176,7 @@ namespace uhal
       for (auto& lBuffer: mNoPreemptiveDispatchBuffers)
       {
         this->predispatch ( lBuffer );
+        recordPacketSent ( *lBuffer );
         this->implementDispatch ( lBuffer ); //responsibility for lBuffer passed to the implementDispatch function
         lBuffer.reset();
       }
@@ -167,16 +192,22 @@ namespace uhal
       if ( mCurrentBuffers )
       {
         this->predispatch ( mCurrentBuffers );
+        recordPacketSent ( *mCurrentBuffers );
         this->implementDispatch ( mCurrentBuffers ); //responsibility for mCurrentBuffers passed to the implementDispatch function
         mCurrentBuffers.reset();
         this->Flush();
       }
+
+      this->dispatchUnbufferedTransactions();
     }
     catch ( ... )
     {
+      mStatistics.recordDispatch ( lStartTime , ClientStatistics::Clock_t::now() );
       this->dispatchExceptionHandler();
       throw;
     }
+
+    mStatistics.recordDispatch ( lStartTime , ClientStatistics::Clock_t::now() );
   }
 
 
@@ -184,8 +215,22 @@ namespace uhal
   {}
 
 
+  void ClientInterface::dispatchUnbufferedTransactions ()
+  {}
+
+
   exception::exception* ClientInterface::validate ( std::shared_ptr< Buffers > aBuffers )
   {
+    mStatistics.recordPacketReceived ( aBuffers->replyCounter() , aBuffers->getDispatchTime() );
+
+    if ( PacketCapture::isEnabled() )
+    {
+      if ( PacketCapture::Stream* lStream = mCaptureStream.load ( std::memory_order_acquire ) )
+      {
+        PacketCapture::capture ( *lStream , aBuffers->getReplyBuffer() , aBuffers->replyCounter() );
+      }
+    }
+
     exception::exception* lRet = this->validate ( aBuffers->getSendBuffer() ,
                                  aBuffers->getSendBuffer() + aBuffers->sendCounter() ,
                                  aBuffers->getReplyBuffer().begin() ,
@@ -308,6 +353,7 @@ namespace uhal
     try
     {
       this->predispatch ( mCurrentBuffers );
+      recordPacketSent ( *mCurrentBuffers );
       this->implementDispatch ( mCurrentBuffers );
       mCurrentBuffers.reset();
     }
@@ -377,9 +423,48 @@ namespace uhal
   }
 
 
+  void ClientInterface::recordPacketSent ( Buffers& aBuffers )
+  {
+    aBuffers.setDispatchTime ( ClientStatistics::Clock_t::now() );
+    mStatistics.recordPacketSent ( aBuffers.sendCounter() );
+
+    if ( PacketCapture::isEnabled() )
+    {
+      PacketCapture::Stream* lStream ( mCaptureStream.load ( std::memory_order_acquire ) );
+
+      // Packets are only sent with the user-side mutex held, so only one thread can get here for a given client
+      if ( not lStream )
+      {
+        lStream = PacketCapture::createStream ( mId , mUri );
+        mCaptureStream.store ( lStream , std::memory_order_release );
+      }
+
+      PacketCapture::capture ( *lStream , aBuffers.getSendBuffer() , aBuffers.sendCounter() );
+    }
+  }
+
+
   void ClientInterface::dispatchExceptionHandler()
   {
     deleteBuffers();
+
+    // Replies to any packets still in flight will never be received
+    mStatistics.recordPacketsAbandoned();
+
+    if ( std::exception_ptr lException = std::current_exception() )
+    {
+      try
+      {
+        std::rethrow_exception ( lException );
+      }
+      catch ( const exception::ClientTimeout& )
+      {
+        mStatistics.recordTimeout();
+      }
+      catch ( ... )
+      {
+      }
+    }
   }
 
 
@@ -491,6 +576,102 @@ namespace uhal
   //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
 
+  //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+  ValHeader ClientInterface::write ( const RegisterDescriptor& aRegister, const uint32_t& aValue )
+  {
+    if ( aRegister.permission & defs::WRITE )
+    {
+      if ( aRegister.mask == defs::NOMASK )
+      {
+        return write ( aRegister.address , aValue );
+      }
+      else if ( aRegister.permission & defs::READ )
+      {
+        return write ( aRegister.address , aValue , aRegister.mask );
+      }
+    }
+
+    exception::WriteAccessDenied lExc;
+    log ( lExc , "Register " , Quote ( aRegister.path ) , ": permissions denied write access" );
+    throw lExc;
+  }
+
+
+  ValHeader ClientInterface::writeBlock ( const RegisterDescriptor& aRegister, const std::vector< uint32_t >& aValues )
+  {
+    if ( ( aRegister.mode == defs::SINGLE ) && ( aValues.size() != 1 ) )
+    {
+      exception::BulkTransferOnSingleRegister lExc;
+      log ( lExc , "Bulk Transfer requested on single register " , Quote ( aRegister.path ) );
+      throw lExc;
+    }
+
+    if ( ( aRegister.size != 1 ) && ( aValues.size() > aRegister.size ) )
+    {
+      exception::BulkTransferRequestedTooLarge lExc;
+      log ( lExc , "Requested bulk write of greater size than the specified endpoint size of register ", Quote ( aRegister.path ) );
+      throw lExc;
+    }
+
+    if ( not ( aRegister.permission & defs::WRITE ) )
+    {
+      exception::WriteAccessDenied lExc;
+      log ( lExc , "Register " , Quote ( aRegister.path ) , ": permissions denied write access" );
+      throw lExc;
+    }
+
+    return writeBlock ( aRegister.address , aValues , aRegister.mode );
+  }
+
+
+  ValWord< uint32_t > ClientInterface::read ( const RegisterDescriptor& aRegister )
+  {
+    if ( not ( aRegister.permission & defs::READ ) )
+    {
+      exception::ReadAccessDenied lExc;
+      log ( lExc , "Register " , Quote ( aRegister.path ) , ": permissions denied read access" );
+      throw lExc;
+    }
+
+    if ( aRegister.mask == defs::NOMASK )
+    {
+      return read ( aRegister.address );
+    }
+    else
+    {
+      return read ( aRegister.address , aRegister.mask );
+    }
+  }
+
+
+  ValVector< uint32_t > ClientInterface::readBlock ( const RegisterDescriptor& aRegister, const uint32_t& aSize )
+  {
+    if ( ( aRegister.mode == defs::SINGLE ) && ( aSize != 1 ) )
+    {
+      exception::BulkTransferOnSingleRegister lExc;
+      log ( lExc , "Bulk Transfer requested on single register " , Quote ( aRegister.path ) );
+      throw lExc;
+    }
+
+    if ( ( aRegister.size != 1 ) && ( aSize > aRegister.size ) )
+    {
+      exception::BulkTransferRequestedTooLarge lExc;
+      log ( lExc , "Requested bulk read of greater size than the specified endpoint size of register " , Quote ( aRegister.path ) );
+      throw lExc;
+    }
+
+    if ( not ( aRegister.permission & defs::READ ) )
+    {
+      exception::ReadAccessDenied lExc;
+      log ( lExc , "Register " , Quote ( aRegister.path ) , ": permissions denied read access" );
+      throw lExc;
+    }
+
+    return readBlock ( aRegister.address , aSize , aRegister.mode );
+  }
+  //-------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+
   void ClientInterface::setTimeoutPeriod ( const uint32_t& aTimeoutPeriod )
   {
     std::lock_guard<std::mutex> lLock ( mUserSideMutex );
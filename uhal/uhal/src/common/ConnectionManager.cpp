@@ -33,7 +33,12 @@
 #include "uhal/ConnectionManager.hpp"
 
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
 #include <mutex>
+#include <thread>
 
 #include <boost/filesystem/operations.hpp>
 #include <boost/regex.hpp>
@@ -135,8 +140,8 @@ namespace uhal
 
   HwInterface ConnectionManager::getDevice ( const std::string& aId )
   {
-    //We need a mutex lock here to protect access to the NodeTreeBuilder and the ClientFactory
-    std::lock_guard<std::mutex> lLock ( mMutex );
+    //We need a mutex lock here to protect access to the NodeTreeBuilder and the ClientFactory; the client itself is created after it is released
+    std::unique_lock<std::mutex> lLock ( mMutex );
 
     if ( mConnectionDescriptors.size() == 0 )
     {
@@ -154,32 +159,38 @@ namespace uhal
       throw lExc;
     }
 
-    //The node tree builder returns a newly created Node which we can safely wrap as a shared_ptr
-    std::shared_ptr< Node > lNode ( NodeTreeBuilder::getInstance().getNodeTree ( lIt->second.address_table , lIt->second.connection_file ) );
+    //The node tree builder returns its cached tree, which the HwInterface copies and binds to the client on first access
+    std::shared_ptr< const Node > lNode ( NodeTreeBuilder::getInstance().getSharedNodeTree ( lIt->second.address_table , lIt->second.connection_file ) );
     log ( Info() , "ConnectionManager created node tree: " , *lNode );
-    std::shared_ptr<ClientInterface> lClientInterface ( ClientFactory::getInstance().getClient ( lIt->second.id , lIt->second.uri , mUserClientActivationList ) );
+    ClientFactory& lFactory ( ClientFactory::getInstance() );
+    lLock.unlock();
+    std::shared_ptr<ClientInterface> lClientInterface ( lFactory.getClient ( lIt->second.id , lIt->second.uri , mUserClientActivationList ) );
     return HwInterface ( lClientInterface , lNode );
   }
 
 
   HwInterface ConnectionManager::getDevice ( const std::string& aId , const std::string& aUri , const std::string& aAddressFileExpr )
   {
-    //We need a mutex lock here to protect access to the TodeTreeBuilder and the ClientFactory
-    std::lock_guard<std::mutex> lLock ( mMutex );
-    std::shared_ptr< Node > lNode ( NodeTreeBuilder::getInstance().getNodeTree ( aAddressFileExpr , boost::filesystem::current_path() / "." ) );
+    //We need a mutex lock here to protect access to the TodeTreeBuilder and the ClientFactory; the client itself is created after it is released
+    std::unique_lock<std::mutex> lLock ( mMutex );
+    std::shared_ptr< const Node > lNode ( NodeTreeBuilder::getInstance().getSharedNodeTree ( aAddressFileExpr , boost::filesystem::current_path() / "." ) );
     log ( Info() , "ConnectionManager created node tree: " , *lNode );
-    std::shared_ptr<ClientInterface> lClientInterface ( ClientFactory::getInstance().getClient ( aId , aUri ) );
+    ClientFactory& lFactory ( ClientFactory::getInstance() );
+    lLock.unlock();
+    std::shared_ptr<ClientInterface> lClientInterface ( lFactory.getClient ( aId , aUri ) );
     return HwInterface ( lClientInterface , lNode );
   }
 
 
   HwInterface ConnectionManager::getDevice ( const std::string& aId , const std::string& aUri , const std::string& aAddressFileExpr, const std::vector<std::string>& aUserClientActivationList )
   {
-    //We need a mutex lock here to protect access to the TodeTreeBuilder and the ClientFactory
-    std::lock_guard<std::mutex> lLock ( mMutex );
-    std::shared_ptr< Node > lNode ( NodeTreeBuilder::getInstance().getNodeTree ( aAddressFileExpr , boost::filesystem::current_path() / "." ) );
+    //We need a mutex lock here to protect access to the TodeTreeBuilder and the ClientFactory; the client itself is created after it is released
+    std::unique_lock<std::mutex> lLock ( mMutex );
+    std::shared_ptr< const Node > lNode ( NodeTreeBuilder::getInstance().getSharedNodeTree ( aAddressFileExpr , boost::filesystem::current_path() / "." ) );
     log ( Info() , "ConnectionManager created node tree: " , *lNode );
-    std::shared_ptr<ClientInterface> lClientInterface ( ClientFactory::getInstance().getClient ( aId , aUri , aUserClientActivationList ) );
+    ClientFactory& lFactory ( ClientFactory::getInstance() );
+    lLock.unlock();
+    std::shared_ptr<ClientInterface> lClientInterface ( lFactory.getClient ( aId , aUri , aUserClientActivationList ) );
     return HwInterface ( lClientInterface , lNode );
   }
 
@@ -217,6 +228,109 @@ namespace uhal
   }
 
 
+  std::vector<HwInterface> ConnectionManager::getDevices ( const std::vector<std::string>& aIds )
+  {
+    //We need a mutex lock here to protect access to the NodeTreeBuilder and the ClientFactory; it is released before the clients are
+    //created, so that other threads can get devices (e.g. with cached address tables) whilst the clients' hostnames are resolved
+    std::unique_lock<std::mutex> lLock ( mMutex );
+    std::vector< const ConnectionDescriptor* > lDescriptors;
+    lDescriptors.reserve ( aIds.size() );
+
+    for ( const std::string& lId : aIds )
+    {
+      std::map< std::string, ConnectionDescriptor >::const_iterator lIt = mConnectionDescriptors.find ( lId );
+
+      if ( lIt == mConnectionDescriptors.end() )
+      {
+        exception::ConnectionUIDDoesNotExist lExc;
+        log ( lExc , "Device ID , " , Quote ( lId ) , ", does not exist in connection map" );
+        throw lExc;
+      }
+
+      lDescriptors.push_back ( &lIt->second );
+    }
+
+    // The builder would return the same shared tree for each device with a given address table, but would re-read the file each time
+    std::map< std::pair< std::string , boost::filesystem::path > , std::shared_ptr< const Node > > lNodeTrees;
+    std::vector< std::shared_ptr< const Node > > lNodes;
+    lNodes.reserve ( lDescriptors.size() );
+
+    for ( const ConnectionDescriptor* lDescriptor : lDescriptors )
+    {
+      std::shared_ptr< const Node >& lNode ( lNodeTrees [ std::make_pair ( lDescriptor->address_table , lDescriptor->connection_file ) ] );
+
+      if ( not lNode )
+      {
+        lNode = NodeTreeBuilder::getInstance().getSharedNodeTree ( lDescriptor->address_table , lDescriptor->connection_file );
+      }
+
+      lNodes.push_back ( lNode );
+    }
+
+    ClientFactory& lFactory ( ClientFactory::getInstance() );
+    lLock.unlock();
+
+    // Clients are created in parallel, since each one may block on hostname resolution; the number of threads isn't limited by the
+    // number of cores, since they mostly wait on the resolver
+    std::vector< std::shared_ptr< ClientInterface > > lClients ( lDescriptors.size() );
+    std::vector< std::exception_ptr > lExceptions ( lDescriptors.size() );
+    std::atomic< size_t > lNext ( 0 );
+    std::function< void () > lWorker = [&] ()
+    {
+      for ( size_t i = lNext++; i < lDescriptors.size(); i = lNext++ )
+      {
+        try
+        {
+          lClients [ i ] = lFactory.getClient ( lDescriptors [ i ]->id , lDescriptors [ i ]->uri , mUserClientActivationList );
+        }
+        catch ( ... )
+        {
+          lExceptions [ i ] = std::current_exception();
+        }
+      }
+    };
+
+    std::vector< std::thread > lThreads;
+
+    for ( size_t i = 1; i < std::min < size_t > ( 32 , lDescriptors.size() ); i++ )
+    {
+      lThreads.push_back ( std::thread ( lWorker ) );
+    }
+
+    lWorker();
+
+    for ( std::thread& lThread : lThreads )
+    {
+      lThread.join();
+    }
+
+    for ( const std::exception_ptr& lException : lExceptions )
+    {
+      if ( lException )
+      {
+        std::rethrow_exception ( lException );
+      }
+    }
+
+    std::vector<HwInterface> lDevices;
+    lDevices.reserve ( lDescriptors.size() );
+
+    for ( size_t i = 0; i < lDescriptors.size(); i++ )
+    {
+      lDevices.push_back ( HwInterface ( lClients [ i ] , lNodes [ i ] ) );
+    }
+
+    log ( Info() , "ConnectionManager created " , Integer ( lDevices.size() ) , " devices, from " , Integer ( lNodeTrees.size() ) , " address tables" );
+    return lDevices;
+  }
+
+
+  std::vector<HwInterface> ConnectionManager::getAllDevices ( )
+  {
+    return getDevices ( getDevices() );
+  }
+
+
   void ConnectionManager::clearAddressFileCache()
   {
     // Need a mutex lock here to protect access to NodeTreeBuilder
@@ -226,6 +340,22 @@ namespace uhal
   }
 
 
+  size_t ConnectionManager::reloadAddressFiles()
+  {
+    // Need a mutex lock here to protect access to NodeTreeBuilder
+    std::lock_guard<std::mutex> lLock ( mMutex );
+    const std::vector< std::pair< std::shared_ptr< const Node > , std::shared_ptr< const Node > > > lReplacements ( NodeTreeBuilder::getInstance().reloadAddressFiles() );
+
+    if ( not lReplacements.empty() )
+    {
+      const size_t lCount ( HwInterface::replaceNodeTrees ( lReplacements ) );
+      log ( Info() , "ConnectionManager reloaded " , Integer ( lReplacements.size() ) , " address tables, and replaced the node trees of " , Integer ( lCount ) , " devices" );
+    }
+
+    return lReplacements.size();
+  }
+
+
   void ConnectionManager::CallBack ( const std::string& aProtocol , const boost::filesystem::path& aPath , std::vector<uint8_t>& aFile )
   {
     std::pair< std::set< std::string >::iterator , bool > lInsert = mPreviouslyOpenedFiles.insert ( aProtocol+ ( aPath.string() ) );
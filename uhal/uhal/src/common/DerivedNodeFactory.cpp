@@ -72,11 +72,17 @@ namespace uhal
 
   Node* DerivedNodeFactory::convertToClassType ( Node* aNode )
   {
-    std::unordered_map< std::string , std::shared_ptr<CreatorInterface> >::const_iterator lIt = mCreators.find ( aNode->mClassName );
+    return convertToClassType ( aNode , aNode->mClassName );
+  }
+
+
+  Node* DerivedNodeFactory::convertToClassType ( Node* aNode , const std::string& aClassName )
+  {
+    std::unordered_map< std::string , std::shared_ptr<CreatorInterface> >::const_iterator lIt = mCreators.find ( aClassName );
 
     if ( lIt == mCreators.end() )
     {
-      log ( Warning , "Class " , Quote ( aNode->mClassName ) , " is unknown to the NodeTreeBuilder class factory. A plain node will be returned instead." );
+      log ( Warning , "Class " , Quote ( aClassName ) , " is unknown to the NodeTreeBuilder class factory. A plain node will be returned instead." );
 
       if ( mCreators.size() )
       {
@@ -102,4 +108,11 @@ namespace uhal
     }
   }
 
+
+  std::string DerivedNodeFactory::getRegisteredClassName ( const Node& aNode ) const
+  {
+    std::unordered_map< std::type_index , std::string >::const_iterator lIt = mClassNames.find ( std::type_index ( typeid ( aNode ) ) );
+    return ( lIt == mClassNames.end() ) ? std::string() : lIt->second;
+  }
+
 }
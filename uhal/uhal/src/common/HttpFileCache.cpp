@@ -0,0 +1,220 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/HttpFileCache.hpp"
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <sstream>
+#include <thread>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include "uhal/grammars/HttpResponseGrammar.hpp"
+#include "uhal/log/log.hpp"
+#include "uhal/NodeTreeCache.hpp"
+
+
+namespace uhal
+{
+
+  HttpFileCache::HttpFileCache ( const boost::filesystem::path& aDirectory ) :
+    mDirectory ( aDirectory )
+  {
+  }
+
+
+  HttpFileCache::~HttpFileCache ()
+  {
+  }
+
+
+  const boost::filesystem::path& HttpFileCache::getDirectory() const
+  {
+    return mDirectory;
+  }
+
+
+  bool HttpFileCache::load ( const std::string& aURL , Entry& aEntry , std::vector<uint8_t>& aContents ) const
+  {
+    const boost::filesystem::path lEntryPath ( getEntryPath ( aURL ) );
+    std::ifstream lEntryFile ( lEntryPath.c_str() );
+
+    if ( not lEntryFile.is_open() )
+    {
+      return false;
+    }
+
+    Entry lEntry;
+    std::string lSize, lHash;
+
+    if ( not ( std::getline ( lEntryFile , lEntry.url ) and std::getline ( lEntryFile , lEntry.etag ) and std::getline ( lEntryFile , lEntry.lastModified ) and std::getline ( lEntryFile , lSize ) and std::getline ( lEntryFile , lHash ) ) )
+    {
+      log ( Warning() , "HTTP cache entry " , Quote ( lEntryPath.string() ) , " is truncated; ignoring it" );
+      return false;
+    }
+
+    if ( lEntry.url != aURL )
+    {
+      log ( Debug() , "HTTP cache entry " , Quote ( lEntryPath.string() ) , " is for a different URL (hash collision)" );
+      return false;
+    }
+
+    lEntry.size = strtoull ( lSize.c_str() , NULL , 10 );
+    lEntry.hash = strtoull ( lHash.c_str() , NULL , 16 );
+
+    const boost::filesystem::path lContentPath ( getContentPath ( lEntry.hash ) );
+    std::ifstream lContentFile ( lContentPath.c_str() , std::ios::binary );
+    std::vector<uint8_t> lContents ( ( std::istreambuf_iterator<char> ( lContentFile ) ) , std::istreambuf_iterator<char>() );
+
+    if ( ( lContents.size() != lEntry.size ) or ( NodeTreeCache::hash ( lContents.data() , lContents.size() ) != lEntry.hash ) )
+    {
+      log ( Warning() , "HTTP cache file " , Quote ( lContentPath.string() ) , " for URL " , Quote ( aURL ) , " is missing or corrupt; ignoring it" );
+      return false;
+    }
+
+    aEntry = lEntry;
+    aContents.swap ( lContents );
+    return true;
+  }
+
+
+  void HttpFileCache::store ( const std::string& aURL , const HttpResponseType& aResponse ) const
+  {
+    Entry lEntry;
+    lEntry.url = aURL;
+    lEntry.etag = getHeader ( aResponse.headers , "ETag" );
+    lEntry.lastModified = getHeader ( aResponse.headers , "Last-Modified" );
+    lEntry.size = aResponse.content.size();
+    lEntry.hash = NodeTreeCache::hash ( aResponse.content.data() , aResponse.content.size() );
+
+    try
+    {
+      boost::filesystem::create_directories ( mDirectory );
+
+      // Contents are only written once, since the file name depends on them
+      const boost::filesystem::path lContentPath ( getContentPath ( lEntry.hash ) );
+
+      if ( ( not boost::filesystem::exists ( lContentPath ) ) or ( boost::filesystem::file_size ( lContentPath ) != lEntry.size ) )
+      {
+        if ( not write ( lContentPath , aResponse.content.data() , aResponse.content.size() ) )
+        {
+          return;
+        }
+      }
+
+      std::ostringstream lStream;
+      lStream << lEntry.url << "\n" << lEntry.etag << "\n" << lEntry.lastModified << "\n" << lEntry.size << "\n" << std::hex << lEntry.hash << "\n";
+      const std::string lEntryData ( lStream.str() );
+
+      if ( not write ( getEntryPath ( aURL ) , lEntryData.data() , lEntryData.size() ) )
+      {
+        return;
+      }
+    }
+    catch ( const boost::filesystem::filesystem_error& aExc )
+    {
+      log ( Warning() , "Failed to write HTTP cache entry for URL " , Quote ( aURL ) , "; caught filesystem_error exception with what returning: " , aExc.what() );
+      return;
+    }
+
+    log ( Debug() , "Stored URL " , Quote ( aURL ) , " in HTTP cache (" , Integer ( lEntry.size ) , " bytes)" );
+  }
+
+
+  boost::filesystem::path HttpFileCache::getEntryPath ( const std::string& aURL ) const
+  {
+    char lHash[17];
+    snprintf ( lHash , sizeof ( lHash ) , "%016llx" , static_cast<unsigned long long> ( NodeTreeCache::hash ( reinterpret_cast<const uint8_t*> ( aURL.data() ) , aURL.size() ) ) );
+    return mDirectory / ( "http-" + std::string ( lHash ) + ".txt" );
+  }
+
+
+  boost::filesystem::path HttpFileCache::getContentPath ( const uint64_t aHash ) const
+  {
+    char lHash[17];
+    snprintf ( lHash , sizeof ( lHash ) , "%016llx" , static_cast<unsigned long long> ( aHash ) );
+    return mDirectory / ( "content-" + std::string ( lHash ) + ".dat" );
+  }
+
+
+  std::string HttpFileCache::getHeader ( const std::string& aHeaders , const std::string& aName )
+  {
+    std::istringstream lStream ( aHeaders );
+    std::string lLine;
+
+    while ( std::getline ( lStream , lLine ) )
+    {
+      const size_t lColon ( lLine.find ( ':' ) );
+
+      if ( ( lColon != std::string::npos ) and boost::iequals ( boost::trim_copy ( lLine.substr ( 0 , lColon ) ) , aName ) )
+      {
+        return boost::trim_copy ( lLine.substr ( lColon + 1 ) );
+      }
+    }
+
+    return "";
+  }
+
+
+  bool HttpFileCache::write ( const boost::filesystem::path& aPath , const void* aData , const size_t aSize )
+  {
+    // Write to a temporary file then rename, so that other threads/processes never see a partially-written file
+    const boost::filesystem::path lTempPath ( aPath.string() + "." + std::to_string ( getpid() ) + "." + std::to_string ( std::hash<std::thread::id>() ( std::this_thread::get_id() ) ) + ".tmp" );
+
+    std::ofstream lFile ( lTempPath.c_str() , std::ios::binary | std::ios::trunc );
+    lFile.write ( reinterpret_cast<const char*> ( aData ) , aSize );
+    lFile.close();
+
+    if ( not lFile )
+    {
+      log ( Warning() , "Failed to write HTTP cache file " , Quote ( lTempPath.string() ) );
+      boost::filesystem::remove ( lTempPath );
+      return false;
+    }
+
+    boost::filesystem::rename ( lTempPath , aPath );
+    return true;
+  }
+
+}
@@ -33,31 +33,72 @@
 #include "uhal/HwInterface.hpp"
 
 
+#include <algorithm>
 #include <deque>
 #include <memory>
 
 #include "uhal/ClientInterface.hpp"
+#include "uhal/detail/NodeBinding.hpp"
 #include "uhal/Node.hpp"
+#include "uhal/RegisterDescriptor.hpp"
 
 
 namespace uhal
 {
 
+  HwInterface::NodeTree::NodeTree ( ClientInterface* aClient , const std::shared_ptr< const Node >& aPrototype ) :
+    mClient ( aClient ),
+    mPrototype ( aPrototype ),
+    mNode ( NULL )
+  {
+  }
+
+
+  HwInterface::NodeTree::~NodeTree()
+  {
+  }
+
+
   HwInterface::HwInterface ( const std::shared_ptr<ClientInterface>& aClientInterface , const std::shared_ptr< Node >& aNode ) :
     mClientInterface ( aClientInterface ),
-    mNode ( aNode )
+    mNodeTree ( new NodeTree ( aClientInterface.get() , std::shared_ptr< const Node >() ) )
   {
-    claimNode ( *mNode );
-    mClientInterface->mNode = mNode;
+    detail::validateRegisteredDescriptors ( *aNode );
+    claimNode ( *aNode , mClientInterface.get() );
+    mNodeTree->mClaimedNode = aNode;
+    mNodeTree->mNode = aNode.get();
+    std::lock_guard<std::mutex> lLock ( mClientInterface->mNodeMutex );
+    mClientInterface->mNode = aNode;
+  }
+
+
+  HwInterface::HwInterface ( const std::shared_ptr<ClientInterface>& aClientInterface , const std::shared_ptr< const Node >& aNode ) :
+    mClientInterface ( aClientInterface ),
+    mNodeTree ( new NodeTree ( aClientInterface.get() , aNode ) )
+  {
+    detail::validateRegisteredDescriptors ( *aNode );
+
+    {
+      std::lock_guard<std::mutex> lLock ( mClientInterface->mNodeMutex );
+      mClientInterface->mNode = aNode;
+    }
+
+    std::lock_guard<std::mutex> lLock ( mNodeTreesMutex );
+
+    if ( mNodeTrees.size() >= mNodeTreesSweepSize )
+    {
+      mNodeTrees.erase ( std::remove_if ( mNodeTrees.begin() , mNodeTrees.end() , [] ( const std::weak_ptr< NodeTree >& aTree ) { return aTree.expired(); } ) , mNodeTrees.end() );
+      mNodeTreesSweepSize = std::max ( mNodeTreesSweepSize , 2 * mNodeTrees.size() );
+    }
+
+    mNodeTrees.push_back ( mNodeTree );
   }
 
 
   HwInterface::HwInterface ( const HwInterface& otherHw ) :
     mClientInterface ( otherHw.mClientInterface ),
-    mNode ( otherHw.mNode->clone() )
+    mNodeTree ( otherHw.mNodeTree )
   {
-    claimNode ( *mNode );
-    mClientInterface->mNode = mNode;
   }
 
 
@@ -66,12 +107,84 @@ namespace uhal
   }
 
 
-  void HwInterface::claimNode ( Node& aNode )
+  void HwInterface::claimNode ( Node& aNode , ClientInterface* aClient )
   {
-    aNode.mHw = this;
+    aNode.mClient = aClient;
 
     for (Node* lChild: aNode.mChildren)
-      claimNode ( *lChild );
+      claimNode ( *lChild , aClient );
+  }
+
+
+  Node& HwInterface::getBoundNode() const
+  {
+    NodeTree& lTree ( *mNodeTree );
+    std::call_once ( lTree.mBindFlag , [&lTree] () {
+      std::lock_guard<std::mutex> lLock ( lTree.mMutex );
+
+      if ( not lTree.mNode.load() )
+      {
+        lTree.mBinding.reset ( new detail::NodeBinding ( lTree.mPrototype , lTree.mClient ) );
+        lTree.mNode.store ( &lTree.mBinding->getRoot() , std::memory_order_release );
+      }
+    } );
+    return *lTree.mNode.load ( std::memory_order_acquire );
+  }
+
+
+  size_t HwInterface::replaceNodeTrees ( const std::vector< std::pair< std::shared_ptr< const Node > , std::shared_ptr< const Node > > >& aReplacements )
+  {
+    std::vector< std::shared_ptr< NodeTree > > lTrees;
+    {
+      std::lock_guard<std::mutex> lLock ( mNodeTreesMutex );
+
+      for ( const std::weak_ptr< NodeTree >& lWeakTree : mNodeTrees )
+      {
+        if ( std::shared_ptr< NodeTree > lTree = lWeakTree.lock() )
+        {
+          lTrees.push_back ( lTree );
+        }
+      }
+    }
+
+    size_t lCount ( 0 );
+
+    for ( const std::shared_ptr< NodeTree >& lTree : lTrees )
+    {
+      std::lock_guard<std::mutex> lLock ( lTree->mMutex );
+
+      for ( const auto& lReplacement : aReplacements )
+      {
+        if ( lTree->mPrototype != lReplacement.first )
+        {
+          continue;
+        }
+
+        lTree->mPrototype = lReplacement.second;
+
+        // Trees that haven't been accessed yet just need their prototype updating; otherwise the binding is replaced by a binding of
+        // the new tree, atomically so that each access from other threads sees either the old or new tree in its entirety. The
+        // previous binding is retired (and the one that it replaced, from the reload before, is destroyed)
+        if ( lTree->mNode.load() )
+        {
+          std::unique_ptr< detail::NodeBinding > lBinding ( new detail::NodeBinding ( lTree->mPrototype , lTree->mClient ) );
+          lTree->mNode.store ( &lBinding->getRoot() , std::memory_order_release );
+          lTree->mRetiredBinding = std::move ( lTree->mBinding );
+          lTree->mBinding = std::move ( lBinding );
+        }
+
+        // Error messages from the client must describe addresses using the new tree
+        {
+          std::lock_guard<std::mutex> lClientLock ( lTree->mClient->mNodeMutex );
+          lTree->mClient->mNode = lTree->mPrototype;
+        }
+
+        lCount++;
+        break;
+      }
+    }
+
+    return lCount;
   }
 
 
@@ -129,27 +242,58 @@ namespace uhal
 
   const Node& HwInterface::getNode () const
   {
-    return *mNode;
+    return getBoundNode();
   }
 
 
   const Node& HwInterface::getNode ( const std::string& aId ) const
   {
-    return mNode->getNode ( aId );
+    return getBoundNode().getNode ( aId );
+  }
+
+
+  Node::Handle HwInterface::getHandle ( const std::string& aId ) const
+  {
+    return getBoundNode().getHandle ( aId );
+  }
+
+
+  const Node& HwInterface::getNode ( const Node::Handle& aHandle ) const
+  {
+    return getBoundNode().getNode ( aHandle );
   }
 
 
   std::vector<std::string> HwInterface::getNodes() const
   {
-    return mNode->getNodes();
+    return getBoundNode().getNodes();
   }
 
 
   std::vector<std::string> HwInterface::getNodes ( const std::string& aRegex ) const
   {
-    return mNode->getNodes ( aRegex );
+    return getBoundNode().getNodes ( aRegex );
+  }
+
+
+  std::vector<std::string> HwInterface::getNodesMatchingGlob ( const std::string& aPattern ) const
+  {
+    return getBoundNode().getNodesMatchingGlob ( aPattern );
   }
 
+
+  std::vector<std::string> HwInterface::getNodesWithPrefix ( const std::string& aPrefix ) const
+  {
+    return getBoundNode().getNodesWithPrefix ( aPrefix );
+  }
+
+
+  std::vector< std::weak_ptr< HwInterface::NodeTree > > HwInterface::mNodeTrees;
+
+  size_t HwInterface::mNodeTreesSweepSize = 64;
+
+  std::mutex HwInterface::mNodeTreesMutex;
+
 }
 
 
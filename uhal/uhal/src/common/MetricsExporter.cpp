@@ -0,0 +1,493 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/MetricsExporter.hpp"
+
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <istream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <vector>
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "uhal/ClientInterface.hpp"
+#include "uhal/grammars/Parsers.hpp"
+#include "uhal/HttpFileCache.hpp"
+#include "uhal/log/log.hpp"
+#include "uhal/log/log_inserters.quote.hpp"
+
+
+namespace uhal
+{
+
+  namespace
+  {
+    struct ClientRegistry
+    {
+      std::mutex mutex;
+      std::set< const ClientInterface* > clients;
+    };
+
+
+    ClientRegistry& getClientRegistry()
+    {
+      // Never destroyed, since clients may outlive other static objects
+      static ClientRegistry* lRegistry = new ClientRegistry();
+      return *lRegistry;
+    }
+
+
+    struct ClientMetrics
+    {
+      std::string id;
+      std::string uri;
+      ClientStatistics::Snapshot statistics;
+
+      bool operator< ( const ClientMetrics& aOther ) const
+      {
+        return ( id < aOther.id ) or ( ( id == aOther.id ) and ( uri < aOther.uri ) );
+      }
+    };
+
+
+    std::string escapeLabelValue ( const std::string& aValue )
+    {
+      std::string lResult;
+      lResult.reserve ( aValue.size() );
+
+      for ( const char c : aValue )
+      {
+        switch ( c )
+        {
+          case '\\' :
+            lResult += "\\\\";
+            break;
+          case '"' :
+            lResult += "\\\"";
+            break;
+          case '\n' :
+            lResult += "\\n";
+            break;
+          default :
+            lResult += c;
+        }
+      }
+
+      return lResult;
+    }
+
+
+    std::string formatDouble ( const double aValue )
+    {
+      std::ostringstream lStream;
+      lStream << std::setprecision ( 10 ) << aValue;
+      return lStream.str();
+    }
+
+
+    std::string getLabels ( const ClientMetrics& aClient )
+    {
+      return "id=\"" + escapeLabelValue ( aClient.id ) + "\",uri=\"" + escapeLabelValue ( aClient.uri ) + "\"";
+    }
+
+
+    void writeHeader ( std::ostream& aStream , const std::string& aName , const std::string& aType , const std::string& aHelp , const bool aOpenMetrics )
+    {
+      // The OpenMetrics format names counter families without the '_total' suffix of their samples, whereas the Prometheus format does not distinguish them
+      const std::string lName ( ( aType == "counter" and not aOpenMetrics ) ? aName + "_total" : aName );
+      aStream << "# HELP " << lName << " " << aHelp << "\n";
+      aStream << "# TYPE " << lName << " " << aType << "\n";
+    }
+
+
+    template < typename T >
+    void writeMetric ( std::ostream& aStream , const std::vector< ClientMetrics >& aClients , const std::string& aName , const std::string& aType , const std::string& aHelp ,
+                       T ClientStatistics::Snapshot::* aMember , const bool aOpenMetrics )
+    {
+      writeHeader ( aStream , aName , aType , aHelp , aOpenMetrics );
+      const std::string lSuffix ( aType == "counter" ? "_total" : "" );
+
+      for ( const ClientMetrics& lClient : aClients )
+      {
+        aStream << aName << lSuffix << "{" << getLabels ( lClient ) << "} " << lClient.statistics.*aMember << "\n";
+      }
+    }
+
+
+    void writeHistogram ( std::ostream& aStream , const std::vector< ClientMetrics >& aClients , const std::string& aName , const std::string& aHelp ,
+                          LatencyHistogram::Snapshot ClientStatistics::Snapshot::* aMember , const bool aOpenMetrics )
+    {
+      // Histogram buckets are exported with power-of-two limits from ~1us to ~34s, which coincide with the limits of the latency histograms' buckets
+      static const size_t kMinExponent = 10;
+      static const size_t kMaxExponent = 35;
+
+      writeHeader ( aStream , aName , "histogram" , aHelp , aOpenMetrics );
+
+      for ( const ClientMetrics& lClient : aClients )
+      {
+        const LatencyHistogram::Snapshot& lHistogram ( lClient.statistics.*aMember );
+        const std::string lLabels ( getLabels ( lClient ) );
+        uint64_t lCumulativeCount ( 0 );
+        size_t lBucket ( 0 );
+
+        for ( size_t lExponent = kMinExponent; lExponent <= kMaxExponent; lExponent++ )
+        {
+          const uint64_t lLimit ( uint64_t ( 1 ) << lExponent );
+
+          for ( ; lBucket < std::min ( LatencyHistogram::getBucket ( lLimit ) , lHistogram.counts.size() ); lBucket++ )
+          {
+            lCumulativeCount += lHistogram.counts.at ( lBucket );
+          }
+
+          aStream << aName << "_bucket{" << lLabels << ",le=\"" << formatDouble ( lLimit * 1e-9 ) << "\"} " << lCumulativeCount << "\n";
+        }
+
+        aStream << aName << "_bucket{" << lLabels << ",le=\"+Inf\"} " << lHistogram.count << "\n";
+        aStream << aName << "_count{" << lLabels << "} " << lHistogram.count << "\n";
+        aStream << aName << "_sum{" << lLabels << "} " << formatDouble ( lHistogram.sum * 1e-9 ) << "\n";
+      }
+    }
+  }
+
+
+  struct MetricsExporter::HttpSession : public std::enable_shared_from_this< HttpSession >
+  {
+    HttpSession ( boost::asio::io_service& aIOservice ) :
+      socket ( aIOservice ),
+      request ( 8192 )
+    {
+    }
+
+    void start()
+    {
+      std::shared_ptr< HttpSession > lSelf ( shared_from_this() );
+      boost::asio::async_read_until ( socket , request , "\r\n\r\n" , [lSelf] ( const boost::system::error_code& aError , std::size_t )
+      {
+        if ( not aError )
+        {
+          lSelf->respond();
+        }
+      } );
+    }
+
+    void respond()
+    {
+      std::istream lStream ( &request );
+      std::string lMethod , lPath;
+      lStream >> lMethod >> lPath;
+      const std::string lHeaders ( ( std::istreambuf_iterator< char > ( lStream ) ) , std::istreambuf_iterator< char >() );
+
+      std::ostringstream lResponse;
+
+      if ( lMethod != "GET" )
+      {
+        lResponse << "HTTP/1.1 405 Method Not Allowed\r\nAllow: GET\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+      }
+      else if ( ( lPath != "/metrics" ) and ( lPath != "/" ) )
+      {
+        lResponse << "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+      }
+      else
+      {
+        const bool lOpenMetrics ( HttpFileCache::getHeader ( lHeaders , "Accept" ).find ( "application/openmetrics-text" ) != std::string::npos );
+        std::ostringstream lBody;
+        MetricsExporter::write ( lBody , lOpenMetrics );
+        lResponse << "HTTP/1.1 200 OK\r\n";
+        lResponse << "Content-Type: " << ( lOpenMetrics ? "application/openmetrics-text; version=1.0.0; charset=utf-8" : "text/plain; version=0.0.4; charset=utf-8" ) << "\r\n";
+        lResponse << "Content-Length: " << lBody.str().size() << "\r\nConnection: close\r\n\r\n" << lBody.str();
+      }
+
+      response = lResponse.str();
+      std::shared_ptr< HttpSession > lSelf ( shared_from_this() );
+      boost::asio::async_write ( socket , boost::asio::buffer ( response ) , [lSelf] ( const boost::system::error_code& , std::size_t )
+      {
+        boost::system::error_code lError;
+        lSelf->socket.shutdown ( boost::asio::ip::tcp::socket::shutdown_both , lError );
+        lSelf->socket.close ( lError );
+      } );
+    }
+
+    boost::asio::ip::tcp::socket socket;
+    boost::asio::streambuf request;
+    std::string response;
+  };
+
+
+  const char* const MetricsExporter::mPortEnvVariable = "UHAL_METRICS_PORT";
+  const char* const MetricsExporter::mFileEnvVariable = "UHAL_METRICS_FILE";
+
+
+  MetricsExporter::MetricsExporter ( const uint16_t aPort , const std::string& aAddress ) :
+    mIOservice(),
+    mPeriod ( 0 ),
+    mStop ( false )
+  {
+    try
+    {
+      const boost::asio::ip::tcp::endpoint lEndpoint ( boost::asio::ip::address::from_string ( aAddress ) , aPort );
+      mAcceptor.reset ( new boost::asio::ip::tcp::acceptor ( mIOservice ) );
+      mAcceptor->open ( lEndpoint.protocol() );
+      mAcceptor->set_option ( boost::asio::ip::tcp::acceptor::reuse_address ( true ) );
+      mAcceptor->bind ( lEndpoint );
+      mAcceptor->listen();
+    }
+    catch ( const boost::system::system_error& aExc )
+    {
+      exception::MetricsExporterError lExc;
+      log ( lExc , "Failed to listen for metrics requests on " , Quote ( aAddress + ":" + std::to_string ( aPort ) ) , "; what returned: " , Quote ( aExc.what() ) );
+      throw lExc;
+    }
+
+    accept();
+    mThread = std::thread ( [this] () { mIOservice.run(); } );
+    log ( Info() , "Serving uHAL metrics on " , Quote ( aAddress + ":" + std::to_string ( getPort() ) ) );
+  }
+
+
+  MetricsExporter::MetricsExporter ( const boost::filesystem::path& aPath , const std::chrono::milliseconds& aPeriod ) :
+    mIOservice(),
+    mPath ( aPath ),
+    mPeriod ( aPeriod ),
+    mStop ( false )
+  {
+    mThread = std::thread ( [this] () { writeFilePeriodically(); } );
+  }
+
+
+  MetricsExporter::~MetricsExporter()
+  {
+    if ( mAcceptor )
+    {
+      mIOservice.stop();
+    }
+    else
+    {
+      std::lock_guard< std::mutex > lLock ( mMutex );
+      mStop = true;
+      mConditionVariable.notify_all();
+    }
+
+    if ( mThread.joinable() )
+    {
+      mThread.join();
+    }
+  }
+
+
+  uint16_t MetricsExporter::getPort() const
+  {
+    return mAcceptor ? mAcceptor->local_endpoint().port() : 0;
+  }
+
+
+  void MetricsExporter::write ( std::ostream& aStream , const bool aOpenMetrics )
+  {
+    std::vector< ClientMetrics > lClients;
+    {
+      ClientRegistry& lRegistry ( getClientRegistry() );
+      std::lock_guard< std::mutex > lLock ( lRegistry.mutex );
+
+      for ( const ClientInterface* lClient : lRegistry.clients )
+      {
+        lClients.push_back ( ClientMetrics { lClient->id() , lClient->uri() , lClient->getStatistics() } );
+      }
+    }
+
+    std::sort ( lClients.begin() , lClients.end() );
+
+    writeMetric ( aStream , lClients , "uhal_client_packets_sent" , "counter" , "Number of packets sent by the client." , &ClientStatistics::Snapshot::packetsSent , aOpenMetrics );
+    writeMetric ( aStream , lClients , "uhal_client_packets_received" , "counter" , "Number of reply packets received by the client." , &ClientStatistics::Snapshot::packetsReceived , aOpenMetrics );
+    writeMetric ( aStream , lClients , "uhal_client_sent_bytes" , "counter" , "Number of bytes sent by the client." , &ClientStatistics::Snapshot::bytesSent , aOpenMetrics );
+    writeMetric ( aStream , lClients , "uhal_client_received_bytes" , "counter" , "Number of bytes received by the client." , &ClientStatistics::Snapshot::bytesReceived , aOpenMetrics );
+
+    writeHeader ( aStream , "uhal_client_transactions" , "counter" , "Number of IPbus transactions sent by the client, by type." , aOpenMetrics );
+
+    for ( const ClientMetrics& lClient : lClients )
+    {
+      for ( const std::pair< const std::string , uint64_t >& lTransactions : lClient.statistics.transactions )
+      {
+        aStream << "uhal_client_transactions_total{" << getLabels ( lClient ) << ",type=\"" << escapeLabelValue ( lTransactions.first ) << "\"} " << lTransactions.second << "\n";
+      }
+    }
+
+    writeMetric ( aStream , lClients , "uhal_client_packets_in_flight" , "gauge" , "Number of packets sent by the client whose replies have not yet been received." , &ClientStatistics::Snapshot::inFlight , aOpenMetrics );
+    writeMetric ( aStream , lClients , "uhal_client_max_packets_in_flight" , "gauge" , "Largest number of packets that the client has had in flight at any one time." , &ClientStatistics::Snapshot::maxInFlight , aOpenMetrics );
+    writeMetric ( aStream , lClients , "uhal_client_dispatches" , "counter" , "Number of dispatches by the client." , &ClientStatistics::Snapshot::dispatches , aOpenMetrics );
+    writeMetric ( aStream , lClients , "uhal_client_timeouts" , "counter" , "Number of dispatches by the client that failed due to a timeout." , &ClientStatistics::Snapshot::timeouts , aOpenMetrics );
+    writeHistogram ( aStream , lClients , "uhal_client_packet_round_trip_seconds" , "Time from handing each packet to the transport layer until its reply is received." , &ClientStatistics::Snapshot::packetRoundTripTime , aOpenMetrics );
+    writeHistogram ( aStream , lClients , "uhal_client_dispatch_seconds" , "Duration of the client's dispatches." , &ClientStatistics::Snapshot::dispatchTime , aOpenMetrics );
+
+    if ( aOpenMetrics )
+    {
+      aStream << "# EOF\n";
+    }
+  }
+
+
+  void MetricsExporter::registerClient ( const ClientInterface& aClient )
+  {
+    static std::once_flag lEnvironmentFlag;
+    std::call_once ( lEnvironmentFlag , &MetricsExporter::startFromEnvironment );
+
+    ClientRegistry& lRegistry ( getClientRegistry() );
+    std::lock_guard< std::mutex > lLock ( lRegistry.mutex );
+    lRegistry.clients.insert ( &aClient );
+  }
+
+
+  void MetricsExporter::deregisterClient ( const ClientInterface& aClient )
+  {
+    ClientRegistry& lRegistry ( getClientRegistry() );
+    std::lock_guard< std::mutex > lLock ( lRegistry.mutex );
+    lRegistry.clients.erase ( &aClient );
+  }
+
+
+  void MetricsExporter::accept()
+  {
+    std::shared_ptr< HttpSession > lSession ( new HttpSession ( mIOservice ) );
+    mAcceptor->async_accept ( lSession->socket , [this, lSession] ( const boost::system::error_code& aError )
+    {
+      if ( aError == boost::asio::error::operation_aborted )
+      {
+        return;
+      }
+
+      if ( not aError )
+      {
+        lSession->start();
+      }
+
+      accept();
+    } );
+  }
+
+
+  void MetricsExporter::writeFilePeriodically()
+  {
+    std::unique_lock< std::mutex > lLock ( mMutex );
+
+    while ( not mStop )
+    {
+      lLock.unlock();
+      writeFile();
+      lLock.lock();
+      mConditionVariable.wait_for ( lLock , mPeriod , [this] () { return mStop; } );
+    }
+  }
+
+
+  void MetricsExporter::writeFile() const
+  {
+    // Write to a temporary file then rename, so that readers never see a partially-written file
+    const boost::filesystem::path lTempPath ( mPath.string() + "." + std::to_string ( getpid() ) + ".tmp" );
+
+    try
+    {
+      std::ofstream lFile ( lTempPath.c_str() , std::ios::trunc );
+      write ( lFile , false );
+      lFile.close();
+
+      if ( not lFile )
+      {
+        log ( Warning() , "Failed to write uHAL metrics to file " , Quote ( lTempPath.string() ) );
+        boost::filesystem::remove ( lTempPath );
+        return;
+      }
+
+      boost::filesystem::rename ( lTempPath , mPath );
+    }
+    catch ( const boost::filesystem::filesystem_error& aExc )
+    {
+      log ( Warning() , "Failed to write uHAL metrics to file " , Quote ( mPath.string() ) , "; caught filesystem_error exception with what returning: " , aExc.what() );
+    }
+  }
+
+
+  void MetricsExporter::startFromEnvironment()
+  {
+    static std::unique_ptr< MetricsExporter > lHttpExporter;
+    static std::unique_ptr< MetricsExporter > lFileExporter;
+
+    if ( const char* lPortString = std::getenv ( mPortEnvVariable ) )
+    {
+      const std::string lValue ( lPortString );
+      // Either a bare port, or an address and port (with IPv6 addresses in brackets)
+      std::pair<std::string, std::string> lAddressPort ( "127.0.0.1" , lValue );
+
+      try
+      {
+        if ( lValue.find ( ':' ) != std::string::npos )
+        {
+          grammars::parseHostPort ( lValue , lAddressPort );
+        }
+
+        const uint16_t lPort ( boost::lexical_cast< uint16_t > ( lAddressPort.second ) );
+        lHttpExporter.reset ( new MetricsExporter ( lPort , lAddressPort.first ) );
+      }
+      catch ( const grammars::ParsingError& )
+      {
+        log ( Error() , "Invalid value " , Quote ( lValue ) , " for environment variable " , mPortEnvVariable , "; metrics will not be served" );
+      }
+      catch ( const boost::bad_lexical_cast& )
+      {
+        log ( Error() , "Invalid value " , Quote ( lValue ) , " for environment variable " , mPortEnvVariable , "; metrics will not be served" );
+      }
+      catch ( const exception::MetricsExporterError& )
+      {
+        // Already logged; the exporter is optional, so don't prevent the client from being created
+      }
+    }
+
+    if ( const char* lPath = std::getenv ( mFileEnvVariable ) )
+    {
+      lFileExporter.reset ( new MetricsExporter ( boost::filesystem::path ( lPath ) ) );
+    }
+  }
+
+}
@@ -32,13 +32,23 @@
 
 #include "uhal/Node.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <iomanip>
+#include <mutex>
+#include <thread>
 #ifdef __GNUG__
 #include <cxxabi.h>
 #endif
 
 #include <boost/regex.hpp>
 
+#include "uhal/detail/AddressIndex.hpp"
+#include "uhal/detail/DeferredChildren.hpp"
+#include "uhal/detail/NodeBinding.hpp"
+#include "uhal/detail/PathIndex.hpp"
+#include "uhal/detail/utilities.hpp"
 #include "uhal/log/log.hpp"
 #include "uhal/HwInterface.hpp"
 #include "uhal/ValMem.hpp"
@@ -48,30 +58,254 @@
 namespace uhal
 {
 
+  namespace
+  {
+    const uint32_t kEmptySlot = 0xFFFFFFFF;
+
+    //! FNV-1a hash, used for the child node look-up tables
+    size_t hashId ( const char* aData , const size_t aSize )
+    {
+      uint32_t lHash = 2166136261u;
+
+      for ( size_t i = 0; i < aSize; i++ )
+      {
+        lHash ^= uint8_t ( aData[i] );
+        lHash *= 16777619u;
+      }
+
+      return lHash;
+    }
+
+
+    const std::unordered_map< std::string, std::string >& getEmptyMap()
+    {
+      static const std::unordered_map< std::string, std::string > lEmptyMap;
+      return lEmptyMap;
+    }
+
+
+    //! Matches a whole string against a glob pattern, in which '*' matches any sequence of characters (including '.') and '?' matches any single character
+    bool matchGlob ( const std::string& aPattern , const std::string& aString )
+    {
+      size_t lPatternIdx ( 0 ) , lStringIdx ( 0 );
+      size_t lStarIdx ( std::string::npos ) , lStarMatchIdx ( 0 );
+
+      while ( lStringIdx < aString.size() )
+      {
+        if ( ( lPatternIdx < aPattern.size() ) and ( ( aPattern[lPatternIdx] == '?' ) or ( aPattern[lPatternIdx] == aString[lStringIdx] ) ) )
+        {
+          lPatternIdx++;
+          lStringIdx++;
+        }
+        else if ( ( lPatternIdx < aPattern.size() ) and ( aPattern[lPatternIdx] == '*' ) )
+        {
+          // Initially match an empty sequence; extended one character at a time if the rest of the pattern doesn't match
+          lStarIdx = lPatternIdx++;
+          lStarMatchIdx = lStringIdx;
+        }
+        else if ( lStarIdx != std::string::npos )
+        {
+          lPatternIdx = lStarIdx + 1;
+          lStringIdx = ++lStarMatchIdx;
+        }
+        else
+        {
+          return false;
+        }
+      }
+
+      while ( ( lPatternIdx < aPattern.size() ) and ( aPattern[lPatternIdx] == '*' ) )
+      {
+        lPatternIdx++;
+      }
+
+      return lPatternIdx == aPattern.size();
+    }
+
+
+    //! Minimum number of paths checked by each thread, when matching in parallel
+    const size_t kMinPathsPerThread = 16384;
+
+    //! Maximum number of threads used to match paths
+    const size_t kMaxThreads = 8;
+
+    //! Returns the paths that satisfy the predicate, sorted alphabetically; if aParallel is true, long lists are split between several threads
+    template < typename Predicate >
+    std::vector<std::string> filterPaths ( const std::vector<std::string>& aPaths , const Predicate& aPredicate , const bool aParallel )
+    {
+      std::vector<uint8_t> lMatches ( aPaths.size() , 0 );
+      const auto lMatch = [&] ( const size_t aBegin , const size_t aEnd ) {
+        for ( size_t i = aBegin; i < aEnd; i++ )
+          lMatches[i] = aPredicate ( aPaths[i] );
+      };
+
+      const size_t lNrThreads ( aParallel ? std::max< size_t > ( 1 , std::min< size_t > ( std::min< size_t > ( std::thread::hardware_concurrency() , kMaxThreads ) , aPaths.size() / kMinPathsPerThread ) ) : 1 );
+
+      if ( lNrThreads == 1 )
+      {
+        lMatch ( 0 , aPaths.size() );
+      }
+      else
+      {
+        std::vector<std::thread> lThreads;
+        std::vector<std::exception_ptr> lExceptions ( lNrThreads );
+        const size_t lChunkSize ( ( aPaths.size() + lNrThreads - 1 ) / lNrThreads );
+
+        for ( size_t i = 0; i < lNrThreads; i++ )
+        {
+          lThreads.push_back ( std::thread ( [&, i] () {
+            try
+            {
+              lMatch ( i * lChunkSize , std::min ( aPaths.size() , ( i + 1 ) * lChunkSize ) );
+            }
+            catch ( ... )
+            {
+              lExceptions.at ( i ) = std::current_exception();
+            }
+          } ) );
+        }
+
+        for ( std::thread& lThread : lThreads )
+        {
+          lThread.join();
+        }
+
+        for ( const std::exception_ptr& lException : lExceptions )
+        {
+          if ( lException )
+          {
+            std::rethrow_exception ( lException );
+          }
+        }
+      }
+
+      std::vector<std::string> lResult;
+
+      for ( size_t i = 0; i < aPaths.size(); i++ )
+      {
+        if ( lMatches[i] )
+        {
+          lResult.push_back ( aPaths[i] );
+        }
+      }
+
+      std::sort ( lResult.begin() , lResult.end() );
+      return lResult;
+    }
+  }
+
+
+  struct Node::TreeIndex
+  {
+    TreeIndex ( const std::shared_ptr< const detail::PathIndex >& aPaths , std::vector< const Node* >& aNodes ) :
+      mId ( sNextId.fetch_add ( 1 , std::memory_order_relaxed ) ),
+      mPaths ( aPaths )
+    {
+      mNodes.swap ( aNodes );
+      mAddresses = std::make_shared< const detail::AddressIndex > ( mNodes );
+      mPathList = std::make_shared< PathList >();
+    }
+
+    //! Index for a copy of a tree, sharing the look-up tables of the original
+    TreeIndex ( const TreeIndex& aOriginal , const Node& aRoot ) :
+      mId ( aOriginal.mId ),
+      mPaths ( aOriginal.mPaths ),
+      mAddresses ( aOriginal.mAddresses ),
+      mPathList ( aOriginal.mPathList )
+    {
+      mNodes.reserve ( aOriginal.mNodes.size() );
+      addNodes ( aRoot );
+    }
+
+    //! Temporary index (without path look-up table) for a tree that hasn't been indexed
+    explicit TreeIndex ( const Node& aRoot ) :
+      mId ( 0 )
+    {
+      addNodes ( aRoot );
+      mAddresses = std::make_shared< const detail::AddressIndex > ( mNodes );
+      mPathList = std::make_shared< PathList >();
+    }
+
+    void addNodes ( const Node& aRoot )
+    {
+      for ( Node::const_iterator lIt = aRoot.begin(); lIt != aRoot.end(); lIt++ )
+      {
+        mNodes.push_back ( &*lIt );
+      }
+    }
+
+    //! Unique ID of the tree, shared by its copies, identifying the node tables to which handles refer (0 for temporary indices)
+    const uint64_t mId;
+
+    static std::atomic< uint64_t > sNextId;
+
+    //! Maps paths (relative to the root) to indices in mNodes
+    std::shared_ptr< const detail::PathIndex > mPaths;
+
+    //! Address ranges of the nodes, referring to nodes by their indices in mNodes
+    std::shared_ptr< const detail::AddressIndex > mAddresses;
+
+    //! Paths of all nodes other than the root, in iteration order; only built when first needed
+    struct PathList
+    {
+      std::once_flag mFlag;
+      std::vector< std::string > mPaths;
+    };
+
+    std::shared_ptr< PathList > mPathList;
+
+    //! All nodes in the tree, in iteration order (i.e. root first)
+    std::vector< const Node* > mNodes;
+  };
+
+
+  std::atomic< uint64_t > Node::TreeIndex::sNextId ( 1 );
+
+
+  const uint32_t Node::Handle::kInvalidIndex;
+
+
+  Node::Handle::Handle() :
+    mTree ( 0 ),
+    mIndex ( kInvalidIndex )
+  {
+  }
+
+
+  Node::Handle::Handle ( const uint64_t aTree , const uint32_t aIndex ) :
+    mTree ( aTree ),
+    mIndex ( aIndex )
+  {
+  }
+
+
   Node::Node ( )  :
-    mHw ( NULL ),
-    mUid ( "" ),
+    mClient ( NULL ),
+    mUid ( ),
     mPartialAddr ( 0x00000000 ),
     mAddr ( 0x00000000 ),
     mMask ( defs::NOMASK ),
     mPermission ( defs::READWRITE ),
     mMode ( defs::HIERARCHICAL ),
     mSize ( 0x00000001 ),
-    mTags ( "" ),
-    mDescription ( "" ),
-    mModule ( "" ),
-    mClassName ( "" ),
+    mTags ( ),
+    mDescription ( ),
+    mModule ( ),
+    mClassName ( ),
     mParameters ( ),
     mFirmwareInfo( ),
     mParent ( NULL ),
     mChildren ( ),
-    mChildrenMap ( )
+    mChildrenIndex ( ),
+    mTreeIndex ( ),
+    mDeferredChildren ( ),
+    mBoundNode ( )
   {
   }
 
 
   Node::Node ( const Node& aNode )  :
-    mHw ( aNode.mHw ),
+    mClient ( aNode.mClient ),
     mUid ( aNode.mUid ),
     mPartialAddr ( aNode.mPartialAddr ),
     mAddr ( aNode.mAddr ),
@@ -87,23 +321,62 @@ namespace uhal
     mFirmwareInfo ( aNode.mFirmwareInfo ),
     mParent ( NULL ),
     mChildren ( ),
-    mChildrenMap ( )
+    mChildrenIndex ( ),
+    mTreeIndex ( ),
+    mDeferredChildren ( ),
+    mBoundNode ( )
   {
-    mChildren.reserve(aNode.mChildren.size());
-    for (Node* lChild : aNode.mChildren)
-      mChildren.push_back (lChild->clone());
+    // Children that haven't been built yet are built independently by each copy (from the same address file contents)
+    if ( aNode.hasDeferredChildren() )
+    {
+      mDeferredChildren.reset ( new detail::DeferredChildren ( aNode.mDeferredChildren->source , aNode.mDeferredChildren->offset , aNode.mDeferredChildren->allMasked ) );
+    }
+    else
+    {
+      mChildrenIndex = aNode.mChildrenIndex;
+      mChildren.reserve(aNode.mChildren.size());
+      for (Node* lChild : aNode.mChildren)
+      {
+        mChildren.push_back (lChild->clone());
+        mChildren.back()->mParent = this;
+      }
+    }
 
-    for (Node* lChild : mChildren)
+    if ( aNode.mTreeIndex )
     {
-      lChild->mParent = this;
-      mChildrenMap.insert ( std::make_pair ( lChild->mUid , lChild ) );
+      mTreeIndex.reset ( new TreeIndex ( *aNode.mTreeIndex , *this ) );
     }
   }
 
 
+  Node::Node ( const Node& aNode , const UnboundCopy& )  :
+    mClient ( aNode.mClient ),
+    mUid ( aNode.mUid ),
+    mPartialAddr ( aNode.mPartialAddr ),
+    mAddr ( aNode.mAddr ),
+    mMask ( aNode.mMask ),
+    mPermission ( aNode.mPermission ),
+    mMode ( aNode.mMode ),
+    mSize ( aNode.mSize ),
+    mTags ( aNode.mTags ),
+    mDescription ( aNode.mDescription ),
+    mModule ( aNode.mModule ),
+    mClassName ( aNode.mClassName ),
+    mParameters ( aNode.mParameters ),
+    mFirmwareInfo ( aNode.mFirmwareInfo ),
+    mParent ( NULL ),
+    mChildren ( ),
+    mChildrenIndex ( ),
+    mTreeIndex ( ),
+    mDeferredChildren ( ),
+    mBoundNode ( )
+  {
+  }
+
+
   Node& Node::operator= ( const Node& aNode )
   {
-    mHw = aNode.mHw;
+    mClient = aNode.mClient;
     mUid = aNode.mUid ;
     mPartialAddr = aNode.mPartialAddr;
     mAddr = aNode.mAddr;
@@ -116,29 +389,42 @@ namespace uhal
     mModule = aNode.mModule;
     mClassName = aNode.mClassName;
     mParameters = aNode.mParameters;
+    mFirmwareInfo = aNode.mFirmwareInfo;
 
-    for (Node* lChild: mChildren)
+    // Children of bound nodes are owned by the binding
+    if ( mBoundNode )
     {
-      if (lChild)
+      mBoundNode.reset();
+    }
+    else
+    {
+      for (Node* lChild: mChildren)
       {
         delete lChild;
-        lChild = NULL;
       }
     }
 
     mChildren.clear();
-    mChildrenMap.clear();
-
-    mChildren.reserve(aNode.mChildren.size());
-    for (Node* lNode: aNode.mChildren)
-      mChildren.push_back ( lNode->clone() );
+    mChildrenIndex.clear();
+    mDeferredChildren.reset();
 
-    for (Node* lNode: mChildren)
+    if ( aNode.hasDeferredChildren() )
     {
-      lNode->mParent = this;
-      mChildrenMap.insert ( std::make_pair ( lNode->mUid , lNode ) );
+      mDeferredChildren.reset ( new detail::DeferredChildren ( aNode.mDeferredChildren->source , aNode.mDeferredChildren->offset , aNode.mDeferredChildren->allMasked ) );
+    }
+    else
+    {
+      mChildrenIndex = aNode.mChildrenIndex;
+      mChildren.reserve(aNode.mChildren.size());
+      for (Node* lNode: aNode.mChildren)
+      {
+        mChildren.push_back ( lNode->clone() );
+        mChildren.back()->mParent = this;
+      }
     }
 
+    mTreeIndex.reset ( aNode.mTreeIndex ? new TreeIndex ( *aNode.mTreeIndex , *this ) : NULL );
+
     return *this;
   }
 
@@ -149,8 +435,40 @@ namespace uhal
   }
 
 
+  Node* Node::cloneUnbound ( ) const
+  {
+    return new Node ( *this , UnboundCopy() );
+  }
+
+
+  void Node::discardChildren()
+  {
+    for ( Node* lChild : mChildren )
+    {
+      delete lChild;
+    }
+
+    mChildren.clear();
+    mChildrenIndex.clear();
+    mDeferredChildren.reset();
+    mTreeIndex.reset();
+  }
+
+
+  const Node* Node::getPrototype() const
+  {
+    return mBoundNode ? &mBoundNode->prototype : NULL;
+  }
+
+
   Node::~Node()
   {
+    // Bound nodes don't own their children; they are deleted by the binding
+    if ( mBoundNode )
+    {
+      return;
+    }
+
     for (Node* lNode: mChildren)
     {
       if (lNode)
@@ -161,7 +479,7 @@ namespace uhal
     }
 
     mChildren.clear();
-    mChildrenMap.clear();
+    mChildrenIndex.clear();
   }
 
 
@@ -253,6 +571,154 @@ namespace uhal
   }
 
 
+  void Node::indexChildren()
+  {
+    mChildrenIndex.clear();
+
+    if ( mChildren.empty() )
+    {
+      return;
+    }
+
+    // Table is at most half full, so that probe sequences remain short
+    size_t lSize = 4;
+
+    while ( lSize < 2 * mChildren.size() )
+    {
+      lSize *= 2;
+    }
+
+    mChildrenIndex.resize ( lSize , kEmptySlot );
+
+    // Children are inserted in order, so that the first of any children with the same ID is found by look-ups
+    for ( size_t i = 0; i < mChildren.size(); i++ )
+    {
+      const std::string& lId ( mChildren[i]->mUid );
+      size_t lSlot = hashId ( lId.data() , lId.size() ) & ( lSize - 1 );
+
+      while ( mChildrenIndex[lSlot] != kEmptySlot )
+      {
+        lSlot = ( lSlot + 1 ) & ( lSize - 1 );
+      }
+
+      mChildrenIndex[lSlot] = i;
+    }
+  }
+
+
+  const std::vector< Node* >& Node::getChildren() const
+  {
+    if ( mBoundNode )
+    {
+      detail::BoundNode& lBound ( *mBoundNode );
+      std::call_once ( lBound.childrenFlag , [this, &lBound] () {
+        const std::vector< Node* >& lChildren ( lBound.prototype.getChildren() );
+        std::vector< Node* >& lBoundChildren ( const_cast< Node& > ( *this ).mChildren );
+        lBoundChildren.reserve ( lChildren.size() );
+
+        for ( const Node* lChild : lChildren )
+        {
+          lBoundChildren.push_back ( &lBound.binding.bind ( *lChild ) );
+        }
+      } );
+      return mChildren;
+    }
+
+    if ( hasDeferredChildren() )
+    {
+      // Children are built before taking this node's lock (during which the builder's lock is taken), so that the two locks are
+      // never nested; if several threads access the children for the first time concurrently, only the first set built is kept
+      std::vector< Node* > lChildren;
+      NodeTreeBuilder::getInstance().buildDeferredChildren ( *this , lChildren );
+
+      detail::DeferredChildren& lDeferred ( *mDeferredChildren );
+      std::lock_guard<std::mutex> lLock ( lDeferred.mutex );
+
+      if ( lDeferred.built.load ( std::memory_order_relaxed ) )
+      {
+        for ( Node* lChild : lChildren )
+        {
+          delete lChild;
+        }
+      }
+      else
+      {
+        Node& lNode ( const_cast< Node& > ( *this ) );
+        lNode.mChildren.swap ( lChildren );
+        lNode.indexChildren();
+        lNode.sortChildrenByAddress();
+        lDeferred.built.store ( true , std::memory_order_release );
+      }
+    }
+
+    return mChildren;
+  }
+
+
+  bool Node::hasDeferredChildren() const
+  {
+    return mDeferredChildren and not mDeferredChildren->built.load ( std::memory_order_acquire );
+  }
+
+
+  const Node* Node::findChild ( const std::string& aId , const size_t aPos , const size_t aLength ) const
+  {
+    getChildren();
+
+    if ( mChildrenIndex.empty() )
+    {
+      return NULL;
+    }
+
+    const size_t lMask = mChildrenIndex.size() - 1;
+
+    for ( size_t lSlot = hashId ( aId.data() + aPos , aLength ) & lMask; mChildrenIndex[lSlot] != kEmptySlot; lSlot = ( lSlot + 1 ) & lMask )
+    {
+      const Node* lChild = mChildren[mChildrenIndex[lSlot]];
+
+      if ( aId.compare ( aPos , aLength , lChild->mUid.str() ) == 0 )
+      {
+        return lChild;
+      }
+    }
+
+    return NULL;
+  }
+
+
+  void Node::sortChildrenByAddress()
+  {
+    // Sort a permutation rather than the children themselves, so that the existing index can be remapped
+    std::vector< uint32_t > lOrder ( mChildren.size() );
+
+    for ( size_t i = 0; i < lOrder.size(); i++ )
+    {
+      lOrder.at ( i ) = i;
+    }
+
+    std::sort ( lOrder.begin() , lOrder.end() , [this] ( const uint32_t aLHS , const uint32_t aRHS ) {
+      return detail::compareNodeAddr ( mChildren[aLHS] , mChildren[aRHS] );
+    } );
+
+    const std::vector< Node* > lChildren ( mChildren );
+    std::vector< uint32_t > lNewIndices ( mChildren.size() );
+
+    for ( size_t i = 0; i < lOrder.size(); i++ )
+    {
+      mChildren.at ( i ) = lChildren.at ( lOrder.at ( i ) );
+      lNewIndices.at ( lOrder.at ( i ) ) = i;
+    }
+
+    for ( std::vector< uint32_t >::iterator lIt = mChildrenIndex.begin(); lIt != mChildrenIndex.end(); lIt++ )
+    {
+      if ( *lIt != kEmptySlot )
+      {
+        *lIt = lNewIndices.at ( *lIt );
+      }
+    }
+  }
+
+
   const uint32_t& Node::getAddress() const
   {
     return mAddr;
@@ -303,18 +769,23 @@ namespace uhal
 
   const std::unordered_map< std::string, std::string >& Node::getParameters() const
   {
-    return mParameters;
+    return mParameters ? *mParameters : getEmptyMap();
   }
 
 
   const std::unordered_map< std::string, std::string >& Node::getFirmwareInfo() const
   {
-    return mFirmwareInfo;
+    return mFirmwareInfo ? *mFirmwareInfo : getEmptyMap();
   }
 
 
   void Node::stream ( std::ostream& aStr , std::size_t aIndent ) const
   {
+    if ( mBoundNode )
+    {
+      return mBoundNode->prototype.stream ( aStr , aIndent );
+    }
+
     std::ios_base::fmtflags original_flags = std::cout.flags();
 
     aStr << std::setfill ( '0' ) << std::uppercase;
@@ -386,12 +857,12 @@ namespace uhal
       aStr << ", Class Name \"" << mClassName << "\"";
     }
 
-    if ( mParameters.size() )
+    if ( getParameters().size() )
     {
       aStr << ", Parameters: ";
       std::unordered_map<std::string, std::string>::const_iterator lIt;
 
-      for ( lIt = mParameters.begin(); lIt != mParameters.end(); ++lIt )
+      for ( lIt = mParameters->begin(); lIt != mParameters->end(); ++lIt )
       {
         aStr << lIt->first << "=" << lIt->second << ";";
       }
@@ -401,7 +872,9 @@ namespace uhal
     aStr.flags(original_flags);
 
     // Recursively print children 
-    for ( std::vector< Node* >::const_iterator lIt = mChildren.begin(); lIt != mChildren.end(); ++lIt )
+    const std::vector< Node* >& lChildren ( getChildren() );
+
+    for ( std::vector< Node* >::const_iterator lIt = lChildren.begin(); lIt != lChildren.end(); ++lIt )
     {
       ( **lIt ).stream ( aStr , aIndent+2 );
     }
@@ -415,6 +888,20 @@ namespace uhal
       return *this;
     }
 
+    // Look-ups in bound trees use the shared tree's indices
+    if ( mBoundNode )
+    {
+      return mBoundNode->binding.bind ( mBoundNode->prototype.getNode ( aId ) );
+    }
+
+    if ( mTreeIndex )
+    {
+      if ( const Node* lNode = findIndexed ( aId ) )
+      {
+        return *lNode;
+      }
+    }
+
     size_t lStartIdx = 0;
     size_t lDotIdx = 0;
 
@@ -422,10 +909,10 @@ namespace uhal
 
     do {
       lDotIdx = aId.find('.', lStartIdx);
-      std::unordered_map< std::string , Node* >::const_iterator lIt = lDescendant->mChildrenMap.find ( aId.substr(lStartIdx, lDotIdx - lStartIdx) );
+      const Node* lChild = lDescendant->findChild ( aId , lStartIdx , ( lDotIdx == std::string::npos ? aId.size() : lDotIdx ) - lStartIdx );
 
-      if (lIt != lDescendant->mChildrenMap.end()) {
-        lDescendant = lIt->second;
+      if (lChild != NULL) {
+        lDescendant = lChild;
       }
       else if (lDescendant == this) {
         exception::NoBranchFoundWithGivenUID lExc;
@@ -445,41 +932,151 @@ namespace uhal
   }
 
 
-  std::vector<std::string> Node::getNodes() const
+  Node::Handle Node::getHandle ( const std::string& aId ) const
   {
-    std::vector<std::string> lNodes;
+    if ( mBoundNode )
+    {
+      return mBoundNode->prototype.getHandle ( aId );
+    }
 
-    // The 'begin' method returns an iterator to this instance, so skip to the next node straight away
-    for (Node::const_iterator lIt = ++begin(); lIt != end(); lIt++)
+    const Node& lNode ( getNode ( aId ) );
+    const Node* lRoot ( getIndexedRoot() );
+
+    if ( lRoot == NULL )
     {
-      lNodes.push_back(lIt->getRelativePath(*this));
+      exception::InvalidNodeHandle lExc;
+      log ( lExc , "Cannot create handle for node " , Quote ( lNode.getPath() ) , " since its node tree has not been indexed (i.e. it was not loaded from an address file, or was loaded lazily)" );
+      throw lExc;
     }
 
-    return lNodes;
+    const TreeIndex& lIndex ( *lRoot->mTreeIndex );
+    uint32_t lIdx ( lIndex.mPaths->find ( lRoot == this ? aId : lNode.getRelativePath ( *lRoot ) ) );
+
+    // Nodes that aren't in the path look-up table (e.g. nodes hidden by siblings with the same ID) are found by searching the node table
+    if ( ( lIdx >= lIndex.mNodes.size() ) or ( lIndex.mNodes[lIdx] != &lNode ) )
+    {
+      lIdx = std::find ( lIndex.mNodes.begin() , lIndex.mNodes.end() , &lNode ) - lIndex.mNodes.begin();
+    }
+
+    return Handle ( lIndex.mId , lIdx );
   }
 
 
-  std::vector<std::string> Node::getNodes ( const std::string& aRegex ) const
+  const Node& Node::getNode ( const Handle& aHandle ) const
+  {
+    if ( mBoundNode )
+    {
+      return mBoundNode->binding.bind ( mBoundNode->prototype.getNode ( aHandle ) );
+    }
+
+    const Node* lRoot ( getIndexedRoot() );
+
+    if ( ( lRoot != NULL ) and ( aHandle.mTree == lRoot->mTreeIndex->mId ) and ( aHandle.mIndex < lRoot->mTreeIndex->mNodes.size() ) )
+    {
+      const Node* lNode ( lRoot->mTreeIndex->mNodes[aHandle.mIndex] );
+
+      if ( lRoot == this )
+      {
+        return *lNode;
+      }
+
+      for ( const Node* lAncestor = lNode; lAncestor != NULL; lAncestor = lAncestor->mParent )
+      {
+        if ( lAncestor == this )
+        {
+          return *lNode;
+        }
+      }
+    }
+
+    exception::InvalidNodeHandle lExc;
+    log ( lExc , "Node handle does not refer to node " , Quote ( getPath() ) , " or any of its descendants" );
+    throw lExc;
+  }
+
+
+  std::vector<std::string> Node::getNodes() const
   {
     std::vector<std::string> lNodes;
+    return std::vector<std::string> ( getPathList ( lNodes ) );
+  }
+
+
+  std::vector<std::string> Node::getNodes ( const std::string& aRegex ) const
+  {
     log ( Info() , "Regular Expression : " , aRegex );
 
-    // The 'begin' method returns an iterator to this instance, so skip to the next node straight away
-    for (Node::const_iterator lIt = ++begin(); lIt != end(); lIt++)
+    // Regex is compiled once; boost::regex objects can be used concurrently from several threads
+    const boost::regex lRegex ( aRegex );
+    std::vector<std::string> lPaths;
+    return filterPaths ( getPathList ( lPaths ) , [&lRegex] ( const std::string& aPath ) { return boost::regex_match ( aPath , lRegex ); } , true );
+  }
+
+
+  std::vector<std::string> Node::getNodesMatchingGlob ( const std::string& aPattern ) const
+  {
+    std::vector<std::string> lPaths;
+    return filterPaths ( getPathList ( lPaths ) , [&aPattern] ( const std::string& aPath ) { return matchGlob ( aPattern , aPath ); } , false );
+  }
+
+
+  std::vector<std::string> Node::getNodesWithPrefix ( const std::string& aPrefix ) const
+  {
+    std::vector<std::string> lPaths;
+    return filterPaths ( getPathList ( lPaths ) , [&aPrefix] ( const std::string& aPath ) { return aPath.compare ( 0 , aPrefix.size() , aPrefix ) == 0; } , false );
+  }
+
+
+  const std::vector<std::string>& Node::getPathList ( std::vector<std::string>& aTemporary ) const
+  {
+    if ( mBoundNode )
+    {
+      return mBoundNode->prototype.getPathList ( aTemporary );
+    }
+
+    if ( not mTreeIndex )
+    {
+      buildPathList ( aTemporary );
+      return aTemporary;
+    }
+
+    TreeIndex::PathList& lPathList ( *mTreeIndex->mPathList );
+    std::call_once ( lPathList.mFlag , [this, &lPathList] () { buildPathList ( lPathList.mPaths ); } );
+    return lPathList.mPaths;
+  }
+
+
+  void Node::buildPathList ( std::vector<std::string>& aPaths ) const
+  {
+    aPaths.clear();
+
+    // Paths are built up incrementally during the walk (same order as the iterator), rather than by walking back up the tree from each node
+    std::vector<std::pair<const Node*, size_t> > lStack;
+    std::string lPath;
+
+    const std::vector<Node*>& lChildren(getChildren());
+    for (std::vector<Node*>::const_reverse_iterator lIt = lChildren.rbegin(); lIt != lChildren.rend(); lIt++)
+      lStack.push_back(std::make_pair(*lIt, size_t(0)));
+
+    while (not lStack.empty())
     {
-      const std::string lRelativePath(lIt->getRelativePath(*this));
-      boost::cmatch lMatch;
+      const Node& lNode = *lStack.back().first;
+      lPath.resize(lStack.back().second);
+      lStack.pop_back();
 
-      if ( boost::regex_match ( lRelativePath.c_str() , lMatch , boost::regex ( aRegex ) ) ) //to allow partial match, add  boost::match_default|boost::match_partial  as fourth argument
+      // Consistent with getPath, nodes with empty IDs don't contribute to the path
+      if (lNode.mUid.size())
       {
-        log ( Info() , lRelativePath , " matches" );
-        lNodes.push_back ( lRelativePath );
+        if (lPath.size())
+          lPath += '.';
+        lPath += lNode.mUid.str();
       }
-    }
+      aPaths.push_back(lPath);
 
-    //bit dirty but since the hash map sorts them by the hash, not the value, they are completely scrambled here making it very hard to use.
-    std::sort ( lNodes.begin(), lNodes.end() );
-    return lNodes;
+      const std::vector<Node*>& lNodeChildren(lNode.getChildren());
+      for (std::vector<Node*>::const_reverse_iterator lIt = lNodeChildren.rbegin(); lIt != lNodeChildren.rend(); lIt++)
+        lStack.push_back(std::make_pair(*lIt, lPath.size()));
+    }
   }
 
 
@@ -489,11 +1086,11 @@ namespace uhal
     {
       if ( mMask == defs::NOMASK )
       {
-        return mHw->getClient().write ( mAddr , aValue );
+        return mClient->write ( mAddr , aValue );
       }
       else if ( mPermission & defs::READ )
       {
-        return mHw->getClient().write ( mAddr , aValue , mMask );
+        return mClient->write ( mAddr , aValue , mMask );
       }
       else // Masked write-only register
       {
@@ -528,7 +1125,7 @@ namespace uhal
 
     if ( mPermission & defs::WRITE )
     {
-      return mHw->getClient().writeBlock ( mAddr , aValues , mMode ); //aMode );
+      return mClient->writeBlock ( mAddr , aValues , mMode ); //aMode );
     }
     else
     {
@@ -566,7 +1163,7 @@ namespace uhal
 
     if ( mPermission & defs::WRITE )
     {
-      return mHw->getClient().writeBlock ( mAddr+aOffset , aValues , mMode ); //aMode );
+      return mClient->writeBlock ( mAddr+aOffset , aValues , mMode ); //aMode );
     }
     else
     {
@@ -584,11 +1181,11 @@ namespace uhal
     {
       if ( mMask == defs::NOMASK )
       {
-        return mHw->getClient().read ( mAddr );
+        return mClient->read ( mAddr );
       }
       else
       {
-        return mHw->getClient().read ( mAddr , mMask );
+        return mClient->read ( mAddr , mMask );
       }
     }
 
@@ -618,7 +1215,7 @@ namespace uhal
 
     if ( mPermission & defs::READ )
     {
-      return mHw->getClient().readBlock ( mAddr , aSize , mMode ); //aMode );
+      return mClient->readBlock ( mAddr , aSize , mMode ); //aMode );
     }
     else
     {
@@ -656,7 +1253,7 @@ namespace uhal
 
     if ( mPermission & defs::READ )
     {
-      return mHw->getClient().readBlock ( mAddr+aOffset , aSize , mMode ); //aMode );
+      return mClient->readBlock ( mAddr+aOffset , aSize , mMode ); //aMode );
     }
     else
     {
@@ -670,7 +1267,7 @@ namespace uhal
 
   ClientInterface& Node::getClient() const
   {
-    return mHw->getClient();
+    return *mClient;
   }
 
 
@@ -691,6 +1288,231 @@ namespace uhal
     return std::vector<const Node*>(lAncestors.rbegin(), lAncestors.rend());
   }
 
+  void Node::indexTree()
+  {
+    std::vector< const Node* > lNodes ( 1 , this );
+    std::vector< std::pair< std::string , uint32_t > > lKeys;
+
+    // Same walk (and hence order) as the iterator, with paths built up incrementally as in getNodes
+    struct Entry
+    {
+      Node* mNode;
+      size_t mPathSize;
+      bool mHidden;
+    };
+
+    std::vector< Entry > lStack;
+    std::string lPath;
+
+    for (std::vector<Node*>::const_reverse_iterator lIt = mChildren.rbegin(); lIt != mChildren.rend(); lIt++)
+    {
+      const Entry lEntry = { *lIt , 0 , false };
+      lStack.push_back ( lEntry );
+    }
+
+    while ( not lStack.empty() )
+    {
+      const Entry lEntry ( lStack.back() );
+      Node& lNode ( *lEntry.mNode );
+      lStack.pop_back();
+
+      // Sub-trees loaded from module files have their own index, which is no longer needed
+      lNode.mTreeIndex.reset();
+
+      lPath.resize ( lEntry.mPathSize );
+
+      if ( lPath.size() )
+      {
+        lPath += '.';
+      }
+
+      lPath += lNode.mUid.str();
+
+      // Only nodes that getNode finds by walking the path one level at a time are added to the path table (i.e. not those
+      // with empty IDs, or hidden by an earlier sibling with the same ID), so that both methods always return the same node
+      const bool lHidden ( lEntry.mHidden or lNode.mUid.empty() or ( lNode.mParent->findChild ( lNode.mUid , 0 , lNode.mUid.size() ) != &lNode ) );
+
+      if ( not lHidden )
+      {
+        lKeys.push_back ( std::make_pair ( lPath , uint32_t ( lNodes.size() ) ) );
+      }
+
+      lNodes.push_back ( &lNode );
+
+      for (std::vector<Node*>::const_reverse_iterator lIt = lNode.mChildren.rbegin(); lIt != lNode.mChildren.rend(); lIt++)
+      {
+        const Entry lChildEntry = { *lIt , lPath.size() , lHidden };
+        lStack.push_back ( lChildEntry );
+      }
+    }
+
+    mTreeIndex.reset ( new TreeIndex ( std::make_shared< const detail::PathIndex > ( lKeys ) , lNodes ) );
+  }
+
+
+  const Node* Node::getIndexedRoot() const
+  {
+    for ( const Node* lNode = this; lNode != NULL; lNode = lNode->mParent )
+    {
+      if ( lNode->mTreeIndex )
+      {
+        return lNode;
+      }
+    }
+
+    return NULL;
+  }
+
+
+  const Node* Node::findIndexed ( const std::string& aId ) const
+  {
+    const uint32_t lIdx ( mTreeIndex->mPaths->find ( aId ) );
+
+    if ( lIdx >= mTreeIndex->mNodes.size() )
+    {
+      return NULL;
+    }
+
+    // Table returns an arbitrary node for unknown paths, so check the candidate's path (without allocating), comparing IDs from the end of the path
+    const Node* lNode ( mTreeIndex->mNodes[lIdx] );
+    size_t lEnd ( aId.size() );
+
+    for ( const Node* lAncestor = lNode; lAncestor != this; lAncestor = lAncestor->mParent )
+    {
+      const std::string& lUid ( lAncestor->mUid );
+
+      if ( ( lUid.size() > lEnd ) or ( aId.compare ( lEnd - lUid.size() , lUid.size() , lUid ) != 0 ) )
+      {
+        return NULL;
+      }
+
+      lEnd -= lUid.size();
+
+      if ( lAncestor->mParent != this )
+      {
+        if ( ( lEnd == 0 ) or ( aId[lEnd - 1] != '.' ) )
+        {
+          return NULL;
+        }
+
+        lEnd--;
+      }
+    }
+
+    return ( lEnd == 0 ) ? lNode : NULL;
+  }
+
+
+  const Node::TreeIndex& Node::getTreeIndex ( std::unique_ptr< TreeIndex >& aTemporary ) const
+  {
+    if ( mTreeIndex )
+    {
+      return *mTreeIndex;
+    }
+
+    aTemporary.reset ( new TreeIndex ( *this ) );
+    return *aTemporary;
+  }
+
+
+  std::vector<const Node*> Node::getNodesAtAddress ( const uint32_t& aAddress , const uint32_t& aSize ) const
+  {
+    std::vector<const Node*> lNodes;
+
+    if ( aSize == 0 )
+    {
+      return lNodes;
+    }
+
+    if ( mBoundNode )
+    {
+      lNodes = mBoundNode->prototype.getNodesAtAddress ( aAddress , aSize );
+
+      for ( const Node*& lNode : lNodes )
+      {
+        lNode = &mBoundNode->binding.bind ( *lNode );
+      }
+
+      return lNodes;
+    }
+
+    const uint32_t lLast ( ( aSize - 1 > 0xFFFFFFFF - aAddress ) ? 0xFFFFFFFF : aAddress + aSize - 1 );
+
+    // Use the index of the whole tree if there is one, rather than building a temporary one for this sub-tree
+    const Node* lRoot ( getIndexedRoot() );
+    std::unique_ptr< TreeIndex > lTemporary;
+    const TreeIndex& lIndex ( lRoot ? *lRoot->mTreeIndex : getTreeIndex ( lTemporary ) );
+
+    std::vector<uint32_t> lIndices;
+    lIndex.mAddresses->find ( aAddress , lLast , lIndices );
+
+    for ( const uint32_t lIdx : lIndices )
+    {
+      const Node* lNode ( lIndex.mNodes[lIdx] );
+      const Node* lAncestor ( lNode );
+
+      while ( ( lAncestor != this ) and ( lAncestor != lRoot ) )
+      {
+        lAncestor = lAncestor->mParent;
+      }
+
+      if ( lAncestor == this )
+      {
+        lNodes.push_back ( lNode );
+      }
+    }
+
+    return lNodes;
+  }
+
+
+  std::vector<std::pair<const Node*, const Node*> > Node::getAddressOverlaps() const
+  {
+    std::unique_ptr< TreeIndex > lTemporary;
+    const TreeIndex& lIndex ( getTreeIndex ( lTemporary ) );
+    const std::vector<detail::AddressIndex::Entry>& lEntries ( lIndex.mAddresses->entries() );
+
+    // Entries are sorted by address, so only the entries following each one need to be checked, up to its last address
+    std::vector<std::pair<const Node*, const Node*> > lOverlappingNodes;
+
+    for (std::vector<detail::AddressIndex::Entry>::const_iterator lIt1 = lEntries.begin() ; lIt1 != lEntries.end(); lIt1++)
+    {
+      // This node itself is not checked
+      if (lIt1->node == 0)
+        continue;
+
+      const Node& lNode1 = *lIndex.mNodes[lIt1->node];
+
+      for (std::vector<detail::AddressIndex::Entry>::const_iterator lIt2(lIt1 + 1) ; (lIt2 != lEntries.end()) and (lIt2->first <= lIt1->last); lIt2++)
+      {
+        if (lIt2->node == 0)
+          continue;
+
+        const Node& lNode2 = *lIndex.mNodes[lIt2->node];
+
+        if (lNode1.getMode() != defs::SINGLE or lNode2.getMode() != defs::SINGLE)
+          lOverlappingNodes.push_back( std::make_pair(&lNode1, &lNode2) );
+
+        else if (lNode1.getMask() & lNode2.getMask())
+        {
+          if (lNode1.getMask() == defs::NOMASK and lNode2.isChildOf(lNode1))
+          {
+            // Node 2 is masked child of node 1: No overlap
+          }
+          else if (lNode2.getMask() == defs::NOMASK and lNode1.isChildOf(lNode2))
+          {
+            // Node 1 is masked child of node 2: No overlap
+          }
+          else
+            lOverlappingNodes.push_back( std::make_pair(&lNode1, &lNode2) );
+        }
+      }
+    }
+
+    return lOverlappingNodes;
+  }
+
+
   bool Node::isChildOf(const Node& aParent) const
   {
     return (&aParent == mParent);
@@ -731,7 +1553,7 @@ namespace uhal
 
   const Node& Node::const_iterator::value() const
   {
-    return ( mItStack.empty() ) ? ( *mBegin ) : ( **mItStack.front() );
+    return ( mItStack.empty() ) ? ( *mBegin ) : ( **mItStack.back() );
   }
 
 
@@ -761,10 +1583,10 @@ namespace uhal
     if ( mItStack.empty() )
     {
       //We have just started and have no stack...
-      if ( mBegin->mChildren.size() )
+      if ( mBegin->getChildren().size() )
       {
         //We have children so recurse down to them
-        mItStack.push_front ( mBegin->mChildren.begin() );
+        mItStack.push_back ( mBegin->mChildren.begin() );
         return true;
       }
 
@@ -774,24 +1596,24 @@ namespace uhal
     }
 
     //We are already in the tree...
-    if ( not ( **mItStack.front() ).mChildren.empty() )
+    if ( not ( **mItStack.back() ).getChildren().empty() )
     {
       // Entry has children, recurse...
-      mItStack.push_front ( ( **mItStack.front() ).mChildren.begin() );
+      mItStack.push_back ( ( **mItStack.back() ).mChildren.begin() );
       return true;
     }
 
     // No children so go to the next entry on this level
     while ( not mItStack.empty() )
     {
-      if ( ++ ( mItStack.front() ) != ( ( mItStack.size() == 1 ) ? ( *mBegin ) : ( **mItStack.at(1) ) ).mChildren.end() )
+      if ( ++ ( mItStack.back() ) != ( ( mItStack.size() == 1 ) ? ( *mBegin ) : ( **mItStack[mItStack.size() - 2] ) ).mChildren.end() )
       {
         // Next entry on this level is valid - return
         return true;
       }
 
       // No more valid entries in this level, go back up tree
-      mItStack.pop_front();
+      mItStack.pop_back();
     }
 
     //We have no more children so we are at the end of the iteration. Make Buffer NULL to stop infinite loop
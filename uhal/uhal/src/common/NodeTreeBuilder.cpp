@@ -33,16 +33,26 @@
 #include "uhal/NodeTreeBuilder.hpp"
 
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <fstream>
 #include <functional>
+#include <iterator>
+#include <thread>
+
+#include <sys/stat.h>
 
 #include <boost/spirit/include/qi.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/filesystem.hpp>
 
+#include "uhal/detail/AddressFileLoader.hpp"
+#include "uhal/detail/DeferredChildren.hpp"
 #include "uhal/detail/utilities.hpp"
 #include "uhal/DerivedNodeFactory.hpp"
+#include "uhal/grammars/Parsers.hpp"
 #include "uhal/log/log.hpp"
 #include "uhal/utilities/files.hpp"
 #include "uhal/utilities/xml.hpp"
@@ -55,6 +65,39 @@ namespace arg = std::placeholders;
 namespace uhal
 {
 
+  namespace
+  {
+    //! Returns the element at the specified offset in a parsed file (see pugi::xml_node::offset_debug), or a null node if there is none
+    pugi::xml_node findElementAtOffset ( const pugi::xml_node& aParent , const ptrdiff_t aOffset )
+    {
+      // Elements are in file order, so the element is either a child, or a descendant of the last child that starts before it
+      pugi::xml_node lCandidate;
+
+      for ( pugi::xml_node lChild = aParent.first_child(); lChild; lChild = lChild.next_sibling() )
+      {
+        if ( lChild.type() != pugi::node_element )
+        {
+          continue;
+        }
+
+        if ( lChild.offset_debug() == aOffset )
+        {
+          return lChild;
+        }
+
+        if ( lChild.offset_debug() > aOffset )
+        {
+          break;
+        }
+
+        lCandidate = lChild;
+      }
+
+      return lCandidate ? findElementAtOffset ( lCandidate , aOffset ) : pugi::xml_node();
+    }
+  }
+
+
   const std::string NodeTreeBuilder::mIdAttribute = "id";
   const std::string NodeTreeBuilder::mAddressAttribute = "address";
   const std::string NodeTreeBuilder::mParametersAttribute = "parameters";
@@ -68,11 +111,17 @@ namespace uhal
   const std::string NodeTreeBuilder::mModuleAttribute = "module";
   const std::string NodeTreeBuilder::mFirmwareInfo = "fwinfo";
 
+  const char* const NodeTreeBuilder::mCacheDirectoryEnvVariable = "UHAL_ADDRESS_TABLE_CACHE_DIR";
+  const char* const NodeTreeBuilder::mLazyLoadingEnvVariable = "UHAL_ADDRESS_TABLE_LAZY_LOADING";
+
 
   std::shared_ptr<NodeTreeBuilder> NodeTreeBuilder::mInstance;
 
 
-  NodeTreeBuilder::NodeTreeBuilder ()
+  NodeTreeBuilder::NodeTreeBuilder () :
+    mFileLoaderThreadCount ( std::min< size_t > ( std::max< size_t > ( std::thread::hardware_concurrency() , 1 ) , 8 ) ),
+    mFileLoader ( NULL ),
+    mLazyLoading ( false )
   {
     //------------------------------------------------------------------------------------------------------------------------
     Rule<Node*> lPlainNode;
@@ -128,6 +177,16 @@ namespace uhal
     mNodeParser.addRule ( lBitMask , std::bind ( &NodeTreeBuilder::bitmaskNodeCreator , this , true , arg::_1 ) );
     mNodeParser.addRule ( lModule , std::bind ( &NodeTreeBuilder::moduleNodeCreator , this , true , arg::_1 ) );
     //------------------------------------------------------------------------------------------------------------------------
+
+    if ( const char* lCacheDir = std::getenv ( mCacheDirectoryEnvVariable ) )
+    {
+      setCacheDirectory ( lCacheDir );
+    }
+
+    if ( const char* lLazyLoading = std::getenv ( mLazyLoadingEnvVariable ) )
+    {
+      setLazyLoading ( std::string ( lLazyLoading ) != "0" );
+    }
   }
 
 
@@ -148,8 +207,9 @@ namespace uhal
   }
 
 
-  Node* NodeTreeBuilder::getNodeTree ( const std::string& aFilenameExpr , const boost::filesystem::path& aPath )
+  std::shared_ptr< const Node > NodeTreeBuilder::getSharedNodeTree ( const std::string& aFilenameExpr , const boost::filesystem::path& aPath )
   {
+    std::lock_guard< std::recursive_mutex > lLock ( mMutex );
     std::vector< std::pair<std::string, std::string> >  lAddressFiles;
     uhal::utilities::ParseSemicolonDelimitedUriList ( aFilenameExpr , lAddressFiles );
 
@@ -160,8 +220,12 @@ namespace uhal
       throw lExc;
     }
 
-    std::vector< const Node* > lNodes;
-    uhal::utilities::OpenFile ( lAddressFiles[0].first , lAddressFiles[0].second , aPath.parent_path() , std::bind ( &NodeTreeBuilder::CallBack, std::ref ( *this ) , arg::_1 , arg::_2 , arg::_3 , std::ref ( lNodes ) ) );
+    std::vector< std::shared_ptr< const Node > > lNodes;
+
+    if ( not buildFromLoadedFiles ( aFilenameExpr , aPath.parent_path() , lNodes ) )
+    {
+      uhal::utilities::OpenFile ( lAddressFiles[0].first , lAddressFiles[0].second , aPath.parent_path() , std::bind ( &NodeTreeBuilder::CallBack, std::ref ( *this ) , arg::_1 , arg::_2 , arg::_3 , std::ref ( lNodes ) ) );
+    }
 
     if ( lNodes.size() != 1 )
     {
@@ -170,16 +234,166 @@ namespace uhal
       throw lExc;
     }
 
-    Node* lNode ( lNodes[0]->clone() );
-    return lNode;
+    return lNodes[0];
+  }
+
+
+  Node* NodeTreeBuilder::getNodeTree ( const std::string& aFilenameExpr , const boost::filesystem::path& aPath )
+  {
+    return getSharedNodeTree ( aFilenameExpr , aPath )->clone();
   }
 
 
   void NodeTreeBuilder::clearAddressFileCache()
   {
-    for(const auto& x: mNodes)
-      delete x.second;
+    std::lock_guard< std::recursive_mutex > lLock ( mMutex );
     mNodes.clear();
+    mFileDependencies.clear();
+    mTopLevelFiles.clear();
+    mFileStatus.clear();
+  }
+
+
+  std::vector< std::pair< std::shared_ptr< const Node > , std::shared_ptr< const Node > > > NodeTreeBuilder::reloadAddressFiles()
+  {
+    std::lock_guard< std::recursive_mutex > lLock ( mMutex );
+    std::vector< std::string > lStale;
+    // Most files are dependencies of several trees (i.e. their own, and those of the files that use them), so are only checked once
+    std::unordered_map< std::string , bool > lChecked;
+
+    for ( const auto& lEntry : mFileDependencies )
+    {
+      for ( const NodeTreeCache::FileDependency& lFile : lEntry.second )
+      {
+        if ( lFile.path.empty() )
+        {
+          continue;
+        }
+
+        std::unordered_map< std::string , bool >::iterator lIt ( lChecked.find ( lFile.path ) );
+
+        if ( lIt == lChecked.end() )
+        {
+          lIt = lChecked.insert ( std::make_pair ( lFile.path , isUnchanged ( lFile ) ) ).first;
+        }
+
+        if ( not lIt->second )
+        {
+          log ( Info() , "Address file " , Quote ( lFile.path ) , " has changed, so node tree for " , Quote ( lEntry.first ) , " will be rebuilt" );
+          lStale.push_back ( lEntry.first );
+          break;
+        }
+      }
+    }
+
+    std::vector< std::pair< std::shared_ptr< const Node > , std::shared_ptr< const Node > > > lReplacements;
+
+    if ( lStale.empty() )
+    {
+      return lReplacements;
+    }
+
+    // Stale trees are removed from the cache (so that they are rebuilt, rather than re-used, by the top-level trees that depend on
+    // them), but are kept until all top-level trees have been rebuilt, so that they can be restored if any of them cannot be
+    std::unordered_map< std::string , std::shared_ptr< const Node > > lOldNodes;
+    std::unordered_map< std::string , std::vector< NodeTreeCache::FileDependency > > lOldDependencies;
+
+    for ( const std::string& lName : lStale )
+    {
+      lOldNodes[lName] = mNodes[lName];
+      mNodes.erase ( lName );
+      lOldDependencies[lName].swap ( mFileDependencies[lName] );
+      mFileDependencies.erase ( lName );
+    }
+
+    try
+    {
+      for ( const std::string& lName : lStale )
+      {
+        std::unordered_map< std::string , std::pair< std::string , boost::filesystem::path > >::const_iterator lIt ( mTopLevelFiles.find ( lName ) );
+
+        // Module files are rebuilt along with the top-level files that use them
+        if ( lIt == mTopLevelFiles.end() )
+        {
+          continue;
+        }
+
+        std::vector< std::shared_ptr< const Node > > lNodes;
+        uhal::utilities::OpenFile ( lIt->second.first , lIt->second.second.string() , lIt->second.second.parent_path() , std::bind ( &NodeTreeBuilder::CallBack, std::ref ( *this ) , arg::_1 , arg::_2 , arg::_3 , std::ref ( lNodes ) ) );
+
+        if ( lNodes.size() != 1 )
+        {
+          exception::FailedToOpenAddressTableFile lExc;
+          log ( lExc , "Failed to reload address file " , Quote ( lName ) );
+          throw lExc;
+        }
+
+        lReplacements.push_back ( std::make_pair ( lOldNodes[lName] , lNodes.front() ) );
+      }
+    }
+    catch ( ... )
+    {
+      for ( const std::string& lName : lStale )
+      {
+        mNodes[lName] = lOldNodes[lName];
+        mFileDependencies[lName].swap ( lOldDependencies[lName] );
+      }
+
+      throw;
+    }
+
+    log ( Info() , "Reloaded " , Integer ( lReplacements.size() ) , " address tables" );
+    return lReplacements;
+  }
+
+
+  void NodeTreeBuilder::setCacheDirectory ( const boost::filesystem::path& aDirectory )
+  {
+    if ( aDirectory.empty() )
+    {
+      mCache.reset();
+      log ( Info() , "Node tree cache disabled" );
+    }
+    else
+    {
+      mCache.reset ( new NodeTreeCache ( aDirectory ) );
+      log ( Info() , "Node tree cache enabled, using directory " , Quote ( aDirectory.string() ) );
+    }
+  }
+
+
+  boost::filesystem::path NodeTreeBuilder::getCacheDirectory() const
+  {
+    return mCache ? mCache->getDirectory() : boost::filesystem::path();
+  }
+
+
+  void NodeTreeBuilder::setFileLoaderThreadCount ( const size_t aThreadCount )
+  {
+    mFileLoaderThreadCount = aThreadCount;
+  }
+
+
+  size_t NodeTreeBuilder::getFileLoaderThreadCount() const
+  {
+    return mFileLoaderThreadCount;
+  }
+
+
+  void NodeTreeBuilder::setLazyLoading ( const bool aLazy )
+  {
+    if ( aLazy != mLazyLoading )
+    {
+      mLazyLoading = aLazy;
+      clearAddressFileCache();
+      log ( Info() , "Lazy loading of node trees " , ( aLazy ? "enabled" : "disabled" ) );
+    }
+  }
+
+
+  bool NodeTreeBuilder::getLazyLoading() const
+  {
+    return mLazyLoading;
   }
 
 
@@ -189,19 +403,36 @@ namespace uhal
     Node* lNode ( mTopLevelNodeParser ( aNode ) );
     mFileCallStack.pop_back( );
     calculateHierarchicalAddresses ( lNode , 0x00000000 );
-    checkForAddressCollisions ( lNode , aAddressFilePath );  // Needs further investigation - disabled for now as it causes exceptions with valid tables.
+
+    // Lazily-loaded trees are neither indexed nor checked for address overlaps, since either would require building the whole tree
+    if ( not mLazyLoading )
+    {
+      lNode->indexTree();
+      checkForAddressCollisions ( lNode , aAddressFilePath );  // Needs further investigation - disabled for now as it causes exceptions with valid tables.
+    }
 
     return lNode;
   }
 
 
-  void NodeTreeBuilder::CallBack ( const std::string& aProtocol , const boost::filesystem::path& aPath , std::vector<uint8_t>& aFile , std::vector< const Node* >& aNodes )
+  void NodeTreeBuilder::CallBack ( const std::string& aProtocol , const boost::filesystem::path& aPath , std::vector<uint8_t>& aFile , std::vector< std::shared_ptr< const Node > >& aNodes )
   {
     std::string lName ( aProtocol + ( aPath.string() ) );
-    std::unordered_map< std::string , const Node* >::iterator lNodeIt = mNodes.find ( lName );
+    std::unordered_map< std::string , std::shared_ptr< const Node > >::iterator lNodeIt = mNodes.find ( lName );
+
+    if ( mDependencyStack.empty() )
+    {
+      mTopLevelFiles[lName] = std::make_pair ( aProtocol , aPath );
+    }
 
     if ( lNodeIt != mNodes.end() )
     {
+      if ( not mDependencyStack.empty() )
+      {
+        const std::vector< NodeTreeCache::FileDependency >& lDependencies ( mFileDependencies[lName] );
+        mDependencyStack.back().insert ( mDependencyStack.back().end() , lDependencies.begin() , lDependencies.end() );
+      }
+
       aNodes.push_back ( lNodeIt->second );
       return;
     }
@@ -211,17 +442,41 @@ namespace uhal
 
     if ( lExtension == ".xml" )
     {
+      // Remote files cannot be re-validated when loading from the node tree cache, so are recorded with an empty path
+      const NodeTreeCache::FileDependency lDependency ( NodeTreeCache::createDependency ( aProtocol == "file" ? aPath.string() : "" , aFile.data() , aFile.size() ) );
+      const bool lIsTopLevel ( mDependencyStack.empty() );
+
+      if ( mCache and lIsTopLevel and ( aProtocol == "file" ) )
+      {
+        std::vector< NodeTreeCache::FileDependency > lDependencies;
+
+        if ( Node* lCachedNode = mCache->load ( lName , aFile , lDependencies ) )
+        {
+          lCachedNode->indexTree();
+          const std::shared_ptr< const Node > lNode ( lCachedNode );
+          mNodes.insert ( std::make_pair ( lName , lNode ) );
+          mFileDependencies[lName].swap ( lDependencies );
+          aNodes.push_back ( lNode );
+          return;
+        }
+      }
+
       log ( Info() , "Reading XML address file " , Quote( aPath.c_str() ) );
-      pugi::xml_document lXmlDocument;
-      pugi::xml_parse_result lLoadResult = lXmlDocument.load_buffer_inplace ( & ( aFile[0] ) , aFile.size() );
+      // Lazily-loaded trees keep the unmodified contents of the file, so that children of its top-level node can be parsed and
+      // built later; otherwise the file is parsed in place
+      const std::shared_ptr< detail::AddressFileSource > lSource ( new detail::AddressFileSource() );
+      lSource->path = aPath;
+      lSource->contents.swap ( aFile );
+      pugi::xml_document lDocument;
+      pugi::xml_parse_result lLoadResult = mLazyLoading ? lDocument.load_buffer ( lSource->contents.data() , lSource->contents.size() ) : lDocument.load_buffer_inplace ( lSource->contents.data() , lSource->contents.size() );
 
       if ( !lLoadResult )
       {
-        uhal::utilities::PugiXMLParseResultPrettifier ( lLoadResult , aPath , aFile );
+        uhal::utilities::PugiXMLParseResultPrettifier ( lLoadResult , aPath , lSource->contents );
         return;
       }
 
-      pugi::xml_node lXmlNode = lXmlDocument.child ( "node" );
+      pugi::xml_node lXmlNode = lDocument.child ( "node" );
 
       if ( !lXmlNode )
       {
@@ -229,9 +484,31 @@ namespace uhal
         return;
       }
 
-      Node* lNode ( build ( lXmlNode , aPath ) );
-      mNodes.insert ( std::make_pair ( lName , lNode ) );
-      aNodes.push_back ( lNode );
+      if ( lIsTopLevel and ( mFileLoaderThreadCount > 0 ) and ( not mLazyLoading ) )
+      {
+        // Read and parse all of the module files in parallel, then assemble the tree from the parsed documents
+        detail::AddressFileLoader lLoader ( mFileLoaderThreadCount );
+        lLoader.load ( lXmlNode , aPath , [this] ( const std::string& aFileName ) { return mNodes.count ( aFileName ) > 0; } );
+        log ( Debug() , "Loaded " , Integer ( lLoader.size() ) , " module files referenced by " , Quote ( aPath.c_str() ) );
+        mFileLoader = &lLoader;
+
+        try
+        {
+          buildTree ( lName , aPath , lDependency , lXmlNode , aNodes );
+        }
+        catch ( ... )
+        {
+          mFileLoader = NULL;
+          throw;
+        }
+
+        mFileLoader = NULL;
+      }
+      else
+      {
+        buildTree ( lName , aPath , lDependency , lXmlNode , aNodes , lSource );
+      }
+
       return;
     }
     else if ( lExtension == ".txt" )
@@ -248,6 +525,216 @@ namespace uhal
   }
 
 
+  void NodeTreeBuilder::buildTree ( const std::string& aName , const boost::filesystem::path& aPath , const NodeTreeCache::FileDependency& aDependency , const pugi::xml_node& aXmlNode , std::vector< std::shared_ptr< const Node > >& aAddressTable , const std::shared_ptr< const detail::AddressFileSource >& aSource )
+  {
+    const bool lIsTopLevel ( mDependencyStack.empty() );
+    mDependencyStack.push_back ( std::vector< NodeTreeCache::FileDependency > ( 1 , aDependency ) );
+    // In lazy mode, the children of the top-level node of module files (but not of the top-level file itself) are deferred
+    mSourceStack.push_back ( ( mLazyLoading and not lIsTopLevel ) ? aSource : std::shared_ptr< const detail::AddressFileSource >() );
+    Node* lNode;
+
+    try
+    {
+      lNode = build ( aXmlNode , aPath );
+    }
+    catch ( ... )
+    {
+      mSourceStack.pop_back();
+      mDependencyStack.pop_back();
+      throw;
+    }
+
+    mSourceStack.pop_back();
+    std::vector< NodeTreeCache::FileDependency >& lDependencies ( mFileDependencies[aName] );
+    lDependencies.swap ( mDependencyStack.back() );
+    mDependencyStack.pop_back();
+
+    if ( not mDependencyStack.empty() )
+    {
+      mDependencyStack.back().insert ( mDependencyStack.back().end() , lDependencies.begin() , lDependencies.end() );
+    }
+
+    const std::shared_ptr< const Node > lSharedNode ( lNode );
+    mNodes.insert ( std::make_pair ( aName , lSharedNode ) );
+    aAddressTable.push_back ( lSharedNode );
+
+    // Lazily-loaded trees are not stored, since that would require building the whole tree
+    if ( mCache and lIsTopLevel and ( not mLazyLoading ) )
+    {
+      bool lAllLocal ( true );
+
+      for ( const NodeTreeCache::FileDependency& lFile : lDependencies )
+      {
+        lAllLocal = lAllLocal and ( not lFile.path.empty() );
+      }
+
+      if ( lAllLocal )
+      {
+        mCache->store ( aName , *lNode , lDependencies );
+      }
+    }
+  }
+
+
+  bool NodeTreeBuilder::buildFromLoadedFiles ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath , std::vector< std::shared_ptr< const Node > >& aAddressTable )
+  {
+    if ( not mFileLoader )
+    {
+      return false;
+    }
+
+    const std::vector< detail::AddressFileLoader::FileId >* lFiles ( mFileLoader->find ( aFilenameExpr , aParentPath ) );
+
+    if ( not lFiles )
+    {
+      return false;
+    }
+
+    for ( const detail::AddressFileLoader::FileId& lFile : *lFiles )
+    {
+      const std::string lName ( lFile.first + lFile.second.string() );
+
+      if ( ( mNodes.count ( lName ) == 0 ) and ( mFileLoader->get ( lName ) == NULL ) )
+      {
+        return false;
+      }
+    }
+
+    for ( const detail::AddressFileLoader::FileId& lFile : *lFiles )
+    {
+      const std::string lName ( lFile.first + lFile.second.string() );
+      const detail::AddressFileLoader::File* lLoadedFile ( mFileLoader->get ( lName ) );
+
+      if ( ( mNodes.count ( lName ) == 0 ) and lLoadedFile )
+      {
+        log ( Info() , "Reading XML address file " , Quote( lFile.second.c_str() ) );
+        buildTree ( lName , lFile.second , lLoadedFile->dependency , lLoadedFile->document.child ( "node" ) , aAddressTable );
+      }
+      else
+      {
+        // Tree has already been built, so CallBack will just return it from the cache
+        std::vector<uint8_t> lContents;
+        CallBack ( lFile.first , lFile.second , lContents , aAddressTable );
+      }
+    }
+
+    return true;
+  }
+
+
+  void NodeTreeBuilder::buildDeferredChildren ( const Node& aNode , std::vector< Node* >& aChildren )
+  {
+    std::lock_guard< std::recursive_mutex > lLock ( mMutex );
+    const detail::DeferredChildren& lDeferred ( *aNode.mDeferredChildren );
+    log ( Debug() , "Building children of node " , Quote ( aNode.getPath() ) , " from address file " , Quote ( lDeferred.source->path.c_str() ) );
+
+    pugi::xml_document lDocument;
+    const pugi::xml_node lDeferredXmlNode ( lDocument.load_buffer ( lDeferred.source->contents.data() , lDeferred.source->contents.size() ) ? findElementAtOffset ( lDocument , lDeferred.offset ) : pugi::xml_node() );
+
+    if ( not lDeferredXmlNode )
+    {
+      exception::DeferredChildrenNotFound lExc;
+      log ( lExc , "Could not find the XML element describing the children of node " , Quote ( aNode.getPath() ) , " in address file " , Quote ( lDeferred.source->path.c_str() ) );
+      throw lExc;
+    }
+
+    // Relative module paths are resolved from the directory of the module file; the empty entry on the dependency stack ensures
+    // that any module files referenced by the children are not treated as top-level files, and so that their children are deferred too
+    mFileCallStack.push_back ( lDeferred.source->path );
+    mDependencyStack.push_back ( std::vector< NodeTreeCache::FileDependency >() );
+    std::vector< Node* > lChildren;
+
+    try
+    {
+      for ( pugi::xml_node lXmlNode = lDeferredXmlNode.child ( "node" ); lXmlNode; lXmlNode = lXmlNode.next_sibling ( "node" ) )
+      {
+        lChildren.push_back ( mNodeParser ( lXmlNode ) );
+      }
+
+      for ( Node* lChild : lChildren )
+      {
+        lChild->mParent = const_cast< Node* > ( &aNode );
+        calculateHierarchicalAddresses ( lChild , aNode.mAddr );
+      }
+    }
+    catch ( ... )
+    {
+      for ( Node* lChild : lChildren )
+      {
+        delete lChild;
+      }
+
+      mDependencyStack.pop_back();
+      mFileCallStack.pop_back();
+      throw;
+    }
+
+    mDependencyStack.pop_back();
+    mFileCallStack.pop_back();
+
+    // New nodes send their transactions through the same client as the rest of the tree
+    std::vector< Node* > lStack ( lChildren );
+
+    while ( not lStack.empty() )
+    {
+      Node* lNode ( lStack.back() );
+      lStack.pop_back();
+      lNode->mClient = aNode.mClient;
+      lStack.insert ( lStack.end() , lNode->mChildren.begin() , lNode->mChildren.end() );
+    }
+
+    aChildren.insert ( aChildren.end() , lChildren.begin() , lChildren.end() );
+  }
+
+
+  bool NodeTreeBuilder::isUnchanged ( const NodeTreeCache::FileDependency& aFile )
+  {
+    struct stat lStat;
+
+    if ( ::stat ( aFile.path.c_str() , &lStat ) != 0 )
+    {
+      return false;
+    }
+
+    FileStatus lStatus;
+#ifdef __APPLE__
+    lStatus.modificationTime = int64_t ( lStat.st_mtimespec.tv_sec ) * 1000000000 + lStat.st_mtimespec.tv_nsec;
+#else
+    lStatus.modificationTime = int64_t ( lStat.st_mtim.tv_sec ) * 1000000000 + lStat.st_mtim.tv_nsec;
+#endif
+    lStatus.size = lStat.st_size;
+    std::unordered_map< std::string , FileStatus >::const_iterator lIt ( mFileStatus.find ( aFile.path ) );
+
+    // The contents are only re-read if the file has been modified since they were last checked (the status is read first, so that
+    // a modification made while the file is being read will be picked up next time)
+    if ( ( lIt == mFileStatus.end() ) or ( lIt->second.modificationTime != lStatus.modificationTime ) or ( lIt->second.size != lStatus.size ) )
+    {
+      std::ifstream lFile ( aFile.path.c_str() , std::ios::binary );
+
+      if ( not lFile )
+      {
+        return false;
+      }
+
+      const std::vector<uint8_t> lContents ( ( std::istreambuf_iterator<char> ( lFile ) ) , std::istreambuf_iterator<char>() );
+      lStatus.hash = NodeTreeCache::hash ( lContents.data() , lContents.size() );
+      mFileStatus[aFile.path] = lStatus;
+    }
+    else
+    {
+      lStatus.hash = lIt->second.hash;
+    }
+
+    return ( lStatus.size == aFile.size ) and ( lStatus.hash == aFile.hash );
+  }
+
+
+  bool NodeTreeBuilder::deferChildren ( const pugi::xml_node& aXmlNode ) const
+  {
+    return mLazyLoading and ( not mSourceStack.empty() ) and mSourceStack.back() and ( aXmlNode.parent() == aXmlNode.root() ) and aXmlNode.child ( "node" );
+  }
+
+
   Node* NodeTreeBuilder::plainNodeCreator ( const bool& aRequireId , const pugi::xml_node& aXmlNode )
   {
     Node* lNode ( new Node() );
@@ -336,7 +823,8 @@ namespace uhal
 
   void NodeTreeBuilder::setUid ( const bool& aRequireId , const pugi::xml_node& aXmlNode , Node* aNode )
   {
-    const bool lHasId = uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mIdAttribute , aNode->mUid );
+    std::string lUid;
+    const bool lHasId = uhal::utilities::GetXMLattribute<false> ( aXmlNode , NodeTreeBuilder::mIdAttribute , lUid );
 
     if ( aRequireId and ( not lHasId ) )
     {
@@ -346,12 +834,14 @@ namespace uhal
 
     if ( lHasId )
     {
-      if ( aNode->mUid.empty() )
+      if ( lUid.empty() )
         throw exception::NodeAttributeIncorrectValue("Invalid node ID specified (empty)");
-      else if ( aNode->mUid.find('.') != std::string::npos )
-        throw exception::NodeAttributeIncorrectValue("Invalid node ID '" + aNode->mUid + "' specified (contains dots)");
-      else if ( ( aNode->mUid.at(0) == ' ' ) or ( aNode->mUid.at(aNode->mUid.size()-1) == ' ' ) )
-        throw exception::NodeAttributeIncorrectValue("Invalid node ID '" + aNode->mUid + "' specified (contains spaces)");
+      else if ( lUid.find('.') != std::string::npos )
+        throw exception::NodeAttributeIncorrectValue("Invalid node ID '" + lUid + "' specified (contains dots)");
+      else if ( ( lUid.at(0) == ' ' ) or ( lUid.at(lUid.size()-1) == ' ' ) )
+        throw exception::NodeAttributeIncorrectValue("Invalid node ID '" + lUid + "' specified (contains spaces)");
+
+      aNode->mUid = lUid;
     }
   }
 
@@ -382,15 +872,16 @@ namespace uhal
     if ( lParsStr.size() )
     {
       //parse the string into a NodeTreeParameters object
-      std::string::const_iterator lBegin ( lParsStr.begin() );
-      std::string::const_iterator lEnd ( lParsStr.end() );
       std::unordered_map<std::string, std::string> lPars;
-      boost::spirit::qi::phrase_parse ( lBegin , lEnd , mNodeTreeParametersGrammar , boost::spirit::ascii::space , lPars );
+      grammars::parseNodeTreeParameters ( lParsStr , lPars );
       // Update the parameters map
       // Add to lPars those previously defined (module node)
-      lPars.insert ( aNode->mParameters.begin(), aNode->mParameters.end() );
-      // Swap the containers
-      aNode->mParameters.swap ( lPars );
+      if ( aNode->mParameters )
+      {
+        lPars.insert ( aNode->mParameters->begin(), aNode->mParameters->end() );
+      }
+      // Replace (rather than modify) the map, since it may be shared with other nodes
+      aNode->mParameters = std::make_shared< const std::unordered_map<std::string, std::string> > ( std::move ( lPars ) );
     }
   }
 
@@ -402,9 +893,7 @@ namespace uhal
 
     if ( lStr.size() && aNode->mTags.size() )
     {
-      aNode->mTags += "[";
-      aNode->mTags += lStr;
-      aNode->mTags += "]";
+      aNode->mTags = aNode->mTags.str() + "[" + lStr + "]";
     }
     else if ( lStr.size() && !aNode->mTags.size() )
     {
@@ -421,9 +910,7 @@ namespace uhal
 
     if ( lStr.size() && aNode->mDescription.size() )
     {
-      aNode->mDescription += "[";
-      aNode->mDescription += lStr;
-      aNode->mDescription += "]";
+      aNode->mDescription = aNode->mDescription.str() + "[" + lStr + "]";
     }
     else if ( lStr.size() && !aNode->mDescription.size() )
     {
@@ -449,7 +936,7 @@ namespace uhal
       const defs::NodePermission* const lPermission = mPermissionsLut.find(lPermissionAttr.c_str());
       if (lPermission == NULL)
       {
-        throw exception::NodeAttributeIncorrectValue("Permission attribute for node with ID '" + aNode->mUid + "' has incorrect value '" + lPermissionAttr + "'");
+        throw exception::NodeAttributeIncorrectValue("Permission attribute for node with ID '" + aNode->mUid.str() + "' has incorrect value '" + lPermissionAttr + "'");
       }
       else
         aNode->mPermission = *lPermission;
@@ -474,7 +961,7 @@ namespace uhal
       const defs::BlockReadWriteMode* const lMode = mModeLut.find(lModeAttr.c_str());
       if (lMode == NULL)
       {
-        throw exception::NodeAttributeIncorrectValue("Mode attribute for node with ID '" + aNode->mUid + "' has incorrect value '" + lModeAttr + "'");
+        throw exception::NodeAttributeIncorrectValue("Mode attribute for node with ID '" + aNode->mUid.str() + "' has incorrect value '" + lModeAttr + "'");
       }
       else
         aNode->mMode = *lMode;
@@ -514,16 +1001,17 @@ namespace uhal
     if ( lFwInfoStr.size() )
     {
       //parse the string into a NodeTreeFwInfoAttribute object
-      std::string::const_iterator lBegin ( lFwInfoStr.begin() );
-      std::string::const_iterator lEnd ( lFwInfoStr.end() );
       NodeTreeFirmwareInfoAttribute lFwInfo;
-      boost::spirit::qi::phrase_parse ( lBegin , lEnd , mNodeTreeFirmwareInfoAttributeGrammar , boost::spirit::ascii::space , lFwInfo );
-      aNode->mFirmwareInfo.insert ( make_pair ( "type",lFwInfo.mType ) );
+      grammars::parseNodeTreeFirmwareInfoAttribute ( lFwInfoStr , lFwInfo );
+      std::unordered_map<std::string, std::string> lFirmwareInfo ( aNode->getFirmwareInfo() );
+      lFirmwareInfo.insert ( make_pair ( "type",lFwInfo.mType ) );
 
       if ( lFwInfo.mArguments.size() )
       {
-        aNode->mFirmwareInfo.insert ( lFwInfo.mArguments.begin() , lFwInfo.mArguments.end() );
+        lFirmwareInfo.insert ( lFwInfo.mArguments.begin() , lFwInfo.mArguments.end() );
       }
+
+      aNode->mFirmwareInfo = std::make_shared< const std::unordered_map<std::string, std::string> > ( std::move ( lFirmwareInfo ) );
     }
   }
 
@@ -541,6 +1029,22 @@ namespace uhal
         throw lExc;
       }
     }
+    else if ( deferChildren ( aXmlNode ) )
+    {
+      // Whether the children are all bit-masked is recorded now, so that the node's mode can be determined without building them
+      bool lAllMasked ( true );
+
+      for ( ; lXmlNode; lXmlNode = lXmlNode.next_sibling ( "node" ) )
+      {
+        uint32_t lMask ( defs::NOMASK );
+        uhal::utilities::GetXMLattribute<false> ( lXmlNode , NodeTreeBuilder::mMaskAttribute , lMask );
+
+        if ( lMask == defs::NOMASK )
+          lAllMasked = false;
+      }
+
+      aNode->mDeferredChildren.reset ( new detail::DeferredChildren ( mSourceStack.back() , aXmlNode.offset_debug() , lAllMasked ) );
+    }
     else
     {
       for ( ; lXmlNode; lXmlNode = lXmlNode.next_sibling ( "node" ) )
@@ -548,8 +1052,7 @@ namespace uhal
         aNode->mChildren.push_back ( mNodeParser ( lXmlNode ) );
       }
 
-      for (const auto& lChild: aNode->mChildren)
-        aNode->mChildrenMap.insert ( std::make_pair ( lChild->mUid , lChild ) );
+      aNode->indexChildren();
     }
   }
 
@@ -557,7 +1060,15 @@ namespace uhal
   {
     if ( aNode->mMode == defs::HIERARCHICAL )
     {
-      if ( aNode->mChildren.size() == 0 )
+      if ( aNode->hasDeferredChildren() )
+      {
+        // Children haven't been built yet, so use the record of whether they are all bit-masked
+        if ( aNode->mDeferredChildren->allMasked )
+        {
+          aNode->mMode = defs::SINGLE;
+        }
+      }
+      else if ( aNode->mChildren.size() == 0 )
       {
         aNode->mMode = defs::SINGLE;
       }
@@ -628,7 +1139,7 @@ namespace uhal
       calculateHierarchicalAddresses ( lChild , aNode->mAddr );
     }
 
-    std::sort ( aNode->mChildren.begin() , aNode->mChildren.end() , detail::compareNodeAddr );
+    aNode->sortChildrenByAddress();
   }
 
 
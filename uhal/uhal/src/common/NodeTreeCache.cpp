@@ -0,0 +1,608 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/NodeTreeCache.hpp"
+
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/filesystem.hpp>
+
+#include "uhal/DerivedNodeFactory.hpp"
+#include "uhal/log/log.hpp"
+#include "uhal/Node.hpp"
+
+
+namespace uhal
+{
+
+  namespace
+  {
+    // Identifies cache entries; last character is incremented whenever the layout changes
+    const char kMagic[8] = { 'u', 'H', 'A', 'L', 'N', 'T', 'C', '1' };
+    // Guards against entries written on a machine with different byte order
+    const uint32_t kByteOrderMarker = 0x01020304;
+
+    // Minimum sizes of the items in an entry, used to check counts before allocating memory for the items
+    const size_t kMinDependencySize = 20;
+    const size_t kMinStringSize = 4;
+    const size_t kMinMapItemSize = 8;
+    const size_t kMinNodeSize = 60;
+
+    // Limits recursion when reading corrupt entries; far deeper than any real address table
+    const size_t kMaxNodeDepth = 1024;
+
+
+    //! Writes the binary representation of a cache entry into a byte vector
+    class EntryWriter
+    {
+      public:
+        EntryWriter ( std::vector<uint8_t>& aBuffer ) :
+          mBuffer ( aBuffer )
+        {
+        }
+
+        template <typename T>
+        void write ( const T& aValue )
+        {
+          const uint8_t* lPtr = reinterpret_cast<const uint8_t*> ( &aValue );
+          mBuffer.insert ( mBuffer.end() , lPtr , lPtr + sizeof ( T ) );
+        }
+
+        void write ( const std::string& aValue )
+        {
+          write<uint32_t> ( aValue.size() );
+          mBuffer.insert ( mBuffer.end() , aValue.begin() , aValue.end() );
+        }
+
+        //! Writes index of string in the entry's string table, adding it to the table if necessary
+        void writeStringIndex ( const std::string& aValue )
+        {
+          std::unordered_map<std::string, uint32_t>::const_iterator lIt = mStringIndices.find ( aValue );
+
+          if ( lIt == mStringIndices.end() )
+          {
+            lIt = mStringIndices.insert ( std::make_pair ( aValue , uint32_t ( mStrings.size() ) ) ).first;
+            mStrings.push_back ( aValue );
+          }
+
+          write<uint32_t> ( lIt->second );
+        }
+
+        const std::vector<std::string>& getStrings() const
+        {
+          return mStrings;
+        }
+
+      private:
+        std::vector<uint8_t>& mBuffer;
+        std::unordered_map<std::string, uint32_t> mStringIndices;
+        std::vector<std::string> mStrings;
+    };
+
+
+    //! Reads values from the binary representation of a cache entry, throwing if the end of the entry is reached
+    class EntryReader
+    {
+      public:
+        EntryReader ( const uint8_t* aBegin , const uint8_t* aEnd ) :
+          mPtr ( aBegin ),
+          mEnd ( aEnd )
+        {
+        }
+
+        template <typename T>
+        T read()
+        {
+          T lValue;
+          memcpy ( &lValue , advance ( sizeof ( T ) ) , sizeof ( T ) );
+          return lValue;
+        }
+
+        //! Reads the number of items that follow, checking that there is space for them in the rest of the entry
+        uint32_t readCount ( const size_t aMinItemSize )
+        {
+          const uint32_t lCount ( read<uint32_t>() );
+
+          if ( size_t ( mEnd - mPtr ) / aMinItemSize < lCount )
+          {
+            throw exception::CorruptNodeTreeCacheEntry ( "Item count exceeds size of entry" );
+          }
+
+          return lCount;
+        }
+
+        std::string readString()
+        {
+          const uint32_t lSize ( read<uint32_t>() );
+          const char* lData = reinterpret_cast<const char*> ( advance ( lSize ) );
+          return std::string ( lData , lSize );
+        }
+
+        const std::string& readStringIndex()
+        {
+          const uint32_t lIndex ( read<uint32_t>() );
+
+          if ( lIndex >= mStrings.size() )
+          {
+            throw exception::CorruptNodeTreeCacheEntry ( "String index out of range" );
+          }
+
+          return mStrings[lIndex];
+        }
+
+        std::vector<std::string>& getStrings()
+        {
+          return mStrings;
+        }
+
+      private:
+        const uint8_t* advance ( const size_t aNrBytes )
+        {
+          if ( size_t ( mEnd - mPtr ) < aNrBytes )
+          {
+            throw exception::CorruptNodeTreeCacheEntry ( "Unexpected end of entry" );
+          }
+
+          const uint8_t* lPtr = mPtr;
+          mPtr += aNrBytes;
+          return lPtr;
+        }
+
+        const uint8_t* mPtr;
+        const uint8_t* const mEnd;
+        std::vector<std::string> mStrings;
+    };
+
+
+    //! Memory-maps a file read-only for the lifetime of the object
+    class MappedFile
+    {
+      public:
+        MappedFile ( const std::string& aPath ) :
+          mData ( NULL ),
+          mSize ( 0 )
+        {
+          const int lFd = open ( aPath.c_str() , O_RDONLY );
+
+          if ( lFd < 0 )
+          {
+            return;
+          }
+
+          struct stat lStat;
+
+          if ( ( fstat ( lFd , &lStat ) == 0 ) and ( lStat.st_size > 0 ) )
+          {
+            void* lPtr = mmap ( NULL , lStat.st_size , PROT_READ , MAP_PRIVATE , lFd , 0 );
+
+            if ( lPtr != MAP_FAILED )
+            {
+              mData = static_cast<const uint8_t*> ( lPtr );
+              mSize = lStat.st_size;
+            }
+          }
+
+          close ( lFd );
+        }
+
+        ~MappedFile()
+        {
+          if ( mData )
+          {
+            munmap ( const_cast<uint8_t*> ( mData ) , mSize );
+          }
+        }
+
+        const uint8_t* begin() const
+        {
+          return mData;
+        }
+
+        const uint8_t* end() const
+        {
+          return mData + mSize;
+        }
+
+        bool valid() const
+        {
+          return mData != NULL;
+        }
+
+      private:
+        MappedFile ( const MappedFile& );
+        MappedFile& operator= ( const MappedFile& );
+
+        const uint8_t* mData;
+        size_t mSize;
+    };
+
+
+    bool isUnchanged ( const NodeTreeCache::FileDependency& aDependency )
+    {
+      std::ifstream lFile ( aDependency.path.c_str() , std::ios::binary );
+
+      if ( not lFile )
+      {
+        return false;
+      }
+
+      std::vector<uint8_t> lContents ( ( std::istreambuf_iterator<char> ( lFile ) ) , std::istreambuf_iterator<char>() );
+      return ( lContents.size() == aDependency.size ) and ( NodeTreeCache::hash ( lContents.data() , lContents.size() ) == aDependency.hash );
+    }
+  }
+
+
+  class NodeTreeCache::Serializer
+  {
+    public:
+      static void writeNode ( EntryWriter& aWriter , const Node& aNode )
+      {
+        aWriter.writeStringIndex ( aNode.mUid );
+        aWriter.write<uint32_t> ( aNode.mPartialAddr );
+        aWriter.write<uint32_t> ( aNode.mAddr );
+        aWriter.write<uint32_t> ( aNode.mMask );
+        aWriter.write<uint32_t> ( aNode.mPermission );
+        aWriter.write<uint32_t> ( aNode.mMode );
+        aWriter.write<uint32_t> ( aNode.mSize );
+        aWriter.writeStringIndex ( aNode.mTags );
+        aWriter.writeStringIndex ( aNode.mDescription );
+        aWriter.writeStringIndex ( aNode.mModule );
+        aWriter.writeStringIndex ( aNode.mClassName );
+        // Derived type isn't necessarily given by class name, since module nodes inherit type from module file's top-level node
+        aWriter.writeStringIndex ( DerivedNodeFactory::getInstance().getRegisteredClassName ( aNode ) );
+        writeMap ( aWriter , aNode.getParameters() );
+        writeMap ( aWriter , aNode.getFirmwareInfo() );
+
+        aWriter.write<uint32_t> ( aNode.mChildren.size() );
+
+        for ( const Node* lChild : aNode.mChildren )
+        {
+          writeNode ( aWriter , *lChild );
+        }
+      }
+
+      static Node* readNode ( EntryReader& aReader , const size_t aDepth = 0 )
+      {
+        if ( aDepth > kMaxNodeDepth )
+        {
+          throw exception::CorruptNodeTreeCacheEntry ( "Node tree too deep" );
+        }
+
+        std::unique_ptr<Node> lNode ( new Node() );
+        lNode->mUid = aReader.readStringIndex();
+        lNode->mPartialAddr = aReader.read<uint32_t>();
+        lNode->mAddr = aReader.read<uint32_t>();
+        lNode->mMask = aReader.read<uint32_t>();
+
+        const uint32_t lPermission ( aReader.read<uint32_t>() );
+
+        if ( ( lPermission != defs::READ ) and ( lPermission != defs::WRITE ) and ( lPermission != defs::READWRITE ) )
+        {
+          throw exception::CorruptNodeTreeCacheEntry ( "Invalid node permission" );
+        }
+
+        lNode->mPermission = defs::NodePermission ( lPermission );
+
+        const uint32_t lMode ( aReader.read<uint32_t>() );
+
+        if ( lMode > defs::HIERARCHICAL )
+        {
+          throw exception::CorruptNodeTreeCacheEntry ( "Invalid node mode" );
+        }
+
+        lNode->mMode = defs::BlockReadWriteMode ( lMode );
+        lNode->mSize = aReader.read<uint32_t>();
+        lNode->mTags = aReader.readStringIndex();
+        lNode->mDescription = aReader.readStringIndex();
+        lNode->mModule = aReader.readStringIndex();
+        lNode->mClassName = aReader.readStringIndex();
+        const std::string& lType ( aReader.readStringIndex() );
+        readMap ( aReader , lNode->mParameters );
+        readMap ( aReader , lNode->mFirmwareInfo );
+
+        const uint32_t lNrChildren ( aReader.readCount ( kMinNodeSize ) );
+        lNode->mChildren.reserve ( lNrChildren );
+
+        for ( uint32_t i = 0; i < lNrChildren; i++ )
+        {
+          Node* lChild ( readNode ( aReader , aDepth + 1 ) );
+          lChild->mParent = lNode.get();
+          lNode->mChildren.push_back ( lChild );
+        }
+
+        lNode->indexChildren();
+
+        // As in NodeTreeBuilder, derived node types are created from the complete plain node (i.e. with its children)
+        if ( lType.size() )
+        {
+          return DerivedNodeFactory::getInstance().convertToClassType ( lNode.release() , lType );
+        }
+
+        return lNode.release();
+      }
+
+    private:
+      static void writeMap ( EntryWriter& aWriter , const std::unordered_map<std::string, std::string>& aMap )
+      {
+        aWriter.write<uint32_t> ( aMap.size() );
+
+        for ( const auto& lItem : aMap )
+        {
+          aWriter.writeStringIndex ( lItem.first );
+          aWriter.writeStringIndex ( lItem.second );
+        }
+      }
+
+      static void readMap ( EntryReader& aReader , std::shared_ptr< const std::unordered_map<std::string, std::string> >& aMap )
+      {
+        const uint32_t lSize ( aReader.readCount ( kMinMapItemSize ) );
+
+        if ( lSize == 0 )
+        {
+          return;
+        }
+
+        std::unordered_map<std::string, std::string> lMap;
+
+        for ( uint32_t i = 0; i < lSize; i++ )
+        {
+          const std::string& lKey ( aReader.readStringIndex() );
+          lMap.insert ( std::make_pair ( lKey , aReader.readStringIndex() ) );
+        }
+
+        aMap = std::make_shared< const std::unordered_map<std::string, std::string> > ( std::move ( lMap ) );
+      }
+  };
+
+
+  NodeTreeCache::NodeTreeCache ( const boost::filesystem::path& aDirectory ) :
+    mDirectory ( aDirectory )
+  {
+  }
+
+
+  NodeTreeCache::~NodeTreeCache ()
+  {
+  }
+
+
+  const boost::filesystem::path& NodeTreeCache::getDirectory() const
+  {
+    return mDirectory;
+  }
+
+
+  Node* NodeTreeCache::load ( const std::string& aName , const std::vector<uint8_t>& aFile , std::vector<FileDependency>& aDependencies ) const
+  {
+    const boost::filesystem::path lEntryPath ( getEntryPath ( aName ) );
+    MappedFile lEntry ( lEntryPath.string() );
+
+    if ( not lEntry.valid() )
+    {
+      log ( Debug() , "No node tree cache entry for address table " , Quote ( aName ) , " at " , Quote ( lEntryPath.string() ) );
+      return NULL;
+    }
+
+    try
+    {
+      EntryReader lReader ( lEntry.begin() , lEntry.end() );
+
+      for ( size_t i = 0; i < sizeof ( kMagic ); i++ )
+      {
+        if ( lReader.read<char>() != kMagic[i] )
+        {
+          throw exception::CorruptNodeTreeCacheEntry ( "Invalid header" );
+        }
+      }
+
+      if ( lReader.read<uint32_t>() != kByteOrderMarker )
+      {
+        throw exception::CorruptNodeTreeCacheEntry ( "Written with different byte order" );
+      }
+
+      if ( lReader.readString() != aName )
+      {
+        log ( Debug() , "Node tree cache entry " , Quote ( lEntryPath.string() ) , " is for a different address table (hash collision)" );
+        return NULL;
+      }
+
+      // Validate dependencies; the first is always the address table file itself
+      std::vector<FileDependency> lDependencies ( lReader.readCount ( kMinDependencySize ) );
+
+      for ( FileDependency& lDependency : lDependencies )
+      {
+        lDependency.path = lReader.readString();
+        lDependency.size = lReader.read<uint64_t>();
+        lDependency.hash = lReader.read<uint64_t>();
+      }
+
+      if ( lDependencies.empty() or ( lDependencies.front().size != aFile.size() ) or ( lDependencies.front().hash != hash ( aFile.data() , aFile.size() ) ) )
+      {
+        log ( Info() , "Node tree cache entry for address table " , Quote ( aName ) , " is stale" );
+        return NULL;
+      }
+
+      for ( std::vector<FileDependency>::const_iterator lIt = lDependencies.begin() + 1; lIt != lDependencies.end(); lIt++ )
+      {
+        if ( not isUnchanged ( *lIt ) )
+        {
+          log ( Info() , "Node tree cache entry for address table " , Quote ( aName ) , " is stale, since " , Quote ( lIt->path ) , " has changed" );
+          return NULL;
+        }
+      }
+
+      std::vector<std::string>& lStrings ( lReader.getStrings() );
+      lStrings.resize ( lReader.readCount ( kMinStringSize ) );
+
+      for ( std::string& lString : lStrings )
+      {
+        lString = lReader.readString();
+      }
+
+      Node* lNode ( Serializer::readNode ( lReader ) );
+      aDependencies.swap ( lDependencies );
+      log ( Info() , "Loaded node tree for address table " , Quote ( aName ) , " from cache entry " , Quote ( lEntryPath.string() ) );
+      return lNode;
+    }
+    catch ( const exception::CorruptNodeTreeCacheEntry& aExc )
+    {
+      log ( Warning() , "Ignoring corrupt node tree cache entry " , Quote ( lEntryPath.string() ) , " (" , aExc.what() , ")" );
+      return NULL;
+    }
+  }
+
+
+  void NodeTreeCache::store ( const std::string& aName , const Node& aNode , const std::vector<FileDependency>& aDependencies ) const
+  {
+    std::vector<uint8_t> lNodeData;
+    EntryWriter lNodeWriter ( lNodeData );
+    Serializer::writeNode ( lNodeWriter , aNode );
+
+    std::vector<uint8_t> lEntry;
+    EntryWriter lWriter ( lEntry );
+
+    for ( size_t i = 0; i < sizeof ( kMagic ); i++ )
+    {
+      lWriter.write<char> ( kMagic[i] );
+    }
+
+    lWriter.write<uint32_t> ( kByteOrderMarker );
+    lWriter.write ( aName );
+
+    // Modules that are included several times only need to be validated once
+    std::vector<const FileDependency*> lDependencies;
+    std::unordered_set<std::string> lPaths;
+
+    for ( const FileDependency& lDependency : aDependencies )
+    {
+      if ( lPaths.insert ( lDependency.path ).second )
+      {
+        lDependencies.push_back ( &lDependency );
+      }
+    }
+
+    lWriter.write<uint32_t> ( lDependencies.size() );
+
+    for ( const FileDependency* lDependency : lDependencies )
+    {
+      lWriter.write ( lDependency->path );
+      lWriter.write<uint64_t> ( lDependency->size );
+      lWriter.write<uint64_t> ( lDependency->hash );
+    }
+
+    lWriter.write<uint32_t> ( lNodeWriter.getStrings().size() );
+
+    for ( const std::string& lString : lNodeWriter.getStrings() )
+    {
+      lWriter.write ( lString );
+    }
+
+    lEntry.insert ( lEntry.end() , lNodeData.begin() , lNodeData.end() );
+
+    // Write to a temporary file then rename, so that other processes never see a partially-written entry
+    const boost::filesystem::path lEntryPath ( getEntryPath ( aName ) );
+    const boost::filesystem::path lTempPath ( lEntryPath.string() + "." + std::to_string ( getpid() ) + ".tmp" );
+
+    try
+    {
+      boost::filesystem::create_directories ( mDirectory );
+
+      std::ofstream lFile ( lTempPath.c_str() , std::ios::binary | std::ios::trunc );
+      lFile.write ( reinterpret_cast<const char*> ( lEntry.data() ) , lEntry.size() );
+      lFile.close();
+
+      if ( not lFile )
+      {
+        log ( Warning() , "Failed to write node tree cache entry " , Quote ( lTempPath.string() ) );
+        boost::filesystem::remove ( lTempPath );
+        return;
+      }
+
+      boost::filesystem::rename ( lTempPath , lEntryPath );
+    }
+    catch ( const boost::filesystem::filesystem_error& aExc )
+    {
+      log ( Warning() , "Failed to write node tree cache entry for address table " , Quote ( aName ) , "; caught filesystem_error exception with what returning: " , aExc.what() );
+      return;
+    }
+
+    log ( Info() , "Wrote node tree for address table " , Quote ( aName ) , " to cache entry " , Quote ( lEntryPath.string() ) , " (" , Integer ( lEntry.size() ) , " bytes)" );
+  }
+
+
+  boost::filesystem::path NodeTreeCache::getEntryPath ( const std::string& aName ) const
+  {
+    char lHash[17];
+    snprintf ( lHash , sizeof ( lHash ) , "%016llx" , static_cast<unsigned long long> ( hash ( reinterpret_cast<const uint8_t*> ( aName.data() ) , aName.size() ) ) );
+    return mDirectory / ( "nodetree-" + std::string ( lHash ) + ".bin" );
+  }
+
+
+  NodeTreeCache::FileDependency NodeTreeCache::createDependency ( const std::string& aPath , const uint8_t* aData , const size_t aSize )
+  {
+    FileDependency lDependency;
+    lDependency.path = aPath;
+    lDependency.size = aSize;
+    lDependency.hash = hash ( aData , aSize );
+    return lDependency;
+  }
+
+
+  uint64_t NodeTreeCache::hash ( const uint8_t* aData , const size_t aSize )
+  {
+    uint64_t lHash = 0xcbf29ce484222325ULL;
+
+    for ( size_t i = 0; i < aSize; i++ )
+    {
+      lHash ^= aData[i];
+      lHash *= 0x100000001b3ULL;
+    }
+
+    return lHash;
+  }
+
+}
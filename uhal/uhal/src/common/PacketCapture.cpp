@@ -0,0 +1,714 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/PacketCapture.hpp"
+
+
+#include <arpa/inet.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "uhal/log/log.hpp"
+#include "uhal/log/log_inserters.quote.hpp"
+
+
+namespace uhal
+{
+
+  namespace
+  {
+    //! The fixed-size part of each packet in a ring buffer; the packet data follows it
+    struct CaptureRecord
+    {
+      //! Size of the record, including the packet data and padding to an 8-byte boundary
+      uint32_t size;
+      //! Whether this record just skips the unused space at the end of the buffer
+      uint32_t skip;
+      //! Time at which the packet was captured, in ns since the epoch
+      uint64_t time;
+      //! Number of bytes of packet data captured
+      uint32_t length;
+      //! Length of the packet
+      uint32_t originalLength;
+    };
+
+
+    //! Single-producer single-consumer ring buffer of variable-size packet records; its memory is only allocated while capturing
+    class CaptureRing
+    {
+      public:
+        CaptureRing() :
+          mBuffer(),
+          mWrite ( 0 ),
+          mRead ( 0 )
+        {
+        }
+
+        //! Allocates the buffer, discarding any records (must not be called while the producer or consumer are using the buffer)
+        void allocate ( const size_t aSize )
+        {
+          mBuffer.assign ( std::max< size_t > ( aSize , 4096 ) / sizeof ( uint64_t ) , 0 );
+          mWrite.store ( 0 , std::memory_order_relaxed );
+          mRead.store ( 0 , std::memory_order_relaxed );
+        }
+
+        //! Frees the buffer (must not be called while the producer or consumer are using the buffer)
+        void release()
+        {
+          std::vector< uint64_t >().swap ( mBuffer );
+          mWrite.store ( 0 , std::memory_order_relaxed );
+          mRead.store ( 0 , std::memory_order_relaxed );
+        }
+
+        size_t capacity() const
+        {
+          return mBuffer.size() * sizeof ( uint64_t );
+        }
+
+        /**
+          Reserves space for a packet (called by the producer only); the packet data is truncated to a quarter of the buffer
+          @return the record, whose data must be filled before calling commit; NULL if there is not enough free space
+        */
+        CaptureRecord* reserve ( const size_t aLength )
+        {
+          const uint64_t lCapacity ( capacity() );
+          const uint32_t lLength ( std::min< size_t > ( aLength , std::min< size_t > ( lCapacity / 4 , 65535 - 28 ) ) );
+          const uint32_t lSize ( ( sizeof ( CaptureRecord ) + lLength + 7 ) & ~uint32_t ( 7 ) );
+          uint64_t lWrite ( mWrite.load ( std::memory_order_relaxed ) );
+          const uint64_t lRead ( mRead.load ( std::memory_order_acquire ) );
+          const uint64_t lOffset ( lWrite % lCapacity );
+          // Records are contiguous, so if this one doesn't fit before the end of the buffer the remaining space is skipped
+          const uint64_t lSkip ( ( lOffset + lSize > lCapacity ) ? lCapacity - lOffset : 0 );
+
+          if ( lWrite + lSkip + lSize - lRead > lCapacity )
+          {
+            return NULL;
+          }
+
+          if ( lSkip )
+          {
+            CaptureRecord* lRecord ( at ( lWrite ) );
+            lRecord->size = lSkip;
+            lRecord->skip = 1;
+            lWrite += lSkip;
+          }
+
+          CaptureRecord* lRecord ( at ( lWrite ) );
+          lRecord->size = lSize + lSkip;
+          lRecord->skip = 0;
+          lRecord->length = lLength;
+          lRecord->originalLength = aLength;
+          return lRecord;
+        }
+
+        //! Timestamps a reserved record and makes it visible to the consumer (called by the producer only)
+        void commit ( CaptureRecord& aRecord )
+        {
+          // Timestamping just before publishing minimises the window in which the consumer could see a later record in another buffer first
+          aRecord.time = std::chrono::duration_cast< std::chrono::nanoseconds > ( std::chrono::system_clock::now().time_since_epoch() ).count();
+          // The size of the reserved record temporarily included the skipped space, so that it is published in one store
+          const uint32_t lSize ( ( sizeof ( CaptureRecord ) + aRecord.length + 7 ) & ~uint32_t ( 7 ) );
+          const uint64_t lWrite ( mWrite.load ( std::memory_order_relaxed ) + aRecord.size );
+          aRecord.size = lSize;
+          mWrite.store ( lWrite , std::memory_order_release );
+        }
+
+        //! @return the oldest record in the buffer, or NULL if it is empty (called by the consumer only)
+        const CaptureRecord* front()
+        {
+          uint64_t lRead ( mRead.load ( std::memory_order_relaxed ) );
+          const uint64_t lWrite ( mWrite.load ( std::memory_order_acquire ) );
+
+          while ( lRead != lWrite )
+          {
+            const CaptureRecord* lRecord ( at ( lRead ) );
+
+            if ( not lRecord->skip )
+            {
+              return lRecord;
+            }
+
+            lRead += lRecord->size;
+            mRead.store ( lRead , std::memory_order_release );
+          }
+
+          return NULL;
+        }
+
+        //! Releases the space occupied by the oldest record (called by the consumer only)
+        void pop ( const CaptureRecord& aRecord )
+        {
+          mRead.store ( mRead.load ( std::memory_order_relaxed ) + aRecord.size , std::memory_order_release );
+        }
+
+      private:
+        CaptureRecord* at ( const uint64_t aPosition )
+        {
+          return reinterpret_cast< CaptureRecord* > ( reinterpret_cast< uint8_t* > ( mBuffer.data() ) + ( aPosition % capacity() ) );
+        }
+
+        std::vector< uint64_t > mBuffer;
+        //! Total number of bytes written and read; each is kept on its own cache line, since they are updated by different threads
+        char mPadding0 [ 64 ];
+        std::atomic< uint64_t > mWrite;
+        char mPadding1 [ 64 ];
+        std::atomic< uint64_t > mRead;
+        char mPadding2 [ 64 ];
+    };
+  }
+
+
+  class PacketCapture::Stream
+  {
+    public:
+      Stream ( const std::string& aId , const URI& aUri ) :
+        id ( aId ),
+        uri ( toString ( aUri ) ),
+        targetAddress ( 0 ),
+        targetPort ( strtoul ( aUri.mPort.c_str() , NULL , 10 ) ),
+        rings(),
+        producers ( 0 ),
+        released ( false ),
+        interface ( kNoInterface )
+      {
+        in_addr lAddress;
+
+        if ( inet_pton ( AF_INET , aUri.mHostname.c_str() , &lAddress ) == 1 )
+        {
+          targetAddress = ntohl ( lAddress.s_addr );
+        }
+      }
+
+      static const uint32_t kNoInterface = 0xFFFFFFFF;
+
+      const std::string id;
+      const std::string uri;
+      uint32_t targetAddress;
+      const uint16_t targetPort;
+      //! Ring buffers for sent and received packets, indexed by direction
+      CaptureRing rings [ 2 ];
+      //! Number of threads currently capturing a packet into the ring buffers, which are only freed once it's zero
+      std::atomic< uint32_t > producers;
+      //! Whether the client has been destroyed
+      bool released;
+      //! Index of the stream's interface in the current file (only used by the background thread)
+      uint32_t interface;
+  };
+
+
+  namespace
+  {
+    //! Registers the current thread as a producer for a stream's ring buffers, for the lifetime of the guard
+    class ProducerGuard
+    {
+      public:
+        ProducerGuard ( PacketCapture::Stream& aStream ) :
+          mStream ( aStream )
+        {
+          mStream.producers.fetch_add ( 1 );
+        }
+
+        ~ProducerGuard()
+        {
+          mStream.producers.fetch_sub ( 1 , std::memory_order_release );
+        }
+
+      private:
+        PacketCapture::Stream& mStream;
+    };
+
+
+    //! State of the packet capture, shared by all clients
+    struct CaptureState
+    {
+      CaptureState() :
+        dropped ( 0 ),
+        running ( false ),
+        stop ( false ),
+        ringSize ( 1 << 20 ),
+        nextInterface ( 0 )
+      {
+      }
+
+      //! Serializes calls to start and stop
+      std::mutex startStopMutex;
+      //! Protects the list of streams, and the other members
+      std::mutex mutex;
+      std::vector< PacketCapture::Stream* > streams;
+      std::atomic< uint64_t > dropped;
+      bool running;
+      bool stop;
+      std::condition_variable condition;
+      size_t ringSize;
+      std::ofstream file;
+      uint32_t nextInterface;
+      std::thread thread;
+    };
+
+
+    CaptureState& getCaptureState()
+    {
+      // Never destroyed, since clients may outlive other static objects
+      static CaptureState* lState = new CaptureState();
+      return *lState;
+    }
+
+
+    template < typename T >
+    void append ( std::vector< uint8_t >& aBlock , const T& aValue )
+    {
+      const uint8_t* lData ( reinterpret_cast< const uint8_t* > ( &aValue ) );
+      aBlock.insert ( aBlock.end() , lData , lData + sizeof ( T ) );
+    }
+
+
+    //! Appends a pcapng option (or the end-of-options marker, if the code is 0), padded to a 4-byte boundary
+    void appendOption ( std::vector< uint8_t >& aBlock , const uint16_t aCode , const void* aData = NULL , const size_t aSize = 0 )
+    {
+      append ( aBlock , aCode );
+      append ( aBlock , uint16_t ( aSize ) );
+      aBlock.insert ( aBlock.end() , static_cast< const uint8_t* > ( aData ) , static_cast< const uint8_t* > ( aData ) + aSize );
+      aBlock.resize ( ( aBlock.size() + 3 ) & ~size_t ( 3 ) , 0 );
+    }
+
+
+    //! Writes a pcapng block with the specified type and body
+    void writeBlock ( std::ostream& aFile , const uint32_t aType , const std::vector< uint8_t >& aBody )
+    {
+      const uint32_t lLength ( aBody.size() + 12 );
+      aFile.write ( reinterpret_cast< const char* > ( &aType ) , sizeof ( aType ) );
+      aFile.write ( reinterpret_cast< const char* > ( &lLength ) , sizeof ( lLength ) );
+      aFile.write ( reinterpret_cast< const char* > ( aBody.data() ) , aBody.size() );
+      aFile.write ( reinterpret_cast< const char* > ( &lLength ) , sizeof ( lLength ) );
+    }
+
+
+    void writeSectionHeader ( std::ostream& aFile )
+    {
+      static const std::string kApplication ( "uHAL" );
+      std::vector< uint8_t > lBody;
+      append ( lBody , uint32_t ( 0x1A2B3C4D ) );
+      append ( lBody , uint16_t ( 1 ) );
+      append ( lBody , uint16_t ( 0 ) );
+      append ( lBody , int64_t ( -1 ) );
+      appendOption ( lBody , 4 , kApplication.data() , kApplication.size() );
+      appendOption ( lBody , 0 );
+      writeBlock ( aFile , 0x0A0D0D0A , lBody );
+    }
+
+
+    void writeInterfaceDescription ( std::ostream& aFile , const PacketCapture::Stream& aStream )
+    {
+      // Packets are recorded as raw IPv4 (LINKTYPE_IPV4), with nanosecond timestamps
+      static const uint8_t kTimestampResolution ( 9 );
+      std::vector< uint8_t > lBody;
+      append ( lBody , uint16_t ( 228 ) );
+      append ( lBody , uint16_t ( 0 ) );
+      append ( lBody , uint32_t ( 0 ) );
+      appendOption ( lBody , 2 , aStream.id.data() , aStream.id.size() );
+      appendOption ( lBody , 3 , aStream.uri.data() , aStream.uri.size() );
+      appendOption ( lBody , 9 , &kTimestampResolution , sizeof ( kTimestampResolution ) );
+      appendOption ( lBody , 0 );
+      writeBlock ( aFile , 1 , lBody );
+    }
+
+
+    //! Appends synthesised IPv4 and UDP headers for a packet with the specified payload length, in network byte order
+    void appendHeaders ( std::vector< uint8_t >& aBlock , const PacketCapture::Stream& aStream , const PacketCapture::Direction aDirection , const uint32_t aLength )
+    {
+      static const uint32_t kLocalAddress ( 0x7F000001 );
+      static const uint16_t kLocalPort ( 49152 );
+      const uint32_t lSource ( htonl ( aDirection == PacketCapture::SENT ? kLocalAddress : aStream.targetAddress ) );
+      const uint32_t lDestination ( htonl ( aDirection == PacketCapture::SENT ? aStream.targetAddress : kLocalAddress ) );
+
+      uint16_t lIpHeader [ 10 ] = { htons ( 0x4500 ) , htons ( std::min< uint32_t > ( aLength + 28 , 0xFFFF ) ) , 0 , htons ( 0x4000 ) , htons ( 0x4011 ) , 0 ,
+                                    uint16_t ( lSource ) , uint16_t ( lSource >> 16 ) , uint16_t ( lDestination ) , uint16_t ( lDestination >> 16 ) };
+      uint32_t lChecksum ( 0 );
+
+      for ( const uint16_t lWord : lIpHeader )
+      {
+        lChecksum += lWord;
+      }
+
+      lChecksum = ( lChecksum & 0xFFFF ) + ( lChecksum >> 16 );
+      lChecksum = ( lChecksum & 0xFFFF ) + ( lChecksum >> 16 );
+      lIpHeader [ 5 ] = ~uint16_t ( lChecksum );
+
+      const uint16_t lUdpHeader [ 4 ] = { htons ( aDirection == PacketCapture::SENT ? kLocalPort : aStream.targetPort ) , htons ( aDirection == PacketCapture::SENT ? aStream.targetPort : kLocalPort ) ,
+                                          htons ( std::min< uint32_t > ( aLength + 8 , 0xFFFF ) ) , 0
+                                        };
+      append ( aBlock , lIpHeader );
+      append ( aBlock , lUdpHeader );
+    }
+
+
+    //! Writes a packet to the file (called by the background thread only)
+    void writePacket ( CaptureState& aState , PacketCapture::Stream& aStream , const PacketCapture::Direction aDirection , const CaptureRecord& aRecord , std::vector< uint8_t >& aBody )
+    {
+      if ( aStream.interface == PacketCapture::Stream::kNoInterface )
+      {
+        aStream.interface = aState.nextInterface++;
+        writeInterfaceDescription ( aState.file , aStream );
+      }
+
+      aBody.clear();
+      append ( aBody , aStream.interface );
+      append ( aBody , uint32_t ( aRecord.time >> 32 ) );
+      append ( aBody , uint32_t ( aRecord.time ) );
+      append ( aBody , uint32_t ( aRecord.length + 28 ) );
+      append ( aBody , uint32_t ( aRecord.originalLength + 28 ) );
+      appendHeaders ( aBody , aStream , aDirection , aRecord.originalLength );
+      const uint8_t* lData ( reinterpret_cast< const uint8_t* > ( &aRecord + 1 ) );
+      aBody.insert ( aBody.end() , lData , lData + aRecord.length );
+      aBody.resize ( ( aBody.size() + 3 ) & ~size_t ( 3 ) , 0 );
+      // Flags option: direction is inbound (1) or outbound (2)
+      const uint32_t lFlags ( aDirection == PacketCapture::SENT ? 2 : 1 );
+      appendOption ( aBody , 2 , &lFlags , sizeof ( lFlags ) );
+      appendOption ( aBody , 0 );
+      writeBlock ( aState.file , 6 , aBody );
+    }
+
+
+    //! Writes out the packets from all streams, and deletes streams whose clients have been destroyed (called by the background thread only)
+    void writePackets ( CaptureState& aState )
+    {
+      std::vector< PacketCapture::Stream* > lStreams;
+      {
+        std::lock_guard< std::mutex > lLock ( aState.mutex );
+        lStreams = aState.streams;
+      }
+
+      std::vector< uint8_t > lBody;
+
+      // Each ring buffer is in time order, so the packets are merged by always writing the oldest one at the front of a buffer
+      while ( true )
+      {
+        PacketCapture::Stream* lStream ( NULL );
+        PacketCapture::Direction lDirection ( PacketCapture::SENT );
+        const CaptureRecord* lRecord ( NULL );
+
+        for ( PacketCapture::Stream* lCandidate : lStreams )
+        {
+          for ( const PacketCapture::Direction lCandidateDirection : { PacketCapture::SENT , PacketCapture::RECEIVED } )
+          {
+            const CaptureRecord* lFront ( lCandidate->rings [ lCandidateDirection ].front() );
+
+            if ( lFront and ( ( not lRecord ) or ( lFront->time < lRecord->time ) ) )
+            {
+              lStream = lCandidate;
+              lDirection = lCandidateDirection;
+              lRecord = lFront;
+            }
+          }
+        }
+
+        if ( not lRecord )
+        {
+          break;
+        }
+
+        writePacket ( aState , *lStream , lDirection , *lRecord , lBody );
+        lStream->rings [ lDirection ].pop ( *lRecord );
+      }
+
+      aState.file.flush();
+
+      std::lock_guard< std::mutex > lLock ( aState.mutex );
+
+      for ( std::vector< PacketCapture::Stream* >::iterator lIt = aState.streams.begin(); lIt != aState.streams.end(); )
+      {
+        // Released streams can't receive any more packets, so can be deleted once they've been written out
+        if ( ( *lIt )->released and std::find ( lStreams.begin() , lStreams.end() , *lIt ) != lStreams.end() and not ( *lIt )->rings [ PacketCapture::SENT ].front() and not ( *lIt )->rings [ PacketCapture::RECEIVED ].front() )
+        {
+          delete *lIt;
+          lIt = aState.streams.erase ( lIt );
+        }
+        else
+        {
+          lIt++;
+        }
+      }
+    }
+
+
+    void runWriter ( CaptureState& aState )
+    {
+      std::unique_lock< std::mutex > lLock ( aState.mutex );
+
+      while ( true )
+      {
+        const bool lStop ( aState.stop );
+        lLock.unlock();
+        writePackets ( aState );
+        lLock.lock();
+
+        if ( lStop )
+        {
+          break;
+        }
+
+        aState.condition.wait_for ( lLock , std::chrono::milliseconds ( 10 ) , [&aState] () { return aState.stop; } );
+      }
+    }
+
+
+    //! Stops the background thread and closes the file (caller must hold the start/stop mutex)
+    void stopCapture ( CaptureState& aState )
+    {
+      {
+        std::lock_guard< std::mutex > lLock ( aState.mutex );
+
+        if ( not aState.running )
+        {
+          return;
+        }
+
+        // Capture has been disabled, so wait for any packets still being captured, so that they're written out below
+        for ( PacketCapture::Stream* lStream : aState.streams )
+        {
+          while ( lStream->producers.load() )
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        aState.stop = true;
+        aState.condition.notify_all();
+      }
+
+      aState.thread.join();
+
+      std::lock_guard< std::mutex > lLock ( aState.mutex );
+      aState.running = false;
+      aState.file.close();
+
+      for ( std::vector< PacketCapture::Stream* >::iterator lIt = aState.streams.begin(); lIt != aState.streams.end(); )
+      {
+        if ( ( *lIt )->released )
+        {
+          delete *lIt;
+          lIt = aState.streams.erase ( lIt );
+        }
+        else
+        {
+          ( *lIt )->rings [ PacketCapture::SENT ].release();
+          ( *lIt )->rings [ PacketCapture::RECEIVED ].release();
+          lIt++;
+        }
+      }
+    }
+  }
+
+
+  std::atomic< bool > PacketCapture::mEnabled ( false );
+
+  const char* const PacketCapture::mFileEnvVariable = "UHAL_PCAP_FILE";
+
+
+  void PacketCapture::start ( const boost::filesystem::path& aPath , const size_t aRingSize )
+  {
+    CaptureState& lState ( getCaptureState() );
+    std::lock_guard< std::mutex > lStartStopLock ( lState.startStopMutex );
+    mEnabled.store ( false );
+    stopCapture ( lState );
+
+    lState.file.open ( aPath.c_str() , std::ios::binary | std::ios::trunc );
+
+    if ( not lState.file )
+    {
+      lState.file.clear();
+      exception::PacketCaptureError lExc;
+      log ( lExc , "Failed to open packet capture file " , Quote ( aPath.string() ) );
+      throw lExc;
+    }
+
+    writeSectionHeader ( lState.file );
+
+    {
+      std::lock_guard< std::mutex > lLock ( lState.mutex );
+
+      for ( Stream* lStream : lState.streams )
+      {
+        lStream->interface = Stream::kNoInterface;
+        lStream->rings [ SENT ].allocate ( aRingSize );
+        lStream->rings [ RECEIVED ].allocate ( aRingSize );
+      }
+
+      lState.running = true;
+      lState.stop = false;
+      lState.dropped.store ( 0 , std::memory_order_relaxed );
+      lState.ringSize = aRingSize;
+      lState.nextInterface = 0;
+    }
+
+    lState.thread = std::thread ( runWriter , std::ref ( lState ) );
+    mEnabled.store ( true );
+    log ( Info() , "Capturing IPbus packets to file " , Quote ( aPath.string() ) );
+  }
+
+
+  void PacketCapture::stop()
+  {
+    CaptureState& lState ( getCaptureState() );
+    std::lock_guard< std::mutex > lStartStopLock ( lState.startStopMutex );
+    mEnabled.store ( false );
+    stopCapture ( lState );
+  }
+
+
+  uint64_t PacketCapture::getDroppedPacketCount()
+  {
+    return getCaptureState().dropped.load ( std::memory_order_relaxed );
+  }
+
+
+  PacketCapture::Stream* PacketCapture::createStream ( const std::string& aId , const URI& aUri )
+  {
+    CaptureState& lState ( getCaptureState() );
+    std::lock_guard< std::mutex > lLock ( lState.mutex );
+    lState.streams.push_back ( new Stream ( aId , aUri ) );
+
+    if ( lState.running )
+    {
+      lState.streams.back()->rings [ SENT ].allocate ( lState.ringSize );
+      lState.streams.back()->rings [ RECEIVED ].allocate ( lState.ringSize );
+    }
+
+    return lState.streams.back();
+  }
+
+
+  void PacketCapture::releaseStream ( Stream* aStream )
+  {
+    CaptureState& lState ( getCaptureState() );
+    std::lock_guard< std::mutex > lLock ( lState.mutex );
+
+    if ( lState.running )
+    {
+      // The background thread deletes the stream after writing out its remaining packets
+      aStream->released = true;
+      return;
+    }
+
+    lState.streams.erase ( std::remove ( lState.streams.begin() , lState.streams.end() , aStream ) , lState.streams.end() );
+    delete aStream;
+  }
+
+
+  void PacketCapture::capture ( Stream& aStream , const uint8_t* aData , const size_t aSize )
+  {
+    // Since the thread is registered as a producer before re-checking that capture is enabled, stop() cannot free the ring buffer while it's in use
+    ProducerGuard lGuard ( aStream );
+
+    if ( not mEnabled.load() )
+    {
+      return;
+    }
+
+    CaptureRing& lRing ( aStream.rings [ SENT ] );
+    CaptureRecord* lRecord ( lRing.reserve ( aSize ) );
+
+    if ( not lRecord )
+    {
+      getCaptureState().dropped.fetch_add ( 1 , std::memory_order_relaxed );
+      return;
+    }
+
+    memcpy ( lRecord + 1 , aData , lRecord->length );
+    lRing.commit ( *lRecord );
+  }
+
+
+  void PacketCapture::capture ( Stream& aStream , const std::deque< std::pair< uint8_t* , uint32_t > >& aReplyBuffer , const size_t aSize )
+  {
+    ProducerGuard lGuard ( aStream );
+
+    if ( not mEnabled.load() )
+    {
+      return;
+    }
+
+    CaptureRing& lRing ( aStream.rings [ RECEIVED ] );
+    CaptureRecord* lRecord ( lRing.reserve ( aSize ) );
+
+    if ( not lRecord )
+    {
+      getCaptureState().dropped.fetch_add ( 1 , std::memory_order_relaxed );
+      return;
+    }
+
+    uint8_t* lData ( reinterpret_cast< uint8_t* > ( lRecord + 1 ) );
+    uint32_t lRemaining ( lRecord->length );
+
+    for ( std::deque< std::pair< uint8_t* , uint32_t > >::const_iterator lIt = aReplyBuffer.begin(); ( lIt != aReplyBuffer.end() ) and ( lRemaining > 0 ); lIt++ )
+    {
+      const uint32_t lSize ( std::min ( lIt->second , lRemaining ) );
+      memcpy ( lData , lIt->first , lSize );
+      lData += lSize;
+      lRemaining -= lSize;
+    }
+
+    lRing.commit ( *lRecord );
+  }
+
+
+  void PacketCapture::startFromEnvironment()
+  {
+    static std::once_flag lEnvironmentFlag;
+    std::call_once ( lEnvironmentFlag , [] ()
+    {
+      if ( const char* lPath = std::getenv ( mFileEnvVariable ) )
+      {
+        try
+        {
+          start ( boost::filesystem::path ( lPath ) );
+        }
+        catch ( const exception::PacketCaptureError& )
+        {
+          // Already logged; capture is optional, so don't prevent the client from being created
+        }
+      }
+    } );
+  }
+
+}
@@ -33,16 +33,15 @@
 #include "uhal/ProtocolControlHub.hpp"
 
 
+#include <cstdlib>
 #include <mutex>
 #include <string>
 #include <vector>
 
 #include <boost/asio.hpp>
-#include <boost/fusion/adapted/std_pair.hpp>
-#include <boost/spirit/include/qi.hpp>
-#include <boost/spirit/include/qi_eps.hpp>
 
 #include "uhal/Buffers.hpp"
+#include "uhal/grammars/Parsers.hpp"
 #include "uhal/ProtocolIPbus.hpp"
 
 
@@ -71,16 +70,7 @@ namespace uhal
 
     try
     {
-      boost::spirit::qi::phrase_parse (	lIt->second.begin() ,
-                                        lIt->second.end(),
-                                        ( boost::spirit::qi::eps >
-                                          * ( boost::spirit::qi::char_ - boost::spirit::qi::lit ( ":" ) ) >
-                                          boost::spirit::qi::lit ( ":" ) >
-                                          *boost::spirit::qi::char_
-                                        ) ,
-                                        boost::spirit::ascii::space ,
-                                        lIP
-                                      );
+      grammars::parseHostPort ( lIt->second , lIP );
     }
     catch ( const std::exception& aExc )
     {
@@ -89,53 +79,53 @@ namespace uhal
       throw lExc;
     }
 
-    std::string lAddr;
+    boost::asio::ip::address lAddr;
     uint16_t lPort;
 
-    try
+    // Numeric addresses and ports (the usual case) do not need to be resolved
+    boost::system::error_code lErrorCode;
+    const boost::asio::ip::address_v4 lNumericAddr ( boost::asio::ip::address_v4::from_string ( lIP.first , lErrorCode ) );
+    char* lPortEnd ( NULL );
+    const unsigned long lNumericPort ( strtoul ( lIP.second.c_str() , &lPortEnd , 10 ) );
+
+    if ( ( not lErrorCode ) and ( not lIP.second.empty() ) and ( *lPortEnd == '\0' ) and ( lNumericPort <= 0xFFFF ) )
     {
-      boost::asio::io_service lService;
-      boost::asio::ip::udp::endpoint lEndpoint (
-        *boost::asio::ip::udp::resolver::iterator (
-          boost::asio::ip::udp::resolver ( lService ).resolve (
-            boost::asio::ip::udp::resolver::query ( boost::asio::ip::udp::v4() , lIP.first , lIP.second )
-          )
-        )
-      );
-      lAddr = lEndpoint.address().to_string();
-      lPort = lEndpoint.port();
+      lAddr = lNumericAddr;
+      lPort = lNumericPort;
     }
-    catch ( const std::exception& aExc )
+    else
     {
-      exception::HostnameToIPlookupFailed lExc;
-      log ( lExc , "Hostname to IP look up failed for hostname=" , lIP.first , ", port=" , lIP.second );
-      log ( lExc , "ASIO threw exception with what returning: ", Quote ( aExc.what() ) );
-      throw lExc;
+      try
+      {
+        boost::asio::io_service lService;
+        boost::asio::ip::udp::endpoint lEndpoint (
+          *boost::asio::ip::udp::resolver::iterator (
+            boost::asio::ip::udp::resolver ( lService ).resolve (
+              boost::asio::ip::udp::resolver::query ( boost::asio::ip::udp::v4() , lIP.first , lIP.second )
+            )
+          )
+        );
+        lAddr = lEndpoint.address();
+        lPort = lEndpoint.port();
+      }
+      catch ( const std::exception& aExc )
+      {
+        exception::HostnameToIPlookupFailed lExc;
+        log ( lExc , "Hostname to IP look up failed for hostname=" , lIP.first , ", port=" , lIP.second );
+        log ( lExc , "ASIO threw exception with what returning: ", Quote ( aExc.what() ) );
+        throw lExc;
+      }
     }
 
-    std::vector< uint32_t > lIPAddr;
-
-    try
-    {
-      boost::spirit::qi::phrase_parse (	lAddr.begin() ,
-                                        lAddr.end() ,
-                                        ( boost::spirit::qi::eps >
-                                          boost::spirit::qi::uint_ > boost::spirit::qi::lit ( "." ) >
-                                          boost::spirit::qi::uint_ > boost::spirit::qi::lit ( "." ) >
-                                          boost::spirit::qi::uint_ > boost::spirit::qi::lit ( "." ) >
-                                          boost::spirit::qi::uint_ ),
-                                        boost::spirit::ascii::space ,
-                                        lIPAddr
-                                      );
-    }
-    catch ( const std::exception& aExc )
+    if ( not lAddr.is_v4() )
     {
       exception::ParsingTargetURLfailed lExc;
-      log ( lExc , "Boost::ASIO returned address " , Quote ( lAddr ) , " for hostname " , Quote (lIP.first) ,  " which could not be parsed as " , Quote ( "aaa.bbb.ccc.ddd" ) );
+      log ( lExc , "Boost::ASIO returned address " , Quote ( lAddr.to_string() ) , " for hostname " , Quote (lIP.first) ,  " which could not be parsed as " , Quote ( "aaa.bbb.ccc.ddd" ) );
       throw lExc;
     }
 
-    uint32_t lIPaddress = ( lIPAddr[0] <<24 ) | ( lIPAddr[1] <<16 ) | ( lIPAddr[2] <<8 ) | ( lIPAddr[3] );
+    const uint32_t lIPaddress ( lAddr.to_v4().to_ulong() );
+    const uint32_t lIPAddr[4] = { lIPaddress >> 24 , ( lIPaddress >> 16 ) & 0xFF , ( lIPaddress >> 8 ) & 0xFF , lIPaddress & 0xFF };
     log ( Info() , "Converted IP address string " ,  Quote ( lIt->second ) , " to " ,
           Integer ( lIPAddr[0] ) , "." , Integer ( lIPAddr[1] ) , "." , Integer ( lIPAddr[2] ) , "." , Integer ( lIPAddr[3] ) , ":" , Integer ( lPort ) ,
           " and converted this to IP " , Integer ( lIPaddress, IntFmt< hex , fixed >() ) , ", port " , Integer ( lPort, IntFmt< hex , fixed >() ) );
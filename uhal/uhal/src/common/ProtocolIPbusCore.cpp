@@ -118,7 +118,12 @@ namespace uhal
   IPbusCore::IPbusCore ( const std::string& aId, const URI& aUri , const boost::posix_time::time_duration& aTimeoutPeriod ) :
     ClientInterface ( aId , aUri , aTimeoutPeriod ),
     mTransactionCounter ( 0x00000000 )
-  {}
+  {
+    for ( const IPbusTransactionType lType : { B_O_T , READ , WRITE , RMW_BITS , RMW_SUM , NI_READ , NI_WRITE , CONFIG_SPACE_READ } )
+    {
+      mStatistics.setTransactionTypeName ( lType , boost::lexical_cast< std::string > ( lType ) );
+    }
+  }
 
 
   IPbusCore::~IPbusCore()
@@ -279,6 +284,7 @@ namespace uhal
     uint32_t lSendBytesAvailable;
     uint32_t  lReplyBytesAvailable;
     std::shared_ptr< Buffers > lBuffers = checkBufferSpace ( lSendByteCount , lReplyByteCount , lSendBytesAvailable , lReplyBytesAvailable );
+    mStatistics.recordTransaction ( B_O_T );
     lBuffers->send ( implementCalculateHeader ( B_O_T , 0 , mTransactionCounter++ , requestTransactionInfoCode() ) );
     std::pair < ValHeader , _ValHeader_* > lReply ( CreateValHeader() );
     lReply.second->IPbusHeaders.push_back ( 0 );
@@ -304,6 +310,7 @@ namespace uhal
     uint32_t lSendBytesAvailable;
     uint32_t  lReplyBytesAvailable;
     std::shared_ptr< Buffers > lBuffers = checkBufferSpace ( lSendByteCount , lReplyByteCount , lSendBytesAvailable , lReplyBytesAvailable );
+    mStatistics.recordTransaction ( WRITE );
     lBuffers->send ( implementCalculateHeader ( WRITE , 1 , mTransactionCounter++ , requestTransactionInfoCode()
                                               ) );
     lBuffers->send ( aAddr );
@@ -343,6 +350,7 @@ namespace uhal
       lBuffers = checkBufferSpace ( lSendHeaderByteCount+lPayloadByteCount , lReplyByteCount , lSendBytesAvailable , lReplyBytesAvailable );
       uint32_t lSendBytesAvailableForPayload ( std::min ( 4*getMaxTransactionWordCount(), lSendBytesAvailable - lSendHeaderByteCount ) & 0xFFFFFFFC );
 
+      mStatistics.recordTransaction ( lType );
       lBuffers->send ( implementCalculateHeader ( lType , lSendBytesAvailableForPayload>>2 , mTransactionCounter++ , requestTransactionInfoCode() ) );
       lBuffers->send ( lAddr );
       if ( aSource.size() > 0 )
@@ -383,6 +391,7 @@ namespace uhal
     uint32_t lSendBytesAvailable;
     uint32_t  lReplyBytesAvailable;
     std::shared_ptr< Buffers > lBuffers = checkBufferSpace ( lSendByteCount , lReplyByteCount , lSendBytesAvailable , lReplyBytesAvailable );
+    mStatistics.recordTransaction ( READ );
     lBuffers->send ( implementCalculateHeader ( READ , 1 , mTransactionCounter++ , requestTransactionInfoCode()
                                               ) );
     lBuffers->send ( aAddr );
@@ -421,6 +430,7 @@ namespace uhal
     {
       lBuffers = checkBufferSpace ( lSendByteCount , lReplyHeaderByteCount+lPayloadByteCount , lSendBytesAvailable , lReplyBytesAvailable );
       uint32_t lReplyBytesAvailableForPayload ( std::min ( 4*getMaxTransactionWordCount(), lReplyBytesAvailable - lReplyHeaderByteCount ) & 0xFFFFFFFC );
+      mStatistics.recordTransaction ( lType );
       lBuffers->send ( implementCalculateHeader ( lType , lReplyBytesAvailableForPayload>>2 , mTransactionCounter++ , requestTransactionInfoCode()
                                                 ) );
       lBuffers->send ( lAddr );
@@ -457,6 +467,7 @@ namespace uhal
     uint32_t lSendBytesAvailable;
     uint32_t  lReplyBytesAvailable;
     std::shared_ptr< Buffers > lBuffers = checkBufferSpace ( lSendByteCount , lReplyByteCount , lSendBytesAvailable , lReplyBytesAvailable );
+    mStatistics.recordTransaction ( CONFIG_SPACE_READ );
     lBuffers->send ( implementCalculateHeader ( CONFIG_SPACE_READ , 1 , mTransactionCounter++ , requestTransactionInfoCode()
                                               ) );
     lBuffers->send ( aAddr );
@@ -487,6 +498,7 @@ namespace uhal
     uint32_t lSendBytesAvailable;
     uint32_t  lReplyBytesAvailable;
     std::shared_ptr< Buffers > lBuffers = checkBufferSpace ( lSendByteCount , lReplyByteCount , lSendBytesAvailable , lReplyBytesAvailable );
+    mStatistics.recordTransaction ( RMW_BITS );
     lBuffers->send ( implementCalculateHeader ( RMW_BITS , 1 , mTransactionCounter++ , requestTransactionInfoCode()
                                               ) );
     lBuffers->send ( aAddr );
@@ -517,6 +529,7 @@ namespace uhal
     uint32_t lSendBytesAvailable;
     uint32_t  lReplyBytesAvailable;
     std::shared_ptr< Buffers > lBuffers = checkBufferSpace ( lSendByteCount , lReplyByteCount , lSendBytesAvailable , lReplyBytesAvailable );
+    mStatistics.recordTransaction ( RMW_SUM );
     lBuffers->send ( implementCalculateHeader ( RMW_SUM , 1 , mTransactionCounter++ , requestTransactionInfoCode()
                                               ) );
     lBuffers->send ( aAddr );
@@ -49,6 +49,7 @@
 #include <fcntl.h>
 #include <iomanip>                                          // for operator<<
 #include <iostream>                                         // for operator<<
+#include <sys/file.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <stdlib.h>                                         // for size_t, free
@@ -67,6 +68,7 @@
 #include "uhal/Buffers.hpp"
 #include "uhal/ClientFactory.hpp"
 #include "uhal/SigBusGuard.hpp"
+#include "uhal/utilities/mmio.hpp"
 
 
 namespace uhal {
@@ -107,13 +109,24 @@ std::ostream& operator<<(std::ostream& aStream, const Mmap::PacketFmt& aPacket)
 
 
 
+// The default version of ipbus_transport_axi_if uses four IPBus
+// transport buffers, each with a 2^11-bit address space. In
+// addition, the first four 32-bit words in the IPBus transport
+// address space contain status information. This means the
+// corresponding memory memory map needs to allocate 2^15 + 16 bytes.
+#define MAP_SIZE (32*1024UL + 16UL)
+#define MAP_MASK (MAP_SIZE - 1)
+
+
 Mmap::File::File(const std::string& aPath, int aFlags) :
   mPath(aPath),
   mFd(-1),
   mFlags(aFlags),
   mOffset(0),
+  mMapSize(MAP_SIZE),
   mMmapPtr(NULL),
-  mMmapIOPtr(NULL)
+  mMmapIOPtr(NULL),
+  mLocked(false)
 {
 }
 
@@ -142,13 +155,16 @@ void Mmap::File::setOffset(size_t aOffset)
 }
 
 
-// The default version of ipbus_transport_axi_if uses four IPBus
-// transport buffers, each with a 2^11-bit address space. In
-// addition, the first four 32-bit words in the IPBus transport
-// address space contain status information. This means the
-// corresponding memory memory map needs to allocate 2^15 + 16 bytes.
-#define MAP_SIZE (32*1024UL + 16UL)
-#define MAP_MASK (MAP_SIZE - 1)
+size_t Mmap::File::getMapSize() const
+{
+  return mMapSize;
+}
+
+
+void Mmap::File::setMapSize(size_t aMapSize)
+{
+  mMapSize = aMapSize;
+}
 
 
 void Mmap::File::open()
@@ -166,7 +182,7 @@ void Mmap::File::open()
   const off_t lPageSize = sysconf(_SC_PAGESIZE);
   const off_t lPageBaseAddr = (mOffset & ~(lPageSize-1));
 
-  mMmapPtr = mmap(0, MAP_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, lPageBaseAddr);
+  mMmapPtr = mmap(0, mMapSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, lPageBaseAddr);
   mMmapIOPtr = static_cast<uint8_t*>(mMmapPtr) + (mOffset - lPageBaseAddr);
 
   if (mMmapPtr == (void *)-1) {
@@ -180,7 +196,7 @@ void Mmap::File::open()
 void Mmap::File::close()
 {
   if (mMmapPtr != NULL) {
-    if (munmap(mMmapPtr, MAP_SIZE) == -1)
+    if (munmap(mMmapPtr, mMapSize) == -1)
       log ( Error() , "mmap client for ", Quote(mPath), " encountered error when unmapping memory" );
     else {
       mMmapPtr = NULL;
@@ -189,8 +205,10 @@ void Mmap::File::close()
   }
 
   if (mFd != -1) {
+    // Closing the file also releases the lock
     int rc = ::close(mFd);
     mFd = -1;
+    mLocked = false;
     if (rc == -1)
       log (Error(), "Failed to close file ", Quote(mPath), "; errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
   }
@@ -202,21 +220,21 @@ void Mmap::File::read(const uint32_t aAddr, const uint32_t aNrWords, std::vector
   if (mFd == -1)
     open();
 
-  if (4 * aAddr + 4 * aNrWords > size_t(MAP_SIZE)) {
+  if (4 * aAddr + 4 * aNrWords > mMapSize) {
     exception::MmapInitialisationError lExc;
-    log(lExc, "Attempted to read beyond the end of mapped memory for device file '" + mPath + "' (reading ", Integer(4 * aNrWords), " bytes from address ", Integer(4 * aAddr), ", i.e. ", Integer(uint32_t(4 * aAddr + 4 * aNrWords - MAP_SIZE)), " bytes beyond end of ", Integer(uint32_t(MAP_SIZE)), " mapped bytes.");
+    log(lExc, "Attempted to read beyond the end of mapped memory for device file '" + mPath + "' (reading ", Integer(4 * aNrWords), " bytes from address ", Integer(4 * aAddr), ", i.e. ", Integer(uint32_t(4 * aAddr + 4 * aNrWords - mMapSize)), " bytes beyond end of ", Integer(uint32_t(mMapSize)), " mapped bytes.");
     throw lExc;
   }
 
   std::ostringstream lMessage;
   lMessage << "SIGBUS received during " << 4*aNrWords << "-byte read @ 0x" << std::hex << 4*aAddr << " in " << mPath;
+  const size_t lInitialSize = aValues.size();
+  aValues.resize(lInitialSize + aNrWords);
+
   SigBusGuard lGuard;
   lGuard.protect([&]{
-    uint8_t* lVirtAddr = static_cast<uint8_t*>(mMmapIOPtr) + off_t(4*aAddr);
-
-    for (size_t i=0; i<aNrWords; i++) {
-      aValues.push_back(*((uint32_t*) (lVirtAddr + 4 * i)));
-    }
+    const uint8_t* lVirtAddr = static_cast<uint8_t*>(mMmapIOPtr) + off_t(4*aAddr);
+    utilities::mmio::read(aValues.data() + lInitialSize, lVirtAddr, aNrWords);
   }, lMessage.str());
 }
 
@@ -232,48 +250,66 @@ void Mmap::File::write(const uint32_t aAddr, const std::vector<std::pair<const u
 
   assert((lNrBytes % 4) == 0);
 
-  if (aAddr + lNrBytes > size_t(MAP_SIZE)) {
+  if (aAddr + lNrBytes > mMapSize) {
     exception::MmapInitialisationError lExc;
-    log(lExc, "Attempted to write beyond the end of mapped memory for device file '" + mPath + "' (writing ", Integer(lNrBytes), " bytes at address ", Integer(aAddr), ", i.e. ", Integer(uint32_t(aAddr + lNrBytes - MAP_SIZE)), " bytes beyond end of ", Integer(uint32_t(MAP_SIZE)), " mapped bytes.");
+    log(lExc, "Attempted to write beyond the end of mapped memory for device file '" + mPath + "' (writing ", Integer(lNrBytes), " bytes at address ", Integer(aAddr), ", i.e. ", Integer(uint32_t(aAddr + lNrBytes - mMapSize)), " bytes beyond end of ", Integer(uint32_t(mMapSize)), " mapped bytes.");
     throw lExc;
   }
 
-  char *allocated = NULL;
-  posix_memalign((void **)&allocated, 4096/*alignment*/, lNrBytes + 4096);
-  if (allocated == NULL) {
-    exception::MmapCommunicationError lExc;
-    log(lExc, "Failed to allocate ", Integer(lNrBytes + 4096), " bytes in File::write/2 function");
-    throw lExc;
+  // Gather the packet into a contiguous buffer, so that the copy kernel can use wide stores across fragment boundaries
+  std::vector<uint8_t> lBuffer(lNrBytes);
+  size_t lNrBytesCopied = 0;
+  for (size_t i = 0; i < aData.size(); i++) {
+    memcpy(lBuffer.data() + lNrBytesCopied, aData.at(i).first, aData.at(i).second);
+    lNrBytesCopied += aData.at(i).second;
   }
 
   std::ostringstream lMessage;
   lMessage << "SIGBUS received during " << lNrBytes << "-byte write @ 0x" << std::hex << aAddr << " in " << mPath;
   SigBusGuard lGuard;
   lGuard.protect([&]{
-    // data to write to register address
-    char* buffer = allocated;
-    size_t lNrBytesCopied = 0;
-    for (size_t i = 0; i < aData.size(); i++) {
-      memcpy(buffer + lNrBytesCopied, aData.at(i).first, aData.at(i).second);
-      lNrBytesCopied += aData.at(i).second;
-    }
+    uint8_t* lVirtAddr = static_cast<uint8_t*>(mMmapIOPtr) + aAddr;
+    utilities::mmio::write(lVirtAddr, lBuffer.data(), lNrBytes);
+  }, lMessage.str());
+}
 
-    lNrBytesCopied = 0;
-    while (lNrBytesCopied < lNrBytes) {
-      char* lSrcPtr = buffer + lNrBytesCopied;
-      char* lVirtAddr = static_cast<char*>(mMmapIOPtr) + aAddr + lNrBytesCopied;
-      if ((lNrBytes - lNrBytesCopied) >= 8) {
-        *((uint64_t*) lVirtAddr) = *(uint64_t*) lSrcPtr;
-        lNrBytesCopied += 8;
-      }
-      else if ((lNrBytes - lNrBytesCopied) >= 4) {
-        *((uint64_t*) lVirtAddr) = uint64_t(*(uint32_t*) lSrcPtr);
-        lNrBytesCopied += 4;
-      }
-    }
 
-    free(allocated);
-  }, lMessage.str());
+volatile uint32_t* Mmap::File::getWordPtr(const uint32_t aAddr)
+{
+  if (mFd == -1)
+    open();
+
+  return reinterpret_cast<volatile uint32_t*>(static_cast<uint8_t*>(mMmapIOPtr) + 4 * size_t(aAddr));
+}
+
+
+bool Mmap::File::haveLock() const
+{
+  return mLocked;
+}
+
+
+void Mmap::File::lock()
+{
+  if (mFd == -1)
+    open();
+
+  if ( flock(mFd, LOCK_EX) == -1 ) {
+    exception::MmapCommunicationError lExc;
+    log(lExc, "Failed to lock device file ", Quote(mPath), "; errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
+    throw lExc;
+  }
+  mLocked = true;
+}
+
+
+void Mmap::File::unlock()
+{
+  if ( flock(mFd, LOCK_UN) == -1 ) {
+    log(Warning(), "Failed to unlock device file ", Quote(mPath), "; errno=", Integer(errno), ", meaning ", Quote (strerror(errno)));
+  }
+  else
+    mLocked = false;
 }
 
 
@@ -282,7 +318,10 @@ void Mmap::File::write(const uint32_t aAddr, const std::vector<std::pair<const u
 Mmap::Mmap ( const std::string& aId, const URI& aUri ) :
   IPbus< 2 , 0 > ( aId , aUri ),
   mConnected(false),
+  mDirectAccess(false),
   mDeviceFile(aUri.mHostname, O_RDWR | O_SYNC),
+  mPoller(std::chrono::microseconds(50)),
+  mTrace(0),
   mNumberOfPages(0),
   mPageSize(0),
   mIndexNextPage(0),
@@ -290,12 +329,23 @@ Mmap::Mmap ( const std::string& aId, const URI& aUri ) :
   mReadReplyPageCount(0),
   mAsynchronousException ( NULL )
 {
-  mSleepDuration = std::chrono::microseconds(50);
-
   for (const auto& lArg: aUri.mArguments) {
     if (lArg.first == "sleep") {
-      mSleepDuration = std::chrono::microseconds(boost::lexical_cast<size_t>(lArg.second));
-      log (Notice() , "mmap client with URI ", Quote (uri()), " : Inter-poll-/-interrupt sleep duration set to ", boost::lexical_cast<size_t>(lArg.second), " us by URI 'sleep' attribute");
+      mPoller.setMaxSleep(std::chrono::microseconds(boost::lexical_cast<size_t>(lArg.second)));
+      log (Notice() , "mmap client with URI ", Quote (uri()), " : Maximum inter-poll sleep duration set to ", boost::lexical_cast<size_t>(lArg.second), " us by URI 'sleep' attribute");
+    }
+    else if (lArg.first == "trace") {
+      mTrace.setDepth(boost::lexical_cast<size_t>(lArg.second));
+      log (Notice() , "mmap client with URI ", Quote (uri()), " : Recording last ", Integer(mTrace.getDepth()), " transfers in packet trace");
+    }
+    else if (lArg.first == "polling") {
+      if ((lArg.second != "adaptive") and (lArg.second != "fixed")) {
+        exception::MmapInitialisationError lExc;
+        log(lExc, "mmap client URI ", Quote(uri()), ": Invalid value, ", Quote(lArg.second), ", for 'polling' attribute (allowed values: 'adaptive', 'fixed')");
+        throw lExc;
+      }
+      mPoller.setAdaptive(lArg.second == "adaptive");
+      log (Notice() , "mmap client with URI ", Quote (uri()), " : Using ", lArg.second, " polling policy");
     }
     else if (lArg.first == "offset") {
       const bool lIsHex = (lArg.second.find("0x") == 0) or (lArg.second.find("0X") == 0);
@@ -303,6 +353,22 @@ Mmap::Mmap ( const std::string& aId, const URI& aUri ) :
       mDeviceFile.setOffset(lOffset);
       log (Notice(), "mmap client with URI ", Quote (uri()), " : Address offset set to ", Integer(lOffset, IntFmt<hex>()));
     }
+    else if (lArg.first == "size") {
+      const bool lIsHex = (lArg.second.find("0x") == 0) or (lArg.second.find("0X") == 0);
+      const size_t lMapSize = (lIsHex ? boost::lexical_cast<HexTo<size_t> >(lArg.second) : boost::lexical_cast<size_t>(lArg.second));
+      mDeviceFile.setMapSize(lMapSize);
+      log (Notice(), "mmap client with URI ", Quote (uri()), " : Size of mapped region set to ", Integer(lMapSize, IntFmt<hex>()), " bytes");
+    }
+    else if (lArg.first == "mode") {
+      if (lArg.second == "direct")
+        mDirectAccess = true;
+      else if (lArg.second != "ipbus") {
+        exception::MmapInitialisationError lExc;
+        log(lExc, "mmap client URI ", Quote(uri()), ": Invalid value, ", Quote(lArg.second), ", for 'mode' attribute (allowed values: 'ipbus', 'direct')");
+        throw lExc;
+      }
+      log (Notice(), "mmap client with URI ", Quote (uri()), " : Registers will be accessed ", (mDirectAccess ? "directly via loads/stores into mapped memory" : "via IPbus packets"));
+    }
     else {
       log (Warning() , "Unknown attribute ", Quote (lArg.first), " used in URI ", Quote(uri()));
     }
@@ -316,6 +382,35 @@ Mmap::~Mmap()
 }
 
 
+const AdaptivePoller& Mmap::getReplyPoller() const
+{
+  return mPoller;
+}
+
+
+const PacketTrace& Mmap::getPacketTrace() const
+{
+  return mTrace;
+}
+
+
+uint32_t Mmap::getRequestOffset() const
+{
+  return 0;
+}
+
+
+void Mmap::notifyRequestWritten()
+{
+}
+
+
+volatile uint32_t* Mmap::getWordPtr(const uint32_t aAddr)
+{
+  return mDeviceFile.getWordPtr(aAddr);
+}
+
+
 void Mmap::implementDispatch ( std::shared_ptr< Buffers > aBuffers )
 {
   log(Debug(), "mmap client (URI: ", Quote(uri()), ") : implementDispatch method called");
@@ -335,6 +430,8 @@ void Mmap::Flush( )
   while ( !mReplyQueue.empty() )
     read();
 
+  if (mDeviceFile.haveLock())
+    mDeviceFile.unlock();
 }
 
 
@@ -344,6 +441,8 @@ void Mmap::dispatchExceptionHandler()
   log(Notice(), "mmap client ", Quote(id()), " (URI: ", Quote(uri()), ") : closing device files since exception detected");
 
   ClientInterface::returnBufferToPool ( mReplyQueue );
+  mPoller.reset();
+  mDirectTransactionQueue.clear();
   disconnect();
 
   InnerProtocol::dispatchExceptionHandler();
@@ -371,9 +470,16 @@ uint32_t Mmap::getMaxReplySize()
 void Mmap::connect()
 {
   log ( Debug() , "mmap client is opening device file " , Quote ( mDeviceFile.getPath() ) );
+  if (mDirectAccess) {
+    mDeviceFile.open();
+    mConnected = true;
+    log ( Info() , "mmap client connected to device at ", Quote(mDeviceFile.getPath()), " in direct access mode; ", Integer(mDeviceFile.getMapSize()), " bytes mapped" );
+    return;
+  }
+
   std::vector<uint32_t> lValues;
   mDeviceFile.read(0x0, 4, lValues);
-  log (Info(), "Read status info from addr 0 (", Integer(lValues.at(0)), ", ", Integer(lValues.at(1)), ", ", Integer(lValues.at(2)), ", ", Integer(lValues.at(3)), "): ", PacketFmt((const uint8_t*)lValues.data(), 4 * lValues.size()));
+  log (Debug(), "Read status info from addr 0 (", Integer(lValues.at(0)), ", ", Integer(lValues.at(1)), ", ", Integer(lValues.at(2)), ", ", Integer(lValues.at(3)), "): ", PacketFmt((const uint8_t*)lValues.data(), 4 * lValues.size()));
 
   mNumberOfPages = lValues.at(0);
   mPageSize = std::min(uint32_t(4096), lValues.at(1));
@@ -407,16 +513,35 @@ void Mmap::disconnect()
 
 void Mmap::write(const std::shared_ptr<Buffers>& aBuffers)
 {
-  log (Info(), "mmap client ", Quote(id()), " (URI: ", Quote(uri()), ") : writing ", Integer(aBuffers->sendCounter() / 4), "-word packet to page ", Integer(mIndexNextPage), " in ", Quote(mDeviceFile.getPath()));
+  // Device is locked from the first request of each dispatch until all replies have been read (in Flush), so that
+  // the page ring is never shared between clients (in this or other processes) mid-dispatch
+  if (not mDeviceFile.haveLock()) {
+    mDeviceFile.lock();
+
+    // Other clients may have sent packets since this client last held the lock, so must re-read status info
+    std::vector<uint32_t> lValues;
+    mDeviceFile.read(0x0, 4, lValues);
+    mIndexNextPage = lValues.at(2);
+    mPublishedReplyPageCount = lValues.at(3);
+    mReadReplyPageCount = mPublishedReplyPageCount;
+
+    if (mIndexNextPage >= mNumberOfPages) {
+      exception::MmapCommunicationError lExc;
+      log (lExc, "Next page index, ", Integer(mIndexNextPage), ", reported in device file ", Quote(mDeviceFile.getPath()), " is inconsistent with number of pages, ", Integer(mNumberOfPages));
+      throw lExc;
+    }
+  }
 
   const uint32_t lHeaderWord = (0x10000 | (((aBuffers->sendCounter() / 4) - 1) & 0xFFFF));
   std::vector<std::pair<const uint8_t*, size_t> > lDataToWrite;
   lDataToWrite.push_back( std::make_pair(reinterpret_cast<const uint8_t*>(&lHeaderWord), sizeof lHeaderWord) );
   lDataToWrite.push_back( std::make_pair(aBuffers->getSendBuffer(), aBuffers->sendCounter()) );
-  mDeviceFile.write(mIndexNextPage * 4 * mPageSize, lDataToWrite);
-
-  log (Debug(), "Wrote " , Integer((aBuffers->sendCounter() / 4) + 1), " 32-bit words at address " , Integer(mIndexNextPage * 4 * mPageSize), " ... ", PacketFmt(lDataToWrite));
+  mDeviceFile.write(getRequestOffset() + mIndexNextPage * 4 * mPageSize, lDataToWrite);
+  notifyRequestWritten();
+  log (Debug(), "Wrote " , Integer((aBuffers->sendCounter() / 4) + 1), " 32-bit words at address " , Integer(getRequestOffset() + mIndexNextPage * 4 * mPageSize), " ... ", PacketFmt(lDataToWrite));
 
+  mPoller.notifySent();
+  mTrace.recordRequest(mIndexNextPage, aBuffers->sendCounter() / 4);
   mIndexNextPage = (mIndexNextPage + 1) % mNumberOfPages;
   mReplyQueue.push_back(aBuffers);
 }
@@ -425,38 +550,33 @@ void Mmap::write(const std::shared_ptr<Buffers>& aBuffers)
 void Mmap::read()
 {
   const size_t lPageIndexToRead = (mIndexNextPage - mReplyQueue.size() + mNumberOfPages) % mNumberOfPages;
-  SteadyClock_t::time_point lStartTime = SteadyClock_t::now();
 
   if (mReadReplyPageCount == mPublishedReplyPageCount)
   {
     uint32_t lHwPublishedPageCount = 0x0;
+    std::vector<uint32_t> lValues;
 
-    while ( true ) {
-      std::vector<uint32_t> lValues;
+    const bool lReady = mPoller.wait([&] () {
+      lValues.clear();
       // FIXME : Improve by simply adding dmaWrite method that takes uint32_t ref as argument (or returns uint32_t)
       mDeviceFile.read(0, 4, lValues);
       lHwPublishedPageCount = lValues.at(3);
-      log (Info(), "Read status info from addr 0 (", Integer(lValues.at(0)), ", ", Integer(lValues.at(1)), ", ", Integer(lValues.at(2)), ", ", Integer(lValues.at(3)), "): ", PacketFmt((const uint8_t*)lValues.data(), 4 * lValues.size()));
-
-      if (lHwPublishedPageCount != mPublishedReplyPageCount) {
-        mPublishedReplyPageCount = lHwPublishedPageCount;
-        break;
-      }
+      log (Debug(), "Read status info from addr 0 (", Integer(lValues.at(0)), ", ", Integer(lValues.at(1)), ", ", Integer(lValues.at(2)), ", ", Integer(lValues.at(3)), "): ", PacketFmt((const uint8_t*)lValues.data(), 4 * lValues.size()));
       // FIXME: Throw if published page count is invalid number
-
-      if (SteadyClock_t::now() - lStartTime > std::chrono::microseconds(getBoostTimeoutPeriod().total_microseconds())) {
-        exception::MmapTimeout lExc;
-        log(lExc, "Next page (index ", Integer(lPageIndexToRead), " count ", Integer(mPublishedReplyPageCount+1), ") of mmap device '" + mDeviceFile.getPath() + "' is not ready after timeout period");
-        throw lExc;
-      }
-
-      log(Debug(), "mmap client ", Quote(id()), " (URI: ", Quote(uri()), ") : Trying to read page index ", Integer(lPageIndexToRead), " = count ", Integer(mReadReplyPageCount+1), "; published page count is ", Integer(lHwPublishedPageCount), "; sleeping for ", mSleepDuration.count(), "us");
-      if (mSleepDuration > std::chrono::microseconds(0))
-        std::this_thread::sleep_for( mSleepDuration );
+      return (lHwPublishedPageCount != mPublishedReplyPageCount);
+    }, std::chrono::microseconds(getBoostTimeoutPeriod().total_microseconds()));
+
+    if (not lReady) {
+      exception::MmapTimeout lExc;
+      log(lExc, "Next page (index ", Integer(lPageIndexToRead), " count ", Integer(mPublishedReplyPageCount+1), ") of mmap device '" + mDeviceFile.getPath() + "' is not ready after timeout period");
+      log(Error(), "Extra timeout-related info - ", mPoller, "; ", mTrace);
+      throw lExc;
     }
 
-    log(Info(), "mmap client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (published count ", Integer(lHwPublishedPageCount), ", surpasses required, ", Integer(mReadReplyPageCount + 1), ")");
+    mPublishedReplyPageCount = lHwPublishedPageCount;
   }
+  else
+    mPoller.notifyReady();
   mReadReplyPageCount++;
   
   // PART 1 : Read the page
@@ -475,6 +595,7 @@ void Mmap::read()
   size_t lNrWordsInPacket = (lPageContents.at(0) >> 16) + (lPageContents.at(0) & 0xFFFF);
   if (lNrWordsInPacket != (lBuffers->replyCounter() >> 2))
     log (Warning(), "Expected reply packet to contain ", Integer(lBuffers->replyCounter() >> 2), " words, but it actually contains ", Integer(lNrWordsInPacket), " words");
+  mTrace.recordReply(lPageIndexToRead, lNrWordsInPacket, mPoller.getLastPollsPerPacket());
 
   size_t lNrBytesCopied = 0;
   for (const auto& lBuffers: lReplyBuffers)
@@ -511,4 +632,169 @@ void Mmap::read()
 }
 
 
+void Mmap::dispatchUnbufferedTransactions()
+{
+  if (mDirectTransactionQueue.empty())
+    return;
+
+  if ( ! mConnected )
+    connect();
+
+  log(Debug(), "mmap client (URI: ", Quote(uri()), ") : performing ", Integer(mDirectTransactionQueue.size()), " direct access transactions");
+
+  SigBusGuard lGuard;
+  lGuard.protect([&]{
+    for (const auto& lTransaction: mDirectTransactionQueue) {
+      volatile uint32_t* lPtr = mDeviceFile.getWordPtr(lTransaction.address);
+
+      switch (lTransaction.type) {
+        case B_O_T:
+          break;
+        case READ:
+          for (size_t i = 0; i < lTransaction.nrWords; i++)
+            lTransaction.replyPtr[i] = lPtr[i];
+          break;
+        case NI_READ:
+          for (size_t i = 0; i < lTransaction.nrWords; i++)
+            lTransaction.replyPtr[i] = *lPtr;
+          break;
+        case WRITE:
+          for (size_t i = 0; i < lTransaction.nrWords; i++)
+            lPtr[i] = lTransaction.writeValues[i];
+          break;
+        case NI_WRITE:
+          for (size_t i = 0; i < lTransaction.nrWords; i++)
+            *lPtr = lTransaction.writeValues[i];
+          break;
+        case RMW_BITS:
+          *lTransaction.replyPtr = *lPtr;
+          *lPtr = (*lTransaction.replyPtr & lTransaction.terms[0]) | lTransaction.terms[1];
+          break;
+        case RMW_SUM:
+          *lTransaction.replyPtr = *lPtr;
+          *lPtr = *lTransaction.replyPtr + lTransaction.terms[0];
+          break;
+        default:
+          break;
+      }
+    }
+  }, "SIGBUS received during direct access transactions in " + mDeviceFile.getPath());
+
+  for (auto& lTransaction: mDirectTransactionQueue)
+    lTransaction.reply.valid(true);
+  mDirectTransactionQueue.clear();
+}
+
+
+void Mmap::checkDirectAccessRange(const uint32_t aAddr, const uint32_t aNrWords) const
+{
+  if ((4 * (size_t(aAddr) + aNrWords)) > mDeviceFile.getMapSize()) {
+    exception::MmapCommunicationError lExc;
+    log(lExc, "Direct access to ", Integer(aNrWords), " words at address ", Integer(aAddr, IntFmt<hex,fixed>()), " would extend beyond the end of the ", Integer(mDeviceFile.getMapSize()), " bytes mapped from device file ", Quote(mDeviceFile.getPath()));
+    throw lExc;
+  }
+}
+
+
+ValHeader Mmap::implementBOT()
+{
+  if ( ! mDirectAccess )
+    return InnerProtocol::implementBOT();
+
+  std::pair < ValHeader , _ValHeader_* > lReply ( CreateValHeader() );
+  DirectTransaction lTransaction = { B_O_T, 0, 0, {0, 0}, std::vector<uint32_t>(), NULL, lReply.first };
+  mDirectTransactionQueue.push_back(lTransaction);
+  return lReply.first;
+}
+
+
+ValHeader Mmap::implementWrite ( const uint32_t& aAddr, const uint32_t& aValue )
+{
+  if ( ! mDirectAccess )
+    return InnerProtocol::implementWrite(aAddr, aValue);
+
+  checkDirectAccessRange(aAddr, 1);
+  std::pair < ValHeader , _ValHeader_* > lReply ( CreateValHeader() );
+  DirectTransaction lTransaction = { WRITE, aAddr, 1, {0, 0}, std::vector<uint32_t>(1, aValue), NULL, lReply.first };
+  mDirectTransactionQueue.push_back(lTransaction);
+  return lReply.first;
+}
+
+
+ValHeader Mmap::implementWriteBlock ( const uint32_t& aAddr, const std::vector< uint32_t >& aValues, const defs::BlockReadWriteMode& aMode )
+{
+  if ( ! mDirectAccess )
+    return InnerProtocol::implementWriteBlock(aAddr, aValues, aMode);
+
+  checkDirectAccessRange(aAddr, (aMode == defs::INCREMENTAL) ? aValues.size() : 1);
+  std::pair < ValHeader , _ValHeader_* > lReply ( CreateValHeader() );
+  DirectTransaction lTransaction = { (aMode == defs::INCREMENTAL) ? WRITE : NI_WRITE, aAddr, uint32_t(aValues.size()), {0, 0}, aValues, NULL, lReply.first };
+  mDirectTransactionQueue.push_back(lTransaction);
+  return lReply.first;
+}
+
+
+ValWord< uint32_t > Mmap::implementRead ( const uint32_t& aAddr, const uint32_t& aMask )
+{
+  if ( ! mDirectAccess )
+    return InnerProtocol::implementRead(aAddr, aMask);
+
+  checkDirectAccessRange(aAddr, 1);
+  std::pair < ValWord<uint32_t> , _ValWord_<uint32_t>* > lReply ( CreateValWord ( 0 , aMask ) );
+  DirectTransaction lTransaction = { READ, aAddr, 1, {0, 0}, std::vector<uint32_t>(), &lReply.second->value, ValHeader(lReply.first) };
+  mDirectTransactionQueue.push_back(lTransaction);
+  return lReply.first;
+}
+
+
+ValVector< uint32_t > Mmap::implementReadBlock ( const uint32_t& aAddr, const uint32_t& aSize, const defs::BlockReadWriteMode& aMode )
+{
+  if ( ! mDirectAccess )
+    return InnerProtocol::implementReadBlock(aAddr, aSize, aMode);
+
+  checkDirectAccessRange(aAddr, (aMode == defs::INCREMENTAL) ? aSize : 1);
+  std::pair < ValVector<uint32_t> , _ValVector_<uint32_t>* > lReply ( CreateValVector ( aSize ) );
+  DirectTransaction lTransaction = { (aMode == defs::INCREMENTAL) ? READ : NI_READ, aAddr, aSize, {0, 0}, std::vector<uint32_t>(), lReply.second->value.data(), ValHeader(lReply.first) };
+  mDirectTransactionQueue.push_back(lTransaction);
+  return lReply.first;
+}
+
+
+ValWord< uint32_t > Mmap::implementReadConfigurationSpace ( const uint32_t& aAddr, const uint32_t& aMask )
+{
+  if ( ! mDirectAccess )
+    return InnerProtocol::implementReadConfigurationSpace(aAddr, aMask);
+
+  exception::MmapDirectAccessUnsupported lExc;
+  log(lExc, "Configuration space reads are not supported by mmap client with URI ", Quote(uri()), " in direct access mode");
+  throw lExc;
+}
+
+
+ValWord< uint32_t > Mmap::implementRMWbits ( const uint32_t& aAddr , const uint32_t& aANDterm , const uint32_t& aORterm )
+{
+  if ( ! mDirectAccess )
+    return InnerProtocol::implementRMWbits(aAddr, aANDterm, aORterm);
+
+  checkDirectAccessRange(aAddr, 1);
+  std::pair < ValWord<uint32_t> , _ValWord_<uint32_t>* > lReply ( CreateValWord ( 0 ) );
+  DirectTransaction lTransaction = { RMW_BITS, aAddr, 1, {aANDterm, aORterm}, std::vector<uint32_t>(), &lReply.second->value, ValHeader(lReply.first) };
+  mDirectTransactionQueue.push_back(lTransaction);
+  return lReply.first;
+}
+
+
+ValWord< uint32_t > Mmap::implementRMWsum ( const uint32_t& aAddr , const int32_t& aAddend )
+{
+  if ( ! mDirectAccess )
+    return InnerProtocol::implementRMWsum(aAddr, aAddend);
+
+  checkDirectAccessRange(aAddr, 1);
+  std::pair < ValWord<uint32_t> , _ValWord_<uint32_t>* > lReply ( CreateValWord ( 0 ) );
+  DirectTransaction lTransaction = { RMW_SUM, aAddr, 1, {static_cast<uint32_t>(aAddend), 0}, std::vector<uint32_t>(), &lReply.second->value, ValHeader(lReply.first) };
+  mDirectTransactionQueue.push_back(lTransaction);
+  return lReply.first;
+}
+
+
 } // end ns uhal
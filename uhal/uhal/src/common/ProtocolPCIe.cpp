@@ -476,6 +476,8 @@ PCIe::PCIe ( const std::string& aId, const URI& aUri ) :
   mIPCMutex(getSharedMemName(mDeviceFileHostToFPGA.getPath())),
   mXdma7seriesWorkaround(false),
   mUseInterrupt(false),
+  mPoller(std::chrono::microseconds(50)),
+  mTrace(0),
   mNumberOfPages(0),
   mMaxInFlight(0),
   mPageSize(0),
@@ -495,8 +497,6 @@ PCIe::PCIe ( const std::string& aId, const URI& aUri ) :
     throw lExc;
   }
 
-  mSleepDuration = std::chrono::microseconds(mUseInterrupt ? 0 : 50);
-
   for (const auto& lArg: aUri.mArguments) {
     if (lArg.first == "events") {
       if (mUseInterrupt) {
@@ -510,8 +510,21 @@ PCIe::PCIe ( const std::string& aId, const URI& aUri ) :
       log (Info() , "PCIe client with URI ", Quote (uri()), " is configured to use interrupts");
     }
     else if (lArg.first == "sleep") {
-      mSleepDuration = std::chrono::microseconds(boost::lexical_cast<size_t>(lArg.second));
-      log (Notice() , "PCIe client with URI ", Quote (uri()), " : Inter-poll-/-interrupt sleep duration set to ", boost::lexical_cast<size_t>(lArg.second), " us by URI 'sleep' attribute");
+      mPoller.setMaxSleep(std::chrono::microseconds(boost::lexical_cast<size_t>(lArg.second)));
+      log (Notice() , "PCIe client with URI ", Quote (uri()), " : Maximum inter-poll-/-interrupt sleep duration set to ", boost::lexical_cast<size_t>(lArg.second), " us by URI 'sleep' attribute");
+    }
+    else if (lArg.first == "trace") {
+      mTrace.setDepth(boost::lexical_cast<size_t>(lArg.second));
+      log (Notice() , "PCIe client with URI ", Quote (uri()), " : Recording last ", Integer(mTrace.getDepth()), " transfers in packet trace");
+    }
+    else if (lArg.first == "polling") {
+      if ((lArg.second != "adaptive") and (lArg.second != "fixed")) {
+        exception::PCIeInitialisationError lExc;
+        log(lExc, "PCIe client URI ", Quote(uri()), ": Invalid value, ", Quote(lArg.second), ", for 'polling' attribute (allowed values: 'adaptive', 'fixed')");
+        throw lExc;
+      }
+      mPoller.setAdaptive(lArg.second == "adaptive");
+      log (Notice() , "PCIe client with URI ", Quote (uri()), " : Using ", lArg.second, " polling policy");
     }
     else if (lArg.first == "max_in_flight") {
       mMaxInFlight = boost::lexical_cast<size_t>(lArg.second);
@@ -537,6 +550,18 @@ PCIe::~PCIe()
 }
 
 
+const AdaptivePoller& PCIe::getReplyPoller() const
+{
+  return mPoller;
+}
+
+
+const PacketTrace& PCIe::getPacketTrace() const
+{
+  return mTrace;
+}
+
+
 void PCIe::implementDispatch ( std::shared_ptr< Buffers > aBuffers )
 {
   log(Debug(), "PCIe client (URI: ", Quote(uri()), ") : implementDispatch method called");
@@ -568,6 +593,7 @@ void PCIe::dispatchExceptionHandler()
   log(Notice(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : closing device files since exception detected");
 
   ClientInterface::returnBufferToPool ( mReplyQueue );
+  mPoller.reset();
 
   mDeviceFileHostToFPGA.unlock();
 
@@ -678,8 +704,6 @@ void PCIe::write(const std::shared_ptr<Buffers>& aBuffers)
     }
   }
 
-  log (Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : writing ", Integer(aBuffers->sendCounter() / 4), "-word packet to page ", Integer(mIndexNextPage), " in ", Quote(mDeviceFileHostToFPGA.getPath()));
-
   const uint32_t lHeaderWord = (0x10000 | (((aBuffers->sendCounter() / 4) - 1) & 0xFFFF));
   std::vector<std::pair<const uint8_t*, size_t> > lDataToWrite;
   lDataToWrite.push_back( std::make_pair(reinterpret_cast<const uint8_t*>(&lHeaderWord), sizeof lHeaderWord) );
@@ -689,6 +713,8 @@ void PCIe::write(const std::shared_ptr<Buffers>& aBuffers)
   mDeviceFileHostToFPGA.write(mIndexNextPage * 4 * mPageSize, lDataToWrite);
   log (Debug(), "Wrote " , Integer((aBuffers->sendCounter() / 4) + 1), " 32-bit words at address " , Integer(mIndexNextPage * 4 * mPageSize), " ... ", PacketFmt(lDataToWrite));
 
+  mPoller.notifySent();
+  mTrace.recordRequest(mIndexNextPage, aBuffers->sendCounter() / 4);
   mIndexNextPage = (mIndexNextPage + 1) % mNumberOfPages;
   mReplyQueue.push_back(aBuffers);
 }
@@ -697,68 +723,58 @@ void PCIe::write(const std::shared_ptr<Buffers>& aBuffers)
 void PCIe::read()
 {
   const size_t lPageIndexToRead = (mIndexNextPage - mReplyQueue.size() + mNumberOfPages) % mNumberOfPages;
-  SteadyClock_t::time_point lStartTime = SteadyClock_t::now();
 
   if (mReadReplyPageCount == mPublishedReplyPageCount)
   {
+    const std::chrono::microseconds lTimeout(getBoostTimeoutPeriod().total_microseconds());
+
     if (mUseInterrupt)
     {
       std::vector<uint32_t> lRxEvent;
       // wait for interrupt; read events file node to see if user interrupt has come
-      while (true) {
-        mDeviceFileFPGAEvent.read(0, 1, lRxEvent);
-        if (lRxEvent.at(0) == 1) {
-          break;
-        }
+      const bool lReady = mPoller.wait([&] () {
         lRxEvent.clear();
+        mDeviceFileFPGAEvent.read(0, 1, lRxEvent);
+        return (lRxEvent.at(0) == 1);
+      }, lTimeout);
 
-        if (SteadyClock_t::now() - lStartTime > std::chrono::microseconds(getBoostTimeoutPeriod().total_microseconds())) {
-          exception::PCIeTimeout lExc;
-          log(lExc, "Next page (index ", Integer(lPageIndexToRead), " count ", Integer(mPublishedReplyPageCount+1), ") of PCIe device '" + mDeviceFileHostToFPGA.getPath() + "' is not ready after timeout period");
-          throw lExc;
-        }
-
-        log(Debug(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Waiting for interrupt; sleeping for ", mSleepDuration.count(), "us");
-        if (mSleepDuration > std::chrono::microseconds(0))
-          std::this_thread::sleep_for( mSleepDuration );
-
-      } // end of while (true)
+      if (not lReady) {
+        exception::PCIeTimeout lExc;
+        log(lExc, "Next page (index ", Integer(lPageIndexToRead), " count ", Integer(mPublishedReplyPageCount+1), ") of PCIe device '" + mDeviceFileHostToFPGA.getPath() + "' is not ready after timeout period");
+        log(Error(), "Extra timeout-related info - ", mPoller, "; ", mTrace);
+        throw lExc;
+      }
 
-      log(Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (interrupt received)");
+      mTrace.recordInterrupt(lPageIndexToRead);
     }
     else
     {
       uint32_t lHwPublishedPageCount = 0x0;
 
       std::vector<uint32_t> lValues;
-      while ( true ) {
+      const bool lReady = mPoller.wait([&] () {
+        lValues.clear();
         // FIXME : Improve by simply adding fileWrite method that takes uint32_t ref as argument (or returns uint32_t)
         IPCScopedLock_t lGuard(*mIPCMutex);
         mDeviceFileFPGAToHost.read(0, (mXdma7seriesWorkaround ? 8 : 4), lValues);
         lHwPublishedPageCount = lValues.at(3);
         log (Debug(), "Read status info from addr 0 (", Integer(lValues.at(0)), ", ", Integer(lValues.at(1)), ", ", Integer(lValues.at(2)), ", ", Integer(lValues.at(3)), "): ", PacketFmt((const uint8_t*)lValues.data(), 4 * lValues.size()));
-
-        if (lHwPublishedPageCount != mPublishedReplyPageCount) {
-          mPublishedReplyPageCount = lHwPublishedPageCount;
-          break;
-        }
         // FIXME: Throw if published page count is invalid number
+        return (lHwPublishedPageCount != mPublishedReplyPageCount);
+      }, lTimeout);
 
-        if (SteadyClock_t::now() - lStartTime > std::chrono::microseconds(getBoostTimeoutPeriod().total_microseconds())) {
-          exception::PCIeTimeout lExc;
-          log(lExc, "Next page (index ", Integer(lPageIndexToRead), " count ", Integer(mPublishedReplyPageCount+1), ") of PCIe device '" + mDeviceFileHostToFPGA.getPath() + "' is not ready after timeout period");
-          throw lExc;
-        }
-
-        log(Debug(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Trying to read page index ", Integer(lPageIndexToRead), " = count ", Integer(mReadReplyPageCount+1), "; published page count is ", Integer(lHwPublishedPageCount), "; sleeping for ", mSleepDuration.count(), "us");
-        if (mSleepDuration > std::chrono::microseconds(0))
-          std::this_thread::sleep_for( mSleepDuration );
-        lValues.clear();
+      if (not lReady) {
+        exception::PCIeTimeout lExc;
+        log(lExc, "Next page (index ", Integer(lPageIndexToRead), " count ", Integer(mPublishedReplyPageCount+1), ") of PCIe device '" + mDeviceFileHostToFPGA.getPath() + "' is not ready after timeout period");
+        log(Error(), "Extra timeout-related info - ", mPoller, "; ", mTrace);
+        throw lExc;
       }
 
-      log(Info(), "PCIe client ", Quote(id()), " (URI: ", Quote(uri()), ") : Reading page ", Integer(lPageIndexToRead), " (published count ", Integer(lHwPublishedPageCount), ", surpasses required, ", Integer(mReadReplyPageCount + 1), ")");
+      mPublishedReplyPageCount = lHwPublishedPageCount;
     }
   }
+  else
+    mPoller.notifyReady();
   mReadReplyPageCount++;
   
   // PART 1 : Read the page
@@ -781,6 +797,7 @@ void PCIe::read()
   size_t lNrWordsInPacket = (lPageContents.at(0) >> 16) + (lPageContents.at(0) & 0xFFFF);
   if (lNrWordsInPacket != (lBuffers->replyCounter() >> 2))
     log (Warning(), "Expected reply packet to contain ", Integer(lBuffers->replyCounter() >> 2), " words, but it actually contains ", Integer(lNrWordsInPacket), " words");
+  mTrace.recordReply(lPageIndexToRead, lNrWordsInPacket, mPoller.getLastPollsPerPacket());
 
   size_t lNrBytesCopied = 0;
   for (const auto& lBuffer: lReplyBuffers)
@@ -73,7 +73,8 @@ namespace uhal
     mPacketsInFlight ( 0 ),
     mFlushStarted ( false ),
     mFlushDone ( true ),
-    mAsynchronousException ( NULL )
+    mAsynchronousException ( NULL ),
+    mTimeoutInfoRateLimit ( 4 )
   {
     mDeadlineTimer.async_wait ([this] (const boost::system::error_code&) { this->CheckDeadline(); });
 
@@ -124,7 +125,7 @@ namespace uhal
 
     if ( mAsynchronousException )
     {
-      log ( *mAsynchronousException , "Rethrowing Asynchronous Exception from 'implementDispatch' method of " , Type<TCP< InnerProtocol , nr_buffers_per_send > >() );
+      log ( mLogRateLimits [ RETHROW_LOG ] , *mAsynchronousException , "Rethrowing Asynchronous Exception from 'implementDispatch' method of " , Type<TCP< InnerProtocol , nr_buffers_per_send > >() );
       mAsynchronousException->throwAsDerivedType();
     }
 
@@ -259,12 +260,12 @@ namespace uhal
     if ( mDeadlineTimer.expires_at () == boost::posix_time::pos_infin )
     {
       mAsynchronousException = new exception::TcpTimeout();
-      log ( *mAsynchronousException , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for send to ",
+      log ( mLogRateLimits [ SEND_TIMEOUT_LOG ] , *mAsynchronousException , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for send to ",
             ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) , " with URI: ", this->uri() );
 
       if ( aErrorCode && aErrorCode != boost::asio::error::operation_aborted )
       {
-        log ( *mAsynchronousException , "ASIO reported an error: " , Quote ( aErrorCode.message() ) );
+        log ( mLogRateLimits [ SEND_TIMEOUT_ERROR_LOG ] , *mAsynchronousException , "ASIO reported an error: " , Quote ( aErrorCode.message() ) );
       }
 
       NotifyConditionalVariable ( true );
@@ -274,7 +275,7 @@ namespace uhal
     if ( ( aErrorCode && ( aErrorCode != boost::asio::error::eof ) ) || ( aBytesTransferred != ( mSendByteCounter+4 ) ) )
     {
       mAsynchronousException = new exception::ASIOTcpError();
-      log ( *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during send to ",
+      log ( mLogRateLimits [ SEND_ERROR_LOG ] , *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during send to ",
             ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) , " with URI: " , this->uri() );
 
       try
@@ -286,12 +287,12 @@ namespace uhal
       }
       catch ( const std::exception& aExc )
       {
-        log ( *mAsynchronousException , "Error closing TCP socket following the ASIO send error" );
+        log ( mLogRateLimits [ SEND_CLOSE_ERROR_LOG ] , *mAsynchronousException , "Error closing TCP socket following the ASIO send error" );
       }
 
       if ( aBytesTransferred != ( mSendByteCounter + 4 ) )
       {
-        log ( *mAsynchronousException , "Attempted to send " , Integer ( mSendByteCounter ) , " bytes to ",
+        log ( mLogRateLimits [ SHORT_SEND_LOG ] , *mAsynchronousException , "Attempted to send " , Integer ( mSendByteCounter ) , " bytes to ",
              ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) ,
              " with URI "  , Quote ( this->uri() ) , ", but only sent " , Integer ( aBytesTransferred ) , " bytes" );
       }
@@ -374,21 +375,21 @@ namespace uhal
       if ( mDeadlineTimer.expires_at () == boost::posix_time::pos_infin )
       {
         exception::TcpTimeout* lExc = new exception::TcpTimeout();
-        log ( *lExc , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " ms) occurred for receive (header) from ",
+        log ( mLogRateLimits [ HEADER_TIMEOUT_LOG ] , *lExc , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " ms) occurred for receive (header) from ",
               ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) , " with URI '", this->uri(), "'. ",
               Integer(mPacketsInFlight), " packets in flight, ", Integer(mReplyBuffers.first.size()), " in this chunk (",
               Integer(lRequestBytes), "/", Integer(lExpectedReplyBytes), " bytes sent/expected). Last send / receive queued ",
               std::chrono::duration<float, std::milli>(lNow - mLastSendQueued).count(), " / ",
               std::chrono::duration<float, std::milli>(lNow - mLastRecvQueued).count(), " ms ago.");
 
-        log ( Error(), "Extra timeout-related info - round-trip times: ", mRTTStats);
-        log ( Error(), "Extra timeout-related info - send-recv  times: ", mLSTStats);
-        log ( Error(), "Extra timeout-related info - inter-send times: ", mInterSendTimeStats);
-        log ( Error(), "Extra timeout-related info - inter-recv times: ", mInterRecvTimeStats);
+        log ( mTimeoutInfoRateLimit , Error(), "Extra timeout-related info - round-trip times: ", mRTTStats);
+        log ( mTimeoutInfoRateLimit , Error(), "Extra timeout-related info - send-recv  times: ", mLSTStats);
+        log ( mTimeoutInfoRateLimit , Error(), "Extra timeout-related info - inter-send times: ", mInterSendTimeStats);
+        log ( mTimeoutInfoRateLimit , Error(), "Extra timeout-related info - inter-recv times: ", mInterRecvTimeStats);
 
         if ( aErrorCode && aErrorCode != boost::asio::error::operation_aborted )
         {
-          log ( *lExc , "ASIO reported an error: " , Quote ( aErrorCode.message() ) );
+          log ( mLogRateLimits [ HEADER_TIMEOUT_ERROR_LOG ] , *lExc , "ASIO reported an error: " , Quote ( aErrorCode.message() ) );
         }
 
         mAsynchronousException = lExc;
@@ -404,13 +405,13 @@ namespace uhal
 
       if ( aErrorCode )
       {
-        log ( *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during receive from ",
+        log ( mLogRateLimits [ HEADER_RECEIVE_ERROR_LOG ] , *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during receive from ",
               ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) , " with URI: " , this->uri() );
       }
 
       if ( aBytesTransferred != 4 )
       {
-        log ( *mAsynchronousException, "Expected to receive 4-byte header in async read from ",
+        log ( mLogRateLimits [ SHORT_HEADER_LOG ] , *mAsynchronousException, "Expected to receive 4-byte header in async read from ",
              ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) ,
              " with URI "  , Quote ( this->uri() ) , ", but only received " , Integer ( aBytesTransferred ) , " bytes" );
       }
@@ -423,7 +424,7 @@ namespace uhal
       }
       catch ( const std::exception& aExc )
       {
-        log ( *mAsynchronousException , "Error closing socket following ASIO read error" );
+        log ( mLogRateLimits [ RECEIVE_CLOSE_ERROR_LOG ] , *mAsynchronousException , "Error closing socket following ASIO read error" );
       }
 
       NotifyConditionalVariable ( true );
@@ -462,19 +463,19 @@ namespace uhal
       if ( mDeadlineTimer.expires_at () == boost::posix_time::pos_infin )
       {
         mAsynchronousException = new exception::TcpTimeout();
-        log ( *mAsynchronousException , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for receive (chunk) from ",
+        log ( mLogRateLimits [ CHUNK_TIMEOUT_LOG ] , *mAsynchronousException , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for receive (chunk) from ",
               ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) , " with URI: ", this->uri() );
       }
       else
       {
         mAsynchronousException = new exception::ASIOTcpError();
-        log ( *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during receive from ",
+        log ( mLogRateLimits [ CHUNK_RECEIVE_ERROR_LOG ] , *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during receive from ",
               ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) , " with URI: " , this->uri() );
       }
 
       if ( lBytesTransferred != mReplyByteCounter )
       {
-        log ( *mAsynchronousException, "Expected to receive " , Integer ( mReplyByteCounter ) , " bytes in read from ",
+        log ( mLogRateLimits [ SHORT_CHUNK_LOG ] , *mAsynchronousException, "Expected to receive " , Integer ( mReplyByteCounter ) , " bytes in read from ",
              ( this->uri().find ( "chtcp-" ) == 0 ? "ControlHub" : "TCP server" ) ,
              " with URI "  , Quote ( this->uri() ) , ", but only received " , Integer ( lBytesTransferred ) , " bytes" );
       }
@@ -124,7 +124,7 @@ namespace uhal
 
     if ( mAsynchronousException )
     {
-      log ( *mAsynchronousException , "Rethrowing Asynchronous Exception from 'implementDispatch' method of " , Type<UDP< InnerProtocol > >() );
+      log ( mLogRateLimits [ RETHROW_LOG ] , *mAsynchronousException , "Rethrowing Asynchronous Exception from 'implementDispatch' method of " , Type<UDP< InnerProtocol > >() );
       mAsynchronousException->throwAsDerivedType();
     }
 
@@ -214,11 +214,11 @@ namespace uhal
     if ( mDeadlineTimer.expires_at () == boost::posix_time::pos_infin )
     {
       exception::UdpTimeout* lExc = new exception::UdpTimeout();
-      log ( *lExc , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for UDP send to target with URI: ", this->uri() );
+      log ( mLogRateLimits [ SEND_TIMEOUT_LOG ] , *lExc , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for UDP send to target with URI: ", this->uri() );
 
       if ( aErrorCode && aErrorCode != boost::asio::error::operation_aborted )
       {
-        log ( *lExc , "ASIO reported an error: " , Quote ( aErrorCode.message() ) );
+        log ( mLogRateLimits [ SEND_TIMEOUT_ERROR_LOG ] , *lExc , "ASIO reported an error: " , Quote ( aErrorCode.message() ) );
       }
 
       mAsynchronousException = lExc;
@@ -232,11 +232,11 @@ namespace uhal
       exception::ASIOUdpError* lExc = new exception::ASIOUdpError();
       if ( aErrorCode )
       {
-        log ( *lExc , "Error ", Quote ( aErrorCode.message() ) , " encountered during send to UDP target with URI: " , this->uri() );
+        log ( mLogRateLimits [ SEND_ERROR_LOG ] , *lExc , "Error ", Quote ( aErrorCode.message() ) , " encountered during send to UDP target with URI: " , this->uri() );
       }
       if ( aBytesTransferred != mDispatchBuffers->sendCounter() )
       {
-        log ( *lExc , "Only ", Integer ( aBytesTransferred ) , " of " , Integer ( mDispatchBuffers->sendCounter() ) , " bytes transferred in UDP send to URI: " , this->uri() );
+        log ( mLogRateLimits [ SHORT_SEND_LOG ] , *lExc , "Only ", Integer ( aBytesTransferred ) , " of " , Integer ( mDispatchBuffers->sendCounter() ) , " bytes transferred in UDP send to URI: " , this->uri() );
       }
       mAsynchronousException = lExc;
       NotifyConditionalVariable ( true );
@@ -305,11 +305,11 @@ namespace uhal
       if ( mDeadlineTimer.expires_at () == boost::posix_time::pos_infin )
       {
         mAsynchronousException = new exception::UdpTimeout();
-        log ( *mAsynchronousException , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for UDP receive from target with URI: ", this->uri() );
+        log ( mLogRateLimits [ RECEIVE_TIMEOUT_LOG ] , *mAsynchronousException , "Timeout (" , Integer ( this->getBoostTimeoutPeriod().total_milliseconds() ) , " milliseconds) occurred for UDP receive from target with URI: ", this->uri() );
 
         if ( aErrorCode && aErrorCode != boost::asio::error::operation_aborted )
         {
-          log ( *mAsynchronousException , "ASIO reported an error: " , Quote ( aErrorCode.message() ) );
+          log ( mLogRateLimits [ RECEIVE_TIMEOUT_ERROR_LOG ] , *mAsynchronousException , "ASIO reported an error: " , Quote ( aErrorCode.message() ) );
         }
 
         NotifyConditionalVariable ( true );
@@ -334,7 +334,7 @@ namespace uhal
 
       std::lock_guard<std::mutex> lLock ( mTransportLayerMutex );
       mAsynchronousException = new exception::ASIOUdpError();
-      log ( *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during receive from UDP target with URI: " , this->uri() );
+      log ( mLogRateLimits [ RECEIVE_ERROR_LOG ] , *mAsynchronousException , "Error ", Quote ( aErrorCode.message() ) , " encountered during receive from UDP target with URI: " , this->uri() );
 
       NotifyConditionalVariable ( true );
       return;
@@ -0,0 +1,179 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/RegisterDescriptor.hpp"
+
+
+#include <string.h>
+
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <boost/filesystem/path.hpp>
+
+#include "uhal/log/log.hpp"
+#include "uhal/log/log_inserters.integer.hpp"
+#include "uhal/log/log_inserters.quote.hpp"
+#include "uhal/Node.hpp"
+
+
+namespace uhal
+{
+
+  namespace
+  {
+    typedef std::pair< const RegisterDescriptor* const* , const RegisterDescriptor* const* > DescriptorRange_t;
+
+    //! Descriptors registered by generated headers, indexed by the name of the address file that they were generated from
+    struct DescriptorRegistry
+    {
+      std::mutex mutex;
+      std::map< std::string , std::vector< DescriptorRange_t > > descriptors;
+    };
+
+    DescriptorRegistry& getDescriptorRegistry()
+    {
+      // Never destroyed, since headers can register descriptors during static initialisation and HwInterfaces may outlive other static objects
+      static DescriptorRegistry* lRegistry = new DescriptorRegistry();
+      return *lRegistry;
+    }
+
+    bool operator== ( const RegisterDescriptor& aLhs , const RegisterDescriptor& aRhs )
+    {
+      return ( strcmp ( aLhs.path , aRhs.path ) == 0 ) and ( aLhs.address == aRhs.address ) and ( aLhs.mask == aRhs.mask ) and
+             ( aLhs.permission == aRhs.permission ) and ( aLhs.mode == aRhs.mode ) and ( aLhs.size == aRhs.size );
+    }
+  }
+
+
+  void validateRegisterDescriptors ( const Node& aNode , const RegisterDescriptor* const* aBegin , const RegisterDescriptor* const* aEnd )
+  {
+    size_t lNrMismatches ( 0 );
+
+    for ( const RegisterDescriptor* const* lIt = aBegin; lIt != aEnd; lIt++ )
+    {
+      const RegisterDescriptor& lDescriptor ( **lIt );
+      const Node* lNode ( NULL );
+
+      try
+      {
+        lNode = & aNode.getNode ( lDescriptor.path );
+      }
+      catch ( const exception::NoBranchFoundWithGivenUID& )
+      {
+        log ( Error() , "Register descriptor " , Quote ( lDescriptor.path ) , " does not match any node in the address table" );
+        lNrMismatches++;
+        continue;
+      }
+
+      if ( ( lNode->getAddress() != lDescriptor.address ) or ( lNode->getMask() != lDescriptor.mask ) )
+      {
+        log ( Error() , "Register descriptor " , Quote ( lDescriptor.path ) , " has address " , Integer ( lDescriptor.address , IntFmt<hex,fixed>() ) ,
+              " and mask " , Integer ( lDescriptor.mask , IntFmt<hex,fixed>() ) , ", but node has address " , Integer ( lNode->getAddress() , IntFmt<hex,fixed>() ) ,
+              " and mask " , Integer ( lNode->getMask() , IntFmt<hex,fixed>() ) );
+        lNrMismatches++;
+      }
+      else if ( ( lNode->getPermission() != lDescriptor.permission ) or ( lNode->getMode() != lDescriptor.mode ) or ( lNode->getSize() != lDescriptor.size ) )
+      {
+        log ( Error() , "Register descriptor " , Quote ( lDescriptor.path ) , " has permission " , Integer ( uint32_t ( lDescriptor.permission ) ) , ", mode " , Integer ( uint32_t ( lDescriptor.mode ) ) ,
+              " and size " , Integer ( lDescriptor.size ) , ", but node has permission " , Integer ( uint32_t ( lNode->getPermission() ) ) , ", mode " , Integer ( uint32_t ( lNode->getMode() ) ) ,
+              " and size " , Integer ( lNode->getSize() ) );
+        lNrMismatches++;
+      }
+    }
+
+    if ( lNrMismatches > 0 )
+    {
+      exception::RegisterDescriptorMismatch lExc;
+      log ( lExc , Integer ( lNrMismatches ) , " of " , Integer ( size_t ( aEnd - aBegin ) ) , " register descriptors do not match the address table of node " , Quote ( aNode.getPath() ) ,
+            "; the register header should be regenerated from the current address table" );
+      throw lExc;
+    }
+  }
+
+
+  void registerRegisterDescriptors ( const std::string& aAddressFile , const RegisterDescriptor* const* aBegin , const RegisterDescriptor* const* aEnd )
+  {
+    DescriptorRegistry& lRegistry ( getDescriptorRegistry() );
+    std::lock_guard< std::mutex > lLock ( lRegistry.mutex );
+    std::vector< DescriptorRange_t >& lRanges ( lRegistry.descriptors [ aAddressFile ] );
+
+    // Each translation unit that includes a generated header registers its own copy of the descriptors, so identical copies are skipped
+    for ( const DescriptorRange_t& lRange : lRanges )
+    {
+      if ( ( lRange.second - lRange.first == aEnd - aBegin ) and std::equal ( aBegin , aEnd , lRange.first , [] ( const RegisterDescriptor* aLhs , const RegisterDescriptor* aRhs ) { return *aLhs == *aRhs; } ) )
+      {
+        return;
+      }
+    }
+
+    lRanges.push_back ( DescriptorRange_t ( aBegin , aEnd ) );
+  }
+
+
+  namespace detail
+  {
+    void validateRegisteredDescriptors ( const Node& aNode )
+    {
+      std::vector< DescriptorRange_t > lRanges;
+      {
+        DescriptorRegistry& lRegistry ( getDescriptorRegistry() );
+        std::lock_guard< std::mutex > lLock ( lRegistry.mutex );
+
+        if ( lRegistry.descriptors.empty() )
+        {
+          return;
+        }
+
+        std::map< std::string , std::vector< DescriptorRange_t > >::const_iterator lIt ( lRegistry.descriptors.find ( boost::filesystem::path ( aNode.getModule() ).filename().string() ) );
+
+        if ( lIt == lRegistry.descriptors.end() )
+        {
+          return;
+        }
+
+        lRanges = lIt->second;
+      }
+
+      for ( const DescriptorRange_t& lRange : lRanges )
+      {
+        validateRegisterDescriptors ( aNode , lRange.first , lRange.second );
+      }
+    }
+  }
+
+}
@@ -0,0 +1,307 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+
+#include "uhal/detail/AddressFileLoader.hpp"
+
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <thread>
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include "uhal/utilities/files.hpp"
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    AddressFileLoader::AddressFileLoader ( const size_t aThreadCount ) :
+      mThreadCount ( std::max< size_t > ( aThreadCount , 1 ) )
+    {
+    }
+
+
+    AddressFileLoader::~AddressFileLoader()
+    {
+    }
+
+
+    void AddressFileLoader::load ( const pugi::xml_node& aNode , const boost::filesystem::path& aPath , const std::function< bool ( const std::string& ) >& aSkip )
+    {
+      std::vector< std::pair< std::string , boost::filesystem::path > > lModules;
+      {
+        std::vector< std::string > lExpressions;
+        findModules ( aNode , lExpressions );
+
+        for ( const std::string& lExpression : lExpressions )
+        {
+          lModules.push_back ( std::make_pair ( lExpression , aPath.parent_path() ) );
+        }
+      }
+
+      while ( not lModules.empty() )
+      {
+        // Resolve this level's module expressions (in this thread, since shell expansion is not thread safe)
+        std::vector< std::unique_ptr< File > > lFiles;
+
+        for ( const std::pair< std::string , boost::filesystem::path >& lModule : lModules )
+        {
+          const std::string lKey ( key ( lModule.first , lModule.second ) );
+
+          if ( mExpressions.count ( lKey ) )
+          {
+            continue;
+          }
+
+          std::vector< FileId > lFileIds;
+
+          if ( not resolve ( lModule.first , lModule.second , lFileIds ) )
+          {
+            continue;
+          }
+
+          for ( const FileId& lFileId : lFileIds )
+          {
+            const std::string lName ( lFileId.first + lFileId.second.string() );
+            std::string lExtension ( lFileId.second.extension().string().substr ( 0 , 4 ) );
+            boost::to_lower ( lExtension );
+
+            if ( lExtension != ".xml" or mFiles.count ( lName ) or aSkip ( lName ) )
+            {
+              continue;
+            }
+
+            lFiles.push_back ( std::unique_ptr< File > ( new File() ) );
+            lFiles.back()->protocol = lFileId.first;
+            lFiles.back()->path = lFileId.second;
+            // Placeholder, so that each file is only loaded once
+            mFiles [ lName ] ;
+          }
+
+          mExpressions [ lKey ].swap ( lFileIds );
+        }
+
+        // Then read and parse the files in parallel
+        std::vector< std::vector< std::string > > lFileModules ( lFiles.size() );
+        std::vector< char > lLoaded ( lFiles.size() , 0 );
+        std::atomic< size_t > lNext ( 0 );
+        std::function< void () > lWorker = [&] ()
+        {
+          for ( size_t i = lNext++; i < lFiles.size(); i = lNext++ )
+          {
+            lLoaded [ i ] = loadFile ( *lFiles [ i ] , lFileModules [ i ] );
+          }
+        };
+
+        std::vector< std::thread > lThreads;
+
+        for ( size_t i = 1; i < std::min ( mThreadCount , lFiles.size() ); i++ )
+        {
+          lThreads.push_back ( std::thread ( lWorker ) );
+        }
+
+        lWorker();
+
+        for ( std::thread& lThread : lThreads )
+        {
+          lThread.join();
+        }
+
+        // Finally, collect the module expressions for the next level
+        lModules.clear();
+
+        for ( size_t i = 0; i < lFiles.size(); i++ )
+        {
+          const std::string lName ( lFiles [ i ]->protocol + lFiles [ i ]->path.string() );
+
+          if ( not lLoaded [ i ] )
+          {
+            mFiles.erase ( lName );
+            continue;
+          }
+
+          for ( const std::string& lExpression : lFileModules [ i ] )
+          {
+            lModules.push_back ( std::make_pair ( lExpression , lFiles [ i ]->path.parent_path() ) );
+          }
+
+          mFiles [ lName ].swap ( lFiles [ i ] );
+        }
+      }
+    }
+
+
+    const std::vector< AddressFileLoader::FileId >* AddressFileLoader::find ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath ) const
+    {
+      std::unordered_map< std::string , std::vector< FileId > >::const_iterator lIt ( mExpressions.find ( key ( aFilenameExpr , aParentPath ) ) );
+      return ( lIt == mExpressions.end() ) ? NULL : & lIt->second;
+    }
+
+
+    const AddressFileLoader::File* AddressFileLoader::get ( const std::string& aName ) const
+    {
+      std::unordered_map< std::string , std::unique_ptr< File > >::const_iterator lIt ( mFiles.find ( aName ) );
+      return ( lIt == mFiles.end() ) ? NULL : lIt->second.get();
+    }
+
+
+    size_t AddressFileLoader::size() const
+    {
+      return mFiles.size();
+    }
+
+
+    bool AddressFileLoader::resolve ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath , std::vector< FileId >& aFiles )
+    {
+      try
+      {
+        std::vector< std::pair<std::string, std::string> > lUris;
+        uhal::utilities::ParseSemicolonDelimitedUriList ( aFilenameExpr , lUris );
+
+        if ( lUris.size() != 1 )
+        {
+          return false;
+        }
+
+        if ( lUris[0].first == "file" )
+        {
+          std::vector< boost::filesystem::path > lPaths;
+          uhal::utilities::ShellExpandFilenameExpr ( lUris[0].second , aParentPath , lPaths );
+
+          for ( const boost::filesystem::path& lPath : lPaths )
+          {
+            aFiles.push_back ( FileId ( "file" , lPath ) );
+          }
+        }
+        else if ( lUris[0].first == "http" )
+        {
+          aFiles.push_back ( FileId ( "http" , boost::filesystem::path ( lUris[0].second ) ) );
+        }
+        else
+        {
+          return false;
+        }
+      }
+      catch ( const std::exception& aExc )
+      {
+        return false;
+      }
+
+      return true;
+    }
+
+
+    bool AddressFileLoader::loadFile ( File& aFile , std::vector< std::string >& aModules )
+    {
+      try
+      {
+        if ( aFile.protocol == "file" )
+        {
+          std::ifstream lStr ( aFile.path.c_str() , std::ios::binary );
+
+          if ( not lStr.is_open() )
+          {
+            return false;
+          }
+
+          lStr.seekg ( 0 , std::ios::end );
+          aFile.contents.resize ( lStr.tellg() );
+          lStr.seekg ( 0 , std::ios::beg );
+          lStr.read ( ( char* ) aFile.contents.data() , aFile.contents.size() );
+
+          if ( not lStr )
+          {
+            return false;
+          }
+        }
+        else
+        {
+          if ( not uhal::utilities::HttpGetFile<false> ( aFile.path.string() , aFile.contents ) )
+          {
+            return false;
+          }
+        }
+
+        // Remote files cannot be re-validated when loading from the node tree cache, so are recorded with an empty path
+        aFile.dependency = NodeTreeCache::createDependency ( aFile.protocol == "file" ? aFile.path.string() : "" , aFile.contents.data() , aFile.contents.size() );
+
+        if ( aFile.contents.empty() or not aFile.document.load_buffer_inplace ( aFile.contents.data() , aFile.contents.size() ) )
+        {
+          return false;
+        }
+
+        const pugi::xml_node lNode ( aFile.document.child ( "node" ) );
+
+        if ( not lNode )
+        {
+          return false;
+        }
+
+        findModules ( lNode , aModules );
+      }
+      catch ( const std::exception& aExc )
+      {
+        return false;
+      }
+
+      return true;
+    }
+
+
+    void AddressFileLoader::findModules ( const pugi::xml_node& aNode , std::vector< std::string >& aModules )
+    {
+      const pugi::xml_attribute lModule ( aNode.attribute ( "module" ) );
+
+      if ( lModule )
+      {
+        aModules.push_back ( lModule.value() );
+        return;
+      }
+
+      for ( pugi::xml_node lChild = aNode.child ( "node" ); lChild; lChild = lChild.next_sibling ( "node" ) )
+      {
+        findModules ( lChild , aModules );
+      }
+    }
+
+
+    std::string AddressFileLoader::key ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath )
+    {
+      return aFilenameExpr + '\n' + aParentPath.string();
+    }
+
+  }
+}
@@ -0,0 +1,187 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+#include "uhal/detail/AddressIndex.hpp"
+
+
+#include <algorithm>
+
+#include "uhal/Node.hpp"
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    AddressIndex::AddressIndex ( const std::vector< const Node* >& aNodes ) :
+      mRootLevel ( -1 )
+    {
+      for ( size_t i = 0; i < aNodes.size(); i++ )
+      {
+        const Node& lNode ( *aNodes[i] );
+
+        if ( lNode.getMode() == defs::HIERARCHICAL )
+        {
+          continue;
+        }
+
+        uint32_t lLast ( lNode.getAddress() );
+
+        if ( ( lNode.getMode() == defs::INCREMENTAL ) and ( lNode.getSize() > 1 ) )
+        {
+          // Saturate, rather than wrap around, for blocks that extend beyond the end of the address space
+          lLast = ( lNode.getSize() - 1 > 0xFFFFFFFF - lLast ) ? 0xFFFFFFFF : lLast + lNode.getSize() - 1;
+        }
+
+        const Entry lEntry = { lNode.getAddress() , lLast , uint32_t ( i ) };
+        mEntries.push_back ( lEntry );
+      }
+
+      std::stable_sort ( mEntries.begin() , mEntries.end() , [] ( const Entry& a , const Entry& b ) { return a.first < b.first; } );
+
+      const int64_t lSize ( mEntries.size() );
+
+      if ( lSize == 0 )
+      {
+        return;
+      }
+
+      // Implicit binary tree, in which the nodes at level k are the entries with indices whose lowest k bits are 1 and
+      // whose (k+1)-th bit is 0 (i.e. leaves at even indices). Since the number of entries is not generally a power of two,
+      // the right-most sub-trees may be incomplete, and 'lLast' tracks the maximum of the missing parts.
+      mMaxLast.resize ( lSize );
+      int64_t lLastIdx ( 0 );
+      uint32_t lLast ( 0 );
+
+      for ( int64_t i = 0; i < lSize; i += 2 )
+      {
+        lLastIdx = i;
+        lLast = mMaxLast[i] = mEntries[i].last;
+      }
+
+      int lLevel ( 1 );
+
+      for ( ; ( int64_t ( 1 ) << lLevel ) <= lSize; lLevel++ )
+      {
+        const int64_t lHalf ( int64_t ( 1 ) << ( lLevel - 1 ) );
+
+        for ( int64_t i = ( lHalf << 1 ) - 1; i < lSize; i += ( lHalf << 2 ) )
+        {
+          const uint32_t lLeft ( mMaxLast[i - lHalf] );
+          const uint32_t lRight ( i + lHalf < lSize ? mMaxLast[i + lHalf] : lLast );
+          mMaxLast[i] = std::max ( mEntries[i].last , std::max ( lLeft , lRight ) );
+        }
+
+        lLastIdx = ( ( lLastIdx >> lLevel ) & 1 ) ? lLastIdx - lHalf : lLastIdx + lHalf;
+
+        if ( ( lLastIdx < lSize ) and ( mMaxLast[lLastIdx] > lLast ) )
+        {
+          lLast = mMaxLast[lLastIdx];
+        }
+      }
+
+      mRootLevel = lLevel - 1;
+    }
+
+
+    void AddressIndex::find ( const uint32_t aFirst , const uint32_t aLast , std::vector< uint32_t >& aIndices ) const
+    {
+      const size_t lInitialSize ( aIndices.size() );
+      const int64_t lSize ( mEntries.size() );
+
+      struct StackItem
+      {
+        int64_t index;
+        int level;
+        bool leftDone;
+      };
+
+      // Depth of implicit tree is at most 32, and each level adds at most two items to the stack
+      StackItem lStack[80];
+      size_t lStackSize ( 0 );
+
+      if ( mRootLevel >= 0 )
+      {
+        const StackItem lRoot = { ( int64_t ( 1 ) << mRootLevel ) - 1 , mRootLevel , false };
+        lStack[lStackSize++] = lRoot;
+      }
+
+      while ( lStackSize > 0 )
+      {
+        const StackItem lItem ( lStack[--lStackSize] );
+
+        if ( lItem.level <= 3 )
+        {
+          // Small sub-tree: linear scan is faster
+          const int64_t lBegin ( ( lItem.index >> lItem.level ) << lItem.level );
+          const int64_t lEnd ( std::min ( lSize , lBegin + ( int64_t ( 1 ) << ( lItem.level + 1 ) ) - 1 ) );
+
+          for ( int64_t i = lBegin; ( i < lEnd ) and ( mEntries[i].first <= aLast ); i++ )
+          {
+            if ( mEntries[i].last >= aFirst )
+            {
+              aIndices.push_back ( mEntries[i].node );
+            }
+          }
+        }
+        else if ( not lItem.leftDone )
+        {
+          const StackItem lSelf = { lItem.index , lItem.level , true };
+          lStack[lStackSize++] = lSelf;
+
+          // Left child may be beyond the end of the array if the tree is incomplete; its sub-tree may still contain entries
+          const int64_t lLeft ( lItem.index - ( int64_t ( 1 ) << ( lItem.level - 1 ) ) );
+
+          if ( ( lLeft >= lSize ) or ( mMaxLast[lLeft] >= aFirst ) )
+          {
+            const StackItem lLeftItem = { lLeft , lItem.level - 1 , false };
+            lStack[lStackSize++] = lLeftItem;
+          }
+        }
+        else if ( ( lItem.index < lSize ) and ( mEntries[lItem.index].first <= aLast ) )
+        {
+          if ( mEntries[lItem.index].last >= aFirst )
+          {
+            aIndices.push_back ( mEntries[lItem.index].node );
+          }
+
+          const StackItem lRightItem = { lItem.index + ( int64_t ( 1 ) << ( lItem.level - 1 ) ) , lItem.level - 1 , false };
+          lStack[lStackSize++] = lRightItem;
+        }
+      }
+
+      // Entries are found in address order; callers expect iteration order
+      std::sort ( aIndices.begin() + lInitialSize , aIndices.end() );
+    }
+
+  }
+}
@@ -0,0 +1,99 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+#include "uhal/detail/NodeBinding.hpp"
+
+
+#include "uhal/Node.hpp"
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    NodeBinding::NodeBinding ( const std::shared_ptr< const Node >& aTree , ClientInterface* aClient ) :
+      mTree ( aTree ),
+      mClient ( aClient )
+    {
+    }
+
+
+    NodeBinding::~NodeBinding()
+    {
+      // Bound nodes don't own their children, so can be deleted in any order
+      for ( const std::pair< const Node* const , Node* >& lEntry : mNodes )
+      {
+        delete lEntry.second;
+      }
+    }
+
+
+    Node& NodeBinding::getRoot()
+    {
+      return bind ( *mTree );
+    }
+
+
+    Node& NodeBinding::bind ( const Node& aNode )
+    {
+      std::lock_guard<std::mutex> lLock ( mMutex );
+      return bindLocked ( aNode );
+    }
+
+
+    size_t NodeBinding::size() const
+    {
+      std::lock_guard<std::mutex> lLock ( mMutex );
+      return mNodes.size();
+    }
+
+
+    Node& NodeBinding::bindLocked ( const Node& aNode )
+    {
+      std::unordered_map< const Node* , Node* >::const_iterator lIt ( mNodes.find ( &aNode ) );
+
+      if ( lIt != mNodes.end() )
+      {
+        return *lIt->second;
+      }
+
+      // Ancestors are bound first, so that the bound node's path (and lineage) are the same as in the shared tree
+      Node* lParent ( ( ( &aNode != mTree.get() ) and aNode.mParent ) ? &bindLocked ( *aNode.mParent ) : NULL );
+      std::unique_ptr< Node > lNode ( aNode.cloneUnbound() );
+      lNode->mClient = mClient;
+      lNode->mParent = lParent;
+      lNode->mBoundNode.reset ( new BoundNode ( aNode , *this ) );
+      mNodes [ &aNode ] = lNode.get();
+      return *lNode.release();
+    }
+
+  }
+}
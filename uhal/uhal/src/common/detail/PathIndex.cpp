@@ -0,0 +1,196 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+
+
+#include "uhal/detail/PathIndex.hpp"
+
+
+#include <algorithm>
+#include <string.h>
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    namespace
+    {
+      //! Give up on a bucket after this many seeds (never reached in practice, since the table is only 80% full)
+      const uint32_t kMaxSeed = 1 << 20;
+    }
+
+
+    const uint32_t PathIndex::kNotFound;
+
+
+    PathIndex::PathIndex ( const std::vector< std::pair<std::string, uint32_t> >& aKeys ) :
+      mSize ( aKeys.size() )
+    {
+      if ( aKeys.empty() )
+      {
+        return;
+      }
+
+      // Average of 4 keys per bucket, and table 80% full, keeps the seed search short
+      const size_t lNrBuckets ( std::max< size_t > ( 1 , aKeys.size() / 4 ) );
+      const size_t lNrSlots ( aKeys.size() + aKeys.size() / 4 + 1 );
+
+      std::vector< uint64_t > lHashes ( aKeys.size() );
+      std::vector< std::vector< uint32_t > > lBuckets ( lNrBuckets );
+
+      for ( size_t i = 0; i < aKeys.size(); i++ )
+      {
+        lHashes[i] = hash ( aKeys[i].first.data() , aKeys[i].first.size() );
+        lBuckets[reduce ( lHashes[i] , lNrBuckets )].push_back ( i );
+      }
+
+      // Largest buckets are placed first, while the table is still mostly empty
+      std::vector< uint32_t > lOrder ( lNrBuckets );
+
+      for ( size_t i = 0; i < lNrBuckets; i++ )
+      {
+        lOrder[i] = i;
+      }
+
+      std::stable_sort ( lOrder.begin() , lOrder.end() , [&lBuckets] ( uint32_t a , uint32_t b ) { return lBuckets[a].size() > lBuckets[b].size(); } );
+
+      std::vector< uint32_t > lValues ( lNrSlots , kNotFound );
+      std::vector< size_t > lSlots;
+      mSeeds.assign ( lNrBuckets , 0 );
+
+      for ( const uint32_t lBucketIdx : lOrder )
+      {
+        const std::vector< uint32_t >& lBucket ( lBuckets[lBucketIdx] );
+
+        if ( lBucket.empty() )
+        {
+          break;
+        }
+
+        uint32_t lSeed ( 0 );
+
+        for ( ; lSeed < kMaxSeed; lSeed++ )
+        {
+          lSlots.clear();
+
+          for ( const uint32_t lKeyIdx : lBucket )
+          {
+            const size_t lSlot ( slot ( lHashes[lKeyIdx] , lSeed , lNrSlots ) );
+
+            if ( ( lValues[lSlot] != kNotFound ) or ( std::find ( lSlots.begin() , lSlots.end() , lSlot ) != lSlots.end() ) )
+            {
+              break;
+            }
+
+            lSlots.push_back ( lSlot );
+          }
+
+          if ( lSlots.size() == lBucket.size() )
+          {
+            break;
+          }
+        }
+
+        if ( lSeed == kMaxSeed )
+        {
+          mSeeds.clear();
+          return;
+        }
+
+        mSeeds[lBucketIdx] = lSeed;
+
+        for ( size_t i = 0; i < lBucket.size(); i++ )
+        {
+          lValues[lSlots[i]] = aKeys[lBucket[i]].second;
+        }
+      }
+
+      mValues.swap ( lValues );
+    }
+
+
+    uint32_t PathIndex::find ( const char* aData , const size_t aSize ) const
+    {
+      if ( mValues.empty() )
+      {
+        return kNotFound;
+      }
+
+      const uint64_t lHash ( hash ( aData , aSize ) );
+      return mValues[slot ( lHash , mSeeds[reduce ( lHash , mSeeds.size() )] , mValues.size() )];
+    }
+
+
+    uint64_t PathIndex::hash ( const char* aData , const size_t aSize )
+    {
+      // Multiply-rotate hash over 8-byte words (paths are typically tens of characters long, so this is several times faster than hashing byte by byte)
+      const uint64_t kMultiplier ( 0x9E3779B97F4A7C15ull );
+      uint64_t lHash ( aSize * kMultiplier );
+      size_t i ( 0 );
+
+      for ( ; i + 8 <= aSize; i += 8 )
+      {
+        uint64_t lWord;
+        memcpy ( &lWord , aData + i , 8 );
+        lHash = ( ( lHash ^ lWord ) * kMultiplier );
+        lHash ^= lHash >> 29;
+      }
+
+      if ( i < aSize )
+      {
+        uint64_t lWord ( 0 );
+        memcpy ( &lWord , aData + i , aSize - i );
+        lHash = ( ( lHash ^ lWord ) * kMultiplier );
+        lHash ^= lHash >> 29;
+      }
+
+      return lHash;
+    }
+
+
+    size_t PathIndex::reduce ( const uint64_t aValue , const size_t aRange )
+    {
+      // Maps the upper 32 bits of the value onto [0, aRange) with a multiply and shift, rather than a (much slower) division
+      return size_t ( ( ( aValue >> 32 ) * uint64_t ( aRange ) ) >> 32 );
+    }
+
+
+    size_t PathIndex::slot ( const uint64_t aHash , const uint32_t aSeed , const size_t aNrSlots )
+    {
+      // Finaliser from splitmix64, so that the slots for different seeds are independent of each other and of the bucket
+      uint64_t lValue ( aHash + ( uint64_t ( aSeed ) + 1 ) * 0x9E3779B97F4A7C15ull );
+      lValue = ( lValue ^ ( lValue >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+      lValue = ( lValue ^ ( lValue >> 27 ) ) * 0x94D049BB133111EBull;
+      return reduce ( lValue ^ ( lValue >> 31 ) , aNrSlots );
+    }
+
+  }
+}
@@ -0,0 +1,197 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+
+#include "uhal/detail/StringPool.hpp"
+
+
+#include <mutex>
+#include <ostream>
+#include <tuple>
+#include <unordered_map>
+
+
+namespace uhal
+{
+  namespace detail
+  {
+
+    namespace
+    {
+      struct Pool
+      {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::atomic<size_t> > entries;
+      };
+
+      // Pool is deliberately leaked, so that it remains usable by nodes destroyed during static destruction
+      Pool& getPool()
+      {
+        static Pool& lPool = *new Pool();
+        return lPool;
+      }
+    }
+
+
+    PooledString::PooledString() :
+      mEntry ( NULL )
+    {
+    }
+
+
+    PooledString::PooledString ( const std::string& aString ) :
+      mEntry ( intern ( aString ) )
+    {
+    }
+
+
+    PooledString::PooledString ( const PooledString& aOther ) :
+      mEntry ( aOther.mEntry )
+    {
+      if ( mEntry )
+      {
+        mEntry->second.fetch_add ( 1 , std::memory_order_relaxed );
+      }
+    }
+
+
+    PooledString::PooledString ( PooledString&& aOther ) :
+      mEntry ( aOther.mEntry )
+    {
+      aOther.mEntry = NULL;
+    }
+
+
+    PooledString::~PooledString()
+    {
+      release ( mEntry );
+    }
+
+
+    PooledString& PooledString::operator= ( const std::string& aString )
+    {
+      Entry* lEntry = intern ( aString );
+      release ( mEntry );
+      mEntry = lEntry;
+      return *this;
+    }
+
+
+    PooledString& PooledString::operator= ( const PooledString& aOther )
+    {
+      if ( aOther.mEntry )
+      {
+        aOther.mEntry->second.fetch_add ( 1 , std::memory_order_relaxed );
+      }
+
+      release ( mEntry );
+      mEntry = aOther.mEntry;
+      return *this;
+    }
+
+
+    PooledString& PooledString::operator= ( PooledString&& aOther )
+    {
+      if ( this != &aOther )
+      {
+        release ( mEntry );
+        mEntry = aOther.mEntry;
+        aOther.mEntry = NULL;
+      }
+
+      return *this;
+    }
+
+
+    size_t PooledString::poolSize()
+    {
+      Pool& lPool = getPool();
+      std::lock_guard<std::mutex> lLock ( lPool.mutex );
+      return lPool.entries.size();
+    }
+
+
+    const std::string& PooledString::getEmptyString()
+    {
+      static const std::string lEmptyString;
+      return lEmptyString;
+    }
+
+
+    PooledString::Entry* PooledString::intern ( const std::string& aString )
+    {
+      if ( aString.empty() )
+      {
+        return NULL;
+      }
+
+      // Elements of node-based containers are never moved, so pointers to them remain valid as the pool changes
+      Pool& lPool = getPool();
+      std::lock_guard<std::mutex> lLock ( lPool.mutex );
+      Entry& lEntry = *lPool.entries.emplace ( std::piecewise_construct , std::forward_as_tuple ( aString ) , std::forward_as_tuple ( 0 ) ).first;
+      lEntry.second.fetch_add ( 1 , std::memory_order_relaxed );
+      return &lEntry;
+    }
+
+
+    void PooledString::release ( Entry* aEntry )
+    {
+      if ( aEntry == NULL )
+      {
+        return;
+      }
+
+      // Other references remain, so the entry can't be erased: decrement without taking the pool lock
+      size_t lCount = aEntry->second.load ( std::memory_order_relaxed );
+
+      while ( lCount > 1 )
+      {
+        if ( aEntry->second.compare_exchange_weak ( lCount , lCount - 1 , std::memory_order_acq_rel ) )
+        {
+          return;
+        }
+      }
+
+      // Possibly the last reference: decrements to zero only happen under the lock (as do increments from zero, in intern), so the entry can be safely erased
+      Pool& lPool = getPool();
+      std::lock_guard<std::mutex> lLock ( lPool.mutex );
+
+      if ( aEntry->second.fetch_sub ( 1 , std::memory_order_acq_rel ) == 1 )
+      {
+        lPool.entries.erase ( lPool.entries.find ( aEntry->first ) );
+      }
+    }
+
+
+    std::ostream& operator<< ( std::ostream& aStream , const PooledString& aString )
+    {
+      return aStream << aString.str();
+    }
+
+  }
+}
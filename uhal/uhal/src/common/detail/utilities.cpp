@@ -33,6 +33,7 @@
 #include <fstream>
 #include <iomanip>
 #include <memory>
+#include <mutex>
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/filesystem.hpp>
@@ -45,18 +46,7 @@ namespace uhal {
 
     std::string getAddressDescription(const Node& aNode, const uint32_t aAddress, const size_t& aMaxListSize)
     {
-      std::vector<const Node*> lMatches;
-      for ( Node::const_iterator lIt = aNode.begin(); lIt != aNode.end(); lIt++ ) {
-
-        if ( lIt->getMode() == uhal::defs::INCREMENTAL ) {
-          if ( ( aAddress >= lIt->getAddress() ) and ( aAddress < ( lIt->getAddress() + lIt->getSize() ) ) )
-            lMatches.push_back(&*lIt);
-        }
-        else if ( lIt->getMode() != uhal::defs::HIERARCHICAL ) {
-          if ( lIt->getAddress() == aAddress )
-          	lMatches.push_back(&*lIt);
-        }
-      }
+      const std::vector<const Node*> lMatches(aNode.getNodesAtAddress(aAddress));
 
       if ( lMatches.empty() )
         return "no matching nodes";
@@ -104,7 +94,13 @@ namespace uhal {
 
     std::string getAddressDescription(const ClientInterface& aClient, const uint32_t aAddress, const size_t& aMaxListSize)
     {
-      if ( std::shared_ptr<Node> lNode = aClient.mNode.lock() )
+      std::shared_ptr<const Node> lNode;
+      {
+        std::lock_guard<std::mutex> lLock(aClient.mNodeMutex);
+        lNode = aClient.mNode.lock();
+      }
+
+      if ( lNode )
         return getAddressDescription(*lNode, aAddress, aMaxListSize);
       else
         return "";
@@ -119,50 +115,7 @@ namespace uhal {
 
     std::vector<std::pair<const Node*, const Node*> > getAddressOverlaps(const Node& aNode)
     {
-      std::vector<const Node*> lNodes;
-      for (Node::const_iterator lIt = aNode.begin() ; lIt.next() ; )
-        lNodes.push_back(&*lIt);
-      std::stable_sort ( lNodes.begin() , lNodes.end() , compareNodeAddr );
-
-      std::vector<std::pair<const Node*, const Node*> > lOverlappingNodes;
-      if (lNodes.size() < 2)
-        return lOverlappingNodes;
-
-      for (std::vector<const Node*>::const_iterator lIt1 = lNodes.begin() ; lIt1 != (lNodes.end() - 1); lIt1++)
-      {
-        const Node& lNode1 = **lIt1;
-        if (lNode1.getMode() == defs::HIERARCHICAL)
-          continue;
-
-        const uint32_t lMaxAddr1(lNode1.getMode() == defs::INCREMENTAL ? lNode1.getAddress() + lNode1.getSize() - 1 : lNode1.getAddress());
-
-        for (std::vector<const Node*>::const_iterator lIt2(lIt1 + 1) ; (lIt2 != lNodes.end()) and (*lIt2)->getAddress() <= lMaxAddr1; lIt2++)
-        {
-          if ((*lIt2)->getMode() == defs::HIERARCHICAL)
-            continue;
-
-          const Node& lNode2 = **lIt2;
-
-          if (lNode1.getMode() != defs::SINGLE or lNode2.getMode() != defs::SINGLE)
-            lOverlappingNodes.push_back( std::make_pair(&lNode1, &lNode2) );
-
-          else if (lNode1.getMask() & lNode2.getMask())
-          {
-            if (lNode1.getMask() == defs::NOMASK and lNode2.isChildOf(lNode1))
-            {
-              // Node 2 is masked child of node 1: No overlap
-            }
-            else if (lNode2.getMask() == defs::NOMASK and lNode1.isChildOf(lNode2))
-            {
-              // Node 1 is masked child of node 2: No overlap
-            }
-            else
-              lOverlappingNodes.push_back( std::make_pair(&lNode1, &lNode2) );
-          }
-        }
-      }
-
-      return lOverlappingNodes;
+      return aNode.getAddressOverlaps();
     }
 
 
@@ -0,0 +1,184 @@
+
+#include "uhal/utilities/AdaptivePoller.hpp"
+
+
+#include <algorithm>                    // for min
+#include <ostream>                      // for operator<<, ostream, basic_os...
+#include <thread>
+
+
+namespace uhal {
+
+namespace {
+  // Upper limit on the spin & yield phases, so that CPU is not burnt when the round-trip time is long
+  const AdaptivePoller::Clock_t::duration kMaxSpinDuration = std::chrono::milliseconds(1);
+  const AdaptivePoller::Clock_t::duration kMinSleepDuration = std::chrono::microseconds(1);
+}
+
+
+AdaptivePoller::AdaptivePoller(const Clock_t::duration& aMaxSleep) :
+  mAdaptive(true),
+  mMaxSleep(aMaxSleep),
+  mEstimatedRTT(Clock_t::duration::zero()),
+  mNrPackets(0),
+  mNrPolls(0),
+  mLastPolls(0)
+{
+}
+
+
+AdaptivePoller::~AdaptivePoller()
+{
+}
+
+
+bool AdaptivePoller::isAdaptive() const
+{
+  return mAdaptive;
+}
+
+
+void AdaptivePoller::setAdaptive(bool aAdaptive)
+{
+  mAdaptive = aAdaptive;
+}
+
+
+const AdaptivePoller::Clock_t::duration& AdaptivePoller::getMaxSleep() const
+{
+  return mMaxSleep;
+}
+
+
+void AdaptivePoller::setMaxSleep(const Clock_t::duration& aMaxSleep)
+{
+  mMaxSleep = aMaxSleep;
+}
+
+
+void AdaptivePoller::notifySent()
+{
+  mSendTimes.push_back(Clock_t::now());
+}
+
+
+void AdaptivePoller::notifyReady()
+{
+  if (not mSendTimes.empty())
+    mSendTimes.pop_front();
+  mNrPackets++;
+  mLastPolls = 0;
+}
+
+
+void AdaptivePoller::reset()
+{
+  mSendTimes.clear();
+}
+
+
+bool AdaptivePoller::wait(const std::function<bool ()>& aPoll, const Clock_t::duration& aTimeout)
+{
+  const Clock_t::time_point lStartTime = Clock_t::now();
+  const Clock_t::time_point lSendTime = (mSendTimes.empty() ? lStartTime : mSendTimes.front());
+  if (not mSendTimes.empty())
+    mSendTimes.pop_front();
+
+  // Spin until 1.5x the estimated RTT has passed since the request was sent, then yield for the same duration
+  const Clock_t::duration lSpinDuration = std::min(mEstimatedRTT + mEstimatedRTT / 2, kMaxSpinDuration);
+  const Clock_t::time_point lSpinEndTime = lSendTime + lSpinDuration;
+  const Clock_t::time_point lYieldEndTime = lSpinEndTime + lSpinDuration;
+  Clock_t::duration lSleepDuration = std::min(kMinSleepDuration, mMaxSleep);
+
+  uint32_t lNrPolls = 0;
+  while (true) {
+    lNrPolls++;
+    if (aPoll())
+      break;
+
+    const Clock_t::time_point lNow = Clock_t::now();
+    if ((lNow - lStartTime) > aTimeout) {
+      mNrPolls += lNrPolls;
+      mLastPolls = lNrPolls;
+      return false;
+    }
+
+    if (not mAdaptive) {
+      if (mMaxSleep > Clock_t::duration::zero())
+        std::this_thread::sleep_for(mMaxSleep);
+    }
+    else if (lNow < lSpinEndTime)
+      continue;
+    else if ((lNow < lYieldEndTime) or (mMaxSleep == Clock_t::duration::zero()))
+      std::this_thread::yield();
+    else {
+      std::this_thread::sleep_for(lSleepDuration);
+      lSleepDuration = std::min(2 * lSleepDuration, mMaxSleep);
+    }
+  }
+
+  // Update RTT estimate with same gain as TCP's smoothed RTT (i.e. 1/8)
+  const Clock_t::duration lRTT = Clock_t::now() - lSendTime;
+  if (mNrPackets == 0)
+    mEstimatedRTT = lRTT;
+  else
+    mEstimatedRTT += (lRTT - mEstimatedRTT) / 8;
+
+  mNrPackets++;
+  mNrPolls += lNrPolls;
+  mLastPolls = lNrPolls;
+  return true;
+}
+
+
+const AdaptivePoller::Clock_t::duration& AdaptivePoller::getEstimatedRTT() const
+{
+  return mEstimatedRTT;
+}
+
+
+uint64_t AdaptivePoller::getNumberOfPackets() const
+{
+  return mNrPackets;
+}
+
+
+uint64_t AdaptivePoller::getNumberOfPolls() const
+{
+  return mNrPolls;
+}
+
+
+double AdaptivePoller::getMeanPollsPerPacket() const
+{
+  return (mNrPackets == 0 ? 0.0 : double(mNrPolls) / mNrPackets);
+}
+
+
+uint32_t AdaptivePoller::getLastPollsPerPacket() const
+{
+  return mLastPolls;
+}
+
+
+void AdaptivePoller::clearStats()
+{
+  mEstimatedRTT = Clock_t::duration::zero();
+  mNrPackets = 0;
+  mNrPolls = 0;
+  mLastPolls = 0;
+}
+
+
+std::ostream& operator<<(std::ostream& aStream, const AdaptivePoller& aPoller)
+{
+  typedef std::chrono::duration<float, std::micro> MicroSec_t;
+
+  aStream << (aPoller.isAdaptive() ? "adaptive" : "fixed") << " polling (max sleep " << MicroSec_t(aPoller.getMaxSleep()).count() << " us)";
+  aStream << "; " << aPoller.getNumberOfPackets() << " replies, estimated RTT " << MicroSec_t(aPoller.getEstimatedRTT()).count() << " us";
+  aStream << ", mean polls per reply " << aPoller.getMeanPollsPerPacket() << " (last " << aPoller.getLastPollsPerPacket() << ")";
+  return aStream;
+}
+
+
+} // end ns uhal
@@ -0,0 +1,215 @@
+
+#include "uhal/utilities/ClientStatistics.hpp"
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ostream>                      // for operator<<, ostream, basic_os...
+
+
+namespace uhal {
+
+
+LatencyHistogram::Snapshot::Snapshot() :
+  count(0),
+  sum(0),
+  min(0),
+  max(0)
+{
+}
+
+
+double LatencyHistogram::Snapshot::mean() const
+{
+  return (count == 0) ? 0.0 : double(sum) / count;
+}
+
+
+uint64_t LatencyHistogram::Snapshot::percentile(const double aPercentile) const
+{
+  if (count == 0)
+    return 0;
+  if (aPercentile <= 0)
+    return min;
+
+  const uint64_t lTarget = std::max<uint64_t>(std::ceil(count * std::min(aPercentile, 100.0) / 100.0), 1);
+  uint64_t lCumulativeCount = 0;
+  for (size_t i = 0; i < counts.size(); i++) {
+    lCumulativeCount += counts.at(i);
+    if (lCumulativeCount >= lTarget)
+      return std::max(std::min(upperBound(i) - 1, max), min);
+  }
+
+  return max;
+}
+
+
+LatencyHistogram::LatencyHistogram()
+{
+  clear();
+}
+
+
+LatencyHistogram::~LatencyHistogram()
+{
+}
+
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+{
+  Snapshot lSnapshot;
+  lSnapshot.counts.resize(kBucketCount);
+  for (size_t i = 0; i < kBucketCount; i++) {
+    lSnapshot.counts.at(i) = mCounts[i].load(std::memory_order_relaxed);
+    lSnapshot.count += lSnapshot.counts.at(i);
+  }
+
+  if (lSnapshot.count > 0) {
+    lSnapshot.sum = mSum.load(std::memory_order_relaxed);
+    lSnapshot.min = mMin.load(std::memory_order_relaxed);
+    lSnapshot.max = mMax.load(std::memory_order_relaxed);
+  }
+  return lSnapshot;
+}
+
+
+void LatencyHistogram::clear()
+{
+  for (size_t i = 0; i < kBucketCount; i++)
+    mCounts[i].store(0, std::memory_order_relaxed);
+  mSum.store(0, std::memory_order_relaxed);
+  mMin.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+  mMax.store(0, std::memory_order_relaxed);
+}
+
+
+uint64_t LatencyHistogram::lowerBound(const size_t aBucket)
+{
+  if (aBucket < kSubBucketCount)
+    return aBucket;
+
+  const size_t lShift = aBucket / kSubBucketCount - 1;
+  return (kSubBucketCount + aBucket % kSubBucketCount) << lShift;
+}
+
+
+uint64_t LatencyHistogram::upperBound(const size_t aBucket)
+{
+  if (aBucket == kBucketCount - 1)
+    return std::numeric_limits<uint64_t>::max();
+  if (aBucket < kSubBucketCount)
+    return aBucket + 1;
+
+  const size_t lShift = aBucket / kSubBucketCount - 1;
+  return lowerBound(aBucket) + (uint64_t(1) << lShift);
+}
+
+
+std::ostream& operator<<(std::ostream& aStream, const LatencyHistogram::Snapshot& aSnapshot)
+{
+  if (aSnapshot.count == 0)
+    aStream << "no values recorded";
+  else {
+    typedef std::chrono::duration<float, std::micro> MicroSec_t;
+    const auto lFormat = [](const double aValue) { return MicroSec_t(std::chrono::duration<double, std::nano>(aValue)).count(); };
+
+    aStream << aSnapshot.count << " values, min / mean / max = " << lFormat(aSnapshot.min) << " / " << lFormat(aSnapshot.mean())
+            << " / " << lFormat(aSnapshot.max) << " us, median / 99% / 99.9% = " << lFormat(aSnapshot.percentile(50))
+            << " / " << lFormat(aSnapshot.percentile(99)) << " / " << lFormat(aSnapshot.percentile(99.9)) << " us";
+  }
+
+  return aStream;
+}
+
+
+ClientStatistics::Snapshot::Snapshot() :
+  packetsSent(0),
+  packetsReceived(0),
+  bytesSent(0),
+  bytesReceived(0),
+  inFlight(0),
+  maxInFlight(0),
+  dispatches(0),
+  timeouts(0)
+{
+}
+
+
+ClientStatistics::ClientStatistics() :
+  mTransactionTypeNames(kMaxTransactionTypes),
+  mInFlight(0)
+{
+  clear();
+}
+
+
+ClientStatistics::~ClientStatistics()
+{
+}
+
+
+void ClientStatistics::setTransactionTypeName(const size_t aType, const std::string& aName)
+{
+  mTransactionTypeNames.at(aType) = aName;
+}
+
+
+ClientStatistics::Snapshot ClientStatistics::snapshot() const
+{
+  Snapshot lSnapshot;
+  lSnapshot.packetsSent = mPacketsSent.load(std::memory_order_relaxed);
+  lSnapshot.packetsReceived = mPacketsReceived.load(std::memory_order_relaxed);
+  lSnapshot.bytesSent = mBytesSent.load(std::memory_order_relaxed);
+  lSnapshot.bytesReceived = mBytesReceived.load(std::memory_order_relaxed);
+
+  for (size_t i = 0; i < kMaxTransactionTypes; i++) {
+    if (not mTransactionTypeNames.at(i).empty())
+      lSnapshot.transactions[mTransactionTypeNames.at(i)] = mTransactions[i].load(std::memory_order_relaxed);
+  }
+
+  lSnapshot.inFlight = mInFlight.load(std::memory_order_relaxed);
+  lSnapshot.maxInFlight = mMaxInFlight.load(std::memory_order_relaxed);
+  lSnapshot.dispatches = mDispatches.load(std::memory_order_relaxed);
+  lSnapshot.timeouts = mTimeouts.load(std::memory_order_relaxed);
+  lSnapshot.packetRoundTripTime = mPacketRoundTripTime.snapshot();
+  lSnapshot.dispatchTime = mDispatchTime.snapshot();
+  return lSnapshot;
+}
+
+
+void ClientStatistics::clear()
+{
+  mPacketsSent.store(0, std::memory_order_relaxed);
+  mPacketsReceived.store(0, std::memory_order_relaxed);
+  mBytesSent.store(0, std::memory_order_relaxed);
+  mBytesReceived.store(0, std::memory_order_relaxed);
+  for (size_t i = 0; i < kMaxTransactionTypes; i++)
+    mTransactions[i].store(0, std::memory_order_relaxed);
+  mMaxInFlight.store(mInFlight.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  mDispatches.store(0, std::memory_order_relaxed);
+  mTimeouts.store(0, std::memory_order_relaxed);
+  mPacketRoundTripTime.clear();
+  mDispatchTime.clear();
+}
+
+
+std::ostream& operator<<(std::ostream& aStream, const ClientStatistics::Snapshot& aSnapshot)
+{
+  aStream << "Packets sent / received = " << aSnapshot.packetsSent << " / " << aSnapshot.packetsReceived
+          << " (" << aSnapshot.bytesSent << " / " << aSnapshot.bytesReceived << " bytes)"
+          << ", in flight = " << aSnapshot.inFlight << " (max " << aSnapshot.maxInFlight << ")"
+          << ", dispatches = " << aSnapshot.dispatches << " (" << aSnapshot.timeouts << " timeouts)" << std::endl;
+
+  for (const auto& lTransactions : aSnapshot.transactions) {
+    if (lTransactions.second > 0)
+      aStream << "  " << lTransactions.first << ": " << lTransactions.second << " transactions" << std::endl;
+  }
+
+  aStream << "  Packet round-trip time: " << aSnapshot.packetRoundTripTime << std::endl;
+  aStream << "  Dispatch time: " << aSnapshot.dispatchTime;
+  return aStream;
+}
+
+
+} // end ns uhal
@@ -0,0 +1,127 @@
+
+#include "uhal/utilities/PacketTrace.hpp"
+
+
+#include <ostream>                      // for operator<<, ostream, basic_os...
+
+
+namespace uhal {
+
+
+PacketTrace::PacketTrace(const size_t aDepth) :
+  mNrRequests(0),
+  mNrRequestWords(0),
+  mNrReplies(0),
+  mNrReplyWords(0),
+  mNrInterrupts(0),
+  mEntries(aDepth),
+  mNextEntry(0),
+  mNrEntries(0)
+{
+}
+
+
+PacketTrace::~PacketTrace()
+{
+}
+
+
+size_t PacketTrace::getDepth() const
+{
+  return mEntries.size();
+}
+
+
+void PacketTrace::setDepth(const size_t aDepth)
+{
+  mEntries.assign(aDepth, Entry());
+  mNextEntry = 0;
+  mNrEntries = 0;
+}
+
+
+uint64_t PacketTrace::getNumberOfRequests() const
+{
+  return mNrRequests;
+}
+
+
+uint64_t PacketTrace::getNumberOfRequestWords() const
+{
+  return mNrRequestWords;
+}
+
+
+uint64_t PacketTrace::getNumberOfReplies() const
+{
+  return mNrReplies;
+}
+
+
+uint64_t PacketTrace::getNumberOfReplyWords() const
+{
+  return mNrReplyWords;
+}
+
+
+uint64_t PacketTrace::getNumberOfInterrupts() const
+{
+  return mNrInterrupts;
+}
+
+
+std::vector<PacketTrace::Entry> PacketTrace::getEntries() const
+{
+  std::vector<Entry> lEntries;
+  lEntries.reserve(mNrEntries);
+  for (size_t i = mEntries.size() + mNextEntry - mNrEntries; i < mEntries.size() + mNextEntry; i++)
+    lEntries.push_back(mEntries.at(i % mEntries.size()));
+  return lEntries;
+}
+
+
+void PacketTrace::clear()
+{
+  mNrRequests = 0;
+  mNrRequestWords = 0;
+  mNrReplies = 0;
+  mNrReplyWords = 0;
+  mNrInterrupts = 0;
+  mNextEntry = 0;
+  mNrEntries = 0;
+}
+
+
+std::ostream& operator<<(std::ostream& aStream, const PacketTrace& aTrace)
+{
+  typedef std::chrono::duration<float, std::micro> MicroSec_t;
+
+  aStream << aTrace.getNumberOfRequests() << " requests (" << aTrace.getNumberOfRequestWords() << " words), ";
+  aStream << aTrace.getNumberOfReplies() << " replies (" << aTrace.getNumberOfReplyWords() << " words), ";
+  aStream << aTrace.getNumberOfInterrupts() << " interrupts";
+
+  const std::vector<PacketTrace::Entry> lEntries(aTrace.getEntries());
+  if (lEntries.empty())
+    return aStream;
+
+  // Times are shown relative to the most recent entry
+  aStream << "; last " << lEntries.size() << " transfers:";
+  for (const auto& lEntry: lEntries) {
+    aStream << std::endl << "  " << MicroSec_t(lEntry.time - lEntries.back().time).count() << " us : ";
+    switch (lEntry.type) {
+      case PacketTrace::REQUEST:
+        aStream << "request, " << lEntry.nrWords << " words, page " << lEntry.pageIndex;
+        break;
+      case PacketTrace::REPLY:
+        aStream << "reply, " << lEntry.nrWords << " words, page " << lEntry.pageIndex << ", after " << lEntry.nrPolls << " polls";
+        break;
+      case PacketTrace::INTERRUPT:
+        aStream << "interrupt, page " << lEntry.pageIndex;
+        break;
+    }
+  }
+  return aStream;
+}
+
+
+} // end ns uhal
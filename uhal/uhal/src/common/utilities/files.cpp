@@ -36,8 +36,12 @@
 #include "uhal/utilities/files.hpp"
 
 
+#include <atomic>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
 
 #include <wordexp.h>
 
@@ -52,6 +56,8 @@
 #include <boost/asio/write.hpp>
 #include <boost/spirit/include/qi.hpp>
 
+#include "uhal/grammars/Parsers.hpp"
+#include "uhal/HttpFileCache.hpp"
 #include "uhal/log/log.hpp"
 
 
@@ -64,8 +70,7 @@ namespace uhal
     {
       try
       {
-        grammars::SemicolonDelimitedUriListGrammar lGrammar;
-        boost::spirit::qi::phrase_parse ( aSemicolonDelimitedUriList.begin() , aSemicolonDelimitedUriList.end() , lGrammar , boost::spirit::ascii::space , aUriList );
+        grammars::parseSemicolonDelimitedUriList ( aSemicolonDelimitedUriList , aUriList );
       }
       catch ( const std::exception& aExc )
       {
@@ -134,7 +139,7 @@ namespace uhal
 
 
     template < bool DebugInfo >
-    bool HttpGet ( const std::string& aURL , HttpResponseType& aResponse )
+    bool HttpGet ( const std::string& aURL , HttpResponseType& aResponse , const std::vector< std::pair<std::string, std::string> >& aRequestHeaders )
     {
       if ( DebugInfo )
       {
@@ -165,19 +170,35 @@ namespace uhal
         return false;
       }
 
+      // The host may be followed by an explicit port number
+      std::pair<std::string, std::string> lHostPort;
+
+      try
+      {
+        grammars::parseHostPort ( lURLPair.first , lHostPort , false );
+      }
+      catch ( const std::exception& aExc )
+      {
+        return false;
+      }
+
+      const std::string& lHost ( lHostPort.first );
+      const std::string lService ( lHostPort.second.empty() ? std::string ( "http" ) : lHostPort.second );
+
       boost::system::error_code lErrorCode ( boost::asio::error::host_not_found );
       // The IO service everything will go through
       boost::asio::io_service io_service;
-      // Get a list of endpoints corresponding to the server name.
-      boost::asio::ip::tcp::resolver resolver ( io_service );
-      boost::asio::ip::tcp::resolver::query query ( lURLPair.first , "http" );
-      boost::asio::ip::tcp::resolver::iterator endpoint_iterator = resolver.resolve ( query );
-      boost::asio::ip::tcp::resolver::iterator end;
       // Try each endpoint until we successfully establish a connection.
       boost::asio::ip::tcp::socket socket ( io_service );
 
       try
       {
+        // Get a list of endpoints corresponding to the server name.
+        boost::asio::ip::tcp::resolver resolver ( io_service );
+        boost::asio::ip::tcp::resolver::query query ( lHost , lService );
+        boost::asio::ip::tcp::resolver::iterator endpoint_iterator = resolver.resolve ( query );
+        boost::asio::ip::tcp::resolver::iterator end;
+
         while ( lErrorCode && endpoint_iterator != end )
         {
           socket.close();
@@ -200,6 +221,12 @@ namespace uhal
       request_stream << "GET /" << lURLPair.second << " HTTP/1.0\r\n";
       request_stream << "Host: " << lURLPair.first << "\r\n";
       request_stream << "Accept: */*\r\n";
+
+      for ( const auto& lHeader : aRequestHeaders )
+      {
+        request_stream << lHeader.first << ": " << lHeader.second << "\r\n";
+      }
+
       request_stream << "Connection: close\r\n\r\n";
 
       try
@@ -277,8 +304,170 @@ namespace uhal
     }
 
 
-    template bool HttpGet<false> ( const std::string& , HttpResponseType& );
-    template bool HttpGet<true> ( const std::string& , HttpResponseType& );
+    template bool HttpGet<false> ( const std::string& , HttpResponseType& , const std::vector< std::pair<std::string, std::string> >& );
+    template bool HttpGet<true> ( const std::string& , HttpResponseType& , const std::vector< std::pair<std::string, std::string> >& );
+
+
+    namespace
+    {
+      //! Configuration of the HTTP file cache, initialised from environment variables on first use
+      struct HttpCacheConfig
+      {
+        HttpCacheConfig() :
+          offline ( false )
+        {
+          if ( const char* lCacheDir = std::getenv ( "UHAL_HTTP_CACHE_DIR" ) )
+          {
+            if ( lCacheDir[0] != '\0' )
+            {
+              cache.reset ( new HttpFileCache ( lCacheDir ) );
+            }
+          }
+
+          if ( const char* lOffline = std::getenv ( "UHAL_HTTP_CACHE_OFFLINE" ) )
+          {
+            offline = ( std::string ( lOffline ) != "0" );
+          }
+        }
+
+        std::mutex mutex;
+        std::shared_ptr<const HttpFileCache> cache;
+        std::atomic<bool> offline;
+      };
+
+      HttpCacheConfig& GetHttpCacheConfig()
+      {
+        static HttpCacheConfig lConfig;
+        return lConfig;
+      }
+    }
+
+
+    template < bool DebugInfo >
+    bool HttpGetFile ( const std::string& aURL , std::vector<uint8_t>& aContents )
+    {
+      HttpCacheConfig& lConfig ( GetHttpCacheConfig() );
+      std::shared_ptr<const HttpFileCache> lCache;
+      {
+        std::lock_guard<std::mutex> lLock ( lConfig.mutex );
+        lCache = lConfig.cache;
+      }
+
+      HttpResponseType lResponse;
+      lResponse.status = 0;
+
+      if ( not lCache )
+      {
+        if ( not HttpGet<DebugInfo> ( aURL , lResponse ) )
+        {
+          return false;
+        }
+
+        aContents.swap ( lResponse.content );
+        return true;
+      }
+
+      HttpFileCache::Entry lEntry;
+      std::vector<uint8_t> lCachedContents;
+      const bool lCached ( lCache->load ( aURL , lEntry , lCachedContents ) );
+
+      if ( lConfig.offline )
+      {
+        if ( not lCached )
+        {
+          log ( Warning() , "URL " , Quote ( aURL ) , " is not in the HTTP cache, and cannot be retrieved in offline mode" );
+          return false;
+        }
+
+        log ( Debug() , "Using cached copy of URL " , Quote ( aURL ) , " (offline mode)" );
+        aContents.swap ( lCachedContents );
+        return true;
+      }
+
+      // Ask the server to only send the file if it has changed since it was cached
+      std::vector< std::pair<std::string, std::string> > lRequestHeaders;
+
+      if ( lCached and not lEntry.etag.empty() )
+      {
+        lRequestHeaders.push_back ( std::make_pair ( "If-None-Match" , lEntry.etag ) );
+      }
+
+      if ( lCached and not lEntry.lastModified.empty() )
+      {
+        lRequestHeaders.push_back ( std::make_pair ( "If-Modified-Since" , lEntry.lastModified ) );
+      }
+
+      if ( HttpGet<DebugInfo> ( aURL , lResponse , lRequestHeaders ) )
+      {
+        lCache->store ( aURL , lResponse );
+        aContents.swap ( lResponse.content );
+        return true;
+      }
+
+      if ( not lCached )
+      {
+        return false;
+      }
+
+      if ( lResponse.status == 304 )
+      {
+        log ( Debug() , "Cached copy of URL " , Quote ( aURL ) , " is up to date" );
+      }
+      else if ( ( lResponse.status == 0 ) or ( lResponse.status >= 500 ) )
+      {
+        log ( Warning() , "Failed to retrieve URL " , Quote ( aURL ) , " from server (status " , Integer ( lResponse.status ) , "); using cached copy" );
+      }
+      else
+      {
+        // e.g. the file has been removed from the server
+        return false;
+      }
+
+      aContents.swap ( lCachedContents );
+      return true;
+    }
+
+
+    template bool HttpGetFile<false> ( const std::string& , std::vector<uint8_t>& );
+    template bool HttpGetFile<true> ( const std::string& , std::vector<uint8_t>& );
+
+
+    void SetHttpCacheDirectory ( const boost::filesystem::path& aDirectory )
+    {
+      HttpCacheConfig& lConfig ( GetHttpCacheConfig() );
+      std::lock_guard<std::mutex> lLock ( lConfig.mutex );
+
+      if ( aDirectory.empty() )
+      {
+        lConfig.cache.reset();
+        log ( Info() , "HTTP cache disabled" );
+      }
+      else
+      {
+        lConfig.cache.reset ( new HttpFileCache ( aDirectory ) );
+        log ( Info() , "HTTP cache enabled, using directory " , Quote ( aDirectory.string() ) );
+      }
+    }
+
+
+    boost::filesystem::path GetHttpCacheDirectory ( )
+    {
+      HttpCacheConfig& lConfig ( GetHttpCacheConfig() );
+      std::lock_guard<std::mutex> lLock ( lConfig.mutex );
+      return lConfig.cache ? lConfig.cache->getDirectory() : boost::filesystem::path();
+    }
+
+
+    void SetHttpOfflineMode ( const bool aOffline )
+    {
+      GetHttpCacheConfig().offline = aOffline;
+    }
+
+
+    bool GetHttpOfflineMode ( )
+    {
+      return GetHttpCacheConfig().offline;
+    }
 
 
     void OpenFileLocal ( const std::string& aFilenameExpr , const boost::filesystem::path& aParentPath , const detail::FileCallback_t& aCallback)
@@ -312,9 +501,9 @@ namespace uhal
 
     void OpenFileHttp ( const std::string& aURL , const detail::FileCallback_t& aCallback )
     {
-      HttpResponseType lHttpResponse;
+      std::vector<uint8_t> lFile;
 
-      if ( ! uhal::utilities::HttpGet<true> ( aURL , lHttpResponse ) )
+      if ( ! uhal::utilities::HttpGetFile<true> ( aURL , lFile ) )
       {
         uhal::exception::CannotOpenFile lExc;
         log ( lExc , "Failed to download file " , Quote ( aURL ) );
@@ -322,7 +511,7 @@ namespace uhal
       }
 
       boost::filesystem::path lFilePath = boost::filesystem::path ( aURL );
-      aCallback ( std::string ( "http" ) , lFilePath , lHttpResponse.content );
+      aCallback ( std::string ( "http" ) , lFilePath , lFile );
     }
 
 
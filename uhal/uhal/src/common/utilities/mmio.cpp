@@ -0,0 +1,341 @@
+/*
+---------------------------------------------------------------------------
+
+    This file is part of uHAL.
+
+    uHAL is a hardware access library and programming framework
+    originally developed for upgrades of the Level-1 trigger of the CMS
+    experiment at CERN.
+
+    uHAL is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    uHAL is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with uHAL.  If not, see <http://www.gnu.org/licenses/>.
+
+
+      Andrew Rose, Imperial College, London
+      email: awr01 <AT> imperial.ac.uk
+
+      Marc Magrans de Abril, CERN
+      email: marc.magrans.de.abril <AT> cern.ch
+
+      Tom Williams, Rutherford Appleton Laboratory, Oxfordshire
+      email: tom.williams <AT> cern.ch
+
+---------------------------------------------------------------------------
+*/
+
+#include "uhal/utilities/mmio.hpp"
+
+
+#include <algorithm>                                        // for min
+#include <string.h>                                         // for memcpy
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || __GNUC__ >= 5)
+#define UHAL_MMIO_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+
+namespace uhal
+{
+  namespace utilities
+  {
+    namespace mmio
+    {
+      namespace
+      {
+        //! Returns the number of bytes from aPtr to the next aAlignment-byte boundary
+        inline size_t bytesToAlignment ( const volatile void* aPtr, const size_t aAlignment )
+        {
+          return ( aAlignment - ( reinterpret_cast<uintptr_t>(aPtr) & ( aAlignment - 1 ) ) ) & ( aAlignment - 1 );
+        }
+
+
+        void readScalar ( uint32_t* aDest, const volatile uint8_t* aSrc, const size_t aNrWords )
+        {
+          const volatile uint32_t* lSrc = reinterpret_cast<const volatile uint32_t*>(aSrc);
+
+          for ( size_t i = 0; i < aNrWords; i++ )
+          {
+            aDest[i] = lSrc[i];
+          }
+        }
+
+
+        void writeScalar ( volatile uint8_t* aDest, const uint8_t* aSrc, size_t aNrBytes )
+        {
+          for ( ; aNrBytes >= 8; aDest += 8, aSrc += 8, aNrBytes -= 8 )
+          {
+            uint64_t lValue;
+            memcpy ( &lValue, aSrc, 8 );
+            *reinterpret_cast<volatile uint64_t*>(aDest) = lValue;
+          }
+
+          if ( aNrBytes >= 4 )
+          {
+            uint32_t lValue;
+            memcpy ( &lValue, aSrc, 4 );
+            *reinterpret_cast<volatile uint64_t*>(aDest) = uint64_t ( lValue );
+          }
+        }
+
+
+#ifdef UHAL_MMIO_X86_KERNELS
+        // Each of the wide kernels copies the unaligned head & tail of the block with the scalar kernel, and the aligned
+        // body with non-temporal (i.e. streaming) instructions. On write-combining memory, full-width streaming stores
+        // are merged into complete bus transactions; streaming loads fetch complete lines from write-combining memory.
+
+        __attribute__ ( ( target ( "sse4.1" ) ) )
+        void readSSE ( uint32_t* aDest, const volatile uint8_t* aSrc, size_t aNrWords )
+        {
+          const size_t lNrHeadWords = std::min ( aNrWords, bytesToAlignment ( aSrc, 16 ) / 4 );
+          readScalar ( aDest, aSrc, lNrHeadWords );
+          aDest += lNrHeadWords;
+          aSrc += 4 * lNrHeadWords;
+          aNrWords -= lNrHeadWords;
+
+          for ( ; aNrWords >= 4; aDest += 4, aSrc += 16, aNrWords -= 4 )
+          {
+            __m128i lValue = _mm_stream_load_si128 ( reinterpret_cast<__m128i*>( const_cast<uint8_t*>(aSrc) ) );
+            _mm_storeu_si128 ( reinterpret_cast<__m128i*>(aDest), lValue );
+          }
+
+          readScalar ( aDest, aSrc, aNrWords );
+        }
+
+
+        __attribute__ ( ( target ( "avx2" ) ) )
+        void readAVX2 ( uint32_t* aDest, const volatile uint8_t* aSrc, size_t aNrWords )
+        {
+          const size_t lNrHeadWords = std::min ( aNrWords, bytesToAlignment ( aSrc, 32 ) / 4 );
+          readScalar ( aDest, aSrc, lNrHeadWords );
+          aDest += lNrHeadWords;
+          aSrc += 4 * lNrHeadWords;
+          aNrWords -= lNrHeadWords;
+
+          for ( ; aNrWords >= 8; aDest += 8, aSrc += 32, aNrWords -= 8 )
+          {
+            __m256i lValue = _mm256_stream_load_si256 ( reinterpret_cast<__m256i*>( const_cast<uint8_t*>(aSrc) ) );
+            _mm256_storeu_si256 ( reinterpret_cast<__m256i*>(aDest), lValue );
+          }
+
+          readScalar ( aDest, aSrc, aNrWords );
+        }
+
+
+        __attribute__ ( ( target ( "avx512f" ) ) )
+        void readAVX512 ( uint32_t* aDest, const volatile uint8_t* aSrc, size_t aNrWords )
+        {
+          const size_t lNrHeadWords = std::min ( aNrWords, bytesToAlignment ( aSrc, 64 ) / 4 );
+          readScalar ( aDest, aSrc, lNrHeadWords );
+          aDest += lNrHeadWords;
+          aSrc += 4 * lNrHeadWords;
+          aNrWords -= lNrHeadWords;
+
+          for ( ; aNrWords >= 16; aDest += 16, aSrc += 64, aNrWords -= 16 )
+          {
+            __m512i lValue = _mm512_stream_load_si512 ( const_cast<uint8_t*>(aSrc) );
+            _mm512_storeu_si512 ( aDest, lValue );
+          }
+
+          readScalar ( aDest, aSrc, aNrWords );
+        }
+
+
+        // N.B. The wide write kernels fall back to the scalar implementation if the destination is not 8-byte aligned,
+        //      so that the head of the block can always be written using 64-bit stores
+
+        __attribute__ ( ( target ( "sse2" ) ) )
+        void writeSSE ( volatile uint8_t* aDest, const uint8_t* aSrc, size_t aNrBytes )
+        {
+          const size_t lNrHeadBytes = bytesToAlignment ( aDest, 16 );
+
+          if ( ( bytesToAlignment ( aDest, 8 ) != 0 ) || ( lNrHeadBytes >= aNrBytes ) )
+          {
+            return writeScalar ( aDest, aSrc, aNrBytes );
+          }
+
+          writeScalar ( aDest, aSrc, lNrHeadBytes );
+          aDest += lNrHeadBytes;
+          aSrc += lNrHeadBytes;
+          aNrBytes -= lNrHeadBytes;
+
+          for ( ; aNrBytes >= 16; aDest += 16, aSrc += 16, aNrBytes -= 16 )
+          {
+            _mm_stream_si128 ( reinterpret_cast<__m128i*>( const_cast<uint8_t*>(aDest) ), _mm_loadu_si128 ( reinterpret_cast<const __m128i*>(aSrc) ) );
+          }
+
+          _mm_sfence();
+          writeScalar ( aDest, aSrc, aNrBytes );
+        }
+
+
+        __attribute__ ( ( target ( "avx2" ) ) )
+        void writeAVX2 ( volatile uint8_t* aDest, const uint8_t* aSrc, size_t aNrBytes )
+        {
+          const size_t lNrHeadBytes = bytesToAlignment ( aDest, 32 );
+
+          if ( ( bytesToAlignment ( aDest, 8 ) != 0 ) || ( lNrHeadBytes >= aNrBytes ) )
+          {
+            return writeScalar ( aDest, aSrc, aNrBytes );
+          }
+
+          writeScalar ( aDest, aSrc, lNrHeadBytes );
+          aDest += lNrHeadBytes;
+          aSrc += lNrHeadBytes;
+          aNrBytes -= lNrHeadBytes;
+
+          for ( ; aNrBytes >= 32; aDest += 32, aSrc += 32, aNrBytes -= 32 )
+          {
+            _mm256_stream_si256 ( reinterpret_cast<__m256i*>( const_cast<uint8_t*>(aDest) ), _mm256_loadu_si256 ( reinterpret_cast<const __m256i*>(aSrc) ) );
+          }
+
+          _mm_sfence();
+          writeScalar ( aDest, aSrc, aNrBytes );
+        }
+
+
+        __attribute__ ( ( target ( "avx512f" ) ) )
+        void writeAVX512 ( volatile uint8_t* aDest, const uint8_t* aSrc, size_t aNrBytes )
+        {
+          const size_t lNrHeadBytes = bytesToAlignment ( aDest, 64 );
+
+          if ( ( bytesToAlignment ( aDest, 8 ) != 0 ) || ( lNrHeadBytes >= aNrBytes ) )
+          {
+            return writeScalar ( aDest, aSrc, aNrBytes );
+          }
+
+          writeScalar ( aDest, aSrc, lNrHeadBytes );
+          aDest += lNrHeadBytes;
+          aSrc += lNrHeadBytes;
+          aNrBytes -= lNrHeadBytes;
+
+          for ( ; aNrBytes >= 64; aDest += 64, aSrc += 64, aNrBytes -= 64 )
+          {
+            _mm512_stream_si512 ( reinterpret_cast<__m512i*>( const_cast<uint8_t*>(aDest) ), _mm512_loadu_si512 ( aSrc ) );
+          }
+
+          _mm_sfence();
+          writeScalar ( aDest, aSrc, aNrBytes );
+        }
+#endif
+      }
+
+
+      std::string getName ( const CopyKernel aKernel )
+      {
+        switch ( aKernel )
+        {
+          case COPY_SCALAR :
+            return "scalar";
+          case COPY_SSE :
+            return "SSE";
+          case COPY_AVX2 :
+            return "AVX2";
+          case COPY_AVX512 :
+            return "AVX-512";
+        }
+
+        return "unknown";
+      }
+
+
+      bool isSupported ( const CopyKernel aKernel )
+      {
+#ifdef UHAL_MMIO_X86_KERNELS
+        __builtin_cpu_init();
+
+        switch ( aKernel )
+        {
+          case COPY_SCALAR :
+            return true;
+          case COPY_SSE :
+            return __builtin_cpu_supports ( "sse4.1" );
+          case COPY_AVX2 :
+            return __builtin_cpu_supports ( "avx2" );
+          case COPY_AVX512 :
+            return __builtin_cpu_supports ( "avx512f" );
+        }
+
+        return false;
+#else
+        return ( aKernel == COPY_SCALAR );
+#endif
+      }
+
+
+      std::vector<CopyKernel> getSupportedKernels()
+      {
+        std::vector<CopyKernel> lKernels;
+        const CopyKernel lAllKernels[] = { COPY_SCALAR, COPY_SSE, COPY_AVX2, COPY_AVX512 };
+
+        for ( size_t i = 0; i < sizeof ( lAllKernels ) / sizeof ( lAllKernels[0] ); i++ )
+        {
+          if ( isSupported ( lAllKernels[i] ) )
+          {
+            lKernels.push_back ( lAllKernels[i] );
+          }
+        }
+
+        return lKernels;
+      }
+
+
+      CopyKernel getDefaultKernel()
+      {
+        static const CopyKernel lKernel = getSupportedKernels().back();
+        return lKernel;
+      }
+
+
+      void read ( uint32_t* aDest, const volatile void* aSrc, const size_t aNrWords, const CopyKernel aKernel )
+      {
+        const volatile uint8_t* lSrc = static_cast<const volatile uint8_t*>(aSrc);
+
+        switch ( aKernel )
+        {
+#ifdef UHAL_MMIO_X86_KERNELS
+          case COPY_SSE :
+            return readSSE ( aDest, lSrc, aNrWords );
+          case COPY_AVX2 :
+            return readAVX2 ( aDest, lSrc, aNrWords );
+          case COPY_AVX512 :
+            return readAVX512 ( aDest, lSrc, aNrWords );
+#endif
+          default :
+            return readScalar ( aDest, lSrc, aNrWords );
+        }
+      }
+
+
+      void write ( volatile void* aDest, const void* aSrc, const size_t aNrBytes, const CopyKernel aKernel )
+      {
+        volatile uint8_t* lDest = static_cast<volatile uint8_t*>(aDest);
+        const uint8_t* lSrc = static_cast<const uint8_t*>(aSrc);
+
+        switch ( aKernel )
+        {
+#ifdef UHAL_MMIO_X86_KERNELS
+          case COPY_SSE :
+            return writeSSE ( lDest, lSrc, aNrBytes );
+          case COPY_AVX2 :
+            return writeAVX2 ( lDest, lSrc, aNrBytes );
+          case COPY_AVX512 :
+            return writeAVX512 ( lDest, lSrc, aNrBytes );
+#endif
+          default :
+            return writeScalar ( lDest, lSrc, aNrBytes );
+        }
+      }
+    }
+  }
+}